@@ -91,7 +91,25 @@ void
 dbern_vec(const eT* __stats_pointer_settings__ vals_in, const T1 prob_par, const bool log_form,
                 rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(dbern,vals_in,vals_out,num_elem,prob_par,log_form);
+    const rT prob_r = static_cast<rT>(prob_par);
+
+    if (!bern_sanity_check(prob_r)) {
+        EVAL_DIST_FN_VEC(dbern,vals_in,vals_out,num_elem,prob_par,log_form);
+        return;
+    }
+
+    // the densities at 0 and 1 are formed once per call
+
+    const rT dens_0 = log_if(rT(1) - prob_r, log_form);
+    const rT dens_1 = log_if(prob_r, log_form);
+    const rT dens_other = log_zero_if<rT>(log_form);
+
+    for (ullint_t j=ullint_t(0); j < num_elem; ++j)
+    {
+        const llint_t x_j = static_cast<llint_t>(vals_in[j]);
+
+        vals_out[j] = x_j == llint_t(1) ? dens_1 : x_j == llint_t(0) ? dens_0 : dens_other;
+    }
 }
 #endif
 
@@ -137,13 +137,46 @@ namespace internal
 {
 
 #ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+// log_cons = -log B(a,b); x outside (0,1), including NaN, are replaced by their scalar values
+
+template<typename eT, typename T>
+statslib_inline
+T
+dbeta_cons_vals_check(const eT x, const T a_par, const T b_par, const T log_cons, const bool log_form)
+noexcept
+{
+    return( static_cast<T>(x) > T(0) && static_cast<T>(x) < T(1) ? \
+                exp_if(log_cons + (a_par - T(1))*stmath::log(static_cast<T>(x)) 
+                           + (b_par - T(1))*stmath::log(T(1) - static_cast<T>(x)), !log_form) :
+                dbeta(static_cast<T>(x),a_par,b_par,log_form) );
+}
+
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 void
 dbeta_vec(const eT* __stats_pointer_settings__ vals_in, const T1 a_par, const T2 b_par, const bool log_form, 
                 rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(dbeta,vals_in,vals_out,num_elem,a_par,b_par,log_form);
+    const rT a_r = static_cast<rT>(a_par);
+    const rT b_r = static_cast<rT>(b_par);
+
+    if (!GCINT::all_finite(a_r,b_r) || !(a_r > rT(0)) || !(b_r > rT(0))) {
+        EVAL_DIST_FN_VEC(dbeta,vals_in,vals_out,num_elem,a_par,b_par,log_form);
+        return;
+    }
+
+    // the normalizing constant, -log B(a,b), depends only on the shape parameters; its log-gamma terms are taken
+    // once, through the batch lgamma
+
+    const rT lgamma_inp[3] = { a_r, b_r, a_r + b_r };
+    rT lgamma_out[3];
+
+    lgamma_vec(lgamma_inp,lgamma_out,3);
+
+    const rT log_cons = - (lgamma_out[0] + lgamma_out[1] - lgamma_out[2]);
+
+    EVAL_DIST_FN_VEC(dbeta_cons_vals_check,vals_in,vals_out,num_elem,a_r,b_r,log_cons,log_form);
 }
 #endif
 
@@ -40,8 +40,8 @@ noexcept
             x == n_trials_par ? \
                 x * stmath::log(prob_par) :
             //
-            gcem::log_binomial_coef(n_trials_par,x) + x*stmath::log(prob_par) \
-                + (n_trials_par - x)*stmath::log(T(1) - prob_par) );
+            log_factorial<T>(n_trials_par) - log_factorial<T>(x) - log_factorial<T>(n_trials_par - x) \
+                + x*stmath::log(prob_par) + (n_trials_par - x)*stmath::log(T(1) - prob_par) );
 }
 
 template<typename T>
@@ -111,13 +111,43 @@ namespace internal
 {
 
 #ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename T>
+struct dbinom_log_kernel
+{
+    llint_t n_trials_par;
+    T log_fact_n;
+    T log_prob;
+    T log_prob_comp;
+
+    statslib_inline
+    T
+    operator()(const llint_t x)
+    const
+    {
+        return log_fact_n - log_factorial<T>(x) - log_factorial<T>(n_trials_par - x) 
+                + T(x) * log_prob + T(n_trials_par - x) * log_prob_comp;
+    }
+};
+
 template<typename eT, typename T1, typename rT>
 statslib_inline
 void
 dbinom_vec(const eT* __stats_pointer_settings__ vals_in, const llint_t n_trials_par, const T1 prob_par, const bool log_form, 
                  rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(dbinom,vals_in,vals_out,num_elem,n_trials_par,prob_par,log_form);
+    const rT prob_r = static_cast<rT>(prob_par);
+
+    if (n_trials_par < llint_t(2) || !(prob_r > rT(0) && prob_r < rT(1))) {
+        EVAL_DIST_FN_VEC(dbinom,vals_in,vals_out,num_elem,n_trials_par,prob_par,log_form);
+        return;
+    }
+
+    // log(n!), log(p) and log(1 - p) are computed once per call
+
+    const dbinom_log_kernel<rT> log_dens_fn = { n_trials_par, log_factorial<rT>(n_trials_par), 
+                                                std::log(prob_r), std::log1p(- prob_r) };
+
+    discrete_pmf_vec(vals_in,log_dens_fn,n_trials_par,log_form,vals_out,num_elem);
 }
 #endif
 
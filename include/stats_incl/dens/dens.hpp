@@ -28,12 +28,12 @@
 #include "dexp.hpp"
 #include "dgamma.hpp"
 #include "dinvgamma.hpp"
-#include "dinvwish.hpp"
 #include "dkumaraswamy.hpp"
 #include "dlaplace.hpp"
 #include "dlogis.hpp"
 #include "dmvnorm.hpp"
 #include "dnorm.hpp"
+#include "dnormmix.hpp"
 #include "dpois.hpp"
 #include "dreciprocal.hpp"
 #include "dt.hpp"
@@ -43,7 +43,10 @@
 
 // these depend on the above
 #include "dbinom.hpp"
+#include "dinvwish.hpp"
 #include "df.hpp"
 #include "dlnorm.hpp"
+#include "dmvnormmix.hpp"
+#include "dmvt.hpp"
 
 #endif
@@ -172,13 +172,62 @@ namespace internal
 {
 
 #ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+// the Beta(a,b) density of abx/(1 + abx), with a = df1/2, b = df2/2, and log_cons = -log B(a,b), as in df_log_check;
+// other x, including NaN, +Inf, and those for which abx/(1 + abx) rounds to 0 or 1, are replaced by their scalar values
+
+template<typename T>
+statslib_inline
+T
+df_cons_compute(const T x, const T a_par, const T b_par, const T log_cons, const T abx, const T z, const bool log_form)
+noexcept
+{
+    return( z > T(0) && z < T(1) ? \
+                exp_if(log_cons + (a_par - T(1))*stmath::log(z) + (b_par - T(1))*stmath::log(T(1) - z)
+                           + stmath::log(df_compute_adj(x,(a_par/b_par)/(T(1) + abx))), !log_form) :
+                df(x,T(2)*a_par,T(2)*b_par,log_form) );
+}
+
+template<typename eT, typename T>
+statslib_inline
+T
+df_cons_vals_check(const eT x, const T a_par, const T b_par, const T log_cons, const bool log_form)
+noexcept
+{
+    return( GCINT::is_finite(static_cast<T>(x)) && static_cast<T>(x) > T(0) ? \
+                df_cons_compute(static_cast<T>(x),a_par,b_par,log_cons,(a_par/b_par)*static_cast<T>(x),
+                                ((a_par/b_par)*static_cast<T>(x)) / (T(1) + (a_par/b_par)*static_cast<T>(x)),log_form) :
+                df(static_cast<T>(x),T(2)*a_par,T(2)*b_par,log_form) );
+}
+
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 void
 df_vec(const eT* __stats_pointer_settings__ vals_in, const T1 df1_par, const T2 df2_par, const bool log_form, 
              rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(df,vals_in,vals_out,num_elem,df1_par,df2_par,log_form);
+    const rT df1_r = static_cast<rT>(df1_par);
+    const rT df2_r = static_cast<rT>(df2_par);
+
+    if (!GCINT::all_finite(df1_r,df2_r) || !(df1_r > rT(0)) || !(df2_r > rT(0))) {
+        EVAL_DIST_FN_VEC(df,vals_in,vals_out,num_elem,df1_par,df2_par,log_form);
+        return;
+    }
+
+    // the Beta(df1/2,df2/2) normalizing constant depends only on the degrees of freedom; its log-gamma terms are
+    // taken once, through the batch lgamma
+
+    const rT a_r = df1_r / rT(2);
+    const rT b_r = df2_r / rT(2);
+
+    const rT lgamma_inp[3] = { a_r, b_r, a_r + b_r };
+    rT lgamma_out[3];
+
+    lgamma_vec(lgamma_inp,lgamma_out,3);
+
+    const rT log_cons = - (lgamma_out[0] + lgamma_out[1] - lgamma_out[2]);
+
+    EVAL_DIST_FN_VEC(df_cons_vals_check,vals_in,vals_out,num_elem,a_r,b_r,log_cons,log_form);
 }
 #endif
 
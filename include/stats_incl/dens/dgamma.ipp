@@ -120,13 +120,43 @@ namespace internal
 {
 
 #ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+// log_cons = - lgamma(shape) - shape log(scale); x that are not finite and positive are replaced by their scalar values
+
+template<typename eT, typename T>
+statslib_inline
+T
+dgamma_cons_vals_check(const eT x, const T shape_par, const T scale_par, const T log_cons, const bool log_form)
+noexcept
+{
+    return( GCINT::is_finite(static_cast<T>(x)) && static_cast<T>(x) > T(0) ? \
+                exp_if(log_cons + (shape_par - T(1))*stmath::log(static_cast<T>(x)) - static_cast<T>(x)/scale_par, !log_form) :
+                dgamma(static_cast<T>(x),shape_par,scale_par,log_form) );
+}
+
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 void
 dgamma_vec(const eT* __stats_pointer_settings__ vals_in, const T1 shape_par, const T2 scale_par, const bool log_form, 
                  rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(dgamma,vals_in,vals_out,num_elem,shape_par,scale_par,log_form);
+    const rT shape_r = static_cast<rT>(shape_par);
+    const rT scale_r = static_cast<rT>(scale_par);
+
+    if (!GCINT::all_finite(shape_r,scale_r) || !(shape_r > rT(0)) || !(scale_r > rT(0))) {
+        EVAL_DIST_FN_VEC(dgamma,vals_in,vals_out,num_elem,shape_par,scale_par,log_form);
+        return;
+    }
+
+    // the normalizing constant depends only on the parameters, and lgamma(shape) is taken once, through the batch lgamma
+
+    rT lgamma_shape;
+
+    lgamma_vec(&shape_r,&lgamma_shape,1);
+
+    const rT log_cons = - lgamma_shape - shape_r*stmath::log(scale_r);
+
+    EVAL_DIST_FN_VEC(dgamma_cons_vals_check,vals_in,vals_out,num_elem,shape_r,scale_r,log_cons,log_form);
 }
 #endif
 
@@ -31,32 +31,19 @@
  * @param log_form return the log-density or the true form.
  *
  * @return the density function evaluated at \c X.
+ *
+ * \c X and \c Psi_par are each factorized once: the log-determinants are read from the diagonals of the Cholesky 
+ * factors, and the trace term is formed by a triangular solve.
  */
 
 template<typename mT, typename pT, typename not_arma_mat<mT>::type*>
 statslib_inline
 return_t<pT>
-dinvwish(const mT& X, const mT& Psi_par, const pT nu_par, bool const log_form)
+dinvwish(const mT& X, const mT& Psi_par, const pT nu_par, const bool log_form)
 {
     typedef return_t<pT> eT;
 
-    const ullint_t K = mat_ops::n_rows(X);
-    const eT nu_par_d2 = static_cast<eT>(nu_par) / eT(2);
-
-    //
-
-    const eT lmg_term = gcem::lmgamma(nu_par_d2, K);
-    const eT norm_term = nu_par_d2*mat_ops::log_det(Psi_par) - nu_par_d2*K*eT(GCEM_LOG_2) - lmg_term;
-
-    eT ret = norm_term - eT(0.5) * ( (nu_par+K+1) * mat_ops::log_det(X) + mat_ops::trace(mat_ops::solve(X,Psi_par)) );
-
-    if (!log_form) {
-        ret = std::exp(ret);
-    }
-
-    //
-    
-    return ret;
+    return internal::wish_dens_compute(X,Psi_par,static_cast<eT>(nu_par),log_form,true);
 }
 
 #ifdef STATS_ENABLE_ARMA_WRAPPERS
@@ -65,22 +52,29 @@ statslib_inline
 eT
 dinvwish(const ArmaMat<eT>& X, const ArmaMat<eT>& Psi_par, const pT nu_par, const bool log_form)
 {
-    const ullint_t K = X.n_rows;
-    const eT nu_par_d2 = static_cast<eT>(nu_par) / eT(2);
-
-    //
-
-    const eT lmg_term = gcem::lmgamma(nu_par_d2, K);
-    const eT norm_term = nu_par_d2*mat_ops::log_det(Psi_par) - nu_par_d2*K*eT(GCEM_LOG_2) - lmg_term;
+    return internal::wish_dens_compute(X,Psi_par,static_cast<eT>(nu_par),log_form,true);
+}
+#endif
 
-    eT ret = norm_term - eT(0.5) * ( (nu_par+K+1) * mat_ops::log_det(X) + mat_ops::trace(mat_ops::solve(X,Psi_par)) );
+/**
+ * @brief Density function of the Inverse-Wishart distribution, evaluated for a set of matrices
+ *
+ * @param X a vector of positive semi-definite matrices.
+ * @param Psi_par a positive semi-definite scale matrix.
+ * @param nu_par the degrees of parameter, a real-valued input.
+ * @param log_form return the log-density or the true form.
+ *
+ * @return a vector of density function values corresponding to the elements of \c X.
+ *
+ * \c Psi_par is factorized once; the matrices in \c X are evaluated in parallel when OpenMP is enabled.
+ */
 
-    if (!log_form) {
-        ret = std::exp(ret);
-    }
+template<typename mT, typename pT>
+statslib_inline
+std::vector<return_t<pT>>
+dinvwish(const std::vector<mT>& X, const mT& Psi_par, const pT nu_par, const bool log_form)
+{
+    typedef return_t<pT> eT;
 
-    //
-    
-    return ret;
+    return internal::wish_dens_batch_compute(X,Psi_par,static_cast<eT>(nu_par),log_form,true);
 }
-#endif
@@ -120,13 +120,48 @@ namespace internal
 {
 
 #ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+// log_cons = - log(2 pi)/2 - log(sigma); x that are not finite and positive are replaced by their scalar values
+
+template<typename T>
+statslib_inline
+T
+dlnorm_cons_compute(const T log_x, const T mu_par, const T sigma_par, const T log_cons, const bool log_form)
+noexcept
+{
+    return exp_if(log_cons - log_x - (log_x - mu_par)*(log_x - mu_par) / (T(2)*sigma_par*sigma_par), !log_form);
+}
+
+template<typename eT, typename T>
+statslib_inline
+T
+dlnorm_cons_vals_check(const eT x, const T mu_par, const T sigma_par, const T log_cons, const bool log_form)
+noexcept
+{
+    return( GCINT::is_finite(static_cast<T>(x)) && static_cast<T>(x) > T(0) ? \
+                dlnorm_cons_compute(stmath::log(static_cast<T>(x)),mu_par,sigma_par,log_cons,log_form) :
+                dlnorm(static_cast<T>(x),mu_par,sigma_par,log_form) );
+}
+
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 void
 dlnorm_vec(const eT* __stats_pointer_settings__ vals_in, const T1 mu_par, const T2 sigma_par, const bool log_form, 
                  rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(dlnorm,vals_in,vals_out,num_elem,mu_par,sigma_par,log_form);
+    const rT mu_r = static_cast<rT>(mu_par);
+    const rT sigma_r = static_cast<rT>(sigma_par);
+
+    if (!GCINT::all_finite(mu_r,sigma_r) || !(sigma_r > rT(0))) {
+        EVAL_DIST_FN_VEC(dlnorm,vals_in,vals_out,num_elem,mu_par,sigma_par,log_form);
+        return;
+    }
+
+    // the normalizing constant depends only on sigma_par, so it is computed once
+
+    const rT log_cons = - rT(0.5)*rT(GCEM_LOG_2PI) - stmath::log(sigma_r);
+
+    EVAL_DIST_FN_VEC(dlnorm_cons_vals_check,vals_in,vals_out,num_elem,mu_r,sigma_r,log_cons,log_form);
 }
 #endif
 
@@ -26,10 +26,23 @@
 #define _statslib_dmvnorm_HPP
 
 #ifdef STATS_ENABLE_MATRIX_FEATURES
+
+// rows of observations evaluated together by dmvnorm_batch
+
+#ifndef STATS_MVN_ROW_BLOCK
+    #define STATS_MVN_ROW_BLOCK ullint_t(64)
+#endif
+
+// single observation
 template<typename vT, typename mT, typename eT = double>
 statslib_inline
 eT dmvnorm(const vT& X, const vT& mu_par, const mT& Sigma_par, bool log_form = false);
 
+// n x K matrix of observations
+template<typename mT, typename vT, typename sT, typename eT = double>
+statslib_inline
+mT dmvnorm_batch(const mT& X, const vT& mu_par, const sT& Sigma_par, const bool log_form = false);
+
 #include "dmvnorm.ipp"
 #endif
 
@@ -22,6 +22,66 @@
  * pdf of the Multivariate Normal distribution
  */
 
+namespace internal
+{
+
+// K = 2, ..., 8: Sigma is copied to the stack and factorized in closed or fully unrolled form, and the quadratic
+// form is a forward substitution; no heap allocation or library factorization is made
+
+template<ullint_t K, typename vT, typename mT, typename eT>
+statslib_inline
+eT
+dmvnorm_small(const vT& X, const vT& mu_par, const mT& Sigma_par, const bool log_form)
+{
+    small_mat<eT,K> S, L;
+    small_mat_load(Sigma_par,S);
+
+    if (!small_chol(S,L)) {
+        return STLIM<eT>::quiet_NaN();
+    }
+
+    eT z_vals[K];
+
+    for (ullint_t k=ullint_t(0); k < K; ++k)
+    {
+        z_vals[k] = static_cast<eT>(X(k,0)) - static_cast<eT>(mu_par(k,0));
+    }
+
+    small_tri_solve(L,z_vals);
+
+    eT quad_term = eT(0);
+
+    for (ullint_t k=ullint_t(0); k < K; ++k)
+    {
+        quad_term += z_vals[k] * z_vals[k];
+    }
+
+    const eT ret = - eT(0.5) * ( K*eT(GCEM_LOG_2PI) + small_chol_log_det(L) + quad_term );
+
+    return( log_form ? ret : std::min(std::exp(ret), STLIM<eT>::max()) );
+}
+
+template<typename vT, typename mT, typename eT>
+struct dmvnorm_small_fn
+{
+    const vT& X;
+    const vT& mu_par;
+    const mT& Sigma_par;
+    const bool log_form;
+
+    eT ret;
+
+    template<ullint_t K>
+    statslib_inline
+    void
+    run()
+    {
+        ret = dmvnorm_small<K,vT,mT,eT>(X,mu_par,Sigma_par,log_form);
+    }
+};
+
+}
+
 /**
  * @brief Density function of the Multivariate-Normal distribution
  *
@@ -31,6 +91,8 @@
  * @param log_form return the log-density or the true form.
  *
  * @return the density function evaluated at \c X.
+ *
+ * For dimensions 2 to 8, a fixed-size kernel is used, with \c Sigma_par factorized on the stack.
  */
 
 template<typename vT, typename mT, typename eT>
@@ -40,13 +102,21 @@ dmvnorm(const vT& X, const vT& mu_par, const mT& Sigma_par, bool log_form)
 {
     const ullint_t K = mat_ops::n_rows(X);
 
+    internal::dmvnorm_small_fn<vT,mT,eT> small_fn = { X, mu_par, Sigma_par, log_form, eT(0) };
+
+    if (mat_ops::n_rows(Sigma_par) == K && mat_ops::n_elem(mu_par) == K && internal::small_mat_dispatch(K,small_fn)) {
+        return small_fn.ret;
+    }
+
     //
 
     const eT cons_term = static_cast<eT>( -eT(0.5)*K*GCEM_LOG_2PI );
     const vT X_cent = X - mu_par; // avoids issues like Mat vs eGlue in templates
-    const eT quad_term = mat_ops::quad_form(X_cent, Sigma_par, true);
+
+    const mat_ops::chol_fact<mT> chol_sig(Sigma_par); // one factorization for both terms
+    const eT quad_term = chol_sig.quad_form(X_cent);
     
-    eT ret = cons_term - eT(0.5) * ( mat_ops::log_det(Sigma_par) + quad_term );
+    eT ret = cons_term - eT(0.5) * ( chol_sig.log_det() + quad_term );
 
     if (!log_form) {
         ret = std::exp(ret);
@@ -60,3 +130,198 @@ dmvnorm(const vT& X, const vT& mu_par, const mT& Sigma_par, bool log_form)
     
     return ret;
 }
+
+//
+// n x K matrix of observations
+
+namespace internal
+{
+
+// forward substitution L Z = Z for a block of n_block observations, stored one coordinate after another
+// (coordinate k of observation b at z_vals[k*n_block + b]), so that the inner loop runs over observations;
+// L is K x K lower triangular and column-major
+
+template<typename eT>
+statslib_inline
+void
+mvnorm_tri_solve_block(const eT* __stats_pointer_settings__ L_vals, const ullint_t K, 
+                       eT* __stats_pointer_settings__ z_vals, const ullint_t n_block)
+{
+    for (ullint_t k=ullint_t(0); k < K; ++k)
+    {
+        const eT L_kk = L_vals[k + k*K];
+        eT* z_k = z_vals + k*n_block;
+
+        for (ullint_t b=ullint_t(0); b < n_block; ++b)
+        {
+            z_k[b] /= L_kk;
+        }
+
+        for (ullint_t r=k+1; r < K; ++r)
+        {
+            const eT L_rk = L_vals[r + k*K];
+            eT* z_r = z_vals + r*n_block;
+
+            for (ullint_t b=ullint_t(0); b < n_block; ++b)
+            {
+                z_r[b] -= L_rk * z_k[b];
+            }
+        }
+    }
+}
+
+// copies the lower triangle of the factor held by chol_sig into L_vals (column-major), the layout read by the
+// block kernels
+
+template<typename sT, typename eT>
+statslib_inline
+void
+mvnorm_factor_vals(const mat_ops::chol_fact<sT>& chol_sig, const ullint_t K, std::vector<eT>& L_vals)
+{
+    const sT& L = chol_sig.factor();
+
+    L_vals.assign(K*K, eT(0));
+
+    for (ullint_t k=ullint_t(0); k < K; ++k)
+    {
+        for (ullint_t r=k; r < K; ++r)
+        {
+            L_vals[r + k*K] = L(r,k);
+        }
+    }
+}
+
+// quadratic forms (x_i - mu)' Sigma^{-1} (x_i - mu) for rows i_begin, ..., i_begin + n_block - 1 of X, written to
+// quad_vals; z_vals is workspace of K*n_block elements
+
+template<typename mT, typename eT>
+statslib_inline
+void
+mvnorm_quad_block(const mT& X, const ullint_t i_begin, const ullint_t n_block, const eT* mu_vals, const eT* L_vals, 
+                  const ullint_t K, eT* z_vals, eT* quad_vals)
+{
+    for (ullint_t k=ullint_t(0); k < K; ++k)
+    {
+        for (ullint_t b=ullint_t(0); b < n_block; ++b)
+        {
+            z_vals[k*n_block + b] = static_cast<eT>(X(i_begin + b,k)) - mu_vals[k];
+        }
+    }
+
+    mvnorm_tri_solve_block(L_vals,K,z_vals,n_block);
+
+    for (ullint_t b=ullint_t(0); b < n_block; ++b)
+    {
+        quad_vals[b] = eT(0);
+    }
+
+    for (ullint_t k=ullint_t(0); k < K; ++k)
+    {
+        for (ullint_t b=ullint_t(0); b < n_block; ++b)
+        {
+            quad_vals[b] += z_vals[k*n_block + b] * z_vals[k*n_block + b];
+        }
+    }
+}
+
+// (log-)densities of the rows of X, written to the n x 1 matrix vals_out, given the mean and the factor of Sigma
+
+template<typename mT, typename eT>
+statslib_inline
+void
+mvnorm_log_dens_rows(const mT& X, const eT* mu_vals, const eT* L_vals, const ullint_t K, const eT log_det, 
+                     const bool log_form, mT& vals_out)
+{
+    const ullint_t n = mat_ops::n_rows(X);
+
+    if (!GCINT::is_finite(log_det)) {
+        for (ullint_t i=ullint_t(0); i < n; ++i)
+        {
+            vals_out(i,0) = STLIM<eT>::quiet_NaN();
+        }
+
+        return;
+    }
+
+    const eT cons_term = - eT(0.5) * ( K*eT(GCEM_LOG_2PI) + log_det );
+
+    const ullint_t n_blocks = (n + STATS_MVN_ROW_BLOCK - ullint_t(1)) / STATS_MVN_ROW_BLOCK;
+
+#ifdef STATS_USE_OPENMP
+    #pragma omp parallel for
+#endif
+    for (ullint_t j=ullint_t(0); j < n_blocks; ++j)
+    {
+        const ullint_t i_begin = j*STATS_MVN_ROW_BLOCK;
+        const ullint_t n_block = std::min(STATS_MVN_ROW_BLOCK, n - i_begin);
+
+        std::vector<eT> z_vals(K*n_block);
+        std::vector<eT> quad_vals(n_block);
+
+        mvnorm_quad_block(X,i_begin,n_block,mu_vals,L_vals,K,z_vals.data(),quad_vals.data());
+
+        for (ullint_t b=ullint_t(0); b < n_block; ++b)
+        {
+            const eT log_dens = cons_term - eT(0.5) * quad_vals[b];
+
+            vals_out(i_begin + b,0) = log_form ? log_dens : std::min(std::exp(log_dens), STLIM<eT>::max());
+        }
+    }
+}
+
+}
+
+/**
+ * @brief Density function of the Multivariate-Normal distribution, evaluated for each row of a matrix
+ *
+ * @param X an n x K matrix, one observation per row.
+ * @param mu_par mean vector.
+ * @param Sigma_par the covariance matrix.
+ * @param log_form return the log-density or the true form.
+ *
+ * @return an n x 1 matrix of density function values corresponding to the rows of \c X.
+ *
+ * \c Sigma_par is factorized once; the quadratic forms are then formed by triangular solves over blocks of 
+ * \c STATS_MVN_ROW_BLOCK rows, with the blocks evaluated in parallel when OpenMP is enabled. If \c Sigma_par is not 
+ * positive definite, the returned values are NaN.
+ */
+
+template<typename mT, typename vT, typename sT, typename eT>
+statslib_inline
+mT
+dmvnorm_batch(const mT& X, const vT& mu_par, const sT& Sigma_par, const bool log_form)
+{
+    mT ret;
+
+    const ullint_t n = mat_ops::n_rows(X);
+    const ullint_t K = mat_ops::n_cols(X);
+
+    if (mat_ops::n_elem(mu_par) != K || mat_ops::n_rows(Sigma_par) != K || mat_ops::n_cols(Sigma_par) != K)
+    {
+        printf("dmvnorm_batch: dimensions of X, mu and Sigma do not agree.\n");
+        return ret;
+    }
+
+    mat_ops::zeros(ret,n,1);
+
+    //
+
+    std::vector<eT> L_vals;
+    std::vector<eT> mu_vals(K);
+
+    const mat_ops::chol_fact<sT> chol_sig(Sigma_par);
+    internal::mvnorm_factor_vals(chol_sig,K,L_vals);
+
+    const eT log_det = static_cast<eT>(chol_sig.log_det());
+
+    for (ullint_t k=ullint_t(0); k < K; ++k)
+    {
+        mu_vals[k] = mu_par(k,0);
+    }
+
+    internal::mvnorm_log_dens_rows(X,mu_vals.data(),L_vals.data(),K,log_det,log_form,ret);
+
+    //
+    
+    return ret;
+}
@@ -0,0 +1,49 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * pdf of a mixture of Multivariate Normal distributions
+ */
+
+#ifndef _statslib_dmvnormmix_HPP
+#define _statslib_dmvnormmix_HPP
+
+#ifdef STATS_ENABLE_MATRIX_FEATURES
+
+// n x d matrix of observations, one per row; the (log-)densities are returned as n x 1 and, if resp_out is given,
+// the n x K component responsibilities are written to it
+
+// a covariance matrix for each component
+template<typename mT, typename vT, typename sT, typename eT = double>
+statslib_inline
+mT dmvnormmix(const mT& X, const vT& weights, const std::vector<vT>& mu_par, const std::vector<sT>& Sigma_par, 
+              const bool log_form = false, mT* resp_out = nullptr);
+
+// a covariance matrix shared by all components
+template<typename mT, typename vT, typename sT, typename eT = double>
+statslib_inline
+mT dmvnormmix(const mT& X, const vT& weights, const std::vector<vT>& mu_par, const sT& Sigma_par, 
+              const bool log_form = false, mT* resp_out = nullptr);
+
+#include "dmvnormmix.ipp"
+
+#endif
+
+#endif
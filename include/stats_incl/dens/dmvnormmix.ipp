@@ -0,0 +1,260 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * pdf of a mixture of Multivariate Normal distributions
+ */
+
+namespace internal
+{
+
+// L_vals and log_det_vals hold the Cholesky factor (d x d, column-major) and log-determinant of each component
+// covariance matrix or, when tied_flag is set, of the one shared covariance matrix. With a shared factor L, the
+// observations are solved once per block, and
+//   (x - mu_c)' Sigma^{-1} (x - mu_c) = || L^{-1} x - L^{-1} mu_c ||^2,
+// with L^{-1} mu_c formed once per component.
+
+template<typename mT, typename vT, typename eT>
+statslib_inline
+mT
+dmvnormmix_compute(const mT& X, const vT& weights, const std::vector<vT>& mu_par, 
+                   const std::vector<std::vector<eT>>& L_vals, const std::vector<eT>& log_det_vals, 
+                   const bool tied_flag, const bool log_form, mT* resp_out)
+{
+    const ullint_t n = mat_ops::n_rows(X);
+    const ullint_t d = mat_ops::n_cols(X);
+    const ullint_t n_comp = mu_par.size();
+
+    // component means, solved by the shared factor when tied, and log(w_c) - (d log(2 pi) + log|Sigma_c|)/2
+
+    std::vector<eT> mu_vals(d*n_comp), cons_vals(n_comp);
+
+    for (ullint_t c=ullint_t(0); c < n_comp; ++c)
+    {
+        for (ullint_t k=ullint_t(0); k < d; ++k)
+        {
+            mu_vals[c*d + k] = static_cast<eT>(mu_par[c](k,0));
+        }
+
+        const eT log_det_c = log_det_vals[tied_flag ? 0 : c];
+
+        cons_vals[c] = GCINT::is_finite(log_det_c) ? 
+                           std::log(static_cast<eT>(weights(c,0))) - eT(0.5) * ( d*eT(GCEM_LOG_2PI) + log_det_c ) :
+                           STLIM<eT>::quiet_NaN();
+
+        if (tied_flag && GCINT::is_finite(log_det_c)) {
+            mvnorm_tri_solve_block(L_vals[0].data(),d,mu_vals.data() + c*d,ullint_t(1));
+        }
+    }
+
+    mT ret;
+    mat_ops::zeros(ret,n,1);
+
+    if (resp_out) {
+        mat_ops::zeros(*resp_out,n,n_comp);
+    }
+
+    const ullint_t n_blocks = (n + STATS_MVN_ROW_BLOCK - ullint_t(1)) / STATS_MVN_ROW_BLOCK;
+
+#ifdef STATS_USE_OPENMP
+    #pragma omp parallel for
+#endif
+    for (ullint_t j=ullint_t(0); j < n_blocks; ++j)
+    {
+        const ullint_t i_begin = j*STATS_MVN_ROW_BLOCK;
+        const ullint_t n_block = std::min(STATS_MVN_ROW_BLOCK, n - i_begin);
+
+        std::vector<eT> x_vals(d*n_block), z_vals(d*n_block);
+        std::vector<eT> lp_vals(n_comp*n_block);
+
+        for (ullint_t k=ullint_t(0); k < d; ++k)
+        {
+            for (ullint_t b=ullint_t(0); b < n_block; ++b)
+            {
+                x_vals[k*n_block + b] = static_cast<eT>(X(i_begin + b,k));
+            }
+        }
+
+        if (tied_flag) {
+            mvnorm_tri_solve_block(L_vals[0].data(),d,x_vals.data(),n_block);
+        }
+
+        for (ullint_t c=ullint_t(0); c < n_comp; ++c)
+        {
+            for (ullint_t k=ullint_t(0); k < d; ++k)
+            {
+                for (ullint_t b=ullint_t(0); b < n_block; ++b)
+                {
+                    z_vals[k*n_block + b] = x_vals[k*n_block + b] - mu_vals[c*d + k];
+                }
+            }
+
+            if (!tied_flag) {
+                mvnorm_tri_solve_block(L_vals[c].data(),d,z_vals.data(),n_block);
+            }
+
+            eT* lp_c = lp_vals.data() + c*n_block;
+
+            for (ullint_t b=ullint_t(0); b < n_block; ++b)
+            {
+                lp_c[b] = eT(0);
+            }
+
+            for (ullint_t k=ullint_t(0); k < d; ++k)
+            {
+                for (ullint_t b=ullint_t(0); b < n_block; ++b)
+                {
+                    lp_c[b] += z_vals[k*n_block + b] * z_vals[k*n_block + b];
+                }
+            }
+
+            for (ullint_t b=ullint_t(0); b < n_block; ++b)
+            {
+                lp_c[b] = cons_vals[c] - eT(0.5) * lp_c[b];
+            }
+        }
+
+        normmix_reduce_block(lp_vals.data(),n_comp,n_block,i_begin,log_form,ret,resp_out);
+    }
+
+    return ret;
+}
+
+template<typename mT, typename vT>
+statslib_inline
+bool
+dmvnormmix_check(const mT& X, const vT& weights, const std::vector<vT>& mu_par)
+{
+    const ullint_t d = mat_ops::n_cols(X);
+
+    bool valid_flag = mat_ops::n_elem(weights) == mu_par.size();
+
+    for (ullint_t c=ullint_t(0); c < mu_par.size(); ++c)
+    {
+        valid_flag = valid_flag && mat_ops::n_elem(mu_par[c]) == d;
+    }
+
+    return valid_flag;
+}
+
+}
+
+/**
+ * @brief Density function of a mixture of Multivariate-Normal distributions
+ *
+ * @param X an n x d matrix, one observation per row.
+ * @param weights the K mixture weights, non-negative and summing to one.
+ * @param mu_par a vector of the K component mean vectors.
+ * @param Sigma_par a vector of the K component covariance matrices.
+ * @param log_form return the log-density or the true form.
+ * @param resp_out an optional pointer to an n x K matrix, set to the posterior probability of each component for 
+ * each observation (the E-step responsibilities).
+ *
+ * @return an n x 1 matrix of mixture density values corresponding to the rows of \c X.
+ *
+ * Each covariance matrix is factorized once. For each block of \c STATS_MVN_ROW_BLOCK rows, the component 
+ * log-densities are formed by triangular solves and reduced by a log-sum-exp in the same pass; blocks are evaluated 
+ * in parallel when OpenMP is enabled. A component whose covariance matrix is not positive definite yields NaN values.
+ */
+
+template<typename mT, typename vT, typename sT, typename eT>
+statslib_inline
+mT
+dmvnormmix(const mT& X, const vT& weights, const std::vector<vT>& mu_par, const std::vector<sT>& Sigma_par, 
+           const bool log_form, mT* resp_out)
+{
+    const ullint_t d = mat_ops::n_cols(X);
+    const ullint_t n_comp = mu_par.size();
+
+    bool valid_flag = internal::dmvnormmix_check(X,weights,mu_par) && Sigma_par.size() == n_comp;
+
+    for (ullint_t c=ullint_t(0); c < Sigma_par.size(); ++c)
+    {
+        valid_flag = valid_flag && mat_ops::n_rows(Sigma_par[c]) == d && mat_ops::n_cols(Sigma_par[c]) == d;
+    }
+
+    if (!valid_flag)
+    {
+        printf("dmvnormmix: dimensions of X, weights, mu and Sigma do not agree.\n");
+        return mT();
+    }
+
+    //
+
+    std::vector<std::vector<eT>> L_vals(n_comp);
+    std::vector<eT> log_det_vals(n_comp);
+
+    for (ullint_t c=ullint_t(0); c < n_comp; ++c)
+    {
+        const mat_ops::chol_fact<sT> chol_sig(Sigma_par[c]);
+        internal::mvnorm_factor_vals(chol_sig,d,L_vals[c]);
+
+        log_det_vals[c] = static_cast<eT>(chol_sig.log_det());
+    }
+
+    return internal::dmvnormmix_compute(X,weights,mu_par,L_vals,log_det_vals,false,log_form,resp_out);
+}
+
+/**
+ * @brief Density function of a mixture of Multivariate-Normal distributions with a shared covariance matrix
+ *
+ * @param X an n x d matrix, one observation per row.
+ * @param weights the K mixture weights, non-negative and summing to one.
+ * @param mu_par a vector of the K component mean vectors.
+ * @param Sigma_par the covariance matrix of every component.
+ * @param log_form return the log-density or the true form.
+ * @param resp_out an optional pointer to an n x K matrix, set to the posterior probability of each component for 
+ * each observation (the E-step responsibilities).
+ *
+ * @return an n x 1 matrix of mixture density values corresponding to the rows of \c X.
+ *
+ * \c Sigma_par is factorized once in total, and each block of observations is solved by its factor once, rather 
+ * than once per component.
+ */
+
+template<typename mT, typename vT, typename sT, typename eT>
+statslib_inline
+mT
+dmvnormmix(const mT& X, const vT& weights, const std::vector<vT>& mu_par, const sT& Sigma_par, 
+           const bool log_form, mT* resp_out)
+{
+    const ullint_t d = mat_ops::n_cols(X);
+
+    const bool valid_flag = internal::dmvnormmix_check(X,weights,mu_par) 
+                            && mat_ops::n_rows(Sigma_par) == d && mat_ops::n_cols(Sigma_par) == d;
+
+    if (!valid_flag)
+    {
+        printf("dmvnormmix: dimensions of X, weights, mu and Sigma do not agree.\n");
+        return mT();
+    }
+
+    //
+
+    std::vector<std::vector<eT>> L_vals(1);
+    std::vector<eT> log_det_vals(1);
+
+    const mat_ops::chol_fact<sT> chol_sig(Sigma_par);
+    internal::mvnorm_factor_vals(chol_sig,d,L_vals[0]);
+
+    log_det_vals[0] = static_cast<eT>(chol_sig.log_det());
+
+    return internal::dmvnormmix_compute(X,weights,mu_par,L_vals,log_det_vals,true,log_form,resp_out);
+}
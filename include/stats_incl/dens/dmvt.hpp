@@ -0,0 +1,43 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * pdf of the Multivariate t distribution
+ */
+
+#ifndef _statslib_dmvt_HPP
+#define _statslib_dmvt_HPP
+
+#ifdef STATS_ENABLE_MATRIX_FEATURES
+
+// single observation
+template<typename vT, typename mT, typename pT, typename eT = double>
+statslib_inline
+eT dmvt(const vT& X, const vT& mu_par, const mT& Sigma_par, const pT dof_par, const bool log_form = false);
+
+// n x K matrix of observations
+template<typename mT, typename vT, typename sT, typename pT, typename eT = double>
+statslib_inline
+mT dmvt_batch(const mT& X, const vT& mu_par, const sT& Sigma_par, const pT dof_par, const bool log_form = false);
+
+#include "dmvt.ipp"
+#endif
+
+#endif
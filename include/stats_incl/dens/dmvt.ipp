@@ -0,0 +1,169 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * pdf of the Multivariate t distribution
+ */
+
+namespace internal
+{
+
+// the terms of the log-density that do not depend on x:
+//   lgamma((nu + K)/2) - lgamma(nu/2) - K/2 log(nu pi) - log|Sigma|/2,
+// NaN for a non-positive nu or a Sigma that is not positive definite
+
+template<typename eT>
+statslib_inline
+eT
+mvt_norm_term(const eT dof_par, const ullint_t K, const eT log_det)
+{
+    if (!(dof_par > eT(0)) || !GCINT::is_finite(log_det)) {
+        return STLIM<eT>::quiet_NaN();
+    }
+
+    return( std::lgamma((dof_par + K) / eT(2)) - std::lgamma(dof_par / eT(2)) 
+            - eT(0.5) * ( K*(std::log(dof_par) + eT(GCEM_LOG_PI)) + log_det ) );
+}
+
+template<typename eT>
+statslib_inline
+eT
+mvt_log_dens(const eT norm_term, const eT quad_term, const eT dof_par, const ullint_t K)
+{
+    return norm_term - eT(0.5) * (dof_par + K) * std::log1p(quad_term / dof_par);
+}
+
+}
+
+/**
+ * @brief Density function of the Multivariate t distribution
+ *
+ * @param X a column vector.
+ * @param mu_par location vector.
+ * @param Sigma_par the scale matrix.
+ * @param dof_par the degrees of freedom parameter, a real-valued input.
+ * @param log_form return the log-density or the true form.
+ *
+ * @return the density function evaluated at \c X.
+ *
+ * \c Sigma_par is factorized once, for both the quadratic form and the log-determinant.
+ */
+
+template<typename vT, typename mT, typename pT, typename eT>
+statslib_inline
+eT
+dmvt(const vT& X, const vT& mu_par, const mT& Sigma_par, const pT dof_par, const bool log_form)
+{
+    const ullint_t K = mat_ops::n_rows(X);
+    const eT dof_val = static_cast<eT>(dof_par);
+
+    //
+
+    const vT X_cent = X - mu_par;
+    const mat_ops::chol_fact<mT> chol_sig(Sigma_par);
+
+    const eT norm_term = internal::mvt_norm_term(dof_val,K,static_cast<eT>(chol_sig.log_det()));
+    const eT ret = internal::mvt_log_dens(norm_term,static_cast<eT>(chol_sig.quad_form(X_cent)),dof_val,K);
+
+    //
+    
+    return( log_form ? ret : std::min(std::exp(ret), STLIM<eT>::max()) );
+}
+
+/**
+ * @brief Density function of the Multivariate t distribution, evaluated for each row of a matrix
+ *
+ * @param X an n x K matrix, one observation per row.
+ * @param mu_par location vector.
+ * @param Sigma_par the scale matrix.
+ * @param dof_par the degrees of freedom parameter, a real-valued input.
+ * @param log_form return the log-density or the true form.
+ *
+ * @return an n x 1 matrix of density function values corresponding to the rows of \c X.
+ *
+ * \c Sigma_par is factorized once and the lgamma normalizing term is computed once; the quadratic forms are then 
+ * formed by triangular solves over blocks of \c STATS_MVN_ROW_BLOCK rows, with the blocks evaluated in parallel when 
+ * OpenMP is enabled.
+ */
+
+template<typename mT, typename vT, typename sT, typename pT, typename eT>
+statslib_inline
+mT
+dmvt_batch(const mT& X, const vT& mu_par, const sT& Sigma_par, const pT dof_par, const bool log_form)
+{
+    mT ret;
+
+    const ullint_t n = mat_ops::n_rows(X);
+    const ullint_t K = mat_ops::n_cols(X);
+
+    if (mat_ops::n_elem(mu_par) != K || mat_ops::n_rows(Sigma_par) != K || mat_ops::n_cols(Sigma_par) != K)
+    {
+        printf("dmvt_batch: dimensions of X, mu and Sigma do not agree.\n");
+        return ret;
+    }
+
+    mat_ops::zeros(ret,n,1);
+
+    //
+
+    const eT dof_val = static_cast<eT>(dof_par);
+
+    std::vector<eT> L_vals;
+    std::vector<eT> mu_vals(K);
+
+    const mat_ops::chol_fact<sT> chol_sig(Sigma_par);
+    internal::mvnorm_factor_vals(chol_sig,K,L_vals);
+
+    const eT norm_term = internal::mvt_norm_term(dof_val,K,static_cast<eT>(chol_sig.log_det()));
+
+    for (ullint_t k=ullint_t(0); k < K; ++k)
+    {
+        mu_vals[k] = mu_par(k,0);
+    }
+
+    const ullint_t n_blocks = (n + STATS_MVN_ROW_BLOCK - ullint_t(1)) / STATS_MVN_ROW_BLOCK;
+
+#ifdef STATS_USE_OPENMP
+    #pragma omp parallel for
+#endif
+    for (ullint_t j=ullint_t(0); j < n_blocks; ++j)
+    {
+        const ullint_t i_begin = j*STATS_MVN_ROW_BLOCK;
+        const ullint_t n_block = std::min(STATS_MVN_ROW_BLOCK, n - i_begin);
+
+        std::vector<eT> z_vals(K*n_block);
+        std::vector<eT> quad_vals(n_block);
+
+        if (GCINT::is_finite(norm_term)) {
+            internal::mvnorm_quad_block(X,i_begin,n_block,mu_vals.data(),L_vals.data(),K,z_vals.data(),quad_vals.data());
+        }
+
+        for (ullint_t b=ullint_t(0); b < n_block; ++b)
+        {
+            const eT log_dens = internal::mvt_log_dens(norm_term,quad_vals[b],dof_val,K);
+
+            ret(i_begin + b,0) = log_form ? log_dens : std::min(std::exp(log_dens), STLIM<eT>::max());
+        }
+    }
+
+    //
+    
+    return ret;
+}
@@ -0,0 +1,156 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * pdf of a mixture of Normal distributions
+ */
+
+namespace internal
+{
+
+// log-sum-exp over the n_comp components for a block of n_block observations, where lp_vals[c*n_block + b] holds
+// log(w_c) plus the log-density of component c at observation b. The mixture (log-)densities are written to rows
+// i_begin, ..., i_begin + n_block - 1 of vals_out and, if resp_out is given, the responsibilities exp(lp - log f)
+// to the same rows of resp_out.
+
+template<typename mT, typename eT>
+statslib_inline
+void
+normmix_reduce_block(const eT* lp_vals, const ullint_t n_comp, const ullint_t n_block, const ullint_t i_begin, 
+                     const bool log_form, mT& vals_out, mT* resp_out)
+{
+    for (ullint_t b=ullint_t(0); b < n_block; ++b)
+    {
+        eT max_val = - STLIM<eT>::infinity();
+        eT sum_val = eT(0);
+
+        for (ullint_t c=ullint_t(0); c < n_comp; ++c)
+        {
+            log_sum_exp_update(max_val,sum_val,lp_vals[c*n_block + b]);
+        }
+
+        const eT log_dens = log_sum_exp_value(max_val,sum_val);
+
+        vals_out(i_begin + b,0) = log_form ? log_dens : std::min(std::exp(log_dens), STLIM<eT>::max());
+
+        if (resp_out) {
+            for (ullint_t c=ullint_t(0); c < n_comp; ++c)
+            {
+                (*resp_out)(i_begin + b,c) = std::exp(lp_vals[c*n_block + b] - log_dens);
+            }
+        }
+    }
+}
+
+template<typename mT, typename vT, typename eT>
+statslib_inline
+mT
+dnormmix_compute(const mT& X, const vT& weights, const vT& mu_par, const vT& sigma_par, const bool log_form,
+                 mT* resp_out)
+{
+    mT ret;
+
+    const ullint_t n = mat_ops::n_rows(X);
+    const ullint_t n_comp = mat_ops::n_elem(weights);
+
+    if (mat_ops::n_cols(X) != ullint_t(1) || mat_ops::n_elem(mu_par) != n_comp || mat_ops::n_elem(sigma_par) != n_comp)
+    {
+        printf("dnormmix: dimensions of X, weights, mu and sigma do not agree.\n");
+        return ret;
+    }
+
+    // log(w_c) - log(sigma_c) - log(2 pi)/2 and 1/sigma_c, once per component
+
+    std::vector<eT> mu_vals(n_comp), inv_sigma_vals(n_comp), cons_vals(n_comp);
+
+    for (ullint_t c=ullint_t(0); c < n_comp; ++c)
+    {
+        const eT sigma_c = static_cast<eT>(sigma_par(c,0));
+        const bool valid_c = sigma_c > eT(0) && GCINT::is_finite(sigma_c);
+
+        mu_vals[c] = static_cast<eT>(mu_par(c,0));
+        inv_sigma_vals[c] = eT(1) / sigma_c;
+        cons_vals[c] = valid_c ? std::log(static_cast<eT>(weights(c,0)) / sigma_c) - eT(GCEM_LOG_2PI) / eT(2) :
+                                 STLIM<eT>::quiet_NaN();
+    }
+
+    mat_ops::zeros(ret,n,1);
+
+    if (resp_out) {
+        mat_ops::zeros(*resp_out,n,n_comp);
+    }
+
+    const ullint_t n_blocks = (n + STATS_MVN_ROW_BLOCK - ullint_t(1)) / STATS_MVN_ROW_BLOCK;
+
+#ifdef STATS_USE_OPENMP
+    #pragma omp parallel for
+#endif
+    for (ullint_t j=ullint_t(0); j < n_blocks; ++j)
+    {
+        const ullint_t i_begin = j*STATS_MVN_ROW_BLOCK;
+        const ullint_t n_block = std::min(STATS_MVN_ROW_BLOCK, n - i_begin);
+
+        std::vector<eT> lp_vals(n_comp*n_block);
+
+        for (ullint_t c=ullint_t(0); c < n_comp; ++c)
+        {
+            eT* lp_c = lp_vals.data() + c*n_block;
+
+            for (ullint_t b=ullint_t(0); b < n_block; ++b)
+            {
+                const eT z = (static_cast<eT>(X(i_begin + b,0)) - mu_vals[c]) * inv_sigma_vals[c];
+
+                lp_c[b] = cons_vals[c] - z*z / eT(2);
+            }
+        }
+
+        normmix_reduce_block(lp_vals.data(),n_comp,n_block,i_begin,log_form,ret,resp_out);
+    }
+
+    return ret;
+}
+
+}
+
+/**
+ * @brief Density function of a mixture of Normal distributions
+ *
+ * @param X an n x 1 matrix of observations.
+ * @param weights the K mixture weights, non-negative and summing to one.
+ * @param mu_par the K component means.
+ * @param sigma_par the K component standard deviations.
+ * @param log_form return the log-density or the true form.
+ * @param resp_out an optional pointer to an n x K matrix, set to the posterior probability of each component for 
+ * each observation (the E-step responsibilities).
+ *
+ * @return an n x 1 matrix of mixture density values, \f$ \sum_k w_k \phi(x_i; \mu_k, \sigma_k) \f$.
+ *
+ * The component log-densities of a block of \c STATS_MVN_ROW_BLOCK observations are formed together and reduced by 
+ * a log-sum-exp in the same pass, so that no per-component temporaries are kept and the result does not underflow 
+ * when every component density does. Blocks are evaluated in parallel when OpenMP is enabled.
+ */
+
+template<typename mT, typename vT, typename eT>
+statslib_inline
+mT
+dnormmix(const mT& X, const vT& weights, const vT& mu_par, const vT& sigma_par, const bool log_form, mT* resp_out)
+{
+    return internal::dnormmix_compute<mT,vT,eT>(X,weights,mu_par,sigma_par,log_form,resp_out);
+}
@@ -34,7 +34,7 @@ T
 dpois_log_compute(const llint_t x, const T rate_par)
 noexcept
 {
-    return( x * stmath::log(rate_par) - rate_par - stmath::lgamma(T(x+1)) );
+    return( x * stmath::log(rate_par) - rate_par - log_factorial<T>(x) );
 }
 
 template<typename T>
@@ -91,13 +91,39 @@ namespace internal
 {
 
 #ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename T>
+struct dpois_log_kernel
+{
+    T rate_par;
+    T log_rate;
+
+    statslib_inline
+    T
+    operator()(const llint_t x)
+    const
+    {
+        return T(x) * log_rate - rate_par - log_factorial<T>(x);
+    }
+};
+
 template<typename eT, typename T1, typename rT>
 statslib_inline
 void
 dpois_vec(const eT* __stats_pointer_settings__ vals_in, const T1 rate_par, const bool log_form, 
                 rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(dpois,vals_in,vals_out,num_elem,rate_par,log_form);
+    const rT rate_r = static_cast<rT>(rate_par);
+
+    if (!GCINT::is_finite(rate_r) || !(rate_r > rT(0))) {
+        EVAL_DIST_FN_VEC(dpois,vals_in,vals_out,num_elem,rate_par,log_form);
+        return;
+    }
+
+    // log(rate) is computed once per call
+
+    const dpois_log_kernel<rT> log_dens_fn = { rate_r, std::log(rate_r) };
+
+    discrete_pmf_vec(vals_in,log_dens_fn,STLIM<llint_t>::max(),log_form,vals_out,num_elem);
 }
 #endif
 
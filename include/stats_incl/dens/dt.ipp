@@ -115,13 +115,43 @@ namespace internal
 {
 
 #ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+// log_cons = dt_log_cons_term(dof_par); non-finite x are replaced by their scalar values
+
+template<typename eT, typename T>
+statslib_inline
+T
+dt_cons_vals_check(const eT x, const T dof_par, const T log_cons, const bool log_form)
+noexcept
+{
+    return( GCINT::is_finite(static_cast<T>(x)) ? \
+                exp_if(log_cons + dt_log_mult_term(static_cast<T>(x),dof_par), !log_form) :
+                dt(static_cast<T>(x),dof_par,log_form) );
+}
+
 template<typename eT, typename T1, typename rT>
 statslib_inline
 void
 dt_vec(const eT* __stats_pointer_settings__ vals_in, const T1 dof_par, const bool log_form, 
              rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(dt,vals_in,vals_out,num_elem,dof_par,log_form);
+    const rT dof_r = static_cast<rT>(dof_par);
+
+    if (!GCINT::is_finite(dof_r) || !(dof_r > rT(0))) {
+        EVAL_DIST_FN_VEC(dt,vals_in,vals_out,num_elem,dof_par,log_form);
+        return;
+    }
+
+    // the normalizing constant depends only on dof_par; its log-gamma terms are taken once, through the batch lgamma
+
+    const rT lgamma_inp[2] = { dof_r/rT(2) + rT(0.5), dof_r/rT(2) };
+    rT lgamma_out[2];
+
+    lgamma_vec(lgamma_inp,lgamma_out,2);
+
+    const rT log_cons = lgamma_out[0] - rT(0.5)*( stmath::log(dof_r) + rT(GCEM_LOG_PI) ) - lgamma_out[1];
+
+    EVAL_DIST_FN_VEC(dt_cons_vals_check,vals_in,vals_out,num_elem,dof_r,log_cons,log_form);
 }
 #endif
 
@@ -31,6 +31,11 @@ template<typename mT, typename pT, typename not_arma_mat<mT>::type* = nullptr>
 statslib_inline
 return_t<pT> dwish(const mT& X, const mT& Psi_par, const pT nu_par, const bool log_form = false);
 
+// a set of matrices, with one factorization of Psi
+template<typename mT, typename pT>
+statslib_inline
+std::vector<return_t<pT>> dwish(const std::vector<mT>& X, const mT& Psi_par, const pT nu_par, const bool log_form = false);
+
 // specializations
 #ifdef STATS_ENABLE_ARMA_WRAPPERS
 template<typename eT, typename pT>
@@ -22,6 +22,195 @@
  * pdf of the Wishart distribution
  */
 
+namespace internal
+{
+
+// the terms of the log-density that do not depend on X, given log|Psi|
+
+template<typename eT>
+statslib_inline
+eT
+wish_norm_term(const eT log_det_Psi, const ullint_t K, const eT nu_par, const bool inv_flag)
+{
+    const eT nu_par_d2 = nu_par / eT(2);
+    const eT lmg_term = gcem::lmgamma(nu_par_d2, K);
+
+    return( (inv_flag ? nu_par_d2 : - nu_par_d2) * log_det_Psi - nu_par_d2*K*eT(GCEM_LOG_2) - lmg_term );
+}
+
+// the log-density from the normalizing term, log|X| and the trace term
+
+template<typename eT>
+statslib_constexpr
+eT
+wish_log_dens_combine(const eT norm_term, const eT log_det_X, const eT trace_term, const ullint_t K, const eT nu_par,
+                      const bool inv_flag)
+noexcept
+{
+    return( inv_flag ? norm_term - eT(0.5) * ( (nu_par + K + 1) * log_det_X + trace_term ) :
+                       norm_term + eT(0.5) * ( (nu_par - K - 1) * log_det_X - trace_term ) );
+}
+
+// log-density of the Wishart (inv_flag = false) or inverse-Wishart distribution at X, given the lower Cholesky 
+// factor L of Psi (column-major) and the normalizing term. With X = C C', log|X| is read from the diagonal of C and
+//   tr(Psi^{-1} X) = || L^{-1} C ||_F^2,    tr(Psi X^{-1}) = || C^{-1} L ||_F^2,
+// each a triangular solve with K right-hand sides.
+
+template<typename mT, typename eT>
+statslib_inline
+eT
+wish_log_dens_compute(const mT& X, const eT* L_vals, const eT norm_term, const ullint_t K, const eT nu_par, 
+                      const bool inv_flag)
+{
+    const mat_ops::chol_fact<mT> chol_X(X);
+
+    if (!chol_X.is_valid()) {
+        return STLIM<eT>::quiet_NaN();
+    }
+
+    std::vector<eT> C_vals;
+    mvnorm_factor_vals(chol_X,K,C_vals);
+
+    const eT log_det_X = static_cast<eT>(chol_X.log_det());
+
+    const eT* T_vals = inv_flag ? C_vals.data() : L_vals;
+    const eT* R_vals = inv_flag ? L_vals : C_vals.data();
+
+    // right-hand sides held one coordinate after another, as mvnorm_tri_solve_block expects
+
+    std::vector<eT> Z_vals(K*K);
+
+    for (ullint_t k=ullint_t(0); k < K; ++k)
+    {
+        for (ullint_t b=ullint_t(0); b < K; ++b)
+        {
+            Z_vals[k*K + b] = R_vals[k + b*K];
+        }
+    }
+
+    mvnorm_tri_solve_block(T_vals,K,Z_vals.data(),K);
+
+    eT trace_term = eT(0);
+
+    for (ullint_t j=ullint_t(0); j < K*K; ++j)
+    {
+        trace_term += Z_vals[j] * Z_vals[j];
+    }
+
+    return wish_log_dens_combine(norm_term,log_det_X,trace_term,K,nu_par,inv_flag);
+}
+
+// K = 2, ..., 8: both factors, and the triangular solve, are formed on the stack
+
+template<ullint_t K, typename mT, typename sT, typename eT>
+statslib_inline
+eT
+wish_log_dens_small(const mT& X, const sT& Psi_par, const eT nu_par, const bool inv_flag)
+{
+    small_mat<eT,K> S, L, C;
+
+    small_mat_load(Psi_par,S);
+    const bool Psi_valid = small_chol(S,L);
+
+    small_mat_load(X,S);
+    const bool X_valid = small_chol(S,C);
+
+    if (!Psi_valid || !X_valid) {
+        return STLIM<eT>::quiet_NaN();
+    }
+
+    const eT trace_term = inv_flag ? small_tri_solve_frob(C,L) : small_tri_solve_frob(L,C);
+    const eT norm_term = wish_norm_term(small_chol_log_det(L),K,nu_par,inv_flag);
+
+    return wish_log_dens_combine(norm_term,small_chol_log_det(C),trace_term,K,nu_par,inv_flag);
+}
+
+template<typename mT, typename sT, typename eT>
+struct wish_log_dens_small_fn
+{
+    const mT& X;
+    const sT& Psi_par;
+    const eT nu_par;
+    const bool inv_flag;
+
+    eT ret;
+
+    template<ullint_t K>
+    statslib_inline
+    void
+    run()
+    {
+        ret = wish_log_dens_small<K>(X,Psi_par,nu_par,inv_flag);
+    }
+};
+
+template<typename mT, typename sT, typename eT>
+statslib_inline
+eT
+wish_dens_compute(const mT& X, const sT& Psi_par, const eT nu_par, const bool log_form, const bool inv_flag)
+{
+    const ullint_t K = mat_ops::n_rows(X);
+
+    wish_log_dens_small_fn<mT,sT,eT> small_fn = { X, Psi_par, nu_par, inv_flag, eT(0) };
+
+    if (mat_ops::n_rows(Psi_par) == K && small_mat_dispatch(K,small_fn)) {
+        return( log_form ? small_fn.ret : std::exp(small_fn.ret) );
+    }
+
+    const mat_ops::chol_fact<sT> chol_Psi(Psi_par);
+
+    if (!chol_Psi.is_valid()) {
+        return STLIM<eT>::quiet_NaN();
+    }
+
+    std::vector<eT> L_vals;
+    mvnorm_factor_vals(chol_Psi,K,L_vals);
+
+    const eT log_det_Psi = static_cast<eT>(chol_Psi.log_det());
+    const eT ret = wish_log_dens_compute(X,L_vals.data(),wish_norm_term(log_det_Psi,K,nu_par,inv_flag),K,nu_par,inv_flag);
+
+    return( log_form ? ret : std::exp(ret) );
+}
+
+template<typename mT, typename eT>
+statslib_inline
+std::vector<eT>
+wish_dens_batch_compute(const std::vector<mT>& X, const mT& Psi_par, const eT nu_par, const bool log_form, 
+                        const bool inv_flag)
+{
+    const ullint_t n = X.size();
+    const ullint_t K = mat_ops::n_rows(Psi_par);
+
+    std::vector<eT> ret(n, STLIM<eT>::quiet_NaN());
+
+    const mat_ops::chol_fact<mT> chol_Psi(Psi_par);
+
+    if (!chol_Psi.is_valid()) {
+        return ret;
+    }
+
+    std::vector<eT> L_vals;
+    mvnorm_factor_vals(chol_Psi,K,L_vals);
+
+    const eT norm_term = wish_norm_term(static_cast<eT>(chol_Psi.log_det()),K,nu_par,inv_flag);
+
+#ifdef STATS_USE_OPENMP
+    #pragma omp parallel for schedule(dynamic)
+#endif
+    for (ullint_t j=ullint_t(0); j < n; ++j)
+    {
+        if (mat_ops::n_rows(X[j]) == K && mat_ops::n_cols(X[j]) == K) {
+            const eT log_dens = wish_log_dens_compute(X[j],L_vals.data(),norm_term,K,nu_par,inv_flag);
+
+            ret[j] = log_form ? log_dens : std::exp(log_dens);
+        }
+    }
+
+    return ret;
+}
+
+}
+
 /**
  * @brief Density function of the Wishart distribution
  *
@@ -31,6 +220,9 @@
  * @param log_form return the log-density or the true form.
  *
  * @return the density function evaluated at \c X.
+ *
+ * The log-determinants are read from the diagonals of the Cholesky factors of \c X and \c Psi_par, and the trace 
+ * term is formed by a triangular solve, so no determinant or full solve is computed.
  */
 
 template<typename mT, typename pT, typename not_arma_mat<mT>::type*>
@@ -40,23 +232,7 @@ dwish(const mT& X, const mT& Psi_par, const pT nu_par, const bool log_form)
 {
     typedef return_t<pT> eT;
 
-    const ullint_t K = mat_ops::n_rows(X);
-    const eT nu_par_d2 = static_cast<eT>(nu_par) / eT(2);
-
-    //
-
-    const eT lmg_term = gcem::lmgamma(nu_par_d2, K);
-    const eT norm_term = - nu_par_d2*std::log(mat_ops::det(Psi_par)) - nu_par_d2*K*GCEM_LOG_2 - lmg_term;
-
-    eT ret = norm_term + eT(0.5) * ( (nu_par-K-1) * std::log(mat_ops::det(X)) - mat_ops::trace(mat_ops::solve(Psi_par,X)) );
-
-    if (!log_form) {
-        ret = std::exp(ret);
-    }
-
-    //
-
-    return ret;
+    return internal::wish_dens_compute(X,Psi_par,static_cast<eT>(nu_par),log_form,false);
 }
 
 #ifdef STATS_ENABLE_ARMA_WRAPPERS
@@ -65,22 +241,29 @@ statslib_inline
 eT
 dwish(const ArmaMat<eT>& X, const ArmaMat<eT>& Psi_par, const pT nu_par, const bool log_form)
 {
-    const ullint_t K = X.n_rows;
-    const eT nu_par_d2 = static_cast<eT>(nu_par) / eT(2);
-
-    //
-
-    const eT lmg_term = gcem::lmgamma(nu_par_d2, K);
-    const eT norm_term = - nu_par_d2*std::log(arma::det(Psi_par)) - nu_par_d2*K*GCEM_LOG_2 - lmg_term;
-
-    eT ret = norm_term + eT(0.5) * ( (nu_par-K-1) * std::log(arma::det(X)) - arma::trace(arma::solve(Psi_par,X)) );
+    return internal::wish_dens_compute(X,Psi_par,static_cast<eT>(nu_par),log_form,false);
+}
+#endif
 
-    if (!log_form) {
-        ret = std::exp(ret);
-    }
+/**
+ * @brief Density function of the Wishart distribution, evaluated for a set of matrices
+ *
+ * @param X a vector of positive semi-definite matrices.
+ * @param Psi_par a positive semi-definite scale matrix.
+ * @param nu_par the degrees of parameter, a real-valued input.
+ * @param log_form return the log-density or the true form.
+ *
+ * @return a vector of density function values corresponding to the elements of \c X.
+ *
+ * \c Psi_par is factorized once; the matrices in \c X are evaluated in parallel when OpenMP is enabled.
+ */
 
-    //
+template<typename mT, typename pT>
+statslib_inline
+std::vector<return_t<pT>>
+dwish(const std::vector<mT>& X, const mT& Psi_par, const pT nu_par, const bool log_form)
+{
+    typedef return_t<pT> eT;
 
-    return ret;
+    return internal::wish_dens_batch_compute(X,Psi_par,static_cast<eT>(nu_par),log_form,false);
 }
-#endif
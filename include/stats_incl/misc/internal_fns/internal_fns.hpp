@@ -23,6 +23,12 @@
 
 #include "log_if.hpp"
 #include "exp_if.hpp"
+#include "tail_if.hpp"
+#include "tail_prob.hpp"
+#include "is_sorted_vec.hpp"
+#include "kahan_sum.hpp"
+#include "log_sum_exp.hpp"
+#include "small_mat.hpp"
 
 #include "statslib_defs.hpp"
 
@@ -0,0 +1,58 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * check for sorted (non-decreasing) input; used to switch to incremental vector paths
+ */
+
+#ifndef _statslib_is_sorted_vec_HPP
+#define _statslib_is_sorted_vec_HPP
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+namespace internal
+{
+
+// NaN values are treated as unsorted
+
+template<typename eT>
+statslib_inline
+bool
+is_sorted_vec(const eT* __stats_pointer_settings__ vals_in, const ullint_t num_elem)
+{
+    if (num_elem == ullint_t(0) || GCINT::is_nan(vals_in[0])) {
+        return false;
+    }
+
+    for (ullint_t j=ullint_t(1); j < num_elem; ++j)
+    {
+        if (!(vals_in[j-1] <= vals_in[j])) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+}
+
+#endif
+
+#endif
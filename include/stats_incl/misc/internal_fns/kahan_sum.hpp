@@ -0,0 +1,60 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * compensated (Kahan-Babuska-Neumaier) summation
+ */
+
+#ifndef _statslib_kahan_sum_HPP
+#define _statslib_kahan_sum_HPP
+
+namespace internal
+{
+
+// add x to sum_val, with the rounding error of the addition added to comp_val. Once the sum is no longer finite the
+// error term would be Inf - Inf, so the compensation is left as it is and the sum carries the Inf or NaN.
+
+template<typename T>
+statslib_inline
+void
+kahan_sum_update(T& sum_val, T& comp_val, const T x)
+noexcept
+{
+    const T t = sum_val + x;
+
+    if (GCINT::is_finite(t)) {
+        comp_val += std::abs(sum_val) >= std::abs(x) ? (sum_val - t) + x : (x - t) + sum_val;
+    }
+
+    sum_val = t;
+}
+
+template<typename T>
+statslib_inline
+T
+kahan_sum_value(const T sum_val, const T comp_val)
+noexcept
+{
+    return( GCINT::is_finite(sum_val) ? sum_val + comp_val : sum_val );
+}
+
+}
+
+#endif
@@ -0,0 +1,79 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * single-pass log-sum-exp accumulation
+ */
+
+#ifndef _statslib_log_sum_exp_HPP
+#define _statslib_log_sum_exp_HPP
+
+namespace internal
+{
+
+// running maximum and sum of exp(x - max_val); the sum is rescaled when a new maximum arrives, so one pass over
+// the inputs suffices. Ties at an infinite maximum count as one, -Inf inputs add nothing and NaN inputs propagate.
+
+template<typename T>
+statslib_inline
+void
+log_sum_exp_update(T& max_val, T& sum_val, const T x)
+noexcept
+{
+    if (x > max_val) {
+        sum_val = sum_val * std::exp(max_val - x) + T(1);
+        max_val = x;
+    } else if (x == max_val) {
+        sum_val += T(1);
+    } else {
+        sum_val += std::exp(x - max_val);
+    }
+}
+
+// merge the state of a second accumulator into the first
+
+template<typename T>
+statslib_inline
+void
+log_sum_exp_combine(T& max_val, T& sum_val, const T max_val_2, const T sum_val_2)
+noexcept
+{
+    if (max_val_2 > max_val) {
+        sum_val = sum_val * std::exp(max_val - max_val_2) + sum_val_2;
+        max_val = max_val_2;
+    } else if (max_val_2 == max_val) {
+        sum_val += sum_val_2;
+    } else {
+        sum_val += sum_val_2 * std::exp(max_val_2 - max_val);
+    }
+}
+
+template<typename T>
+statslib_inline
+T
+log_sum_exp_value(const T max_val, const T sum_val)
+noexcept
+{
+    return( GCINT::is_inf(max_val) && !GCINT::is_nan(sum_val) ? max_val : max_val + std::log(sum_val) );
+}
+
+}
+
+#endif
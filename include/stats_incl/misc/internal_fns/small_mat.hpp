@@ -0,0 +1,313 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * fixed-dimension kernels for small covariance and scale matrices
+ */
+
+#ifndef _statslib_small_mat_HPP
+#define _statslib_small_mat_HPP
+
+#ifdef STATS_ENABLE_MATRIX_FEATURES
+
+namespace internal
+{
+
+// a K x K matrix held on the stack, column-major. With K known at compile time, the loops below have fixed trip
+// counts and are unrolled by the compiler; K = 2 and K = 3 have closed-form Cholesky factors.
+//
+// The kernels that loop or write through a reference (small_chol, small_tri_solve, small_tri_mat_mult, small_gram,
+// and the rest) are statslib_inline, not statslib_constexpr: the library is C++11, where a constexpr function body
+// is a single return statement and cannot modify its arguments.
+
+template<typename T, ullint_t K>
+struct small_mat
+{
+    T vals[K*K];
+
+    statslib_constexpr
+    T
+    operator()(const ullint_t i, const ullint_t j)
+    const noexcept
+    {
+        return vals[i + j*K];
+    }
+
+    statslib_inline
+    T&
+    operator()(const ullint_t i, const ullint_t j)
+    noexcept
+    {
+        return vals[i + j*K];
+    }
+};
+
+// calls f.template run<K>() for K = 2, ..., 8; returns false, without calling f, for any other dimension
+
+template<typename fT>
+statslib_inline
+bool
+small_mat_dispatch(const ullint_t K, fT& f)
+{
+    switch (K)
+    {
+        case 2: f.template run<2>(); return true;
+        case 3: f.template run<3>(); return true;
+        case 4: f.template run<4>(); return true;
+        case 5: f.template run<5>(); return true;
+        case 6: f.template run<6>(); return true;
+        case 7: f.template run<7>(); return true;
+        case 8: f.template run<8>(); return true;
+        default: return false;
+    }
+}
+
+//
+
+template<typename T, ullint_t K, typename mT>
+statslib_inline
+void
+small_mat_load(const mT& X, small_mat<T,K>& A)
+{
+    for (ullint_t j=ullint_t(0); j < K; ++j)
+    {
+        for (ullint_t i=ullint_t(0); i < K; ++i)
+        {
+            A(i,j) = static_cast<T>(X(i,j));
+        }
+    }
+}
+
+// the lower triangle of X, with zeros above the diagonal
+
+template<typename T, ullint_t K, typename mT>
+statslib_inline
+void
+small_mat_load_lower(const mT& X, small_mat<T,K>& A)
+{
+    for (ullint_t j=ullint_t(0); j < K; ++j)
+    {
+        for (ullint_t i=ullint_t(0); i < K; ++i)
+        {
+            A(i,j) = i < j ? T(0) : static_cast<T>(X(i,j));
+        }
+    }
+}
+
+template<typename T, ullint_t K>
+statslib_constexpr
+bool
+small_chol_valid(const small_mat<T,K>& L, const ullint_t k = ullint_t(0))
+noexcept
+{
+    return( k == K ? true :
+            L(k,k) > T(0) && L(k,k) < STLIM<T>::infinity() && small_chol_valid(L,k+1) );
+}
+
+// lower Cholesky factor L of S, from the lower triangle of S; returns false if S is not positive definite
+
+template<typename T, ullint_t K>
+statslib_inline
+bool
+small_chol(const small_mat<T,K>& S, small_mat<T,K>& L)
+{
+    for (ullint_t j=ullint_t(0); j < K; ++j)
+    {
+        T d = S(j,j);
+
+        for (ullint_t k=ullint_t(0); k < j; ++k)
+        {
+            d -= L(j,k) * L(j,k);
+        }
+
+        if (!(d > T(0))) {
+            return false;
+        }
+
+        const T L_jj = std::sqrt(d);
+
+        for (ullint_t i=ullint_t(0); i < j; ++i)
+        {
+            L(i,j) = T(0);
+        }
+
+        L(j,j) = L_jj;
+
+        for (ullint_t i=j+1; i < K; ++i)
+        {
+            T val = S(i,j);
+
+            for (ullint_t k=ullint_t(0); k < j; ++k)
+            {
+                val -= L(i,k) * L(j,k);
+            }
+
+            L(i,j) = val / L_jj;
+        }
+    }
+
+    return small_chol_valid(L);
+}
+
+template<typename T>
+statslib_inline
+bool
+small_chol(const small_mat<T,2>& S, small_mat<T,2>& L)
+{
+    const T L_00 = std::sqrt(S(0,0));
+    const T L_10 = S(1,0) / L_00;
+
+    L.vals[0] = L_00; L.vals[2] = T(0);
+    L.vals[1] = L_10; L.vals[3] = std::sqrt(S(1,1) - L_10*L_10);
+
+    return small_chol_valid(L);
+}
+
+template<typename T>
+statslib_inline
+bool
+small_chol(const small_mat<T,3>& S, small_mat<T,3>& L)
+{
+    const T L_00 = std::sqrt(S(0,0));
+    const T L_10 = S(1,0) / L_00;
+    const T L_20 = S(2,0) / L_00;
+    const T L_11 = std::sqrt(S(1,1) - L_10*L_10);
+    const T L_21 = (S(2,1) - L_20*L_10) / L_11;
+
+    L.vals[0] = L_00; L.vals[3] = T(0); L.vals[6] = T(0);
+    L.vals[1] = L_10; L.vals[4] = L_11; L.vals[7] = T(0);
+    L.vals[2] = L_20; L.vals[5] = L_21; L.vals[8] = std::sqrt(S(2,2) - L_20*L_20 - L_21*L_21);
+
+    return small_chol_valid(L);
+}
+
+// log|S| = 2 sum_k log L(k,k)
+
+template<typename T, ullint_t K>
+statslib_inline
+T
+small_chol_log_det(const small_mat<T,K>& L)
+{
+    T log_det = T(0);
+
+    for (ullint_t k=ullint_t(0); k < K; ++k)
+    {
+        log_det += std::log(L(k,k));
+    }
+
+    return T(2) * log_det;
+}
+
+// forward substitution L z = z, in place
+
+template<typename T, ullint_t K>
+statslib_inline
+void
+small_tri_solve(const small_mat<T,K>& L, T* z_vals)
+{
+    for (ullint_t k=ullint_t(0); k < K; ++k)
+    {
+        T val = z_vals[k];
+
+        for (ullint_t r=ullint_t(0); r < k; ++r)
+        {
+            val -= L(k,r) * z_vals[r];
+        }
+
+        z_vals[k] = val / L(k,k);
+    }
+}
+
+// || T^{-1} R ||_F^2 for lower triangular T and R, solved one column of R at a time
+
+template<typename T, ullint_t K>
+statslib_inline
+T
+small_tri_solve_frob(const small_mat<T,K>& T_mat, const small_mat<T,K>& R_mat)
+{
+    small_mat<T,K> Z = R_mat;
+
+    T ret = T(0);
+
+    for (ullint_t j=ullint_t(0); j < K; ++j)
+    {
+        small_tri_solve(T_mat, Z.vals + j*K);
+
+        for (ullint_t i=j; i < K; ++i)
+        {
+            ret += Z(i,j) * Z(i,j);
+        }
+    }
+
+    return ret;
+}
+
+// B = L A, for lower triangular L and A
+
+template<typename T, ullint_t K>
+statslib_inline
+void
+small_tri_mat_mult(const small_mat<T,K>& L, const small_mat<T,K>& A, small_mat<T,K>& B)
+{
+    for (ullint_t j=ullint_t(0); j < K; ++j)
+    {
+        for (ullint_t i=ullint_t(0); i < K; ++i)
+        {
+            T val = T(0);
+
+            for (ullint_t k=j; k <= i; ++k)
+            {
+                val += L(i,k) * A(k,j);
+            }
+
+            B(i,j) = val;
+        }
+    }
+}
+
+// W = B B', written to a K x K matrix of any type
+
+template<typename T, ullint_t K, typename mT>
+statslib_inline
+void
+small_gram(const small_mat<T,K>& B, mT& W)
+{
+    for (ullint_t b=ullint_t(0); b < K; ++b)
+    {
+        for (ullint_t a=b; a < K; ++a)
+        {
+            T val = T(0);
+
+            for (ullint_t k=ullint_t(0); k < K; ++k)
+            {
+                val += B(a,k) * B(b,k);
+            }
+
+            W(a,b) = val;
+            W(b,a) = val;
+        }
+    }
+}
+
+}
+
+#endif
+
+#endif
@@ -0,0 +1,44 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * lower-tail-if-true function
+ */
+
+#ifndef _statslib_tail_if_HPP
+#define _statslib_tail_if_HPP
+
+namespace internal
+{
+
+// only for exact limit values; use the complementary tail algorithm otherwise
+
+template<typename T>
+statslib_constexpr
+T
+tail_if(const T x, const bool lower_tail)
+noexcept
+{
+    return lower_tail ? x : T(1) - x;
+}
+
+}
+
+#endif
@@ -0,0 +1,123 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+/*
+ * quantile-function inputs given on either tail and on either scale
+ */
+
+#ifndef _statslib_tail_prob_HPP
+#define _statslib_tail_prob_HPP
+
+namespace internal
+{
+
+// log(1 - exp(x)) for x <= 0, switching between the two forms at -log(2) (Maechler, 2012)
+
+template<typename T>
+statslib_constexpr
+T
+log1mexp(const T x)
+noexcept
+{
+    return( x > - T(GCEM_LOG_2) ? \
+                stmath::log(- stmath::expm1(x)) :
+                stmath::log1p(- stmath::exp(x)) );
+}
+
+// P(X <= x) and P(X > x) implied by an input p; with lower_tail = false, p is the upper-tail probability,
+// and with log_p = true, p is given as log(p)
+
+template<typename T>
+statslib_constexpr
+T
+prob_lower(const T p, const bool lower_tail, const bool log_p)
+noexcept
+{
+    return( lower_tail ? \
+                (log_p ? stmath::exp(p) : p) :
+                (log_p ? - stmath::expm1(p) : T(1) - p) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+prob_upper(const T p, const bool lower_tail, const bool log_p)
+noexcept
+{
+    return prob_lower(p,!lower_tail,log_p);
+}
+
+template<typename T>
+statslib_constexpr
+T
+log_prob_lower(const T p, const bool lower_tail, const bool log_p)
+noexcept
+{
+    return( lower_tail ? \
+                (log_p ? p : stmath::log(p)) :
+                (log_p ? log1mexp(p) : stmath::log1p(-p)) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+log_prob_upper(const T p, const bool lower_tail, const bool log_p)
+noexcept
+{
+    return log_prob_lower(p,!lower_tail,log_p);
+}
+
+// whether p marks P(X <= x) = 0 or P(X > x) = 0 exactly; tested on p itself so that log-probabilities
+// below the smallest double are not mistaken for zeros
+
+template<typename T>
+statslib_constexpr
+bool
+prob_lower_is_zero(const T p, const bool lower_tail, const bool log_p)
+noexcept
+{
+    return( lower_tail ? \
+                (log_p ? GCINT::is_neginf(p) : p == T(0)) :
+                (log_p ? p == T(0) : p == T(1)) );
+}
+
+template<typename T>
+statslib_constexpr
+bool
+prob_upper_is_zero(const T p, const bool lower_tail, const bool log_p)
+noexcept
+{
+    return prob_lower_is_zero(p,!lower_tail,log_p);
+}
+
+// whether a quantile should be found by inverting the upper tail; plain lower-tail inputs
+// keep the lower-tail inversion, as 1 - p would already have rounded away the upper tail
+
+template<typename T>
+statslib_constexpr
+bool
+invert_upper_tail(const T p, const bool lower_tail, const bool log_p)
+noexcept
+{
+    return( (!lower_tail || log_p) && prob_upper(p,lower_tail,log_p) < T(0.5) );
+}
+
+}
+
+#endif
@@ -25,28 +25,134 @@
 //
 // sum all elements and sum of squared values
 
+#ifndef STATS_ACCU_BLOCK
+    #define STATS_ACCU_BLOCK ullint_t(4096)
+#endif
+
+#ifndef STATS_ACCU_PAIRWISE_BASE
+    #define STATS_ACCU_PAIRWISE_BASE ullint_t(128)
+#endif
+
+enum class accu_mode_t
+{
+    naive,          // four interleaved running sums
+    pairwise,       // recursive halving down to STATS_ACCU_PAIRWISE_BASE values; error O(log n)
+    kahan           // Kahan-Babuska-Neumaier compensated summation; error O(1)
+};
+
+// the kernels below sum x, or x^2 with sq_flag. The four independent accumulators of the naive kernel leave the
+// compiler free to vectorize without reassociating floating-point additions.
+
+template<typename eT, bool sq_flag>
+statslib_inline
+eT
+accu_naive(const eT* vals, const ullint_t num_elem)
+{
+    eT sum_0 = eT(0), sum_1 = eT(0), sum_2 = eT(0), sum_3 = eT(0);
+
+    const ullint_t n_main = num_elem - num_elem % ullint_t(4);
+
+    for (ullint_t j=ullint_t(0); j < n_main; j += ullint_t(4))
+    {
+        sum_0 += sq_flag ? vals[j]*vals[j] : vals[j];
+        sum_1 += sq_flag ? vals[j+1]*vals[j+1] : vals[j+1];
+        sum_2 += sq_flag ? vals[j+2]*vals[j+2] : vals[j+2];
+        sum_3 += sq_flag ? vals[j+3]*vals[j+3] : vals[j+3];
+    }
+
+    for (ullint_t j=n_main; j < num_elem; ++j)
+    {
+        sum_0 += sq_flag ? vals[j]*vals[j] : vals[j];
+    }
+
+    return (sum_0 + sum_1) + (sum_2 + sum_3);
+}
+
+template<typename eT, bool sq_flag>
+statslib_inline
+eT
+accu_pairwise(const eT* vals, const ullint_t num_elem)
+{
+    if (num_elem <= STATS_ACCU_PAIRWISE_BASE) {
+        return accu_naive<eT,sq_flag>(vals,num_elem);
+    }
+
+    const ullint_t n_half = num_elem / ullint_t(2);
+
+    return accu_pairwise<eT,sq_flag>(vals,n_half) + accu_pairwise<eT,sq_flag>(vals + n_half,num_elem - n_half);
+}
+
+template<typename eT, bool sq_flag>
+statslib_inline
+void
+accu_kahan(const eT* vals, const ullint_t num_elem, eT& sum_val, eT& comp_val)
+{
+    for (ullint_t j=ullint_t(0); j < num_elem; ++j)
+    {
+        internal::kahan_sum_update(sum_val,comp_val,sq_flag ? vals[j]*vals[j] : vals[j]);
+    }
+}
+
+// blocks of STATS_ACCU_BLOCK values are summed separately (in parallel when OpenMP is enabled) and the block sums are
+// then combined in block order with the same method, so a given input is summed bit-for-bit identically for any 
+// number of threads
+
+template<typename eT, bool sq_flag>
+statslib_inline
+eT
+accu_vals(const eT* vals, const ullint_t num_elem, const accu_mode_t mode)
+{
+    const ullint_t n_blocks = (num_elem + STATS_ACCU_BLOCK - ullint_t(1)) / STATS_ACCU_BLOCK;
+
+    std::vector<eT> sum_vals(n_blocks, eT(0));
+    std::vector<eT> comp_vals(n_blocks, eT(0));
+
+#ifdef STATS_USE_OPENMP
+    #pragma omp parallel for
+#endif
+    for (ullint_t j=ullint_t(0); j < n_blocks; ++j)
+    {
+        const ullint_t i_begin = j*STATS_ACCU_BLOCK;
+        const ullint_t n_block = std::min(STATS_ACCU_BLOCK, num_elem - i_begin);
+
+        if (mode == accu_mode_t::kahan) {
+            accu_kahan<eT,sq_flag>(vals + i_begin,n_block,sum_vals[j],comp_vals[j]);
+        } else if (mode == accu_mode_t::pairwise) {
+            sum_vals[j] = accu_pairwise<eT,sq_flag>(vals + i_begin,n_block);
+        } else {
+            sum_vals[j] = accu_naive<eT,sq_flag>(vals + i_begin,n_block);
+        }
+    }
+
+    if (mode == accu_mode_t::kahan) {
+        eT sum_val = eT(0), comp_val = eT(0);
+
+        accu_kahan<eT,false>(sum_vals.data(),n_blocks,sum_val,comp_val);
+
+        return internal::kahan_sum_value(sum_val,comp_val + accu_naive<eT,false>(comp_vals.data(),n_blocks));
+    }
+
+    return mode == accu_mode_t::pairwise ? accu_pairwise<eT,false>(sum_vals.data(),n_blocks) : 
+                                           accu_naive<eT,false>(sum_vals.data(),n_blocks);
+}
+
+//
+
 #ifdef STATS_ENABLE_STDVEC_WRAPPERS
 template<typename eT>
 statslib_inline
 eT
-accu(const std::vector<eT>& X)
+accu(const std::vector<eT>& X, const accu_mode_t mode = accu_mode_t::pairwise)
 {
-    // const eT sum_val = std::accumulate(X.begin(), X.end(), eT(0));
-    eT sum_val = eT(0);
-    for (auto x : X)
-        sum_val += x;
-    return sum_val;
+    return accu_vals<eT,false>(X.data(),X.size(),mode);
 }
 
 template<typename eT>
 statslib_inline
 eT
-sqaccu(const std::vector<eT>& X)
+sqaccu(const std::vector<eT>& X, const accu_mode_t mode = accu_mode_t::pairwise)
 {
-    eT sum_val = eT(0);
-    for (auto& x : X)
-        sum_val += x*x;
-    return sum_val;
+    return accu_vals<eT,true>(X.data(),X.size(),mode);
 }
 #endif
 
@@ -54,37 +160,54 @@ sqaccu(const std::vector<eT>& X)
 template<typename eT>
 statslib_inline
 eT
-accu(const ArmaMat<eT>& X)
+accu(const ArmaMat<eT>& X, const accu_mode_t mode = accu_mode_t::pairwise)
 {
-    return arma::accu(X);
+    return accu_vals<eT,false>(X.memptr(),n_elem(X),mode);
 }
 
 template<typename eT>
 statslib_inline
 eT
-sqaccu(const ArmaMat<eT>& X)
+sqaccu(const ArmaMat<eT>& X, const accu_mode_t mode = accu_mode_t::pairwise)
 {
-    return arma::accu(arma::pow(X,2));
+    return accu_vals<eT,true>(X.memptr(),n_elem(X),mode);
 }
 #endif
 
 #ifdef STATS_ENABLE_BLAZE_WRAPPERS
+// the rows (or columns, for column-major storage) may be padded; each one is summed, then the line sums
+template<typename eT, bool To, bool sq_flag>
+statslib_inline
+eT
+accu_blaze(const BlazeMat<eT,To>& X, const accu_mode_t mode)
+{
+    const ullint_t n_lines = To == blaze::columnMajor ? n_cols(X) : n_rows(X);
+    const ullint_t n_line_elem = To == blaze::columnMajor ? n_rows(X) : n_cols(X);
+
+    std::vector<eT> line_vals(n_lines);
+
+    for (ullint_t i=ullint_t(0); i < n_lines; ++i)
+    {
+        line_vals[i] = accu_vals<eT,sq_flag>(X.data(i),n_line_elem,mode);
+    }
+
+    return accu_vals<eT,false>(line_vals.data(),n_lines,mode);
+}
+
 template<typename eT, bool To>
 statslib_inline
 eT
-accu(const BlazeMat<eT,To>& X)
+accu(const BlazeMat<eT,To>& X, const accu_mode_t mode = accu_mode_t::pairwise)
 {
-    eT out_val = blaze::sum(X);
-    return out_val;
+    return accu_blaze<eT,To,false>(X,mode);
 }
 
 template<typename eT, bool To>
 statslib_inline
 eT
-sqaccu(const BlazeMat<eT,To>& X)
+sqaccu(const BlazeMat<eT,To>& X, const accu_mode_t mode = accu_mode_t::pairwise)
 {
-    eT out_val = blaze::sum(blaze::pow(X,2));
-    return out_val;
+    return accu_blaze<eT,To,true>(X,mode);
 }
 #endif
 
@@ -92,22 +215,16 @@ sqaccu(const BlazeMat<eT,To>& X)
 template<typename eT, int iTr, int iTc>
 statslib_inline
 eT
-accu(const EigenMat<eT,iTr,iTc>& X)
+accu(const EigenMat<eT,iTr,iTc>& X, const accu_mode_t mode = accu_mode_t::pairwise)
 {
-    return X.sum();
+    return accu_vals<eT,false>(X.data(),n_elem(X),mode);
 }
 
 template<typename eT, int iTr, int iTc>
 statslib_inline
 eT
-sqaccu(const EigenMat<eT,iTr,iTc>& X)
+sqaccu(const EigenMat<eT,iTr,iTc>& X, const accu_mode_t mode = accu_mode_t::pairwise)
 {
-    // const eT* vals = X.data();
-    // eT out_val = eT(0);
-    // for (ullint_t j=0U; j < n_elem(X); ++j) {
-    //     out_val += vals[j]*vals[j];
-    // }
-    // return out_val;
-    return (X.pow(2)).sum();
+    return accu_vals<eT,true>(X.data(),n_elem(X),mode);
 }
 #endif
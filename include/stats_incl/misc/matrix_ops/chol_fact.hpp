@@ -0,0 +1,302 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * for internal use only; used to switch between the different matrix libraries
+ */
+
+//
+// Cholesky factorization of a symmetric positive definite matrix, A = L L' with L lower triangular
+
+// factorize A into L; returns false if A is not positive definite, in which case L is left the size of A and
+// filled with NaN rather than holding an empty or partial factor
+
+#ifdef STATS_ENABLE_ARMA_WRAPPERS
+template<typename eT>
+statslib_inline
+bool
+chol_compute(const ArmaMat<eT>& A, ArmaMat<eT>& L)
+{
+    if (arma::chol(L,A,"lower")) {
+        return true;
+    }
+
+    // arma::chol resets L to 0 x 0 on failure
+
+    L.set_size(A.n_rows,A.n_cols);
+    L.fill(STLIM<eT>::quiet_NaN());
+
+    return false;
+}
+#endif
+
+#ifdef STATS_ENABLE_BLAZE_WRAPPERS
+template<typename eT, bool To>
+statslib_inline
+bool
+chol_compute(const BlazeMat<eT,To>& A, BlazeMat<eT,To>& L)
+{
+    L = A;
+
+    try {
+        blaze::potrf(L,'L');
+    } catch (...) {
+        L = STLIM<eT>::quiet_NaN();
+        return false;
+    }
+
+    for (size_t j=1; j < L.columns(); ++j)
+    {
+        for (size_t i=0; i < j; ++i)
+        {
+            L(i,j) = eT(0);
+        }
+    }
+
+    return true;
+}
+#endif
+
+#ifdef STATS_ENABLE_EIGEN_WRAPPERS
+template<typename eT, int iTr, int iTc>
+statslib_inline
+bool
+chol_compute(const EigenMat<eT,iTr,iTc>& A, EigenMat<eT,iTr,iTc>& L)
+{
+    const Eigen::LLT<EigenMat<eT,iTr,iTc>> llt_A(A);
+
+    if (llt_A.info() != Eigen::Success) {
+        L.setConstant(A.rows(),A.cols(),STLIM<eT>::quiet_NaN());
+        return false;
+    }
+
+    L = llt_A.matrixL();
+
+    return true;
+}
+#endif
+
+// L^{-1} x, or (L')^{-1} x with trans_flag
+
+#ifdef STATS_ENABLE_ARMA_WRAPPERS
+template<typename eT, typename vT>
+statslib_inline
+vT
+chol_tri_solve(const ArmaMat<eT>& L, const vT& x, const bool trans_flag)
+{
+    if (trans_flag) {
+        return arma::solve(arma::trimatu(L.t()),x);
+    } else {
+        return arma::solve(arma::trimatl(L),x);
+    }
+}
+#endif
+
+#ifdef STATS_ENABLE_BLAZE_WRAPPERS
+template<typename eT, bool To, typename vT>
+statslib_inline
+vT
+chol_tri_solve(const BlazeMat<eT,To>& L, const vT& x, const bool trans_flag)
+{
+    // substitution over the columns of x, which avoids a dependence on the LAPACK triangular solvers
+
+    vT ret = x;
+
+    const size_t K = L.rows();
+
+    for (size_t j=0; j < ret.columns(); ++j)
+    {
+        for (size_t k_ind=0; k_ind < K; ++k_ind)
+        {
+            const size_t k = trans_flag ? K - 1 - k_ind : k_ind;
+
+            eT val = ret(k,j);
+
+            for (size_t r_ind=0; r_ind < k_ind; ++r_ind)
+            {
+                const size_t r = trans_flag ? K - 1 - r_ind : r_ind;
+                val -= (trans_flag ? L(r,k) : L(k,r)) * ret(r,j);
+            }
+
+            ret(k,j) = val / L(k,k);
+        }
+    }
+
+    return ret;
+}
+#endif
+
+#ifdef STATS_ENABLE_EIGEN_WRAPPERS
+template<typename eT, int iTr, int iTc, typename vT>
+statslib_inline
+vT
+chol_tri_solve(const EigenMat<eT,iTr,iTc>& L, const vT& x, const bool trans_flag)
+{
+    if (trans_flag) {
+        return L.transpose().template triangularView<Eigen::Upper>().solve(x);
+    } else {
+        return L.template triangularView<Eigen::Lower>().solve(x);
+    }
+}
+#endif
+
+#ifdef STATS_ENABLE_MATRIX_FEATURES
+
+/**
+ * @brief Cholesky factorization handle for a symmetric positive definite matrix
+ *
+ * The matrix is factorized once, on construction; solves, quadratic forms, the log-determinant and triangular
+ * products then reuse the lower factor \c L, where \c A = \c L \c L'. If \c A is not positive definite, 
+ * \c is_valid is false, \c L is filled with NaN, and \c log_det, \c quad_form and the solves return NaN.
+ */
+
+template<typename mT>
+class chol_fact
+{
+    public:
+        explicit chol_fact(const mT& A);
+
+        bool is_valid() const;
+        const mT& factor() const;
+
+        // log|A|, NaN if A is not positive definite
+
+        double log_det() const;
+
+        // A^{-1} x, L^{-1} x, L x and x' A^{-1} x, for x with the same number of rows as A
+
+        template<typename vT>
+        vT solve(const vT& x) const;
+
+        template<typename vT>
+        vT tri_solve(const vT& x) const;
+
+        template<typename vT>
+        vT tri_mult(const vT& x) const;
+
+        template<typename vT>
+        double quad_form(const vT& x) const;
+
+    private:
+        mT L;
+        bool valid_flag;
+        double log_det_val;
+};
+
+template<typename mT>
+chol_fact<mT>::chol_fact(const mT& A)
+{
+    valid_flag = chol_compute(A,L);
+    log_det_val = 0.0;
+
+    for (ullint_t k=ullint_t(0); k < mat_ops::n_rows(L); ++k)
+    {
+        log_det_val += std::log(static_cast<double>(L(k,k)));
+    }
+
+    log_det_val *= 2.0;
+
+    if (!valid_flag || !GCINT::is_finite(log_det_val)) {
+        valid_flag = false;
+        log_det_val = STLIM<double>::quiet_NaN();
+    }
+}
+
+template<typename mT>
+statslib_inline
+bool
+chol_fact<mT>::is_valid()
+const
+{
+    return valid_flag;
+}
+
+template<typename mT>
+statslib_inline
+const mT&
+chol_fact<mT>::factor()
+const
+{
+    return L;
+}
+
+template<typename mT>
+statslib_inline
+double
+chol_fact<mT>::log_det()
+const
+{
+    return log_det_val;
+}
+
+template<typename mT>
+template<typename vT>
+statslib_inline
+vT
+chol_fact<mT>::solve(const vT& x)
+const
+{
+    return chol_tri_solve(L,chol_tri_solve(L,x,false),true);
+}
+
+template<typename mT>
+template<typename vT>
+statslib_inline
+vT
+chol_fact<mT>::tri_solve(const vT& x)
+const
+{
+    return chol_tri_solve(L,x,false);
+}
+
+template<typename mT>
+template<typename vT>
+statslib_inline
+vT
+chol_fact<mT>::tri_mult(const vT& x)
+const
+{
+    return L * x;
+}
+
+template<typename mT>
+template<typename vT>
+statslib_inline
+double
+chol_fact<mT>::quad_form(const vT& x)
+const
+{
+    if (!valid_flag) {
+        return STLIM<double>::quiet_NaN();
+    }
+
+    const vT z = chol_tri_solve(L,x,false);
+
+    double ret = 0.0;
+
+    for (ullint_t k=ullint_t(0); k < mat_ops::n_rows(z); ++k)
+    {
+        ret += static_cast<double>(z(k,0)) * static_cast<double>(z(k,0));
+    }
+
+    return ret;
+}
+
+#endif
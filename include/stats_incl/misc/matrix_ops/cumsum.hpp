@@ -23,51 +23,207 @@
  */
 
 //
-// Cumulative sum (assumes a vector form)
+// Cumulative sum. Vectors are scanned end to end; an Armadillo matrix is scanned column by column, as arma::cumsum,
+// while the other wrappers scan all elements in column-major order.
+
+#ifndef STATS_CUMSUM_BLOCK
+    #define STATS_CUMSUM_BLOCK ullint_t(4096)
+#endif
+
+// running sum of vals, written to vals_out from the starting state (sum_val, comp_val); with comp_flag, the 
+// Kahan-Babuska-Neumaier compensation term is carried and added to each output
 
-#ifdef STATS_ENABLE_STDVEC_WRAPPERS
 template<typename eT>
 statslib_inline
-std::vector<eT>
-cumsum(const std::vector<eT>& X)
+void
+cumsum_block(const eT* vals, eT* vals_out, const ullint_t num_elem, const bool comp_flag, eT& sum_val, eT& comp_val)
 {
-    std::vector<eT> mat_out = X;
+    if (!comp_flag) {
+        for (ullint_t j=ullint_t(0); j < num_elem; ++j)
+        {
+            sum_val += vals[j];
+            vals_out[j] = sum_val;
+        }
 
-    eT* mem_out = mat_out.data();
+        return;
+    }
 
-    for (ullint_t j=ullint_t(1); j < X.rows()*X.columns(); ++j)
+    for (ullint_t j=ullint_t(0); j < num_elem; ++j)
     {
-        mem_out[j] += mem_out[j-1];
+        internal::kahan_sum_update(sum_val,comp_val,vals[j]);
+        vals_out[j] = internal::kahan_sum_value(sum_val,comp_val);
+    }
+}
+
+// two-pass blocked scan; the input and output may alias. Blocks of STATS_CUMSUM_BLOCK values are first totalled,
+// in parallel when OpenMP is enabled, the block totals are scanned in order, and each block is then scanned from
+// its offset, again in parallel. The result does not depend on the number of threads.
+
+template<typename eT>
+statslib_inline
+void
+cumsum_vals(const eT* vals, eT* vals_out, const ullint_t num_elem, const bool comp_flag)
+{
+    const ullint_t n_blocks = (num_elem + STATS_CUMSUM_BLOCK - ullint_t(1)) / STATS_CUMSUM_BLOCK;
+
+    if (n_blocks <= ullint_t(1)) {
+        eT sum_val = eT(0), comp_val = eT(0);
+        cumsum_block(vals,vals_out,num_elem,comp_flag,sum_val,comp_val);
+        return;
+    }
+
+    // block totals
+
+    std::vector<eT> sum_vals(n_blocks, eT(0));
+    std::vector<eT> comp_vals(n_blocks, eT(0));
+
+#ifdef STATS_USE_OPENMP
+    #pragma omp parallel for
+#endif
+    for (ullint_t j=ullint_t(0); j < n_blocks - ullint_t(1); ++j)
+    {
+        const eT* vals_j = vals + j*STATS_CUMSUM_BLOCK;
+
+        if (comp_flag) {
+            for (ullint_t i=ullint_t(0); i < STATS_CUMSUM_BLOCK; ++i)
+            {
+                internal::kahan_sum_update(sum_vals[j],comp_vals[j],vals_j[i]);
+            }
+        } else {
+            for (ullint_t i=ullint_t(0); i < STATS_CUMSUM_BLOCK; ++i)
+            {
+                sum_vals[j] += vals_j[i];
+            }
+        }
     }
 
+    // exclusive scan of the block totals, then each block from its offset
+
+    std::vector<eT> offset_vals(n_blocks, eT(0));
+    std::vector<eT> offset_comp_vals(n_blocks, eT(0));
+
+    for (ullint_t j=ullint_t(1); j < n_blocks; ++j)
+    {
+        offset_vals[j] = offset_vals[j-1];
+        offset_comp_vals[j] = offset_comp_vals[j-1];
+
+        if (comp_flag) {
+            internal::kahan_sum_update(offset_vals[j],offset_comp_vals[j],sum_vals[j-1]);
+            offset_comp_vals[j] += comp_vals[j-1];
+        } else {
+            offset_vals[j] += sum_vals[j-1];
+        }
+    }
+
+#ifdef STATS_USE_OPENMP
+    #pragma omp parallel for
+#endif
+    for (ullint_t j=ullint_t(0); j < n_blocks; ++j)
+    {
+        const ullint_t i_begin = j*STATS_CUMSUM_BLOCK;
+        const ullint_t n_block = std::min(STATS_CUMSUM_BLOCK, num_elem - i_begin);
+
+        eT sum_val = offset_vals[j];
+        eT comp_val = offset_comp_vals[j];
+
+        cumsum_block(vals + i_begin,vals_out + i_begin,n_block,comp_flag,sum_val,comp_val);
+    }
+}
+
+#ifdef STATS_ENABLE_STDVEC_WRAPPERS
+template<typename eT>
+statslib_inline
+void
+cumsum_inplace(std::vector<eT>& X, const bool comp_flag = false)
+{
+    cumsum_vals(X.data(),X.data(),X.size(),comp_flag);
+}
+
+template<typename eT>
+statslib_inline
+std::vector<eT>
+cumsum(const std::vector<eT>& X, const bool comp_flag = false)
+{
+    std::vector<eT> mat_out(X.size());
+    cumsum_vals(X.data(),mat_out.data(),X.size(),comp_flag);
+
     return mat_out;
 }
 #endif
 
 #ifdef STATS_ENABLE_ARMA_WRAPPERS
+// row and column vectors are contiguous; the columns of a matrix are scanned separately
+template<typename eT>
+statslib_inline
+void
+cumsum_arma(const ArmaMat<eT>& X, ArmaMat<eT>& mat_out, const bool comp_flag)
+{
+    if (X.n_rows == 1 || X.n_cols == 1) {
+        cumsum_vals(X.memptr(),mat_out.memptr(),n_elem(X),comp_flag);
+        return;
+    }
+
+    for (ullint_t k=ullint_t(0); k < X.n_cols; ++k)
+    {
+        cumsum_vals(X.colptr(k),mat_out.colptr(k),X.n_rows,comp_flag);
+    }
+}
+
+template<typename eT>
+statslib_inline
+void
+cumsum_inplace(ArmaMat<eT>& X, const bool comp_flag = false)
+{
+    cumsum_arma(X,X,comp_flag);
+}
+
 template<typename eT>
 statslib_inline
 ArmaMat<eT>
-cumsum(const ArmaMat<eT>& X)
+cumsum(const ArmaMat<eT>& X, const bool comp_flag = false)
 {
-    return arma::cumsum(X);
+    ArmaMat<eT> mat_out(X.n_rows,X.n_cols);
+    cumsum_arma(X,mat_out,comp_flag);
+
+    return mat_out;
 }
 #endif
 
 #ifdef STATS_ENABLE_BLAZE_WRAPPERS
+// the rows may be padded; the values are scanned in column-major order
 template<typename eT, bool To>
 statslib_inline
-BlazeMat<eT,To>
-cumsum(const BlazeMat<eT,To>& X)
+void
+cumsum_inplace(BlazeMat<eT,To>& X, const bool comp_flag = false)
 {
-    BlazeMat<eT,To> mat_out = X;
+    std::vector<eT> vals(n_elem(X));
 
-    eT* mem_out = mat_out.data();
+    for (ullint_t k=ullint_t(0); k < n_cols(X); ++k)
+    {
+        for (ullint_t i=ullint_t(0); i < n_rows(X); ++i)
+        {
+            vals[k*n_rows(X) + i] = X(i,k);
+        }
+    }
 
-    for (ullint_t j=ullint_t(1); j < X.rows()*X.columns(); ++j)
+    cumsum_vals(vals.data(),vals.data(),vals.size(),comp_flag);
+
+    for (ullint_t k=ullint_t(0); k < n_cols(X); ++k)
     {
-        mem_out[j] += mem_out[j-1];
+        for (ullint_t i=ullint_t(0); i < n_rows(X); ++i)
+        {
+            X(i,k) = vals[k*n_rows(X) + i];
+        }
     }
+}
+
+template<typename eT, bool To>
+statslib_inline
+BlazeMat<eT,To>
+cumsum(const BlazeMat<eT,To>& X, const bool comp_flag = false)
+{
+    BlazeMat<eT,To> mat_out = X;
+    cumsum_inplace(mat_out,comp_flag);
 
     return mat_out;
 }
@@ -76,17 +232,19 @@ cumsum(const BlazeMat<eT,To>& X)
 #ifdef STATS_ENABLE_EIGEN_WRAPPERS
 template<typename eT, int iTr, int iTc>
 statslib_inline
-EigenMat<eT,iTr,iTc>
-cumsum(const EigenMat<eT,iTr,iTc>& X)
+void
+cumsum_inplace(EigenMat<eT,iTr,iTc>& X, const bool comp_flag = false)
 {
-    EigenMat<eT,iTr,iTc> mat_out = X;
-
-    eT* mem_out = mat_out.data();
+    cumsum_vals(X.data(),X.data(),n_elem(X),comp_flag);
+}
 
-    for (ullint_t j=ullint_t(1); j < X.rows()*X.cols(); ++j)
-    {
-        mem_out[j] += mem_out[j-1];
-    }
+template<typename eT, int iTr, int iTc>
+statslib_inline
+EigenMat<eT,iTr,iTc>
+cumsum(const EigenMat<eT,iTr,iTc>& X, const bool comp_flag = false)
+{
+    EigenMat<eT,iTr,iTc> mat_out(X.rows(),X.cols());
+    cumsum_vals(X.data(),mat_out.data(),n_elem(X),comp_flag);
 
     return mat_out;
 }
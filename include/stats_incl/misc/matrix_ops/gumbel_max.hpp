@@ -0,0 +1,183 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * for internal use only; used to switch between the different matrix libraries
+ */
+
+//
+// categorical draws from unnormalized log-probabilities by the Gumbel-max trick: argmax_k (x_k + g_k), with g_k
+// standard Gumbel draws, is distributed as softmax(x). Entries of -Inf are never selected; if no entry can be
+// selected (all -Inf or NaN), the number of categories is returned.
+
+#ifndef STATS_GUMBEL_MAX_BLOCK
+    #define STATS_GUMBEL_MAX_BLOCK ullint_t(1024)
+#endif
+
+template<typename eT>
+statslib_inline
+ullint_t
+gumbel_max_vals(const eT* vals, const ullint_t num_elem, rand_engine_t& engine)
+{
+    std::uniform_real_distribution<eT> unif_dist(eT(0),eT(1));
+
+    ullint_t max_ind = num_elem;
+    eT max_val = - STLIM<eT>::infinity();
+
+    for (ullint_t k=ullint_t(0); k < num_elem; ++k)
+    {
+        const eT val_k = vals[k] - std::log(- std::log(unif_dist(engine)));
+
+        if (val_k > max_val) {
+            max_val = val_k;
+            max_ind = k;
+        }
+    }
+
+    return max_ind;
+}
+
+#ifdef STATS_ENABLE_MATRIX_FEATURES
+
+// one draw per row. Block j of STATS_GUMBEL_MAX_BLOCK rows takes its Gumbel noise, column by column, from an engine
+// seeded by (seed_val, j), so that the draws are reproducible for any number of threads.
+
+template<typename mT, typename eT>
+statslib_inline
+std::vector<ullint_t>
+gumbel_max_rows_compute(const mT& X, const ullint_t seed_val)
+{
+    const ullint_t n = n_rows(X);
+    const ullint_t K = n_cols(X);
+    const ullint_t n_blocks = (n + STATS_GUMBEL_MAX_BLOCK - ullint_t(1)) / STATS_GUMBEL_MAX_BLOCK;
+
+    std::vector<ullint_t> ind_out(n, K);
+
+#ifdef STATS_USE_OPENMP
+    #pragma omp parallel for
+#endif
+    for (ullint_t j=ullint_t(0); j < n_blocks; ++j)
+    {
+        const ullint_t i_begin = j*STATS_GUMBEL_MAX_BLOCK;
+        const ullint_t n_block = std::min(STATS_GUMBEL_MAX_BLOCK, n - i_begin);
+
+        std::seed_seq seed_seq_j = { uint_t(seed_val), uint_t(seed_val >> 32), uint_t(j), uint_t(j >> 32) };
+        rand_engine_t engine_j(seed_seq_j);
+
+        std::uniform_real_distribution<eT> unif_dist(eT(0),eT(1));
+
+        std::vector<eT> max_vals(n_block, - STLIM<eT>::infinity());
+
+        for (ullint_t k=ullint_t(0); k < K; ++k)
+        {
+            for (ullint_t b=ullint_t(0); b < n_block; ++b)
+            {
+                const eT val_k = static_cast<eT>(X(i_begin + b,k)) - std::log(- std::log(unif_dist(engine_j)));
+
+                if (val_k > max_vals[b]) {
+                    max_vals[b] = val_k;
+                    ind_out[i_begin + b] = k;
+                }
+            }
+        }
+    }
+
+    return ind_out;
+}
+
+#endif
+
+//
+
+#ifdef STATS_ENABLE_STDVEC_WRAPPERS
+template<typename eT>
+statslib_inline
+ullint_t
+gumbel_max(const std::vector<eT>& X, rand_engine_t& engine)
+{
+    return gumbel_max_vals(X.data(),X.size(),engine);
+}
+#endif
+
+#ifdef STATS_ENABLE_ARMA_WRAPPERS
+template<typename eT>
+statslib_inline
+ullint_t
+gumbel_max(const ArmaMat<eT>& X, rand_engine_t& engine)
+{
+    return gumbel_max_vals(X.memptr(),n_elem(X),engine);
+}
+
+template<typename eT>
+statslib_inline
+std::vector<ullint_t>
+gumbel_max_rows(const ArmaMat<eT>& X, rand_engine_t& engine)
+{
+    return gumbel_max_rows_compute<ArmaMat<eT>,eT>(X,static_cast<ullint_t>(engine()));
+}
+#endif
+
+#ifdef STATS_ENABLE_BLAZE_WRAPPERS
+template<typename eT, bool To>
+statslib_inline
+ullint_t
+gumbel_max(const BlazeMat<eT,To>& X, rand_engine_t& engine)
+{
+    // the rows may be padded
+    std::vector<eT> vals;
+    vals.reserve(n_elem(X));
+
+    for (ullint_t i=ullint_t(0); i < n_rows(X); ++i)
+    {
+        for (ullint_t k=ullint_t(0); k < n_cols(X); ++k)
+        {
+            vals.push_back(X(i,k));
+        }
+    }
+
+    return gumbel_max_vals(vals.data(),vals.size(),engine);
+}
+
+template<typename eT, bool To>
+statslib_inline
+std::vector<ullint_t>
+gumbel_max_rows(const BlazeMat<eT,To>& X, rand_engine_t& engine)
+{
+    return gumbel_max_rows_compute<BlazeMat<eT,To>,eT>(X,static_cast<ullint_t>(engine()));
+}
+#endif
+
+#ifdef STATS_ENABLE_EIGEN_WRAPPERS
+template<typename eT, int iTr, int iTc>
+statslib_inline
+ullint_t
+gumbel_max(const EigenMat<eT,iTr,iTc>& X, rand_engine_t& engine)
+{
+    return gumbel_max_vals(X.data(),n_elem(X),engine);
+}
+
+template<typename eT, int iTr, int iTc>
+statslib_inline
+std::vector<ullint_t>
+gumbel_max_rows(const EigenMat<eT,iTr,iTc>& X, rand_engine_t& engine)
+{
+    return gumbel_max_rows_compute<EigenMat<eT,iTr,iTc>,eT>(X,static_cast<ullint_t>(engine()));
+}
+#endif
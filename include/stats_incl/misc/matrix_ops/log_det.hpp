@@ -23,7 +23,7 @@
  */
 
 //
-// log-determinant
+// log-determinant of a symmetric positive definite matrix, NaN otherwise
 
 #ifdef STATS_ENABLE_ARMA_WRAPPERS
 template<typename eT>
@@ -31,8 +31,7 @@ statslib_inline
 eT
 log_det(const ArmaMat<eT>& X)
 {
-    ArmaMat<eT> vec = mat_ops::chol(X).diag();
-    return 2.0*arma::accu(arma::log(vec));
+    return static_cast<eT>(chol_fact<ArmaMat<eT>>(X).log_det());
 }
 #endif
 
@@ -42,14 +41,7 @@ statslib_inline
 eT
 log_det(const BlazeMat<eT,To>& X)
 {
-    BlazeMat<eT,To> chol_sig = mat_ops::chol(X);
-    auto vec = blaze::diagonal(chol_sig);
-    eT total = eT(0);
-    for (auto it=vec.cbegin(); it!=vec.cend(); ++it)
-    {
-        total += std::log(*it);
-    }
-    return 2.0*total;
+    return static_cast<eT>(chol_fact<BlazeMat<eT,To>>(X).log_det());
 }
 #endif
 
@@ -59,6 +51,6 @@ statslib_inline
 eT
 log_det(const EigenMat<eT,iTr,iTc>& X)
 {
-    return ( mat_ops::chol(X).diagonal().array().log()*2.0 ).sum();
+    return static_cast<eT>(chol_fact<EigenMat<eT,iTr,iTc>>(X).log_det());
 }
 #endif
@@ -0,0 +1,245 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * for internal use only; used to switch between the different matrix libraries
+ */
+
+//
+// log-sum-exp over all elements, rows or columns, in one pass over the inputs
+
+#ifndef STATS_LOG_SUM_EXP_BLOCK
+    #define STATS_LOG_SUM_EXP_BLOCK ullint_t(4096)
+#endif
+
+// contiguous values, accumulated in blocks of STATS_LOG_SUM_EXP_BLOCK (in parallel when OpenMP is enabled) and
+// merged in block order, so the result does not depend on the number of threads
+
+template<typename eT>
+statslib_inline
+eT
+log_sum_exp_vals(const eT* vals, const ullint_t num_elem)
+{
+    const ullint_t n_blocks = (num_elem + STATS_LOG_SUM_EXP_BLOCK - ullint_t(1)) / STATS_LOG_SUM_EXP_BLOCK;
+
+    std::vector<eT> max_vals(n_blocks, - STLIM<eT>::infinity());
+    std::vector<eT> sum_vals(n_blocks, eT(0));
+
+#ifdef STATS_USE_OPENMP
+    #pragma omp parallel for
+#endif
+    for (ullint_t j=ullint_t(0); j < n_blocks; ++j)
+    {
+        const ullint_t i_end = std::min(num_elem, (j + ullint_t(1))*STATS_LOG_SUM_EXP_BLOCK);
+
+        for (ullint_t i=j*STATS_LOG_SUM_EXP_BLOCK; i < i_end; ++i)
+        {
+            internal::log_sum_exp_update(max_vals[j],sum_vals[j],vals[i]);
+        }
+    }
+
+    eT max_val = - STLIM<eT>::infinity();
+    eT sum_val = eT(0);
+
+    for (ullint_t j=ullint_t(0); j < n_blocks; ++j)
+    {
+        internal::log_sum_exp_combine(max_val,sum_val,max_vals[j],sum_vals[j]);
+    }
+
+    return internal::log_sum_exp_value(max_val,sum_val);
+}
+
+#ifdef STATS_ENABLE_MATRIX_FEATURES
+
+// an n x 1 matrix of row values; column by column within each block of rows, so that the inner loop runs down a 
+// column of a column-major matrix
+
+template<typename mT, typename eT>
+statslib_inline
+mT
+log_sum_exp_rows_compute(const mT& X)
+{
+    const ullint_t n = n_rows(X);
+    const ullint_t K = n_cols(X);
+    const ullint_t n_blocks = (n + STATS_LOG_SUM_EXP_BLOCK - ullint_t(1)) / STATS_LOG_SUM_EXP_BLOCK;
+
+    mT mat_out(n,ullint_t(1));
+
+#ifdef STATS_USE_OPENMP
+    #pragma omp parallel for
+#endif
+    for (ullint_t j=ullint_t(0); j < n_blocks; ++j)
+    {
+        const ullint_t i_begin = j*STATS_LOG_SUM_EXP_BLOCK;
+        const ullint_t n_block = std::min(STATS_LOG_SUM_EXP_BLOCK, n - i_begin);
+
+        std::vector<eT> max_vals(n_block, - STLIM<eT>::infinity());
+        std::vector<eT> sum_vals(n_block, eT(0));
+
+        for (ullint_t k=ullint_t(0); k < K; ++k)
+        {
+            for (ullint_t b=ullint_t(0); b < n_block; ++b)
+            {
+                internal::log_sum_exp_update(max_vals[b],sum_vals[b],static_cast<eT>(X(i_begin + b,k)));
+            }
+        }
+
+        for (ullint_t b=ullint_t(0); b < n_block; ++b)
+        {
+            mat_out(i_begin + b,0) = internal::log_sum_exp_value(max_vals[b],sum_vals[b]);
+        }
+    }
+
+    return mat_out;
+}
+
+// a 1 x K matrix of column values
+
+template<typename mT, typename eT>
+statslib_inline
+mT
+log_sum_exp_cols_compute(const mT& X)
+{
+    const ullint_t n = n_rows(X);
+    const ullint_t K = n_cols(X);
+
+    mT mat_out(ullint_t(1),K);
+
+#ifdef STATS_USE_OPENMP
+    #pragma omp parallel for
+#endif
+    for (ullint_t k=ullint_t(0); k < K; ++k)
+    {
+        eT max_val = - STLIM<eT>::infinity();
+        eT sum_val = eT(0);
+
+        for (ullint_t i=ullint_t(0); i < n; ++i)
+        {
+            internal::log_sum_exp_update(max_val,sum_val,static_cast<eT>(X(i,k)));
+        }
+
+        mat_out(0,k) = internal::log_sum_exp_value(max_val,sum_val);
+    }
+
+    return mat_out;
+}
+
+#endif
+
+//
+
+#ifdef STATS_ENABLE_STDVEC_WRAPPERS
+template<typename eT>
+statslib_inline
+eT
+log_sum_exp(const std::vector<eT>& X)
+{
+    return log_sum_exp_vals(X.data(),X.size());
+}
+#endif
+
+#ifdef STATS_ENABLE_ARMA_WRAPPERS
+template<typename eT>
+statslib_inline
+eT
+log_sum_exp(const ArmaMat<eT>& X)
+{
+    return log_sum_exp_vals(X.memptr(),n_elem(X));
+}
+
+template<typename eT>
+statslib_inline
+ArmaMat<eT>
+log_sum_exp_rows(const ArmaMat<eT>& X)
+{
+    return log_sum_exp_rows_compute<ArmaMat<eT>,eT>(X);
+}
+
+template<typename eT>
+statslib_inline
+ArmaMat<eT>
+log_sum_exp_cols(const ArmaMat<eT>& X)
+{
+    return log_sum_exp_cols_compute<ArmaMat<eT>,eT>(X);
+}
+#endif
+
+#ifdef STATS_ENABLE_BLAZE_WRAPPERS
+template<typename eT, bool To>
+statslib_inline
+eT
+log_sum_exp(const BlazeMat<eT,To>& X)
+{
+    // the rows may be padded; merge the column values
+    const BlazeMat<eT,To> col_vals = log_sum_exp_cols_compute<BlazeMat<eT,To>,eT>(X);
+
+    eT max_val = - STLIM<eT>::infinity();
+    eT sum_val = eT(0);
+
+    for (ullint_t k=ullint_t(0); k < n_cols(X); ++k)
+    {
+        internal::log_sum_exp_update(max_val,sum_val,col_vals(0,k));
+    }
+
+    return internal::log_sum_exp_value(max_val,sum_val);
+}
+
+template<typename eT, bool To>
+statslib_inline
+BlazeMat<eT,To>
+log_sum_exp_rows(const BlazeMat<eT,To>& X)
+{
+    return log_sum_exp_rows_compute<BlazeMat<eT,To>,eT>(X);
+}
+
+template<typename eT, bool To>
+statslib_inline
+BlazeMat<eT,To>
+log_sum_exp_cols(const BlazeMat<eT,To>& X)
+{
+    return log_sum_exp_cols_compute<BlazeMat<eT,To>,eT>(X);
+}
+#endif
+
+#ifdef STATS_ENABLE_EIGEN_WRAPPERS
+template<typename eT, int iTr, int iTc>
+statslib_inline
+eT
+log_sum_exp(const EigenMat<eT,iTr,iTc>& X)
+{
+    return log_sum_exp_vals(X.data(),n_elem(X));
+}
+
+template<typename eT, int iTr, int iTc>
+statslib_inline
+EigenMat<eT,iTr,iTc>
+log_sum_exp_rows(const EigenMat<eT,iTr,iTc>& X)
+{
+    return log_sum_exp_rows_compute<EigenMat<eT,iTr,iTc>,eT>(X);
+}
+
+template<typename eT, int iTr, int iTc>
+statslib_inline
+EigenMat<eT,iTr,iTc>
+log_sum_exp_cols(const EigenMat<eT,iTr,iTc>& X)
+{
+    return log_sum_exp_cols_compute<EigenMat<eT,iTr,iTc>,eT>(X);
+}
+#endif
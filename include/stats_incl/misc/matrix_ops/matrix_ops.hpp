@@ -31,22 +31,27 @@ namespace mat_ops
     #include "n_elem.hpp"
 
     #include "get_mem_ptr.hpp"
+    #include "moments.hpp"
 
     #include "accu.hpp"
     #include "chol.hpp"
+    #include "chol_fact.hpp"
     #include "cumsum.hpp"
     #include "det.hpp"
     #include "exp.hpp"
     #include "eye.hpp"
     #include "fill.hpp"
     #include "get_row.hpp"
+    #include "gumbel_max.hpp"
     #include "inv.hpp"
     #include "log.hpp"
     #include "log_det.hpp"
+    #include "log_sum_exp.hpp"
     #include "mean.hpp"
     #include "quad_form.hpp"
     #include "repmat.hpp"
     #include "resize.hpp"
+    #include "softmax.hpp"
     #include "solve.hpp"
     #include "spacing.hpp"
     #include "sum_absdiff.hpp"
@@ -23,7 +23,7 @@
  */
 
 //
-// vector mean
+// vector mean, from the streaming moments accumulator
 
 #ifdef STATS_ENABLE_STDVEC_WRAPPERS
 template<typename eT>
@@ -31,7 +31,7 @@ statslib_inline
 eT
 mean(const std::vector<eT>& X)
 {
-    return accu(X) / static_cast<eT>(X.size());
+    return moments(X).mean();
 }
 #endif
 
@@ -41,7 +41,7 @@ statslib_inline
 eT
 mean(const ArmaMat<eT>& X)
 {
-    return arma::as_scalar(arma::mean(X));
+    return moments(X).mean();
 }
 #endif
 
@@ -51,7 +51,7 @@ statslib_inline
 eT
 mean(const BlazeMat<eT,To>& X)
 {
-    return accu(X) / static_cast<eT>(n_elem(X));
+    return moments(X).mean();
 }
 #endif
 
@@ -61,6 +61,6 @@ statslib_inline
 eT
 mean(const EigenMat<eT,iTr,iTc>& X)
 {
-    return X.mean();
+    return moments(X).mean();
 }
 #endif
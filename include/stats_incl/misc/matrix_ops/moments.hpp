@@ -0,0 +1,288 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * for internal use only; used to switch between the different matrix libraries
+ */
+
+//
+// streaming central moments, mergeable across threads and chunks
+
+#ifndef STATS_MOMENTS_BLOCK
+    #define STATS_MOMENTS_BLOCK ullint_t(4096)
+#endif
+
+/**
+ * @brief Accumulator for the mean and the second to fourth central moments
+ *
+ * Values are added one at a time with the updates of Welford (1962) and Terriberry (2007), or as arrays; two 
+ * accumulators are combined with the pairwise formulas of Chan, Golub and LeVeque (1979) and Pebay (2008). No 
+ * running sum of squares is kept, so the variance does not suffer cancellation when the mean is large relative to
+ * the spread.
+ */
+
+template<typename eT>
+class moments_acc
+{
+    public:
+        moments_acc();
+
+        void update(const eT x);
+        void update(const eT* vals, const ullint_t num_elem);
+        void merge(const moments_acc<eT>& acc_2);
+
+        ullint_t count() const;
+        eT mean() const;
+
+        // the population variance, or the unbiased (n - 1) form with sample_flag
+
+        eT var(const bool sample_flag = false) const;
+        eT skewness() const;
+
+        // excess kurtosis
+
+        eT kurtosis() const;
+
+    private:
+        ullint_t n;
+        eT mean_val;
+        eT M2;
+        eT M3;
+        eT M4;
+};
+
+template<typename eT>
+moments_acc<eT>::moments_acc()
+    : n(0), mean_val(0), M2(0), M3(0), M4(0)
+{}
+
+template<typename eT>
+statslib_inline
+void
+moments_acc<eT>::update(const eT x)
+{
+    const eT n_1 = static_cast<eT>(n);
+    ++n;
+    const eT n_val = static_cast<eT>(n);
+
+    const eT delta = x - mean_val;
+    const eT delta_n = delta / n_val;
+    const eT delta_n2 = delta_n * delta_n;
+    const eT term_1 = delta * delta_n * n_1;
+
+    mean_val += delta_n;
+    M4 += term_1 * delta_n2 * (n_val*n_val - eT(3)*n_val + eT(3)) + eT(6) * delta_n2 * M2 - eT(4) * delta_n * M3;
+    M3 += term_1 * delta_n * (n_val - eT(2)) - eT(3) * delta_n * M2;
+    M2 += term_1;
+}
+
+// blocks of STATS_MOMENTS_BLOCK values are accumulated separately (in parallel when OpenMP is enabled) and merged
+// in block order, so the result does not depend on the number of threads
+
+template<typename eT>
+statslib_inline
+void
+moments_acc<eT>::update(const eT* vals, const ullint_t num_elem)
+{
+    const ullint_t n_blocks = (num_elem + STATS_MOMENTS_BLOCK - ullint_t(1)) / STATS_MOMENTS_BLOCK;
+
+    std::vector<moments_acc<eT>> block_accs(n_blocks);
+
+#ifdef STATS_USE_OPENMP
+    #pragma omp parallel for
+#endif
+    for (ullint_t j=ullint_t(0); j < n_blocks; ++j)
+    {
+        const ullint_t i_end = std::min(num_elem, (j + ullint_t(1))*STATS_MOMENTS_BLOCK);
+
+        for (ullint_t i=j*STATS_MOMENTS_BLOCK; i < i_end; ++i)
+        {
+            block_accs[j].update(vals[i]);
+        }
+    }
+
+    for (ullint_t j=ullint_t(0); j < n_blocks; ++j)
+    {
+        merge(block_accs[j]);
+    }
+}
+
+template<typename eT>
+statslib_inline
+void
+moments_acc<eT>::merge(const moments_acc<eT>& acc_2)
+{
+    if (acc_2.n == ullint_t(0)) {
+        return;
+    }
+
+    if (n == ullint_t(0)) {
+        *this = acc_2;
+        return;
+    }
+
+    const eT n_a = static_cast<eT>(n);
+    const eT n_b = static_cast<eT>(acc_2.n);
+    const eT n_val = n_a + n_b;
+
+    const eT delta = acc_2.mean_val - mean_val;
+    const eT delta2 = delta * delta;
+    const eT delta_n = delta / n_val;
+
+    const eT M2_new = M2 + acc_2.M2 + delta * delta_n * n_a * n_b;
+    const eT M3_new = M3 + acc_2.M3 + delta2 * delta_n * n_a * n_b * (n_a - n_b) / n_val 
+                        + eT(3) * delta_n * (n_a * acc_2.M2 - n_b * M2);
+    const eT M4_new = M4 + acc_2.M4 + delta2 * delta_n * delta_n * n_a * n_b * (n_a*n_a - n_a*n_b + n_b*n_b) / n_val
+                        + eT(6) * delta_n * delta_n * (n_a*n_a * acc_2.M2 + n_b*n_b * M2) 
+                        + eT(4) * delta_n * (n_a * acc_2.M3 - n_b * M3);
+
+    n += acc_2.n;
+    mean_val += delta_n * n_b;
+    M2 = M2_new;
+    M3 = M3_new;
+    M4 = M4_new;
+}
+
+template<typename eT>
+statslib_inline
+ullint_t
+moments_acc<eT>::count()
+const
+{
+    return n;
+}
+
+template<typename eT>
+statslib_inline
+eT
+moments_acc<eT>::mean()
+const
+{
+    return n > ullint_t(0) ? mean_val : STLIM<eT>::quiet_NaN();
+}
+
+template<typename eT>
+statslib_inline
+eT
+moments_acc<eT>::var(const bool sample_flag)
+const
+{
+    const ullint_t n_denom = sample_flag ? n - ullint_t(1) : n;
+
+    return n > ullint_t(sample_flag) ? M2 / static_cast<eT>(n_denom) : STLIM<eT>::quiet_NaN();
+}
+
+template<typename eT>
+statslib_inline
+eT
+moments_acc<eT>::skewness()
+const
+{
+    return n > ullint_t(0) ? std::sqrt(static_cast<eT>(n)) * M3 / std::pow(M2, eT(1.5)) : STLIM<eT>::quiet_NaN();
+}
+
+template<typename eT>
+statslib_inline
+eT
+moments_acc<eT>::kurtosis()
+const
+{
+    return n > ullint_t(0) ? static_cast<eT>(n) * M4 / (M2 * M2) - eT(3) : STLIM<eT>::quiet_NaN();
+}
+
+//
+
+#ifdef STATS_ENABLE_STDVEC_WRAPPERS
+template<typename eT>
+statslib_inline
+moments_acc<eT>
+moments(const std::vector<eT>& X)
+{
+    moments_acc<eT> acc;
+    acc.update(X.data(),X.size());
+
+    return acc;
+}
+#endif
+
+#ifdef STATS_ENABLE_ARMA_WRAPPERS
+template<typename eT>
+statslib_inline
+moments_acc<eT>
+moments(const ArmaMat<eT>& X)
+{
+    moments_acc<eT> acc;
+    acc.update(X.memptr(),n_elem(X));
+
+    return acc;
+}
+#endif
+
+#ifdef STATS_ENABLE_BLAZE_WRAPPERS
+template<typename eT, bool To>
+statslib_inline
+moments_acc<eT>
+moments(const BlazeMat<eT,To>& X)
+{
+    // the rows may be padded; accumulate blocks of rows and merge them in order
+    const ullint_t n = n_rows(X);
+    const ullint_t n_blocks = (n + STATS_MOMENTS_BLOCK - ullint_t(1)) / STATS_MOMENTS_BLOCK;
+
+    std::vector<moments_acc<eT>> block_accs(n_blocks);
+
+#ifdef STATS_USE_OPENMP
+    #pragma omp parallel for
+#endif
+    for (ullint_t j=ullint_t(0); j < n_blocks; ++j)
+    {
+        const ullint_t i_end = std::min(n, (j + ullint_t(1))*STATS_MOMENTS_BLOCK);
+
+        for (ullint_t i=j*STATS_MOMENTS_BLOCK; i < i_end; ++i)
+        {
+            for (ullint_t k=ullint_t(0); k < n_cols(X); ++k)
+            {
+                block_accs[j].update(X(i,k));
+            }
+        }
+    }
+
+    moments_acc<eT> acc;
+
+    for (ullint_t j=ullint_t(0); j < n_blocks; ++j)
+    {
+        acc.merge(block_accs[j]);
+    }
+
+    return acc;
+}
+#endif
+
+#ifdef STATS_ENABLE_EIGEN_WRAPPERS
+template<typename eT, int iTr, int iTc>
+statslib_inline
+moments_acc<eT>
+moments(const EigenMat<eT,iTr,iTc>& X)
+{
+    moments_acc<eT> acc;
+    acc.update(X.data(),n_elem(X));
+
+    return acc;
+}
+#endif
@@ -23,7 +23,8 @@
  */
 
 //
-// x'Ax or x'(A^{-1})x, where x is (n x 1) and A is (n x n)
+// x'Ax or x'(A^{-1})x, where x is (n x 1) and A is (n x n); with inv_A, A is taken to be symmetric positive definite
+// and x'(A^{-1})x = ||L^{-1}x||^2 is formed from its Cholesky factor
 
 #ifdef STATS_ENABLE_ARMA_WRAPPERS
 template<typename eT>
@@ -32,7 +33,7 @@ double
 quad_form(const ArmaMat<eT>& x, const ArmaMat<eT>& A, const bool inv_A = true)
 {
     if (inv_A) {
-        return static_cast<double>( arma::dot(x,arma::solve(A,x)) );
+        return chol_fact<ArmaMat<eT>>(A).quad_form(x);
     } else {
         return static_cast<double>( arma::dot(x,A*x) );
     }
@@ -46,9 +47,7 @@ double
 quad_form(const vT& x, const mT& A, const bool inv_A = true)
 {
     if (inv_A) {
-        // return static_cast<double>( blaze::dot(x, blaze::inv(A)*x) );
-        mT res = blaze::trans(x) * blaze::inv(A) * x;
-        return static_cast<double>( res(0,0) );
+        return chol_fact<mT>(A).quad_form(x);
     } else {
         mT res = blaze::trans(x) * A * x;
         return static_cast<double>( res(0,0) );
@@ -63,8 +62,7 @@ double
 quad_form(const vT& x, const mT& A, const bool inv_A = true)
 {
     if (inv_A) {
-        const vT Ax = A.colPivHouseholderQr().solve(x);
-        return static_cast<double>( (x.transpose() * Ax)(0) );
+        return chol_fact<mT>(A).quad_form(x);
     } else {
         return static_cast<double>( (x.transpose() * A * x)(0) );
     }
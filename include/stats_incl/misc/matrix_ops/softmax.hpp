@@ -0,0 +1,199 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * for internal use only; used to switch between the different matrix libraries
+ */
+
+//
+// softmax over all elements, rows or columns: exp(x - log_sum_exp(x))
+
+template<typename eT>
+statslib_inline
+void
+softmax_vals(const eT* vals, eT* vals_out, const ullint_t num_elem)
+{
+    const eT lse_val = log_sum_exp_vals(vals,num_elem);
+
+#ifdef STATS_USE_OPENMP
+    #pragma omp parallel for
+#endif
+    for (ullint_t j=ullint_t(0); j < num_elem; ++j)
+    {
+        vals_out[j] = std::exp(vals[j] - lse_val);
+    }
+}
+
+#ifdef STATS_ENABLE_MATRIX_FEATURES
+
+template<typename mT>
+statslib_inline
+mT
+softmax_rows_compute(const mT& X, const mT& lse_vals)
+{
+    mT mat_out = X;
+
+#ifdef STATS_USE_OPENMP
+    #pragma omp parallel for
+#endif
+    for (ullint_t k=ullint_t(0); k < n_cols(X); ++k)
+    {
+        for (ullint_t i=ullint_t(0); i < n_rows(X); ++i)
+        {
+            mat_out(i,k) = std::exp(X(i,k) - lse_vals(i,0));
+        }
+    }
+
+    return mat_out;
+}
+
+template<typename mT>
+statslib_inline
+mT
+softmax_cols_compute(const mT& X, const mT& lse_vals)
+{
+    mT mat_out = X;
+
+#ifdef STATS_USE_OPENMP
+    #pragma omp parallel for
+#endif
+    for (ullint_t k=ullint_t(0); k < n_cols(X); ++k)
+    {
+        for (ullint_t i=ullint_t(0); i < n_rows(X); ++i)
+        {
+            mat_out(i,k) = std::exp(X(i,k) - lse_vals(0,k));
+        }
+    }
+
+    return mat_out;
+}
+
+#endif
+
+//
+
+#ifdef STATS_ENABLE_STDVEC_WRAPPERS
+template<typename eT>
+statslib_inline
+std::vector<eT>
+softmax(const std::vector<eT>& X)
+{
+    std::vector<eT> mat_out(X.size());
+    softmax_vals(X.data(),mat_out.data(),X.size());
+
+    return mat_out;
+}
+#endif
+
+#ifdef STATS_ENABLE_ARMA_WRAPPERS
+template<typename eT>
+statslib_inline
+ArmaMat<eT>
+softmax(const ArmaMat<eT>& X)
+{
+    ArmaMat<eT> mat_out(X.n_rows,X.n_cols);
+    softmax_vals(X.memptr(),mat_out.memptr(),n_elem(X));
+
+    return mat_out;
+}
+
+template<typename eT>
+statslib_inline
+ArmaMat<eT>
+softmax_rows(const ArmaMat<eT>& X)
+{
+    return softmax_rows_compute(X,log_sum_exp_rows(X));
+}
+
+template<typename eT>
+statslib_inline
+ArmaMat<eT>
+softmax_cols(const ArmaMat<eT>& X)
+{
+    return softmax_cols_compute(X,log_sum_exp_cols(X));
+}
+#endif
+
+#ifdef STATS_ENABLE_BLAZE_WRAPPERS
+template<typename eT, bool To>
+statslib_inline
+BlazeMat<eT,To>
+softmax(const BlazeMat<eT,To>& X)
+{
+    const eT lse_val = log_sum_exp(X);
+
+    BlazeMat<eT,To> mat_out = X;
+
+    for (ullint_t i=ullint_t(0); i < n_rows(X); ++i)
+    {
+        for (ullint_t k=ullint_t(0); k < n_cols(X); ++k)
+        {
+            mat_out(i,k) = std::exp(X(i,k) - lse_val);
+        }
+    }
+
+    return mat_out;
+}
+
+template<typename eT, bool To>
+statslib_inline
+BlazeMat<eT,To>
+softmax_rows(const BlazeMat<eT,To>& X)
+{
+    return softmax_rows_compute(X,log_sum_exp_rows(X));
+}
+
+template<typename eT, bool To>
+statslib_inline
+BlazeMat<eT,To>
+softmax_cols(const BlazeMat<eT,To>& X)
+{
+    return softmax_cols_compute(X,log_sum_exp_cols(X));
+}
+#endif
+
+#ifdef STATS_ENABLE_EIGEN_WRAPPERS
+template<typename eT, int iTr, int iTc>
+statslib_inline
+EigenMat<eT,iTr,iTc>
+softmax(const EigenMat<eT,iTr,iTc>& X)
+{
+    EigenMat<eT,iTr,iTc> mat_out(X.rows(),X.cols());
+    softmax_vals(X.data(),mat_out.data(),n_elem(X));
+
+    return mat_out;
+}
+
+template<typename eT, int iTr, int iTc>
+statslib_inline
+EigenMat<eT,iTr,iTc>
+softmax_rows(const EigenMat<eT,iTr,iTc>& X)
+{
+    return softmax_rows_compute(X,log_sum_exp_rows(X));
+}
+
+template<typename eT, int iTr, int iTc>
+statslib_inline
+EigenMat<eT,iTr,iTc>
+softmax_cols(const EigenMat<eT,iTr,iTc>& X)
+{
+    return softmax_cols_compute(X,log_sum_exp_cols(X));
+}
+#endif
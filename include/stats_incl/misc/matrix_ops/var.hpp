@@ -23,7 +23,7 @@
  */
 
 //
-// vector variance
+// vector variance, from the streaming moments accumulator
 
 #ifdef STATS_ENABLE_STDVEC_WRAPPERS
 template<typename eT>
@@ -31,9 +31,7 @@ statslib_inline
 eT
 var(const std::vector<eT>& X)
 {
-    eT mean_val = mean(X);
-    eT sq_val = sqaccu(X) / static_cast<eT>(X.size());
-    return sq_val - mean_val*mean_val;
+    return moments(X).var();
 }
 #endif
 
@@ -43,7 +41,10 @@ statslib_inline
 eT
 var(const ArmaMat<eT>& X)
 {
-    return arma::as_scalar(arma::var(X));
+    // the (n - 1) form, as arma::var, which also returns 0 for a single element
+    const moments_acc<eT> acc = moments(X);
+
+    return acc.count() == ullint_t(1) ? eT(0) : acc.var(true);
 }
 #endif
 
@@ -53,9 +54,7 @@ statslib_inline
 eT
 var(const BlazeMat<eT,To>& X)
 {
-    eT mean_val = mean(X);
-    eT sq_val = sqaccu(X) / static_cast<eT>(n_elem(X));
-    return sq_val - mean_val*mean_val;
+    return moments(X).var();
 }
 #endif
 
@@ -65,8 +64,6 @@ statslib_inline
 eT
 var(const EigenMat<eT,iTr,iTc>& X)
 {
-    eT mean_val = mean(X);
-    eT sq_val = sqaccu(X) / static_cast<eT>(n_elem(X));
-    return sq_val - mean_val*mean_val;
+    return moments(X).var();
 }
 #endif
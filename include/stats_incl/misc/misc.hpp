@@ -24,5 +24,6 @@
 #include "internal_fns/internal_fns.hpp"
 #include "matrix_ops/matrix_ops.hpp"
 #include "sanity_checks/sanity_checks.hpp"
+#include "special_fns/special_fns.hpp"
 
 #endif
@@ -43,4 +43,15 @@ noexcept
                 true );
 }
 
+template<typename T>
+statslib_constexpr
+bool
+prob_val_check(const T prob_val, const bool log_p)
+noexcept
+{
+    return( log_p ? \
+                !GCINT::is_nan(prob_val) && prob_val <= T(0) :
+                prob_val_check(prob_val) );
+}
+
 }
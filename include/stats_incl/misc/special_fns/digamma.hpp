@@ -0,0 +1,83 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * digamma function
+ */
+
+#ifndef _statslib_digamma_HPP
+#define _statslib_digamma_HPP
+
+namespace internal
+{
+
+// asymptotic expansion psi(x) = log(x) - 1/(2x) - sum_k B_{2k} / (2k x^{2k}), accurate to double precision for x >= 10
+
+template<typename T>
+statslib_constexpr
+T
+digamma_asymp(const T x, const T w)
+noexcept
+{   // w = 1/x^2
+    return( - T(0.5) / x - w * ( T(1)/T(12) - w * ( T(1)/T(120) - w * ( T(1)/T(252) - w * ( T(1)/T(240) 
+                - w * ( T(1)/T(132) - w * ( T(691)/T(32760) - w / T(12) ) ) ) ) ) ) );
+}
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+// x < 1/2 is reflected, psi(x) = psi(1 - x) - pi / tan(pi x), and arguments below 10 are raised through
+// psi(x) = psi(x + 1) - 1/x with a fixed number of masked steps; poles (x = 0, -1, -2, ...) are returned as NaN.
+// The input and output may alias.
+
+template<typename T>
+statslib_inline
+void
+digamma_vec(const T* x_vals, T* vals_out, const ullint_t num_elem)
+{
+    for (ullint_t j=ullint_t(0); j < num_elem; ++j)
+    {
+        const T x = x_vals[j];
+        const bool x_refl = x < T(0.5);
+
+        T x_s = x_refl ? T(1) - x : x;
+        T shift_val = T(0);
+
+        for (int k=0; k < 10; ++k)
+        {
+            const bool x_low = x_s < T(10);
+
+            shift_val -= x_low ? T(1) / x_s : T(0);
+            x_s += x_low ? T(1) : T(0);
+        }
+
+        const T psi_val = std::log(x_s) + digamma_asymp(x_s, T(1) / (x_s*x_s)) + shift_val;
+        const T x_frac = x - std::floor(x);
+
+        vals_out[j] = !x_refl ? psi_val :
+                      x_frac == T(0) ? STLIM<T>::quiet_NaN() :
+                      psi_val - T(GCEM_PI) / std::tan(T(GCEM_PI) * x_frac);
+    }
+}
+
+#endif
+
+}
+
+#endif
@@ -0,0 +1,98 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * batch evaluation of discrete densities over integer counts
+ */
+
+#ifndef _statslib_discrete_pmf_HPP
+#define _statslib_discrete_pmf_HPP
+
+namespace internal
+{
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+// log_dens_fn(x) returns the log-density at an integer count x in [0, x_max]; counts outside the support are
+// given zero density. When a block is longer than the cache, densities at counts below
+// STATS_DISCRETE_PMF_CACHE_SIZE are computed on first use and kept in a direct-mapped table indexed by the count,
+// so that repeated small counts cost one lookup. Each block keeps its own table.
+
+template<typename eT, typename rT, typename LogDensFn>
+statslib_inline
+void
+discrete_pmf_block(const eT* vals_in, const LogDensFn& log_dens_fn, const llint_t x_max, const bool log_form, 
+                   rT* vals_out, const ullint_t num_elem)
+{
+    const rT zero_val = log_form ? - STLIM<rT>::infinity() : rT(0);
+
+    const llint_t n_cache = num_elem <= ullint_t(STATS_DISCRETE_PMF_CACHE_SIZE) ? llint_t(0) :
+                            x_max < llint_t(STATS_DISCRETE_PMF_CACHE_SIZE) ? x_max + 1 : 
+                                llint_t(STATS_DISCRETE_PMF_CACHE_SIZE);
+
+    rT cache_vals[STATS_DISCRETE_PMF_CACHE_SIZE + 1];
+    bool cache_set[STATS_DISCRETE_PMF_CACHE_SIZE + 1] = { false };
+
+    for (ullint_t j=ullint_t(0); j < num_elem; ++j)
+    {
+        const llint_t x_j = static_cast<llint_t>(vals_in[j]);
+
+        if (x_j < llint_t(0) || x_j > x_max) {
+            vals_out[j] = zero_val;
+        } else if (x_j < n_cache) {
+            if (!cache_set[x_j]) {
+                cache_vals[x_j] = log_form ? log_dens_fn(x_j) : std::exp(log_dens_fn(x_j));
+                cache_set[x_j] = true;
+            }
+
+            vals_out[j] = cache_vals[x_j];
+        } else {
+            vals_out[j] = log_form ? log_dens_fn(x_j) : std::exp(log_dens_fn(x_j));
+        }
+    }
+}
+
+// blocks of STATS_DISCRETE_PMF_BLOCK counts are evaluated in parallel when OpenMP is enabled
+
+template<typename eT, typename rT, typename LogDensFn>
+statslib_inline
+void
+discrete_pmf_vec(const eT* vals_in, const LogDensFn& log_dens_fn, const llint_t x_max, const bool log_form, 
+                 rT* vals_out, const ullint_t num_elem)
+{
+    const ullint_t n_blocks = (num_elem + STATS_DISCRETE_PMF_BLOCK - ullint_t(1)) / STATS_DISCRETE_PMF_BLOCK;
+
+#ifdef STATS_USE_OPENMP
+    #pragma omp parallel for
+#endif
+    for (ullint_t j=ullint_t(0); j < n_blocks; ++j)
+    {
+        const ullint_t i_begin = j*STATS_DISCRETE_PMF_BLOCK;
+        const ullint_t n_block = std::min(STATS_DISCRETE_PMF_BLOCK, num_elem - i_begin);
+
+        discrete_pmf_block(vals_in + i_begin,log_dens_fn,x_max,log_form,vals_out + i_begin,n_block);
+    }
+}
+
+#endif
+
+}
+
+#endif
@@ -0,0 +1,150 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * regularized incomplete beta function
+ */
+
+#ifndef _statslib_incomplete_beta_HPP
+#define _statslib_incomplete_beta_HPP
+
+namespace internal
+{
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+// I_x(a,b) for fixed a, b > 0 and arrays of x and y = 1 - x, the latter passed separately so that callers can form
+// it without cancellation. For x < (a+1)/(a+b+2), I_x(a,b) = x^a y^b / (a B(a,b)) K_x(a,b), with K the continued
+// fraction of Abramowitz and Stegun 26.5.8 (modified Lentz); otherwise 1 - I_x(a,b) = I_y(b,a) is computed the same way,
+// so that the tail returned is never formed by subtracting from one when it is the smaller of the two.
+//
+// The lanes of a block of STATS_SPECIAL_FN_LANES elements may use different orientations, (a,b,x) or (b,a,y), and
+// run the continued fraction in lockstep with masked convergence. log B(a,b) is computed once. Unconverged lanes
+// and NaN inputs are returned as NaN. The inputs and the output may alias.
+
+template<typename T>
+statslib_inline
+void
+incomplete_beta_vec(const T a_par, const T b_par, const T* x_vals, const T* y_vals, const bool lower_tail, 
+                    T* vals_out, const ullint_t num_elem)
+{
+    const int n_lanes = STATS_SPECIAL_FN_LANES;
+    const T tiny_val = T(10) * STLIM<T>::min();
+    const T eps_val = STLIM<T>::epsilon();
+
+    const T lbeta_ab = std::lgamma(a_par) + std::lgamma(b_par) - std::lgamma(a_par + b_par);
+    const T x_switch = (a_par + T(1)) / (a_par + b_par + T(2));
+
+    const ullint_t n_blocks = (num_elem + ullint_t(n_lanes) - ullint_t(1)) / ullint_t(n_lanes);
+
+#ifdef STATS_USE_OPENMP
+    #pragma omp parallel for
+#endif
+    for (ullint_t b=ullint_t(0); b < n_blocks; ++b)
+    {
+        const ullint_t j_start = b * ullint_t(n_lanes);
+        const int n_active_lanes = static_cast<int>( std::min(ullint_t(n_lanes), num_elem - j_start) );
+
+        T p_l[STATS_SPECIAL_FN_LANES], q_l[STATS_SPECIAL_FN_LANES], x_l[STATS_SPECIAL_FN_LANES];
+        T front_val[STATS_SPECIAL_FN_LANES], h_val[STATS_SPECIAL_FN_LANES];
+        T c_val[STATS_SPECIAL_FN_LANES], d_val[STATS_SPECIAL_FN_LANES];
+        bool swapped[STATS_SPECIAL_FN_LANES], active[STATS_SPECIAL_FN_LANES];
+
+        int n_cf = 0;
+
+        // padding lanes are set to x = 0, which converges at once
+
+        for (int l=0; l < n_lanes; ++l)
+        {
+            const T x = l < n_active_lanes ? x_vals[j_start + l] : T(0);
+            const T y = l < n_active_lanes ? y_vals[j_start + l] : T(1);
+
+            swapped[l] = !(x < x_switch);
+            p_l[l] = swapped[l] ? b_par : a_par;
+            q_l[l] = swapped[l] ? a_par : b_par;
+            x_l[l] = swapped[l] ? y : x;
+
+            front_val[l] = std::exp(a_par*std::log(x) + b_par*std::log(y) - lbeta_ab) / p_l[l];
+
+            const T d_0 = T(1) - (p_l[l] + q_l[l]) * x_l[l] / (p_l[l] + T(1));
+
+            c_val[l] = T(1);
+            d_val[l] = T(1) / (std::abs(d_0) < tiny_val ? tiny_val : d_0);
+            h_val[l] = d_val[l];
+            active[l] = x_l[l] > T(0);
+
+            n_cf += active[l];
+        }
+
+        // each iteration applies the even and the odd step of the fraction
+
+        for (int m=1; n_cf > 0 && m <= STATS_SPECIAL_FN_MAX_ITER; ++m)
+        {
+            n_cf = 0;
+
+            const T m_r = T(m);
+
+            for (int l=0; l < n_lanes; ++l)
+            {
+                const T p = p_l[l], q = q_l[l], x = x_l[l];
+
+                const T aa_even = m_r * (q - m_r) * x / ((p + T(2)*m_r - T(1)) * (p + T(2)*m_r));
+
+                T d_new = T(1) + aa_even * d_val[l];
+                T c_new = T(1) + aa_even / c_val[l];
+
+                d_new = T(1) / (std::abs(d_new) < tiny_val ? tiny_val : d_new);
+                c_new = std::abs(c_new) < tiny_val ? tiny_val : c_new;
+
+                const T h_even = h_val[l] * d_new * c_new;
+
+                const T aa_odd = - (p + m_r) * (p + q + m_r) * x / ((p + T(2)*m_r) * (p + T(1) + T(2)*m_r));
+
+                d_new = T(1) + aa_odd * d_new;
+                c_new = T(1) + aa_odd / c_new;
+
+                d_new = T(1) / (std::abs(d_new) < tiny_val ? tiny_val : d_new);
+                c_new = std::abs(c_new) < tiny_val ? tiny_val : c_new;
+
+                const T delta_val = d_new * c_new;
+
+                d_val[l] = active[l] ? d_new : d_val[l];
+                c_val[l] = active[l] ? c_new : c_val[l];
+                h_val[l] = active[l] ? h_even * delta_val : h_val[l];
+                active[l] = active[l] && std::abs(delta_val - T(1)) > eps_val;
+
+                n_cf += active[l];
+            }
+        }
+
+        for (int l=0; l < n_active_lanes; ++l)
+        {
+            const T i_val = active[l] ? STLIM<T>::quiet_NaN() : front_val[l] * h_val[l];
+
+            vals_out[j_start + l] = (lower_tail != swapped[l]) ? i_val : T(1) - i_val;
+        }
+    }
+}
+
+#endif
+
+}
+
+#endif
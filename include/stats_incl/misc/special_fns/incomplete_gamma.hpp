@@ -0,0 +1,177 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * regularized incomplete gamma functions
+ */
+
+#ifndef _statslib_incomplete_gamma_HPP
+#define _statslib_incomplete_gamma_HPP
+
+namespace internal
+{
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+// P(a,z) and Q(a,z) = 1 - P(a,z) for a fixed a > 0 and an array of z > 0. P comes from the series
+// sum_{n >= 0} z^n / ((a+1) ... (a+n)) and, for z > a + 1 and z > a + 2 sqrt(a), Q comes from the Legendre
+// continued fraction (modified Lentz); the other tail is one minus the first.
+//
+// Elements are processed in blocks of STATS_SPECIAL_FN_LANES: the series and the continued fraction each advance
+// all of their lanes in lockstep, a lane dropping out of the update once it has converged, until every lane has
+// converged or the iteration cap is reached. Unconverged lanes, and NaN inputs, are returned as NaN. The terms
+// of the prefactor exp(-z) z^a / Gamma(a) that depend only on a are computed once. The input and output may alias.
+
+template<typename T>
+statslib_inline
+void
+incomplete_gamma_vec(const T a_par, const T* z_vals, const bool lower_tail, T* vals_out, const ullint_t num_elem)
+{
+    const int n_lanes = STATS_SPECIAL_FN_LANES;
+    const T tiny_val = T(10) * STLIM<T>::min();
+    const T eps_val = STLIM<T>::epsilon();
+
+    // log prefactor: a log(z) - z - lgamma(a), or, for a >= 32, the form used by pgamma without the O(a eps) cancellation
+
+    const bool a_large = a_par >= T(32);
+    const T lgamma_a = a_large ? T(0) : std::lgamma(a_par);
+    const T front_a = a_large ? T(0.5)*std::log(a_par) - T(0.5)*T(GCEM_LOG_2PI) - lgamma_stirling_err(a_par) : T(0);
+    const T cf_bound = a_par + std::max(T(1), T(2)*std::sqrt(a_par));
+
+    const ullint_t n_blocks = (num_elem + ullint_t(n_lanes) - ullint_t(1)) / ullint_t(n_lanes);
+
+#ifdef STATS_USE_OPENMP
+    #pragma omp parallel for
+#endif
+    for (ullint_t b=ullint_t(0); b < n_blocks; ++b)
+    {
+        const ullint_t j_start = b * ullint_t(n_lanes);
+        const int n_active_lanes = static_cast<int>( std::min(ullint_t(n_lanes), num_elem - j_start) );
+
+        T z[STATS_SPECIAL_FN_LANES], front_val[STATS_SPECIAL_FN_LANES], res_val[STATS_SPECIAL_FN_LANES];
+        T term_val[STATS_SPECIAL_FN_LANES], c_val[STATS_SPECIAL_FN_LANES], d_val[STATS_SPECIAL_FN_LANES];
+        bool use_cf[STATS_SPECIAL_FN_LANES], active[STATS_SPECIAL_FN_LANES];
+
+        // padding lanes are set to z = 0, which converges at once
+
+        int n_series = 0, n_cf = 0;
+
+        for (int l=0; l < n_lanes; ++l)
+        {
+            z[l] = l < n_active_lanes ? z_vals[j_start + l] : T(0);
+            use_cf[l] = z[l] > cf_bound;
+
+            // log(1 + d) with d = (z - a)/a; below d = -1/2, 1 + d is not recovered accurately from d
+
+            const T d_z = (z[l] - a_par) / a_par;
+            const T log1p_d = d_z < - T(0.5) ? std::log(z[l] / a_par) : std::log1p(d_z);
+
+            front_val[l] = a_large ? - a_par*(d_z - log1p_d) + front_a : a_par*std::log(z[l]) - z[l] - lgamma_a;
+
+            n_series += !use_cf[l];
+            n_cf += use_cf[l];
+        }
+
+        // series for P: lanes with z <= cf_bound
+
+        for (int l=0; l < n_lanes; ++l)
+        {
+            term_val[l] = T(1);
+            res_val[l] = T(1);
+            active[l] = !use_cf[l] && z[l] > T(0);
+        }
+
+        for (int iter=1; n_series > 0 && iter <= STATS_SPECIAL_FN_MAX_ITER; ++iter)
+        {
+            n_series = 0;
+
+            for (int l=0; l < n_lanes; ++l)
+            {
+                const T term_new = term_val[l] * z[l] / (a_par + T(iter));
+
+                term_val[l] = active[l] ? term_new : term_val[l];
+                res_val[l] = active[l] ? res_val[l] + term_new : res_val[l];
+                active[l] = active[l] && term_new > eps_val * res_val[l];
+
+                n_series += active[l];
+            }
+        }
+
+        for (int l=0; l < n_lanes; ++l)
+        {
+            res_val[l] = use_cf[l] ? T(0) : 
+                         active[l] ? STLIM<T>::quiet_NaN() : std::exp(front_val[l]) * res_val[l] / a_par;
+        }
+
+        // continued fraction for Q: lanes with z > cf_bound; term_val holds the Lentz product h
+
+        for (int l=0; l < n_lanes; ++l)
+        {
+            const T b_0 = z[l] + T(1) - a_par;
+
+            c_val[l] = T(1) / tiny_val;
+            d_val[l] = T(1) / b_0;
+            term_val[l] = d_val[l];
+            active[l] = use_cf[l];
+        }
+
+        for (int iter=1; n_cf > 0 && iter <= STATS_SPECIAL_FN_MAX_ITER; ++iter)
+        {
+            n_cf = 0;
+
+            const T a_n = - T(iter) * (T(iter) - a_par);
+
+            for (int l=0; l < n_lanes; ++l)
+            {
+                const T b_n = z[l] + T(2*iter + 1) - a_par;
+
+                T d_new = a_n * d_val[l] + b_n;
+                T c_new = b_n + a_n / c_val[l];
+
+                d_new = std::abs(d_new) < tiny_val ? tiny_val : d_new;
+                c_new = std::abs(c_new) < tiny_val ? tiny_val : c_new;
+                d_new = T(1) / d_new;
+
+                const T delta_val = d_new * c_new;
+
+                d_val[l] = active[l] ? d_new : d_val[l];
+                c_val[l] = active[l] ? c_new : c_val[l];
+                term_val[l] = active[l] ? term_val[l] * delta_val : term_val[l];
+                active[l] = active[l] && std::abs(delta_val - T(1)) > eps_val;
+
+                n_cf += active[l];
+            }
+        }
+
+        for (int l=0; l < n_active_lanes; ++l)
+        {
+            const T q_val = active[l] ? STLIM<T>::quiet_NaN() : std::exp(front_val[l]) * term_val[l];
+
+            vals_out[j_start + l] = use_cf[l] ? (lower_tail ? T(1) - q_val : q_val) :
+                                                (lower_tail ? res_val[l] : T(1) - res_val[l]);
+        }
+    }
+}
+
+#endif
+
+}
+
+#endif
@@ -0,0 +1,101 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * log-gamma function
+ */
+
+#ifndef _statslib_lgamma_HPP
+#define _statslib_lgamma_HPP
+
+namespace internal
+{
+
+// lgamma(a) - (a - 1/2) log(a) + a - log(2 pi)/2: the Stirling series for a >= 32, and directly from lgamma below
+
+template<typename T>
+statslib_constexpr
+T
+lgamma_stirling_err(const T a_par)
+noexcept
+{
+    return( a_par < T(32) ? \
+                stmath::lgamma(a_par) - (a_par - T(0.5))*stmath::log(a_par) + a_par - T(0.5)*T(GCEM_LOG_2PI) :
+            T(1) / (T(12)*a_par) - T(1) / (T(360)*a_par*a_par*a_par) 
+                + T(1) / (T(1260)*stmath::pow(a_par,5)) - T(1) / (T(1680)*stmath::pow(a_par,7)) );
+}
+
+// Lanczos approximation (g = 7, n = 9) for x >= 1/2, written for x - 1; the term (x - 1/2) log(t) - t
+// is rearranged so that it does not overflow before the result does
+
+template<typename T>
+statslib_constexpr
+T
+lgamma_lanczos_sum(const T x_m1)
+noexcept
+{
+    return( T(0.99999999999980993) + T(676.5203681218851) / (x_m1 + T(1)) - T(1259.1392167224028) / (x_m1 + T(2))
+            + T(771.32342877765313) / (x_m1 + T(3)) - T(176.61502916214059) / (x_m1 + T(4))
+            + T(12.507343278686905) / (x_m1 + T(5)) - T(0.13857109526572012) / (x_m1 + T(6))
+            + T(9.9843695780195716e-6) / (x_m1 + T(7)) + T(1.5056327351493116e-7) / (x_m1 + T(8)) );
+}
+
+template<typename T>
+statslib_inline
+T
+lgamma_lanczos(const T x)
+noexcept
+{
+    return( T(0.5)*T(GCEM_LOG_2PI) + (x - T(0.5))*(std::log(x + T(6.5)) - T(1)) - T(7)
+            + std::log(lgamma_lanczos_sum(x - T(1))) );
+}
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+// lgamma for 0 < x < Inf, through lgamma(x) = lgamma(x+1) - log(x) below 1/2; other inputs (poles, negative
+// values, NaN and Inf) are passed to std::lgamma in a second pass, so the input and output must not alias.
+
+template<typename T>
+statslib_inline
+void
+lgamma_vec(const T* x_vals, T* vals_out, const ullint_t num_elem)
+{
+    for (ullint_t j=ullint_t(0); j < num_elem; ++j)
+    {
+        const T x = x_vals[j];
+        const bool x_small = x < T(0.5);
+
+        vals_out[j] = lgamma_lanczos(x_small ? x + T(1) : x) - (x_small ? std::log(x) : T(0));
+    }
+
+    for (ullint_t j=ullint_t(0); j < num_elem; ++j)
+    {
+        if (!(x_vals[j] > T(0)) || GCINT::is_posinf(x_vals[j]))
+        {
+            vals_out[j] = std::lgamma(x_vals[j]);
+        }
+    }
+}
+
+#endif
+
+}
+
+#endif
@@ -0,0 +1,114 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * log-factorial function
+ */
+
+#ifndef _statslib_log_factorial_HPP
+#define _statslib_log_factorial_HPP
+
+// log(n!) is tabulated at compile time for n = 0, ..., STATS_LOG_FACTORIAL_TABLE_MAX
+
+#ifndef STATS_LOG_FACTORIAL_TABLE_MAX
+    #define STATS_LOG_FACTORIAL_TABLE_MAX 4096
+#endif
+
+namespace internal
+{
+
+// integer sequence 0, ..., N-1 (C++11), built by halving so that the instantiation depth is O(log N)
+
+template<ullint_t... I>
+struct log_factorial_index_seq
+{};
+
+template<typename S1, typename S2>
+struct log_factorial_index_cat;
+
+template<ullint_t... I1, ullint_t... I2>
+struct log_factorial_index_cat<log_factorial_index_seq<I1...>, log_factorial_index_seq<I2...>>
+{
+    using type = log_factorial_index_seq<I1..., (sizeof...(I1) + I2)...>;
+};
+
+template<ullint_t N>
+struct log_factorial_make_seq
+{
+    using type = typename log_factorial_index_cat<typename log_factorial_make_seq<N/2>::type, 
+                                                  typename log_factorial_make_seq<N - N/2>::type>::type;
+};
+
+template<>
+struct log_factorial_make_seq<0>
+{
+    using type = log_factorial_index_seq<>;
+};
+
+template<>
+struct log_factorial_make_seq<1>
+{
+    using type = log_factorial_index_seq<0>;
+};
+
+// the table: entries are generated by gcem when the table is first used with a given T
+
+template<typename T, typename S>
+struct log_factorial_table_impl;
+
+template<typename T, ullint_t... I>
+struct log_factorial_table_impl<T, log_factorial_index_seq<I...>>
+{
+    static constexpr T vals[sizeof...(I)] = { (I < ullint_t(2) ? T(0) : static_cast<T>(gcem::lgamma(T(I + 1))))... };
+};
+
+template<typename T, ullint_t... I>
+constexpr T log_factorial_table_impl<T, log_factorial_index_seq<I...>>::vals[sizeof...(I)];
+
+template<typename T>
+using log_factorial_table = log_factorial_table_impl<T, typename log_factorial_make_seq<STATS_LOG_FACTORIAL_TABLE_MAX + 1>::type>;
+
+// beyond the table: log(n!) = (n + 1/2) log(n) - n + log(2 pi)/2 + Stirling remainder
+
+template<typename T>
+statslib_constexpr
+T
+log_factorial_stirling(const T n)
+noexcept
+{
+    return( (n + T(0.5))*stmath::log(n) - n + T(0.5)*T(GCEM_LOG_2PI) + lgamma_stirling_err(n) );
+}
+
+// log(n!) for n >= 0
+
+template<typename T>
+statslib_constexpr
+T
+log_factorial(const llint_t n)
+noexcept
+{
+    return( n <= llint_t(STATS_LOG_FACTORIAL_TABLE_MAX) ? \
+                log_factorial_table<T>::vals[n] :
+                log_factorial_stirling(T(n)) );
+}
+
+}
+
+#endif
@@ -0,0 +1,151 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * batch evaluation of the standard normal distribution function, erf and erfc
+ */
+
+#ifndef _statslib_norm_cdf_HPP
+#define _statslib_norm_cdf_HPP
+
+namespace internal
+{
+
+// Cody's rational Chebyshev approximations (Cody, 1969): Phi(z) - 1/2 for |z| <= 0.67449, then the upper tail
+// Q(|z|) = exp(-z^2/2) R(|z|), with R in |z| for |z| <= sqrt(32) and in 1/z^2 beyond. All three pieces are
+// branch-free, so that a loop over z evaluates them for every element and selects the result.
+
+template<typename T>
+statslib_constexpr
+T
+norm_cdf_central(const T z)
+noexcept
+{   // Phi(z) - 1/2
+    return z * ( (((T(0.065682337918207449113) * z*z + T(2.2352520354606839287)) * z*z + T(161.02823106855587881)) * z*z
+                   + T(1067.6894854603709582)) * z*z + T(18154.981253343561249) )
+             / ( (((z*z + T(47.20258190468824187)) * z*z + T(976.09855173777669322)) * z*z
+                   + T(10260.932208618978205)) * z*z + T(45507.789335026729956) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+norm_cdf_tail_mid(const T y)
+noexcept
+{
+    return( ((((((((T(1.0765576773720192317e-8) * y + T(0.39894151208813466764)) * y + T(8.8831497943883759412)) * y
+                   + T(93.506656132177855979)) * y + T(597.27027639480026226)) * y + T(2494.5375852903726711)) * y
+                   + T(6848.1904505362823326)) * y + T(11602.651437647350124)) * y + T(9842.7148383839780218))
+             / ((((((((y + T(22.266688044328115691)) * y + T(235.38790178262499861)) * y + T(1519.377599407554805)) * y
+                   + T(6485.558298266760755)) * y + T(18615.571640885098091)) * y + T(34900.952721145977266)) * y
+                   + T(38912.003286093271411)) * y + T(19685.429676859990727)) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+norm_cdf_tail_far_w(const T w)
+noexcept
+{   // w = 1/y^2
+    return w * ( ((((T(0.02307344176494017303) * w + T(0.21589853405795699)) * w + T(0.1274011611602473639)) * w
+                   + T(0.022235277870649807)) * w + T(0.001421619193227893466)) * w + T(2.9112874951168792e-5) )
+             / ( ((((w + T(1.28426009614491121)) * w + T(0.468238212480865118)) * w + T(0.0659881378689285515)) * w
+                   + T(0.00378239633202758244)) * w + T(7.29751555083966205e-5) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+norm_cdf_tail_far(const T y)
+noexcept
+{
+    return( T(0.398942280401432677939946059934) - norm_cdf_tail_far_w(T(1) / (y*y)) ) / y;
+}
+
+// Q(y) for y > 0.67449; exp(-y^2/2) is split at y rounded down to a multiple of 1/16 so that y^2 is not rounded
+
+template<typename T>
+statslib_inline
+T
+norm_cdf_upper_tail(const T y)
+noexcept
+{
+    const T y_r = std::floor(y * T(16)) / T(16);
+
+    return std::exp(- y_r * y_r / T(2)) * std::exp(- (y - y_r) * (y + y_r) / T(2))
+             * (y <= T(5.656854249492380195206754896838792) ? norm_cdf_tail_mid(y) : norm_cdf_tail_far(y));
+}
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+// Q(z) = P(Z > z); the input and output may alias. NaN inputs are returned as NaN.
+
+template<typename T>
+statslib_inline
+void
+norm_upper_vec(const T* z_vals, T* vals_out, const ullint_t num_elem)
+{
+    for (ullint_t j=ullint_t(0); j < num_elem; ++j)
+    {
+        const T z = z_vals[j];
+        const T tail_val = norm_cdf_upper_tail(std::abs(z));
+
+        vals_out[j] = std::abs(z) <= T(0.67448975) ? T(0.5) - norm_cdf_central(z) :
+                      z > T(0) ? tail_val : T(1) - tail_val;
+    }
+}
+
+// erf(x) = 2 Phi(x sqrt(2)) - 1 and erfc(x) = 2 Q(x sqrt(2))
+
+template<typename T>
+statslib_inline
+void
+erf_vec(const T* x_vals, T* vals_out, const ullint_t num_elem)
+{
+    for (ullint_t j=ullint_t(0); j < num_elem; ++j)
+    {
+        const T z = x_vals[j] * T(GCEM_SQRT_2);
+        const T tail_val = norm_cdf_upper_tail(std::abs(z));
+
+        vals_out[j] = std::abs(z) <= T(0.67448975) ? T(2) * norm_cdf_central(z) :
+                      z > T(0) ? T(1) - T(2) * tail_val : T(2) * tail_val - T(1);
+    }
+}
+
+template<typename T>
+statslib_inline
+void
+erfc_vec(const T* x_vals, T* vals_out, const ullint_t num_elem)
+{
+    for (ullint_t j=ullint_t(0); j < num_elem; ++j)
+    {
+        const T z = x_vals[j] * T(GCEM_SQRT_2);
+        const T tail_val = norm_cdf_upper_tail(std::abs(z));
+
+        vals_out[j] = std::abs(z) <= T(0.67448975) ? T(1) - T(2) * norm_cdf_central(z) :
+                      z > T(0) ? T(2) * tail_val : T(2) - T(2) * tail_val;
+    }
+}
+
+#endif
+
+}
+
+#endif
@@ -0,0 +1,148 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * standard normal quantile function and erf_inv
+ */
+
+#ifndef _statslib_norm_quantile_HPP
+#define _statslib_norm_quantile_HPP
+
+namespace internal
+{
+
+// Wichura's algorithm AS241 (PPND16); rational approximations in q = p - 1/2 near the median
+// and in r = sqrt(-log(min(p, 1 - p))) in the tails
+
+template<typename T>
+statslib_constexpr
+T
+ppnd16_central(const T q, const T r)
+noexcept
+{
+    return q * ( (((((((r * T(2509.0809287301226727) + T(33430.575583588128105)) * r + T(67265.770927008700853)) * r
+                   + T(45921.953931549871457)) * r + T(13731.693765509461125)) * r + T(1971.5909503065514427)) * r
+                   + T(133.14166789178437745)) * r + T(3.387132872796366608))
+             / (((((((r * T(5226.495278852545925) + T(28729.085735721942674)) * r + T(39307.89580009271061)) * r
+                   + T(21213.794301586595867)) * r + T(5394.1960214247511077)) * r + T(687.1870074920579083)) * r
+                   + T(42.313330701600911252)) * r + T(1)) );
+}
+
+// tails: r - 1.6 for r <= 5, and r - 5 beyond
+
+template<typename T>
+statslib_constexpr
+T
+ppnd16_tail_mid(const T r)
+noexcept
+{
+    return( (((((((r * T(7.7454501427834140764e-4) + T(0.0227238449892691845833)) * r + T(0.24178072517745061177)) * r
+                   + T(1.27045825245236838258)) * r + T(3.64784832476320460504)) * r + T(5.7694972214606914055)) * r
+                   + T(4.6303378461565452959)) * r + T(1.42343711074968357734))
+             / (((((((r * T(1.05075007164441684324e-9) + T(5.475938084995344946e-4)) * r + T(0.0151986665636164571966)) * r
+                   + T(0.14810397642748007459)) * r + T(0.68976733498510000455)) * r + T(1.6763848301838038494)) * r
+                   + T(2.05319162663775882187)) * r + T(1)) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+ppnd16_tail_far(const T r)
+noexcept
+{
+    return( (((((((r * T(2.01033439929228813265e-7) + T(2.71155556874348757815e-5)) * r + T(0.0012426609473880784386)) * r
+                   + T(0.026532189526576123093)) * r + T(0.29656057182850489123)) * r + T(1.7848265399172913358)) * r
+                   + T(5.4637849111641143699)) * r + T(6.6579046435011037772))
+             / (((((((r * T(2.04426310338993978564e-15) + T(1.4215117583164458887e-7)) * r + T(1.8463183175100546818e-5)) * r
+                   + T(7.868691311456132591e-4)) * r + T(0.0148753612908506148525)) * r + T(0.13692988092273580531)) * r
+                   + T(0.59983220655588793769)) * r + T(1)) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+ppnd16_tail(const T r)
+noexcept
+{
+    return( r <= T(5) ? \
+                ppnd16_tail_mid(r - T(1.6)) :
+                ppnd16_tail_far(r - T(5)) );
+}
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+// q = P(X <= x) - 1/2 and log_tail = log(min(P(X <= x), P(X > x))); both branches are formed for every element
+
+template<typename T>
+statslib_inline
+T
+ppnd16_select(const T q, const T log_tail)
+noexcept
+{
+    const T tail_val = ppnd16_tail(std::sqrt(- log_tail));
+
+    return( std::abs(q) <= T(0.425) ? ppnd16_central(q, T(0.180625) - q*q) :
+            q < T(0) ? - tail_val : tail_val );
+}
+
+// standard normal quantiles of probabilities given on either tail and on either scale; the input and output may
+// alias. Probabilities of 0 or 1, and invalid inputs, are returned as non-finite values for the caller to resolve.
+
+template<typename T>
+statslib_inline
+void
+norm_quantile_vec(const T* p_vals, const bool lower_tail, const bool log_p, T* vals_out, const ullint_t num_elem)
+{
+    for (ullint_t j=ullint_t(0); j < num_elem; ++j)
+    {
+        const T p = p_vals[j];
+        const T p_tail = log_p ? std::exp(p) : p;
+        const T q = lower_tail ? p_tail - T(0.5) : T(0.5) - p_tail;
+
+        // the tail given is the smaller one when q < 0 on the lower tail, or q >= 0 on the upper tail
+
+        const T log_p_tail = log_p ? p : std::log(p);
+        const T log_p_comp = log_p ? (p > - T(GCEM_LOG_2) ? std::log(- std::expm1(p)) : std::log1p(- std::exp(p))) :
+                                     std::log1p(- p);
+
+        vals_out[j] = ppnd16_select(q, (q < T(0)) == lower_tail ? log_p_tail : log_p_comp);
+    }
+}
+
+// erf_inv(y) = Phi^{-1}((1 + y)/2) / sqrt(2), with q = y/2 and the tail probability (1 - |y|)/2
+
+template<typename T>
+statslib_inline
+void
+erf_inv_vec(const T* y_vals, T* vals_out, const ullint_t num_elem)
+{
+    for (ullint_t j=ullint_t(0); j < num_elem; ++j)
+    {
+        const T y = y_vals[j];
+
+        vals_out[j] = ppnd16_select(y / T(2), std::log1p(- std::abs(y)) - T(GCEM_LOG_2)) / T(GCEM_SQRT_2);
+    }
+}
+
+#endif
+
+}
+
+#endif
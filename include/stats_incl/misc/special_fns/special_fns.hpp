@@ -0,0 +1,63 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * special functions shared by the distribution families: batch versions of the normal CDF and quantile, lgamma,
+ * digamma, and the regularized incomplete gamma and beta functions for the vector paths, a tabulated log(n!), and a
+ * driver for discrete densities over integer counts
+ */
+
+#ifndef _statslib_special_fns_HPP
+#define _statslib_special_fns_HPP
+
+// number of elements advanced together through a continued fraction or series
+
+#ifndef STATS_SPECIAL_FN_LANES
+    #define STATS_SPECIAL_FN_LANES 8
+#endif
+
+// iteration cap for the continued fractions and series; lanes still unconverged at the cap are returned as NaN
+
+#ifndef STATS_SPECIAL_FN_MAX_ITER
+    #define STATS_SPECIAL_FN_MAX_ITER 1000
+#endif
+
+// discrete densities over integer counts: counts below this are memoized per block (0 disables the cache)
+
+#ifndef STATS_DISCRETE_PMF_CACHE_SIZE
+    #define STATS_DISCRETE_PMF_CACHE_SIZE 64
+#endif
+
+// discrete densities over integer counts: counts are split into blocks of this size, each with its own cache
+
+#ifndef STATS_DISCRETE_PMF_BLOCK
+    #define STATS_DISCRETE_PMF_BLOCK ullint_t(4096)
+#endif
+
+#include "norm_cdf.hpp"
+#include "norm_quantile.hpp"
+#include "lgamma.hpp"
+#include "log_factorial.hpp"
+#include "digamma.hpp"
+#include "incomplete_gamma.hpp"
+#include "incomplete_beta.hpp"
+#include "discrete_pmf.hpp"
+
+#endif
@@ -186,7 +186,9 @@ namespace stats
 // other
 
 #ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+    #include <algorithm> // min, max, sort, ...
     #include <iostream> // cerr, cout, ...
+    #include <vector> // work arrays
 #endif
 
 //
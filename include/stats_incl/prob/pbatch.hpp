@@ -0,0 +1,191 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * batch distribution functions for hypothesis testing: p-values for parallel arrays of test statistics 
+ * and per-test degrees of freedom, with optional multiple-testing adjustment
+ */
+
+#ifndef _statslib_pbatch_HPP
+#define _statslib_pbatch_HPP
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+#ifndef STATS_BATCH_BLOCK_SIZE
+    #define STATS_BATCH_BLOCK_SIZE ullint_t(4096)
+#endif
+
+/**
+ * @brief Multiple-testing adjustments
+ */
+
+enum class p_adjust_t
+{
+    none,
+    bonferroni,     // min(1, m p)
+    bh              // Benjamini-Hochberg step-up (false discovery rate)
+};
+
+//
+// p-value adjustment
+
+#ifdef STATS_ENABLE_STDVEC_WRAPPERS
+template<typename eT, typename rT = return_t<eT>>
+statslib_inline
+std::vector<rT>
+p_adjust(const std::vector<eT>& p, const p_adjust_t method, const bool log_form = false);
+#endif
+
+#ifdef STATS_ENABLE_ARMA_WRAPPERS
+template<typename eT, typename rT = return_t<eT>>
+statslib_inline
+ArmaMat<rT>
+p_adjust(const ArmaMat<eT>& P, const p_adjust_t method, const bool log_form = false);
+#endif
+
+#ifdef STATS_ENABLE_BLAZE_WRAPPERS
+template<typename eT, typename rT = return_t<eT>, bool To = blaze::columnMajor>
+statslib_inline
+BlazeMat<rT,To>
+p_adjust(const BlazeMat<eT,To>& P, const p_adjust_t method, const bool log_form = false);
+#endif
+
+#ifdef STATS_ENABLE_EIGEN_WRAPPERS
+template<typename eT, typename rT = return_t<eT>, int iTr = Eigen::Dynamic, int iTc = Eigen::Dynamic>
+statslib_inline
+EigenMat<rT,iTr,iTc>
+p_adjust(const EigenMat<eT,iTr,iTc>& P, const p_adjust_t method, const bool log_form = false);
+#endif
+
+//
+// batch distribution functions
+
+#ifdef STATS_ENABLE_STDVEC_WRAPPERS
+template<typename eT, typename dT, typename rT = common_return_t<eT,dT>>
+statslib_inline
+std::vector<rT>
+pt_batch(const std::vector<eT>& x, const std::vector<dT>& dof_par, const bool log_form = false, const bool lower_tail = true,
+         const p_adjust_t adjust = p_adjust_t::none);
+
+template<typename eT, typename dT, typename rT = common_return_t<eT,dT>>
+statslib_inline
+std::vector<rT>
+pchisq_batch(const std::vector<eT>& x, const std::vector<dT>& dof_par, const bool log_form = false, const bool lower_tail = true,
+             const p_adjust_t adjust = p_adjust_t::none);
+
+template<typename eT, typename dT, typename rT = common_return_t<eT,dT>>
+statslib_inline
+std::vector<rT>
+pf_batch(const std::vector<eT>& x, const std::vector<dT>& df1_par, const std::vector<dT>& df2_par, 
+         const bool log_form = false, const bool lower_tail = true, const p_adjust_t adjust = p_adjust_t::none);
+
+template<typename eT, typename rT = return_t<eT>>
+statslib_inline
+std::vector<rT>
+pnorm_batch(const std::vector<eT>& x, const bool log_form = false, const bool lower_tail = true,
+            const p_adjust_t adjust = p_adjust_t::none);
+#endif
+
+#ifdef STATS_ENABLE_ARMA_WRAPPERS
+template<typename eT, typename dT, typename rT = common_return_t<eT,dT>>
+statslib_inline
+ArmaMat<rT>
+pt_batch(const ArmaMat<eT>& X, const ArmaMat<dT>& dof_par, const bool log_form = false, const bool lower_tail = true,
+         const p_adjust_t adjust = p_adjust_t::none);
+
+template<typename eT, typename dT, typename rT = common_return_t<eT,dT>>
+statslib_inline
+ArmaMat<rT>
+pchisq_batch(const ArmaMat<eT>& X, const ArmaMat<dT>& dof_par, const bool log_form = false, const bool lower_tail = true,
+             const p_adjust_t adjust = p_adjust_t::none);
+
+template<typename eT, typename dT, typename rT = common_return_t<eT,dT>>
+statslib_inline
+ArmaMat<rT>
+pf_batch(const ArmaMat<eT>& X, const ArmaMat<dT>& df1_par, const ArmaMat<dT>& df2_par, 
+         const bool log_form = false, const bool lower_tail = true, const p_adjust_t adjust = p_adjust_t::none);
+
+template<typename eT, typename rT = return_t<eT>>
+statslib_inline
+ArmaMat<rT>
+pnorm_batch(const ArmaMat<eT>& X, const bool log_form = false, const bool lower_tail = true,
+            const p_adjust_t adjust = p_adjust_t::none);
+#endif
+
+#ifdef STATS_ENABLE_BLAZE_WRAPPERS
+template<typename eT, typename dT, typename rT = common_return_t<eT,dT>, bool To = blaze::columnMajor>
+statslib_inline
+BlazeMat<rT,To>
+pt_batch(const BlazeMat<eT,To>& X, const BlazeMat<dT,To>& dof_par, const bool log_form = false, const bool lower_tail = true,
+         const p_adjust_t adjust = p_adjust_t::none);
+
+template<typename eT, typename dT, typename rT = common_return_t<eT,dT>, bool To = blaze::columnMajor>
+statslib_inline
+BlazeMat<rT,To>
+pchisq_batch(const BlazeMat<eT,To>& X, const BlazeMat<dT,To>& dof_par, const bool log_form = false, const bool lower_tail = true,
+             const p_adjust_t adjust = p_adjust_t::none);
+
+template<typename eT, typename dT, typename rT = common_return_t<eT,dT>, bool To = blaze::columnMajor>
+statslib_inline
+BlazeMat<rT,To>
+pf_batch(const BlazeMat<eT,To>& X, const BlazeMat<dT,To>& df1_par, const BlazeMat<dT,To>& df2_par, 
+         const bool log_form = false, const bool lower_tail = true, const p_adjust_t adjust = p_adjust_t::none);
+
+template<typename eT, typename rT = return_t<eT>, bool To = blaze::columnMajor>
+statslib_inline
+BlazeMat<rT,To>
+pnorm_batch(const BlazeMat<eT,To>& X, const bool log_form = false, const bool lower_tail = true,
+            const p_adjust_t adjust = p_adjust_t::none);
+#endif
+
+#ifdef STATS_ENABLE_EIGEN_WRAPPERS
+template<typename eT, typename dT, typename rT = common_return_t<eT,dT>, int iTr = Eigen::Dynamic, int iTc = Eigen::Dynamic>
+statslib_inline
+EigenMat<rT,iTr,iTc>
+pt_batch(const EigenMat<eT,iTr,iTc>& X, const EigenMat<dT,iTr,iTc>& dof_par, const bool log_form = false, const bool lower_tail = true,
+         const p_adjust_t adjust = p_adjust_t::none);
+
+template<typename eT, typename dT, typename rT = common_return_t<eT,dT>, int iTr = Eigen::Dynamic, int iTc = Eigen::Dynamic>
+statslib_inline
+EigenMat<rT,iTr,iTc>
+pchisq_batch(const EigenMat<eT,iTr,iTc>& X, const EigenMat<dT,iTr,iTc>& dof_par, const bool log_form = false, const bool lower_tail = true,
+             const p_adjust_t adjust = p_adjust_t::none);
+
+template<typename eT, typename dT, typename rT = common_return_t<eT,dT>, int iTr = Eigen::Dynamic, int iTc = Eigen::Dynamic>
+statslib_inline
+EigenMat<rT,iTr,iTc>
+pf_batch(const EigenMat<eT,iTr,iTc>& X, const EigenMat<dT,iTr,iTc>& df1_par, const EigenMat<dT,iTr,iTc>& df2_par, 
+         const bool log_form = false, const bool lower_tail = true, const p_adjust_t adjust = p_adjust_t::none);
+
+template<typename eT, typename rT = return_t<eT>, int iTr = Eigen::Dynamic, int iTc = Eigen::Dynamic>
+statslib_inline
+EigenMat<rT,iTr,iTc>
+pnorm_batch(const EigenMat<eT,iTr,iTc>& X, const bool log_form = false, const bool lower_tail = true,
+            const p_adjust_t adjust = p_adjust_t::none);
+#endif
+
+//
+// include implementation files
+
+#include "pbatch.ipp"
+
+#endif
+
+#endif
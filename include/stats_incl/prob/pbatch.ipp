@@ -0,0 +1,815 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * batch distribution functions for hypothesis testing
+ */
+
+namespace internal
+{
+
+//
+// multiple-testing adjustment, in place; NaN entries are left as they are and not counted as tests
+
+template<typename rT>
+statslib_inline
+rT
+p_adjust_cap(const rT p_val, const bool log_form)
+{
+    return( log_form ? std::min(p_val, rT(0)) : std::min(p_val, rT(1)) );
+}
+
+template<typename rT>
+statslib_inline
+void
+p_adjust_vec(rT* __stats_pointer_settings__ vals, const p_adjust_t method, const bool log_form, const ullint_t num_elem)
+{
+    if (method == p_adjust_t::none) {
+        return;
+    }
+
+    std::vector<ullint_t> test_ind;
+    test_ind.reserve(num_elem);
+
+    for (ullint_t j=ullint_t(0); j < num_elem; ++j)
+    {
+        if (!GCINT::is_nan(vals[j])) {
+            test_ind.push_back(j);
+        }
+    }
+
+    const ullint_t n_tests = test_ind.size();
+
+    if (n_tests == ullint_t(0)) {
+        return;
+    }
+
+    const rT n_val = static_cast<rT>(n_tests);
+    const rT log_n = std::log(n_val);
+
+    if (method == p_adjust_t::bonferroni) {
+        for (ullint_t j=ullint_t(0); j < n_tests; ++j)
+        {
+            const ullint_t k = test_ind[j];
+            vals[k] = p_adjust_cap(log_form ? vals[k] + log_n : vals[k] * n_val, log_form);
+        }
+
+        return;
+    }
+
+    // Benjamini-Hochberg: with p_(1) <= ... <= p_(m), the adjusted p_(i) is min_{j >= i} min(1, m p_(j) / j)
+
+    std::sort(test_ind.begin(), test_ind.end(), [vals](const ullint_t i, const ullint_t j) { return vals[i] < vals[j]; });
+
+    rT running_min = log_form ? rT(0) : rT(1);
+
+    for (ullint_t j=n_tests; j > ullint_t(0); --j)
+    {
+        const ullint_t k = test_ind[j-1];
+        const rT adj_val = log_form ? vals[k] + log_n - std::log(static_cast<rT>(j)) : vals[k] * n_val / static_cast<rT>(j);
+
+        running_min = std::min(running_min, adj_val);
+        vals[k] = running_min;
+    }
+}
+
+//
+// per-test degrees of freedom: the inputs are ordered by their degrees of freedom and split into blocks of 
+// equal parameters, each of which is passed to the single-parameter vector kernel (so that constants depending 
+// only on the degrees of freedom are computed once per block); blocks are evaluated in parallel
+
+template<typename dT>
+statslib_inline
+bool
+batch_dof_nan(const dT* dof_1, const dT* dof_2, const ullint_t i)
+{
+    return( GCINT::is_nan(dof_1[i]) || (dof_2 != nullptr && GCINT::is_nan(dof_2[i])) );
+}
+
+template<typename dT>
+statslib_inline
+bool
+batch_dof_equal(const dT* dof_1, const dT* dof_2, const ullint_t i, const ullint_t j)
+{
+    return( dof_1[i] == dof_1[j] && (dof_2 == nullptr || dof_2[i] == dof_2[j]) );
+}
+
+// strict weak ordering with NaN parameters last
+
+template<typename dT>
+statslib_inline
+bool
+batch_dof_less(const dT* dof_1, const dT* dof_2, const ullint_t i, const ullint_t j)
+{
+    return( batch_dof_nan(dof_1,dof_2,i) ? \
+                false :
+            batch_dof_nan(dof_1,dof_2,j) ? \
+                true :
+            dof_1[i] != dof_1[j] ? \
+                dof_1[i] < dof_1[j] :
+            // equal first parameter
+                dof_2 != nullptr && dof_2[i] < dof_2[j] );
+}
+
+template<typename dT>
+statslib_inline
+std::vector<ullint_t>
+batch_dof_order(const dT* dof_1, const dT* dof_2, const ullint_t num_elem)
+{
+    std::vector<ullint_t> order_ind(num_elem);
+
+    for (ullint_t j=ullint_t(0); j < num_elem; ++j)
+    {
+        order_ind[j] = j;
+    }
+
+    auto dof_less = [dof_1,dof_2](const ullint_t i, const ullint_t j) { return batch_dof_less(dof_1,dof_2,i,j); };
+
+    if (!std::is_sorted(order_ind.begin(), order_ind.end(), dof_less)) {
+        std::sort(order_ind.begin(), order_ind.end(), dof_less);
+    }
+
+    return order_ind;
+}
+
+// block_fn(x_block, k, out_block, n_block) evaluates a block whose parameters are those of input k
+
+template<typename eT, typename dT, typename rT, typename Fn>
+statslib_inline
+void
+batch_dof_eval(const eT* __stats_pointer_settings__ vals_in, const dT* dof_1, const dT* dof_2, 
+               rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem, Fn block_fn)
+{
+    if (num_elem == ullint_t(0)) {
+        return;
+    }
+
+    const std::vector<ullint_t> order_ind = batch_dof_order(dof_1,dof_2,num_elem);
+
+    std::vector<ullint_t> block_start(1,ullint_t(0));
+
+    for (ullint_t j=ullint_t(1); j < num_elem; ++j)
+    {
+        if (!batch_dof_equal(dof_1,dof_2,order_ind[j-1],order_ind[j]) || j - block_start.back() >= STATS_BATCH_BLOCK_SIZE) {
+            block_start.push_back(j);
+        }
+    }
+
+    block_start.push_back(num_elem);
+
+    const ullint_t n_blocks = block_start.size() - ullint_t(1);
+
+#ifdef STATS_USE_OPENMP
+    #pragma omp parallel for schedule(dynamic)
+#endif
+    for (ullint_t b=ullint_t(0); b < n_blocks; ++b)
+    {
+        const ullint_t j_begin = block_start[b];
+        const ullint_t n_block = block_start[b+1] - j_begin;
+
+        std::vector<eT> x_block(n_block);
+        std::vector<rT> out_block(n_block);
+
+        for (ullint_t i=ullint_t(0); i < n_block; ++i)
+        {
+            x_block[i] = vals_in[order_ind[j_begin + i]];
+        }
+
+        block_fn(x_block.data(),order_ind[j_begin],out_block.data(),n_block);
+
+        for (ullint_t i=ullint_t(0); i < n_block; ++i)
+        {
+            vals_out[order_ind[j_begin + i]] = out_block[i];
+        }
+    }
+}
+
+//
+
+template<typename eT, typename dT, typename rT>
+statslib_inline
+void
+pt_batch_vec(const eT* __stats_pointer_settings__ vals_in, const dT* __stats_pointer_settings__ dof_par, 
+             const bool log_form, const bool lower_tail, const p_adjust_t adjust, 
+             rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    batch_dof_eval(vals_in,dof_par,static_cast<const dT*>(nullptr),vals_out,num_elem,
+        [dof_par,log_form,lower_tail](const eT* x_block, const ullint_t k, rT* out_block, const ullint_t n_block) {
+            pt_vec(x_block,dof_par[k],log_form,lower_tail,out_block,n_block);
+        });
+
+    p_adjust_vec(vals_out,adjust,log_form,num_elem);
+}
+
+template<typename eT, typename dT, typename rT>
+statslib_inline
+void
+pchisq_batch_vec(const eT* __stats_pointer_settings__ vals_in, const dT* __stats_pointer_settings__ dof_par, 
+                 const bool log_form, const bool lower_tail, const p_adjust_t adjust, 
+                 rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    batch_dof_eval(vals_in,dof_par,static_cast<const dT*>(nullptr),vals_out,num_elem,
+        [dof_par,log_form,lower_tail](const eT* x_block, const ullint_t k, rT* out_block, const ullint_t n_block) {
+            pchisq_vec(x_block,dof_par[k],log_form,lower_tail,out_block,n_block);
+        });
+
+    p_adjust_vec(vals_out,adjust,log_form,num_elem);
+}
+
+template<typename eT, typename dT, typename rT>
+statslib_inline
+void
+pf_batch_vec(const eT* __stats_pointer_settings__ vals_in, const dT* __stats_pointer_settings__ df1_par, 
+             const dT* __stats_pointer_settings__ df2_par, const bool log_form, const bool lower_tail, const p_adjust_t adjust, 
+             rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    batch_dof_eval(vals_in,df1_par,df2_par,vals_out,num_elem,
+        [df1_par,df2_par,log_form,lower_tail](const eT* x_block, const ullint_t k, rT* out_block, const ullint_t n_block) {
+            pf_vec(x_block,df1_par[k],df2_par[k],log_form,lower_tail,out_block,n_block);
+        });
+
+    p_adjust_vec(vals_out,adjust,log_form,num_elem);
+}
+
+template<typename eT, typename rT>
+statslib_inline
+void
+pnorm_batch_vec(const eT* __stats_pointer_settings__ vals_in, const bool log_form, const bool lower_tail, const p_adjust_t adjust, 
+                rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    pnorm_vec(vals_in,rT(0),rT(1),log_form,lower_tail,vals_out,num_elem);
+
+    p_adjust_vec(vals_out,adjust,log_form,num_elem);
+}
+
+#ifdef STATS_ENABLE_BLAZE_WRAPPERS
+// the rows (or columns, for column-major storage) may be padded; the values are copied out, and back, in column-major order
+
+template<typename rT, typename eT, bool To>
+statslib_inline
+std::vector<rT>
+batch_blaze_vals(const BlazeMat<eT,To>& X)
+{
+    std::vector<rT> vals(X.rows()*X.columns());
+
+    for (size_t k=0; k < X.columns(); ++k)
+    {
+        for (size_t i=0; i < X.rows(); ++i)
+        {
+            vals[k*X.rows() + i] = static_cast<rT>(X(i,k));
+        }
+    }
+
+    return vals;
+}
+
+template<typename rT, bool To>
+statslib_inline
+void
+batch_blaze_fill(BlazeMat<rT,To>& mat_out, const std::vector<rT>& vals)
+{
+    for (size_t k=0; k < mat_out.columns(); ++k)
+    {
+        for (size_t i=0; i < mat_out.rows(); ++i)
+        {
+            mat_out(i,k) = vals[k*mat_out.rows() + i];
+        }
+    }
+}
+#endif
+
+}
+
+//
+// p-value adjustment
+
+/**
+ * @brief Multiple-testing adjustment of p-values
+ *
+ * @param p a standard vector of p-values.
+ * @param method the adjustment: \c p_adjust_t::bonferroni, \f$ \min(1, m p_i) \f$, or \c p_adjust_t::bh, the 
+ * Benjamini-Hochberg step-up adjustment, \f$ \min_{j \geq i} \min(1, m p_{(j)} / j) \f$, for \f$ m \f$ tests.
+ * @param log_form \c p, and the return values, are given on the log scale.
+ *
+ * @return a vector of adjusted p-values. NaN inputs are returned as NaN and not counted among the \f$ m \f$ tests.
+ *
+ * Example:
+ * \code{.cpp}
+ * std::vector<double> p = {0.01, 0.04, 0.03, 0.2};
+ * stats::p_adjust(p,stats::p_adjust_t::bh);
+ * \endcode
+ */
+
+#ifdef STATS_ENABLE_STDVEC_WRAPPERS
+template<typename eT, typename rT>
+statslib_inline
+std::vector<rT>
+p_adjust(const std::vector<eT>& p, const p_adjust_t method, const bool log_form)
+{
+    std::vector<rT> vec_out(p.begin(),p.end());
+
+    internal::p_adjust_vec(vec_out.data(),method,log_form,vec_out.size());
+
+    return vec_out;
+}
+#endif
+
+/**
+ * @brief Multiple-testing adjustment of p-values
+ *
+ * @param P a matrix of p-values.
+ * @param method the adjustment: \c p_adjust_t::bonferroni or \c p_adjust_t::bh.
+ * @param log_form \c P, and the return values, are given on the log scale.
+ *
+ * @return a matrix of adjusted p-values, taking every element of \c P as one test.
+ *
+ * Example:
+ * \code{.cpp}
+ * arma::mat P = { {0.01, 0.04},
+ *                 {0.03, 0.2} };
+ * stats::p_adjust(P,stats::p_adjust_t::bonferroni);
+ * \endcode
+ */
+
+#ifdef STATS_ENABLE_ARMA_WRAPPERS
+template<typename eT, typename rT>
+statslib_inline
+ArmaMat<rT>
+p_adjust(const ArmaMat<eT>& P, const p_adjust_t method, const bool log_form)
+{
+    ArmaMat<rT> mat_out = arma::conv_to<ArmaMat<rT>>::from(P);
+
+    internal::p_adjust_vec(mat_out.memptr(),method,log_form,mat_out.n_elem);
+
+    return mat_out;
+}
+#endif
+
+/**
+ * @brief Multiple-testing adjustment of p-values
+ *
+ * @param P a matrix of p-values.
+ * @param method the adjustment: \c p_adjust_t::bonferroni or \c p_adjust_t::bh.
+ * @param log_form \c P, and the return values, are given on the log scale.
+ *
+ * @return a matrix of adjusted p-values, taking every element of \c P as one test.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::p_adjust(P,stats::p_adjust_t::bonferroni);
+ * \endcode
+ */
+
+#ifdef STATS_ENABLE_BLAZE_WRAPPERS
+template<typename eT, typename rT, bool To>
+statslib_inline
+BlazeMat<rT,To>
+p_adjust(const BlazeMat<eT,To>& P, const p_adjust_t method, const bool log_form)
+{
+    BlazeMat<rT,To> mat_out(P.rows(),P.columns());
+    std::vector<rT> vals = internal::batch_blaze_vals<rT>(P);
+
+    internal::p_adjust_vec(vals.data(),method,log_form,vals.size());
+    internal::batch_blaze_fill(mat_out,vals);
+
+    return mat_out;
+}
+#endif
+
+/**
+ * @brief Multiple-testing adjustment of p-values
+ *
+ * @param P a matrix of p-values.
+ * @param method the adjustment: \c p_adjust_t::bonferroni or \c p_adjust_t::bh.
+ * @param log_form \c P, and the return values, are given on the log scale.
+ *
+ * @return a matrix of adjusted p-values, taking every element of \c P as one test.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::p_adjust(P,stats::p_adjust_t::bonferroni);
+ * \endcode
+ */
+
+#ifdef STATS_ENABLE_EIGEN_WRAPPERS
+template<typename eT, typename rT, int iTr, int iTc>
+statslib_inline
+EigenMat<rT,iTr,iTc>
+p_adjust(const EigenMat<eT,iTr,iTc>& P, const p_adjust_t method, const bool log_form)
+{
+    EigenMat<rT,iTr,iTc> mat_out = P.template cast<rT>();
+
+    internal::p_adjust_vec(mat_out.data(),method,log_form,static_cast<ullint_t>(mat_out.size()));
+
+    return mat_out;
+}
+#endif
+
+//
+// batch distribution functions; the parameter arrays must match the statistics in size, or every return value is NaN
+
+/**
+ * @brief Batch distribution function of the t-distribution
+ *
+ * @param x a standard vector of test statistics.
+ * @param dof_par a standard vector of degrees of freedom, one for each element of \c x.
+ * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
+ * @param adjust a multiple-testing adjustment applied to the returned probabilities.
+ *
+ * @return a vector of CDF values, or p-values with \c lower_tail \c = \c false, corresponding to the elements of \c x.
+ *
+ * Example:
+ * \code{.cpp}
+ * std::vector<double> x = {2.1, -0.4, 3.3};
+ * std::vector<double> dof = {8, 12, 8};
+ * stats::pt_batch(x,dof,false,false,stats::p_adjust_t::bh);
+ * \endcode
+ */
+
+#ifdef STATS_ENABLE_STDVEC_WRAPPERS
+template<typename eT, typename dT, typename rT>
+statslib_inline
+std::vector<rT>
+pt_batch(const std::vector<eT>& x, const std::vector<dT>& dof_par, const bool log_form, const bool lower_tail, const p_adjust_t adjust)
+{
+    std::vector<rT> vec_out(x.size(),STLIM<rT>::quiet_NaN());
+
+    if (dof_par.size() == x.size()) {
+        internal::pt_batch_vec(x.data(),dof_par.data(),log_form,lower_tail,adjust,vec_out.data(),x.size());
+    }
+
+    return vec_out;
+}
+#endif
+
+/**
+ * @brief Batch distribution function of the Chi-squared distribution
+ *
+ * @param x a standard vector of test statistics.
+ * @param dof_par a standard vector of degrees of freedom, one for each element of \c x.
+ * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
+ * @param adjust a multiple-testing adjustment applied to the returned probabilities.
+ *
+ * @return a vector of CDF values, or p-values with \c lower_tail \c = \c false, corresponding to the elements of \c x.
+ *
+ * Example:
+ * \code{.cpp}
+ * std::vector<double> x = {4.2, 11.0, 0.7};
+ * std::vector<double> dof = {2, 3, 2};
+ * stats::pchisq_batch(x,dof,true,false);
+ * \endcode
+ */
+
+#ifdef STATS_ENABLE_STDVEC_WRAPPERS
+template<typename eT, typename dT, typename rT>
+statslib_inline
+std::vector<rT>
+pchisq_batch(const std::vector<eT>& x, const std::vector<dT>& dof_par, const bool log_form, const bool lower_tail, const p_adjust_t adjust)
+{
+    std::vector<rT> vec_out(x.size(),STLIM<rT>::quiet_NaN());
+
+    if (dof_par.size() == x.size()) {
+        internal::pchisq_batch_vec(x.data(),dof_par.data(),log_form,lower_tail,adjust,vec_out.data(),x.size());
+    }
+
+    return vec_out;
+}
+#endif
+
+/**
+ * @brief Batch distribution function of the F-distribution
+ *
+ * @param x a standard vector of test statistics.
+ * @param df1_par a standard vector of numerator degrees of freedom, one for each element of \c x.
+ * @param df2_par a standard vector of denominator degrees of freedom, one for each element of \c x.
+ * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
+ * @param adjust a multiple-testing adjustment applied to the returned probabilities.
+ *
+ * @return a vector of CDF values, or p-values with \c lower_tail \c = \c false, corresponding to the elements of \c x.
+ *
+ * Example:
+ * \code{.cpp}
+ * std::vector<double> x = {1.5, 3.9};
+ * std::vector<double> df1 = {2, 4};
+ * std::vector<double> df2 = {20, 20};
+ * stats::pf_batch(x,df1,df2,false,false,stats::p_adjust_t::bonferroni);
+ * \endcode
+ */
+
+#ifdef STATS_ENABLE_STDVEC_WRAPPERS
+template<typename eT, typename dT, typename rT>
+statslib_inline
+std::vector<rT>
+pf_batch(const std::vector<eT>& x, const std::vector<dT>& df1_par, const std::vector<dT>& df2_par, 
+         const bool log_form, const bool lower_tail, const p_adjust_t adjust)
+{
+    std::vector<rT> vec_out(x.size(),STLIM<rT>::quiet_NaN());
+
+    if (df1_par.size() == x.size() && df2_par.size() == x.size()) {
+        internal::pf_batch_vec(x.data(),df1_par.data(),df2_par.data(),log_form,lower_tail,adjust,vec_out.data(),x.size());
+    }
+
+    return vec_out;
+}
+#endif
+
+/**
+ * @brief Batch distribution function of the standard normal distribution (z-tests)
+ *
+ * @param x a standard vector of test statistics.
+ * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
+ * @param adjust a multiple-testing adjustment applied to the returned probabilities.
+ *
+ * @return a vector of CDF values, or p-values with \c lower_tail \c = \c false, corresponding to the elements of \c x.
+ *
+ * Example:
+ * \code{.cpp}
+ * std::vector<double> x = {1.2, 2.8, -0.3};
+ * stats::pnorm_batch(x,false,false,stats::p_adjust_t::bh);
+ * \endcode
+ */
+
+#ifdef STATS_ENABLE_STDVEC_WRAPPERS
+template<typename eT, typename rT>
+statslib_inline
+std::vector<rT>
+pnorm_batch(const std::vector<eT>& x, const bool log_form, const bool lower_tail, const p_adjust_t adjust)
+{
+    std::vector<rT> vec_out(x.size());
+
+    internal::pnorm_batch_vec(x.data(),log_form,lower_tail,adjust,vec_out.data(),x.size());
+
+    return vec_out;
+}
+#endif
+
+//
+// matrix input: every element is one test, and the parameter matrices must match X in size
+
+/**
+ * @brief Batch distribution function of the t-distribution
+ *
+ * @param X a matrix of test statistics.
+ * @param dof_par a matrix of degrees of freedom, one for each element of \c X.
+ * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
+ * @param adjust a multiple-testing adjustment applied to the returned probabilities, taking every element of \c X as one test.
+ *
+ * @return a matrix of CDF values, or p-values with \c lower_tail \c = \c false, corresponding to the elements of \c X.
+ *
+ * Example:
+ * \code{.cpp}
+ * arma::mat X = { {2.1, -0.4}, {3.3, 1.0} };
+ * arma::mat D = { {8, 12}, {8, 30} };
+ * stats::pt_batch(X,D,false,false);
+ * \endcode
+ */
+
+#ifdef STATS_ENABLE_ARMA_WRAPPERS
+template<typename eT, typename dT, typename rT>
+statslib_inline
+ArmaMat<rT>
+pt_batch(const ArmaMat<eT>& X, const ArmaMat<dT>& dof_par, const bool log_form, const bool lower_tail, const p_adjust_t adjust)
+{
+    ArmaMat<rT> mat_out(X.n_rows,X.n_cols);
+    mat_out.fill(STLIM<rT>::quiet_NaN());
+
+    if (dof_par.n_rows == X.n_rows && dof_par.n_cols == X.n_cols) {
+        internal::pt_batch_vec(X.memptr(),dof_par.memptr(),log_form,lower_tail,adjust,mat_out.memptr(),mat_out.n_elem);
+    }
+
+    return mat_out;
+}
+
+template<typename eT, typename dT, typename rT>
+statslib_inline
+ArmaMat<rT>
+pchisq_batch(const ArmaMat<eT>& X, const ArmaMat<dT>& dof_par, const bool log_form, const bool lower_tail, const p_adjust_t adjust)
+{
+    ArmaMat<rT> mat_out(X.n_rows,X.n_cols);
+    mat_out.fill(STLIM<rT>::quiet_NaN());
+
+    if (dof_par.n_rows == X.n_rows && dof_par.n_cols == X.n_cols) {
+        internal::pchisq_batch_vec(X.memptr(),dof_par.memptr(),log_form,lower_tail,adjust,mat_out.memptr(),mat_out.n_elem);
+    }
+
+    return mat_out;
+}
+
+template<typename eT, typename dT, typename rT>
+statslib_inline
+ArmaMat<rT>
+pf_batch(const ArmaMat<eT>& X, const ArmaMat<dT>& df1_par, const ArmaMat<dT>& df2_par, 
+         const bool log_form, const bool lower_tail, const p_adjust_t adjust)
+{
+    ArmaMat<rT> mat_out(X.n_rows,X.n_cols);
+    mat_out.fill(STLIM<rT>::quiet_NaN());
+
+    if (df1_par.n_rows == X.n_rows && df1_par.n_cols == X.n_cols && df2_par.n_rows == X.n_rows && df2_par.n_cols == X.n_cols) {
+        internal::pf_batch_vec(X.memptr(),df1_par.memptr(),df2_par.memptr(),log_form,lower_tail,adjust,mat_out.memptr(),mat_out.n_elem);
+    }
+
+    return mat_out;
+}
+
+template<typename eT, typename rT>
+statslib_inline
+ArmaMat<rT>
+pnorm_batch(const ArmaMat<eT>& X, const bool log_form, const bool lower_tail, const p_adjust_t adjust)
+{
+    ArmaMat<rT> mat_out(X.n_rows,X.n_cols);
+
+    internal::pnorm_batch_vec(X.memptr(),log_form,lower_tail,adjust,mat_out.memptr(),mat_out.n_elem);
+
+    return mat_out;
+}
+#endif
+
+/**
+ * @brief Batch distribution function of the t-distribution
+ *
+ * @param X a matrix of test statistics.
+ * @param dof_par a matrix of degrees of freedom, one for each element of \c X.
+ * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
+ * @param adjust a multiple-testing adjustment applied to the returned probabilities, taking every element of \c X as one test.
+ *
+ * @return a matrix of CDF values, or p-values with \c lower_tail \c = \c false, corresponding to the elements of \c X.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::pt_batch(X,D,false,false);
+ * \endcode
+ */
+
+#ifdef STATS_ENABLE_BLAZE_WRAPPERS
+template<typename eT, typename dT, typename rT, bool To>
+statslib_inline
+BlazeMat<rT,To>
+pt_batch(const BlazeMat<eT,To>& X, const BlazeMat<dT,To>& dof_par, const bool log_form, const bool lower_tail, const p_adjust_t adjust)
+{
+    BlazeMat<rT,To> mat_out(X.rows(),X.columns(),STLIM<rT>::quiet_NaN());
+
+    if (dof_par.rows() == X.rows() && dof_par.columns() == X.columns()) {
+        const std::vector<eT> x_vals = internal::batch_blaze_vals<eT>(X);
+        const std::vector<dT> dof_vals = internal::batch_blaze_vals<dT>(dof_par);
+        std::vector<rT> vals_out(x_vals.size());
+
+        internal::pt_batch_vec(x_vals.data(),dof_vals.data(),log_form,lower_tail,adjust,vals_out.data(),vals_out.size());
+        internal::batch_blaze_fill(mat_out,vals_out);
+    }
+
+    return mat_out;
+}
+
+template<typename eT, typename dT, typename rT, bool To>
+statslib_inline
+BlazeMat<rT,To>
+pchisq_batch(const BlazeMat<eT,To>& X, const BlazeMat<dT,To>& dof_par, const bool log_form, const bool lower_tail, const p_adjust_t adjust)
+{
+    BlazeMat<rT,To> mat_out(X.rows(),X.columns(),STLIM<rT>::quiet_NaN());
+
+    if (dof_par.rows() == X.rows() && dof_par.columns() == X.columns()) {
+        const std::vector<eT> x_vals = internal::batch_blaze_vals<eT>(X);
+        const std::vector<dT> dof_vals = internal::batch_blaze_vals<dT>(dof_par);
+        std::vector<rT> vals_out(x_vals.size());
+
+        internal::pchisq_batch_vec(x_vals.data(),dof_vals.data(),log_form,lower_tail,adjust,vals_out.data(),vals_out.size());
+        internal::batch_blaze_fill(mat_out,vals_out);
+    }
+
+    return mat_out;
+}
+
+template<typename eT, typename dT, typename rT, bool To>
+statslib_inline
+BlazeMat<rT,To>
+pf_batch(const BlazeMat<eT,To>& X, const BlazeMat<dT,To>& df1_par, const BlazeMat<dT,To>& df2_par, 
+         const bool log_form, const bool lower_tail, const p_adjust_t adjust)
+{
+    BlazeMat<rT,To> mat_out(X.rows(),X.columns(),STLIM<rT>::quiet_NaN());
+
+    if (df1_par.rows() == X.rows() && df1_par.columns() == X.columns() && df2_par.rows() == X.rows() && df2_par.columns() == X.columns()) {
+        const std::vector<eT> x_vals = internal::batch_blaze_vals<eT>(X);
+        const std::vector<dT> df1_vals = internal::batch_blaze_vals<dT>(df1_par);
+        const std::vector<dT> df2_vals = internal::batch_blaze_vals<dT>(df2_par);
+        std::vector<rT> vals_out(x_vals.size());
+
+        internal::pf_batch_vec(x_vals.data(),df1_vals.data(),df2_vals.data(),log_form,lower_tail,adjust,vals_out.data(),vals_out.size());
+        internal::batch_blaze_fill(mat_out,vals_out);
+    }
+
+    return mat_out;
+}
+
+template<typename eT, typename rT, bool To>
+statslib_inline
+BlazeMat<rT,To>
+pnorm_batch(const BlazeMat<eT,To>& X, const bool log_form, const bool lower_tail, const p_adjust_t adjust)
+{
+    BlazeMat<rT,To> mat_out(X.rows(),X.columns());
+
+    const std::vector<eT> x_vals = internal::batch_blaze_vals<eT>(X);
+    std::vector<rT> vals_out(x_vals.size());
+
+    internal::pnorm_batch_vec(x_vals.data(),log_form,lower_tail,adjust,vals_out.data(),vals_out.size());
+    internal::batch_blaze_fill(mat_out,vals_out);
+
+    return mat_out;
+}
+#endif
+
+/**
+ * @brief Batch distribution function of the t-distribution
+ *
+ * @param X a matrix of test statistics.
+ * @param dof_par a matrix of degrees of freedom, one for each element of \c X.
+ * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
+ * @param adjust a multiple-testing adjustment applied to the returned probabilities, taking every element of \c X as one test.
+ *
+ * @return a matrix of CDF values, or p-values with \c lower_tail \c = \c false, corresponding to the elements of \c X.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::pt_batch(X,D,false,false);
+ * \endcode
+ */
+
+#ifdef STATS_ENABLE_EIGEN_WRAPPERS
+template<typename eT, typename dT, typename rT, int iTr, int iTc>
+statslib_inline
+EigenMat<rT,iTr,iTc>
+pt_batch(const EigenMat<eT,iTr,iTc>& X, const EigenMat<dT,iTr,iTc>& dof_par, const bool log_form, const bool lower_tail, const p_adjust_t adjust)
+{
+    EigenMat<rT,iTr,iTc> mat_out = EigenMat<rT,iTr,iTc>::Constant(X.rows(),X.cols(),STLIM<rT>::quiet_NaN());
+
+    if (dof_par.rows() == X.rows() && dof_par.cols() == X.cols()) {
+        internal::pt_batch_vec(X.data(),dof_par.data(),log_form,lower_tail,adjust,mat_out.data(),static_cast<ullint_t>(mat_out.size()));
+    }
+
+    return mat_out;
+}
+
+template<typename eT, typename dT, typename rT, int iTr, int iTc>
+statslib_inline
+EigenMat<rT,iTr,iTc>
+pchisq_batch(const EigenMat<eT,iTr,iTc>& X, const EigenMat<dT,iTr,iTc>& dof_par, const bool log_form, const bool lower_tail, const p_adjust_t adjust)
+{
+    EigenMat<rT,iTr,iTc> mat_out = EigenMat<rT,iTr,iTc>::Constant(X.rows(),X.cols(),STLIM<rT>::quiet_NaN());
+
+    if (dof_par.rows() == X.rows() && dof_par.cols() == X.cols()) {
+        internal::pchisq_batch_vec(X.data(),dof_par.data(),log_form,lower_tail,adjust,mat_out.data(),static_cast<ullint_t>(mat_out.size()));
+    }
+
+    return mat_out;
+}
+
+template<typename eT, typename dT, typename rT, int iTr, int iTc>
+statslib_inline
+EigenMat<rT,iTr,iTc>
+pf_batch(const EigenMat<eT,iTr,iTc>& X, const EigenMat<dT,iTr,iTc>& df1_par, const EigenMat<dT,iTr,iTc>& df2_par, 
+         const bool log_form, const bool lower_tail, const p_adjust_t adjust)
+{
+    EigenMat<rT,iTr,iTc> mat_out = EigenMat<rT,iTr,iTc>::Constant(X.rows(),X.cols(),STLIM<rT>::quiet_NaN());
+
+    if (df1_par.rows() == X.rows() && df1_par.cols() == X.cols() && df2_par.rows() == X.rows() && df2_par.cols() == X.cols()) {
+        internal::pf_batch_vec(X.data(),df1_par.data(),df2_par.data(),log_form,lower_tail,adjust,mat_out.data(),static_cast<ullint_t>(mat_out.size()));
+    }
+
+    return mat_out;
+}
+
+template<typename eT, typename rT, int iTr, int iTc>
+statslib_inline
+EigenMat<rT,iTr,iTc>
+pnorm_batch(const EigenMat<eT,iTr,iTc>& X, const bool log_form, const bool lower_tail, const p_adjust_t adjust)
+{
+    EigenMat<rT,iTr,iTc> mat_out(X.rows(),X.cols());
+
+    internal::pnorm_batch_vec(X.data(),log_form,lower_tail,adjust,mat_out.data(),static_cast<ullint_t>(mat_out.size()));
+
+    return mat_out;
+}
+#endif
@@ -31,7 +31,7 @@
 template<typename T>
 statslib_constexpr
 return_t<T>
-pbern(const llint_t x, const T prob_par, const bool log_form = false) noexcept;
+pbern(const llint_t x, const T prob_par, const bool log_form = false, const bool lower_tail = true) noexcept;
 
 //
 // vector/matrix input
@@ -40,33 +40,33 @@ pbern(const llint_t x, const T prob_par, const bool log_form = false) noexcept;
 template<typename eT, typename T1, typename rT = common_return_t<eT,T1>>
 statslib_inline
 std::vector<rT>
-pbern(const std::vector<eT>& x, const T1 prob_par, const bool log_form = false);
+pbern(const std::vector<eT>& x, const T1 prob_par, const bool log_form = false, const bool lower_tail = true);
 #endif
 
 #ifdef STATS_ENABLE_ARMA_WRAPPERS
 template<typename eT, typename T1, typename rT = common_return_t<eT,T1>>
 statslib_inline
 ArmaMat<rT>
-pbern(const ArmaMat<eT>& X, const T1 prob_par, const bool log_form = false);
+pbern(const ArmaMat<eT>& X, const T1 prob_par, const bool log_form = false, const bool lower_tail = true);
 
 template<typename mT, typename tT, typename T1>
 statslib_inline
 mT 
-pbern(const ArmaGen<mT,tT>& X, const T1 prob_par, const bool log_form = false);
+pbern(const ArmaGen<mT,tT>& X, const T1 prob_par, const bool log_form = false, const bool lower_tail = true);
 #endif
 
 #ifdef STATS_ENABLE_BLAZE_WRAPPERS
 template<typename eT, typename T1, typename rT = common_return_t<eT,T1>, bool To = blaze::columnMajor>
 statslib_inline
 BlazeMat<rT,To>
-pbern(const BlazeMat<eT,To>& X, const T1 prob_par, const bool log_form = false);
+pbern(const BlazeMat<eT,To>& X, const T1 prob_par, const bool log_form = false, const bool lower_tail = true);
 #endif
 
 #ifdef STATS_ENABLE_EIGEN_WRAPPERS
 template<typename eT, typename T1, typename rT = common_return_t<eT,T1>, int iTr = Eigen::Dynamic, int iTc = Eigen::Dynamic>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-pbern(const EigenMat<eT,iTr,iTc>& X, const T1 prob_par, const bool log_form = false);
+pbern(const EigenMat<eT,iTr,iTc>& X, const T1 prob_par, const bool log_form = false, const bool lower_tail = true);
 #endif
 
 //
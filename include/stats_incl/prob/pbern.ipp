@@ -31,27 +31,30 @@ namespace internal
 template<typename T>
 statslib_constexpr
 T
-pbern_compute(const llint_t x, const T prob_par)
+pbern_compute(const llint_t x, const T prob_par, const bool lower_tail)
 noexcept
 {
     return( x < llint_t(0) ? \
-                T(0) :
+                tail_if(T(0),lower_tail) :
             //
             x >= llint_t(1) ? \
-                T(1) : 
-                T(1) - prob_par );
+                tail_if(T(1),lower_tail) : 
+            //
+            lower_tail ? \
+                T(1) - prob_par :
+                prob_par );
 }
 
 template<typename T>
 statslib_constexpr
 T
-pbern_vals_check(const llint_t x, const T prob_par, const bool log_form)
+pbern_vals_check(const llint_t x, const T prob_par, const bool log_form, const bool lower_tail)
 noexcept
 {
     return( !bern_sanity_check(prob_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            log_if(pbern_compute(x,prob_par), log_form) );
+            log_if(pbern_compute(x,prob_par,lower_tail), log_form) );
 }
 
 }
@@ -62,6 +65,7 @@ noexcept
  * @param x a value equal to 0 or 1.
  * @param prob_par the probability parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return the cumulative distribution function evaluated at \c x.
  * 
@@ -72,10 +76,10 @@ noexcept
 template<typename T>
 statslib_constexpr
 return_t<T>
-pbern(const llint_t x, const T prob_par, const bool log_form)
+pbern(const llint_t x, const T prob_par, const bool log_form, const bool lower_tail)
 noexcept
 {
-    return internal::pbern_vals_check(x,static_cast<return_t<T>>(prob_par),log_form);
+    return internal::pbern_vals_check(x,static_cast<return_t<T>>(prob_par),log_form,lower_tail);
 }
 
 //
@@ -88,10 +92,10 @@ namespace internal
 template<typename eT, typename T1, typename rT>
 statslib_inline
 void
-pbern_vec(const eT* __stats_pointer_settings__ vals_in, const T1 prob_par, const bool log_form,
+pbern_vec(const eT* __stats_pointer_settings__ vals_in, const T1 prob_par, const bool log_form, const bool lower_tail,
                 rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(pbern,vals_in,vals_out,num_elem,prob_par,log_form);
+    EVAL_DIST_FN_VEC(pbern,vals_in,vals_out,num_elem,prob_par,log_form,lower_tail);
 }
 #endif
 
@@ -103,6 +107,7 @@ pbern_vec(const eT* __stats_pointer_settings__ vals_in, const T1 prob_par, const
  * @param x a standard vector.
  * @param prob_par the probability parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a vector of CDF values corresponding to the elements of \c x.
  * 
@@ -117,9 +122,9 @@ pbern_vec(const eT* __stats_pointer_settings__ vals_in, const T1 prob_par, const
 template<typename eT, typename T1, typename rT>
 statslib_inline
 std::vector<rT>
-pbern(const std::vector<eT>& x, const T1 prob_par, const bool log_form)
+pbern(const std::vector<eT>& x, const T1 prob_par, const bool log_form, const bool lower_tail)
 {
-    STDVEC_DIST_FN(pbern_vec,prob_par,log_form);
+    STDVEC_DIST_FN(pbern_vec,prob_par,log_form,lower_tail);
 }
 #endif
 
@@ -129,6 +134,7 @@ pbern(const std::vector<eT>& x, const T1 prob_par, const bool log_form)
  * @param X a matrix of input values.
  * @param prob_par the probability parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -144,17 +150,17 @@ pbern(const std::vector<eT>& x, const T1 prob_par, const bool log_form)
 template<typename eT, typename T1, typename rT>
 statslib_inline
 ArmaMat<rT>
-pbern(const ArmaMat<eT>& X, const T1 prob_par, const bool log_form)
+pbern(const ArmaMat<eT>& X, const T1 prob_par, const bool log_form, const bool lower_tail)
 {
-    ARMA_DIST_FN(pbern_vec,prob_par,log_form);
+    ARMA_DIST_FN(pbern_vec,prob_par,log_form,lower_tail);
 }
 
 template<typename mT, typename tT, typename T1>
 statslib_inline
 mT
-pbern(const ArmaGen<mT,tT>& X, const T1 prob_par, const bool log_form)
+pbern(const ArmaGen<mT,tT>& X, const T1 prob_par, const bool log_form, const bool lower_tail)
 {
-    return pbern(X.eval(),prob_par,log_form);
+    return pbern(X.eval(),prob_par,log_form,lower_tail);
 }
 #endif
 
@@ -164,6 +170,7 @@ pbern(const ArmaGen<mT,tT>& X, const T1 prob_par, const bool log_form)
  * @param X a matrix of input values.
  * @param prob_par the probability parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -177,9 +184,9 @@ pbern(const ArmaGen<mT,tT>& X, const T1 prob_par, const bool log_form)
 template<typename eT, typename T1, typename rT, bool To>
 statslib_inline
 BlazeMat<rT,To>
-pbern(const BlazeMat<eT,To>& X, const T1 prob_par, const bool log_form)
+pbern(const BlazeMat<eT,To>& X, const T1 prob_par, const bool log_form, const bool lower_tail)
 {
-    BLAZE_DIST_FN(pbern_vec,prob_par,log_form);
+    BLAZE_DIST_FN(pbern_vec,prob_par,log_form,lower_tail);
 }
 #endif
 
@@ -189,6 +196,7 @@ pbern(const BlazeMat<eT,To>& X, const T1 prob_par, const bool log_form)
  * @param X a matrix of input values.
  * @param prob_par the probability parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -202,8 +210,8 @@ pbern(const BlazeMat<eT,To>& X, const T1 prob_par, const bool log_form)
 template<typename eT, typename T1, typename rT, int iTr, int iTc>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-pbern(const EigenMat<eT,iTr,iTc>& X, const T1 prob_par, const bool log_form)
+pbern(const EigenMat<eT,iTr,iTc>& X, const T1 prob_par, const bool log_form, const bool lower_tail)
 {
-    EIGEN_DIST_FN(pbern_vec,prob_par,log_form);
+    EIGEN_DIST_FN(pbern_vec,prob_par,log_form,lower_tail);
 }
 #endif
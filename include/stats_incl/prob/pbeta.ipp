@@ -28,13 +28,17 @@
 namespace internal
 {
 
+// upper tail by symmetry: P(X > x) = I_{1-x}(b,a)
+
 template<typename T>
 statslib_constexpr
 T
-pbeta_compute(const T x, const T a_par, const T b_par)
+pbeta_compute(const T x, const T a_par, const T b_par, const bool lower_tail)
 noexcept
 {
-    return gcem::incomplete_beta(a_par,b_par,x);
+    return( lower_tail ? \
+                gcem::incomplete_beta(a_par,b_par,x) :
+                gcem::incomplete_beta(b_par,a_par,T(1) - x) );
 }
 
 template<typename T>
@@ -60,31 +64,31 @@ noexcept
 template<typename T>
 statslib_constexpr
 T
-pbeta_vals_check(const T x, const T a_par, const T b_par, const bool log_form)
+pbeta_vals_check(const T x, const T a_par, const T b_par, const bool log_form, const bool lower_tail)
 noexcept
 {
     return( !beta_sanity_check(x,a_par,b_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
             x <= T(0) ? \
-                log_zero_if<T>(log_form) :
+                log_if(tail_if(T(0),lower_tail),log_form) :
             x >= T(1) ? \
-                log_if(T(1),log_form) :
+                log_if(tail_if(T(1),lower_tail),log_form) :
             //
             (a_par == T(0) || b_par == T(0) || GCINT::any_posinf(a_par,b_par)) ? \
-                log_if(pbeta_limit_vals(x,a_par,b_par),log_form) :
+                log_if(tail_if(pbeta_limit_vals(x,a_par,b_par),lower_tail),log_form) :
             //
-            log_if(pbeta_compute(x,a_par,b_par), log_form) );
+            log_if(pbeta_compute(x,a_par,b_par,lower_tail), log_form) );
 }
 
 template<typename T1, typename T2, typename T3, typename TC = common_return_t<T1,T2,T3>>
 statslib_constexpr
 TC
-pbeta_type_check(const T1 x, const T2 a_par, const T3 b_par, const bool log_form)
+pbeta_type_check(const T1 x, const T2 a_par, const T3 b_par, const bool log_form, const bool lower_tail)
 noexcept
 {
     return pbeta_vals_check(static_cast<TC>(x),static_cast<TC>(a_par),
-                            static_cast<TC>(b_par),log_form);
+                            static_cast<TC>(b_par),log_form,lower_tail);
 }
 
 }
@@ -96,6 +100,7 @@ noexcept
  * @param a_par a real-valued shape parameter.
  * @param b_par a real-valued shape parameter.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return the cumulative distribution function evaluated at \c x.
  * 
@@ -106,10 +111,10 @@ noexcept
 template<typename T1, typename T2, typename T3>
 statslib_constexpr
 common_return_t<T1,T2,T3>
-pbeta(const T1 x, const T2 a_par, const T3 b_par, const bool log_form)
+pbeta(const T1 x, const T2 a_par, const T3 b_par, const bool log_form, const bool lower_tail)
 noexcept
 {
-    return internal::pbeta_type_check(x,a_par,b_par,log_form);
+    return internal::pbeta_type_check(x,a_par,b_par,log_form,lower_tail);
 }
 
 //
@@ -122,10 +127,39 @@ namespace internal
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 void
-pbeta_vec(const eT* __stats_pointer_settings__ vals_in, const T1 a_par, const T2 b_par, const bool log_form, 
+pbeta_vec(const eT* __stats_pointer_settings__ vals_in, const T1 a_par, const T2 b_par, const bool log_form, const bool lower_tail,
                 rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(pbeta,vals_in,vals_out,num_elem,a_par,b_par,log_form);
+    const rT a_r = static_cast<rT>(a_par);
+    const rT b_r = static_cast<rT>(b_par);
+
+    if (log_form || !GCINT::all_finite(a_r,b_r) || !(a_r > rT(0)) || !(b_r > rT(0))) {
+        EVAL_DIST_FN_VEC(pbeta,vals_in,vals_out,num_elem,a_par,b_par,log_form,lower_tail);
+        return;
+    }
+
+    // 0 < x < 1 through the batch incomplete beta function; the other elements are set to NaN there,
+    // and replaced by their scalar values
+
+    std::vector<rT> y_vals(num_elem);
+
+    for (ullint_t j=ullint_t(0); j < num_elem; ++j)
+    {
+        const rT x_j = static_cast<rT>(vals_in[j]);
+        const bool x_inside = x_j > rT(0) && x_j < rT(1);
+
+        vals_out[j] = x_inside ? x_j : STLIM<rT>::quiet_NaN();
+        y_vals[j] = rT(1) - vals_out[j];
+    }
+
+    incomplete_beta_vec(a_r,b_r,vals_out,y_vals.data(),lower_tail,vals_out,num_elem);
+
+    for (ullint_t j=ullint_t(0); j < num_elem; ++j)
+    {
+        if (GCINT::is_nan(vals_out[j])) {
+            vals_out[j] = pbeta(vals_in[j],a_par,b_par,log_form,lower_tail);
+        }
+    }
 }
 #endif
 
@@ -138,6 +172,7 @@ pbeta_vec(const eT* __stats_pointer_settings__ vals_in, const T1 a_par, const T2
  * @param a_par a real-valued shape parameter.
  * @param b_par a real-valued shape parameter.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a vector of CDF values corresponding to the elements of \c x.
  * 
@@ -152,9 +187,9 @@ pbeta_vec(const eT* __stats_pointer_settings__ vals_in, const T1 a_par, const T2
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 std::vector<rT>
-pbeta(const std::vector<eT>& x, const T1 a_par, const T2 b_par, const bool log_form)
+pbeta(const std::vector<eT>& x, const T1 a_par, const T2 b_par, const bool log_form, const bool lower_tail)
 {
-    STDVEC_DIST_FN(pbeta_vec,a_par,b_par,log_form);
+    STDVEC_DIST_FN(pbeta_vec,a_par,b_par,log_form,lower_tail);
 }
 #endif
 
@@ -165,6 +200,7 @@ pbeta(const std::vector<eT>& x, const T1 a_par, const T2 b_par, const bool log_f
  * @param a_par a real-valued shape parameter.
  * @param b_par a real-valued shape parameter.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -180,17 +216,17 @@ pbeta(const std::vector<eT>& x, const T1 a_par, const T2 b_par, const bool log_f
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 ArmaMat<rT>
-pbeta(const ArmaMat<eT>& X, const T1 a_par, const T2 b_par, const bool log_form)
+pbeta(const ArmaMat<eT>& X, const T1 a_par, const T2 b_par, const bool log_form, const bool lower_tail)
 {
-    ARMA_DIST_FN(pbeta_vec,a_par,b_par,log_form);
+    ARMA_DIST_FN(pbeta_vec,a_par,b_par,log_form,lower_tail);
 }
 
 template<typename mT, typename tT, typename T1, typename T2>
 statslib_inline
 mT
-pbeta(const ArmaGen<mT,tT>& X, const T1 a_par, const T2 b_par, const bool log_form)
+pbeta(const ArmaGen<mT,tT>& X, const T1 a_par, const T2 b_par, const bool log_form, const bool lower_tail)
 {
-    return pbeta(X.eval(),a_par,b_par,log_form);
+    return pbeta(X.eval(),a_par,b_par,log_form,lower_tail);
 }
 #endif
 
@@ -201,6 +237,7 @@ pbeta(const ArmaGen<mT,tT>& X, const T1 a_par, const T2 b_par, const bool log_fo
  * @param a_par a real-valued shape parameter.
  * @param b_par a real-valued shape parameter.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -214,9 +251,9 @@ pbeta(const ArmaGen<mT,tT>& X, const T1 a_par, const T2 b_par, const bool log_fo
 template<typename eT, typename T1, typename T2, typename rT, bool To>
 statslib_inline
 BlazeMat<rT,To>
-pbeta(const BlazeMat<eT,To>& X, const T1 a_par, const T2 b_par, const bool log_form)
+pbeta(const BlazeMat<eT,To>& X, const T1 a_par, const T2 b_par, const bool log_form, const bool lower_tail)
 {
-    BLAZE_DIST_FN(pbeta_vec,a_par,b_par,log_form);
+    BLAZE_DIST_FN(pbeta_vec,a_par,b_par,log_form,lower_tail);
 }
 #endif
 
@@ -227,6 +264,7 @@ pbeta(const BlazeMat<eT,To>& X, const T1 a_par, const T2 b_par, const bool log_f
  * @param a_par a real-valued shape parameter.
  * @param b_par a real-valued shape parameter.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  *
@@ -240,8 +278,8 @@ pbeta(const BlazeMat<eT,To>& X, const T1 a_par, const T2 b_par, const bool log_f
 template<typename eT, typename T1, typename T2, typename rT, int iTr, int iTc>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-pbeta(const EigenMat<eT,iTr,iTc>& X, const T1 a_par, const T2 b_par, const bool log_form)
+pbeta(const EigenMat<eT,iTr,iTc>& X, const T1 a_par, const T2 b_par, const bool log_form, const bool lower_tail)
 {
-    EIGEN_DIST_FN(pbeta_vec,a_par,b_par,log_form);
+    EIGEN_DIST_FN(pbeta_vec,a_par,b_par,log_form,lower_tail);
 }
 #endif
@@ -28,35 +28,42 @@
 namespace internal
 {
 
+// P(X <= x) = I_{1-p}(n-x, x+1) and P(X > x) = I_p(x+1, n-x)
+
 template<typename T>
 statslib_constexpr
 T
-pbinom_compute(const llint_t x, const llint_t n_trials_par, const T prob_par, const llint_t count)
+pbinom_compute(const llint_t x, const llint_t n_trials_par, const T prob_par, const bool lower_tail)
 noexcept
 {
-    return( count == x ? \
-                dbinom(count,n_trials_par,prob_par,false) : 
-                dbinom(count,n_trials_par,prob_par,false) + pbinom_compute(x,n_trials_par,prob_par,count+1) );
+    return( lower_tail ? \
+                gcem::incomplete_beta(T(n_trials_par - x), T(x + 1), T(1) - prob_par) :
+                gcem::incomplete_beta(T(x + 1), T(n_trials_par - x), prob_par) );
 }
 
 template<typename T>
 statslib_constexpr
 T
-pbinom_vals_check(const llint_t x, const llint_t n_trials_par, const T prob_par, const bool log_form)
+pbinom_vals_check(const llint_t x, const llint_t n_trials_par, const T prob_par, const bool log_form, const bool lower_tail)
 noexcept
 {
     return( !binom_sanity_check(n_trials_par,prob_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
             x < llint_t(0) ? \
-                log_zero_if<T>(log_form) :
+                log_if(tail_if(T(0),lower_tail),log_form) :
             x >= n_trials_par ? \
-                log_if(T(1),log_form) : // includes pbinom(0,0,.) case
+                log_if(tail_if(T(1),lower_tail),log_form) : // includes pbinom(0,0,.) case
             //
             n_trials_par == llint_t(1) ? \
-                pbern(x,prob_par,log_form) :
+                pbern(x,prob_par,log_form,lower_tail) :
+            // 0 <= x < n
+            prob_par == T(0) ? \
+                log_if(tail_if(T(1),lower_tail),log_form) :
+            prob_par == T(1) ? \
+                log_if(tail_if(T(0),lower_tail),log_form) :
             //
-            log_if(pbinom_compute(x,n_trials_par,prob_par,llint_t(0)), log_form) );
+            log_if(pbinom_compute(x,n_trials_par,prob_par,lower_tail), log_form) );
 }
 
 }
@@ -68,6 +75,7 @@ noexcept
  * @param n_trials_par the number of trials, a non-negative integral-valued input.
  * @param prob_par the probability parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return the cumulative distribution function evaluated at \c x.
  * 
@@ -78,10 +86,10 @@ noexcept
 template<typename T>
 statslib_constexpr
 T
-pbinom(const llint_t x, const llint_t n_trials_par, const T prob_par, const bool log_form)
+pbinom(const llint_t x, const llint_t n_trials_par, const T prob_par, const bool log_form, const bool lower_tail)
 noexcept
 {
-    return internal::pbinom_vals_check(x,n_trials_par,prob_par,log_form);
+    return internal::pbinom_vals_check(x,n_trials_par,prob_par,log_form,lower_tail);
 }
 
 //
@@ -91,13 +99,194 @@ namespace internal
 {
 
 #ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+// continued fraction of I_z(a,b) (modified Lentz)
+
+template<typename T>
+statslib_inline
+T
+pbinom_cf(const T a_par, const T b_par, const T z)
+{
+    const T tiny_val = STLIM<T>::min() / STLIM<T>::epsilon();
+
+    T c_val = T(1);
+    T d_val = T(1) - (a_par + b_par) * z / (a_par + T(1));
+    d_val = T(1) / (std::abs(d_val) < tiny_val ? tiny_val : d_val);
+
+    T ret = d_val;
+
+    for (int m = 1; m < 1000; ++m)
+    {
+        const T m_d = T(m);
+        const T a_2m = a_par + T(2)*m_d;
+
+        for (int k = 0; k < 2; ++k)
+        {
+            const T coef = (k == 0) ? m_d * (b_par - m_d) * z / ((a_2m - T(1)) * a_2m) :
+                                      - (a_par + m_d) * (a_par + b_par + m_d) * z / (a_2m * (a_2m + T(1)));
+
+            d_val = T(1) + coef * d_val;
+            d_val = T(1) / (std::abs(d_val) < tiny_val ? tiny_val : d_val);
+            c_val = T(1) + coef / c_val;
+            c_val = (std::abs(c_val) < tiny_val ? tiny_val : c_val);
+
+            ret *= c_val * d_val;
+        }
+
+        if (std::abs(c_val * d_val - T(1)) < STLIM<T>::epsilon()) {
+            break;
+        }
+    }
+
+    return ret;
+}
+
+// log f(x) in saddle-point form (Loader, 2000): the O(n eps) cancellation of
+// lgamma(n+1) - lgamma(x+1) - lgamma(n-x+1) is replaced by Stirling remainders and deviances
+
+template<typename T>
+statslib_inline
+T
+pbinom_bd0(const T x, const T mean_val)
+{   // x log(x/m) + m - x
+    const T d_val = (x - mean_val) / mean_val;
+
+    return mean_val * ( (T(1) + d_val)*std::log1p(d_val) - d_val );
+}
+
+template<typename T>
+statslib_inline
+T
+pbinom_log_pmf(const llint_t x, const llint_t n_trials_par, const T prob_par)
+{
+    if (x == llint_t(0)) {
+        return T(n_trials_par) * std::log1p(-prob_par);
+    }
+
+    if (x == n_trials_par) {
+        return T(n_trials_par) * std::log(prob_par);
+    }
+
+    const T n_d = T(n_trials_par);
+    const T x_d = T(x);
+
+    return( lgamma_stirling_err(n_d) - lgamma_stirling_err(x_d) - lgamma_stirling_err(n_d - x_d)
+            - pbinom_bd0(x_d,n_d*prob_par) - pbinom_bd0(n_d - x_d,n_d*(T(1) - prob_par))
+            + T(0.5)*std::log(n_d / (x_d*(n_d - x_d))) - T(0.5)*T(GCEM_LOG_2PI) );
+}
+
+// scalar kernel of the vector path
+
+template<typename T>
+statslib_inline
+T
+pbinom_vec_compute(const llint_t x, const llint_t n_trials_par, const T prob_par, const bool log_form, const bool lower_tail)
+{
+    if (x < llint_t(0) || x >= n_trials_par || prob_par == T(0) || prob_par == T(1) || n_trials_par == llint_t(1)) {
+        return pbinom(x,n_trials_par,prob_par,log_form,lower_tail);
+    }
+
+    // lower tail: I_z(a,b) with z = 1-p, a = n-x, b = x+1, and the prefactor z^a (1-z)^b / (a B(a,b)) = f(x) p
+
+    const T a_par = T(n_trials_par - x);
+    const T b_par = T(x + 1);
+
+    const T log_front = pbinom_log_pmf(x,n_trials_par,prob_par) + std::log(a_par) + std::log(prob_par);
+
+    // evaluate whichever tail converges quickly, then complement if the other one was requested
+
+    const bool lower_cf = (T(1) - prob_par) * (a_par + b_par + T(2)) < a_par + T(1);
+
+    const T log_tail = lower_cf ? log_front + std::log(pbinom_cf(a_par,b_par,T(1) - prob_par) / a_par) :
+                                  log_front + std::log(pbinom_cf(b_par,a_par,prob_par) / b_par);
+
+    if (lower_cf == lower_tail) {
+        return log_form ? log_tail : std::exp(log_tail);
+    }
+
+    return log_form ? std::log1p(-std::exp(log_tail)) : - std::expm1(log_tail);
+}
+
+// sorted input: carry F(x) (or 1 - F(x), walking backward) and f(x) between neighbouring elements,
+// restarting from a direct evaluation across wide gaps or once the pmf term underflows
+
+template<typename eT, typename rT>
+statslib_inline
+void
+pbinom_vec_sorted(const eT* __stats_pointer_settings__ vals_in, const llint_t n_trials_par, const rT prob_par, 
+                  const bool log_form, const bool lower_tail,
+                        rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    const llint_t max_gap = llint_t(64);
+    const rT odds_val = prob_par / (rT(1) - prob_par);
+
+    bool anchored = false;
+    llint_t x_prev = llint_t(0);
+    rT tail_val = rT(0);
+    rT pmf_val = rT(0);
+
+    for (ullint_t i=ullint_t(0); i < num_elem; ++i)
+    {
+        const ullint_t j = lower_tail ? i : num_elem - i - ullint_t(1);
+        const llint_t x_j = static_cast<llint_t>(vals_in[j]);
+
+        if (x_j < llint_t(0) || x_j >= n_trials_par) {
+            vals_out[j] = log_if(tail_if(x_j < llint_t(0) ? rT(0) : rT(1),lower_tail),log_form);
+            continue;
+        }
+
+        const llint_t x_gap = lower_tail ? x_j - x_prev : x_prev - x_j;
+
+        if (!anchored || x_gap > max_gap || pmf_val < STLIM<rT>::min())
+        {
+            tail_val = pbinom_vec_compute(x_j,n_trials_par,prob_par,false,lower_tail);
+            pmf_val = std::exp(pbinom_log_pmf(x_j,n_trials_par,prob_par));
+            anchored = true;
+        }
+        else if (lower_tail)
+        {   // F(k) = F(k-1) + f(k)
+            for (llint_t k = x_prev + 1; k <= x_j; ++k) {
+                pmf_val *= odds_val * rT(n_trials_par - k + 1) / rT(k);
+                tail_val += pmf_val;
+            }
+        }
+        else
+        {   // 1 - F(k-1) = 1 - F(k) + f(k)
+            for (llint_t k = x_prev; k > x_j; --k) {
+                tail_val += pmf_val;
+                pmf_val *= rT(k) / (odds_val * rT(n_trials_par - k + 1));
+            }
+        }
+
+        tail_val = std::min(tail_val,rT(1));
+        x_prev = x_j;
+
+        vals_out[j] = log_form ? std::log(tail_val) : tail_val;
+    }
+}
+
 template<typename eT, typename T1, typename rT>
 statslib_inline
 void
-pbinom_vec(const eT* __stats_pointer_settings__ vals_in, const llint_t n_trials_par, const T1 prob_par, const bool log_form, 
+pbinom_vec(const eT* __stats_pointer_settings__ vals_in, const llint_t n_trials_par, const T1 prob_par, const bool log_form, const bool lower_tail,
                  rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(pbinom,vals_in,vals_out,num_elem,n_trials_par,prob_par,log_form);
+    const rT prob_r = static_cast<rT>(prob_par);
+
+    if (!binom_sanity_check(n_trials_par,prob_r)) {
+        for (ullint_t j=ullint_t(0); j < num_elem; ++j) {
+            vals_out[j] = STLIM<rT>::quiet_NaN();
+        }
+
+        return;
+    }
+
+    if (prob_r > rT(0) && prob_r < rT(1) && n_trials_par > llint_t(1) && is_sorted_vec(vals_in,num_elem)) {
+        pbinom_vec_sorted(vals_in,n_trials_par,prob_r,log_form,lower_tail,vals_out,num_elem);
+        return;
+    }
+
+    EVAL_DIST_FN_VEC(pbinom_vec_compute,vals_in,vals_out,num_elem,n_trials_par,prob_r,log_form,lower_tail);
 }
 #endif
 
@@ -110,6 +299,7 @@ pbinom_vec(const eT* __stats_pointer_settings__ vals_in, const llint_t n_trials_
  * @param n_trials_par the number of trials, a non-negative integral-valued input.
  * @param prob_par the probability parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a vector of CDF values corresponding to the elements of \c x.
  * 
@@ -124,9 +314,9 @@ pbinom_vec(const eT* __stats_pointer_settings__ vals_in, const llint_t n_trials_
 template<typename eT, typename T1, typename rT>
 statslib_inline
 std::vector<rT>
-pbinom(const std::vector<eT>& x, const llint_t n_trials_par, const T1 prob_par, const bool log_form)
+pbinom(const std::vector<eT>& x, const llint_t n_trials_par, const T1 prob_par, const bool log_form, const bool lower_tail)
 {
-    STDVEC_DIST_FN(pbinom_vec,n_trials_par,prob_par,log_form);
+    STDVEC_DIST_FN(pbinom_vec,n_trials_par,prob_par,log_form,lower_tail);
 }
 #endif
 
@@ -137,6 +327,7 @@ pbinom(const std::vector<eT>& x, const llint_t n_trials_par, const T1 prob_par,
  * @param n_trials_par the number of trials, a non-negative integral-valued input.
  * @param prob_par the probability parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -150,17 +341,17 @@ pbinom(const std::vector<eT>& x, const llint_t n_trials_par, const T1 prob_par,
 template<typename eT, typename T1, typename rT>
 statslib_inline
 ArmaMat<rT>
-pbinom(const ArmaMat<eT>& X, const llint_t n_trials_par, const T1 prob_par, const bool log_form)
+pbinom(const ArmaMat<eT>& X, const llint_t n_trials_par, const T1 prob_par, const bool log_form, const bool lower_tail)
 {
-    ARMA_DIST_FN(pbinom_vec,n_trials_par,prob_par,log_form);
+    ARMA_DIST_FN(pbinom_vec,n_trials_par,prob_par,log_form,lower_tail);
 }
 
 template<typename mT, typename tT, typename T1>
 statslib_inline
 mT
-pbinom(const ArmaGen<mT,tT>& X, const llint_t n_trials_par, const T1 prob_par, const bool log_form)
+pbinom(const ArmaGen<mT,tT>& X, const llint_t n_trials_par, const T1 prob_par, const bool log_form, const bool lower_tail)
 {
-    return pbinom(X.eval(),n_trials_par,prob_par,log_form);
+    return pbinom(X.eval(),n_trials_par,prob_par,log_form,lower_tail);
 }
 #endif
 
@@ -171,6 +362,7 @@ pbinom(const ArmaGen<mT,tT>& X, const llint_t n_trials_par, const T1 prob_par, c
  * @param n_trials_par the number of trials, a non-negative integral-valued input.
  * @param prob_par the probability parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -184,9 +376,9 @@ pbinom(const ArmaGen<mT,tT>& X, const llint_t n_trials_par, const T1 prob_par, c
 template<typename eT, typename T1, typename rT, bool To>
 statslib_inline
 BlazeMat<rT,To>
-pbinom(const BlazeMat<eT,To>& X, const llint_t n_trials_par, const T1 prob_par, const bool log_form)
+pbinom(const BlazeMat<eT,To>& X, const llint_t n_trials_par, const T1 prob_par, const bool log_form, const bool lower_tail)
 {
-    BLAZE_DIST_FN(pbinom_vec,n_trials_par,prob_par,log_form);
+    BLAZE_DIST_FN(pbinom_vec,n_trials_par,prob_par,log_form,lower_tail);
 }
 #endif
 
@@ -197,6 +389,7 @@ pbinom(const BlazeMat<eT,To>& X, const llint_t n_trials_par, const T1 prob_par,
  * @param n_trials_par the number of trials, a non-negative integral-valued input.
  * @param prob_par the probability parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -210,8 +403,8 @@ pbinom(const BlazeMat<eT,To>& X, const llint_t n_trials_par, const T1 prob_par,
 template<typename eT, typename T1, typename rT, int iTr, int iTc>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-pbinom(const EigenMat<eT,iTr,iTc>& X, const llint_t n_trials_par, const T1 prob_par, const bool log_form)
+pbinom(const EigenMat<eT,iTr,iTc>& X, const llint_t n_trials_par, const T1 prob_par, const bool log_form, const bool lower_tail)
 {
-    EIGEN_DIST_FN(pbinom_vec,n_trials_par,prob_par,log_form);
+    EIGEN_DIST_FN(pbinom_vec,n_trials_par,prob_par,log_form,lower_tail);
 }
 #endif
@@ -31,7 +31,7 @@
 template<typename T1, typename T2, typename T3>
 statslib_constexpr
 common_return_t<T1,T2,T3>
-pcauchy(const T1 x, const T2 mu_par, const T3 sigma_par, const bool log_form = false) noexcept;
+pcauchy(const T1 x, const T2 mu_par, const T3 sigma_par, const bool log_form = false, const bool lower_tail = true) noexcept;
 
 //
 // vector/matrix input
@@ -40,33 +40,33 @@ pcauchy(const T1 x, const T2 mu_par, const T3 sigma_par, const bool log_form = f
 template<typename eT, typename T1, typename T2, typename rT = common_return_t<eT,T1,T2>>
 statslib_inline
 std::vector<rT>
-pcauchy(const std::vector<eT>& x, const T1 mu_par, const T2 sigma_par, const bool log_form = false);
+pcauchy(const std::vector<eT>& x, const T1 mu_par, const T2 sigma_par, const bool log_form = false, const bool lower_tail = true);
 #endif
 
 #ifdef STATS_ENABLE_ARMA_WRAPPERS
 template<typename eT, typename T1, typename T2, typename rT = common_return_t<eT,T1,T2>>
 statslib_inline
 ArmaMat<rT>
-pcauchy(const ArmaMat<eT>& X, const T1 mu_par, const T2 sigma_par, const bool log_form = false);
+pcauchy(const ArmaMat<eT>& X, const T1 mu_par, const T2 sigma_par, const bool log_form = false, const bool lower_tail = true);
 
 template<typename mT, typename tT, typename T1, typename T2>
 statslib_inline
 mT
-pcauchy(const ArmaGen<mT,tT>& X, const T1 mu_par, const T2 sigma_par, const bool log_form = false);
+pcauchy(const ArmaGen<mT,tT>& X, const T1 mu_par, const T2 sigma_par, const bool log_form = false, const bool lower_tail = true);
 #endif
 
 #ifdef STATS_ENABLE_BLAZE_WRAPPERS
 template<typename eT, typename T1, typename T2, typename rT = common_return_t<eT,T1,T2>, bool To = blaze::columnMajor>
 statslib_inline
 BlazeMat<rT,To>
-pcauchy(const BlazeMat<eT,To>& X, const T1 mu_par, const T2 sigma_par, const bool log_form = false);
+pcauchy(const BlazeMat<eT,To>& X, const T1 mu_par, const T2 sigma_par, const bool log_form = false, const bool lower_tail = true);
 #endif
 
 #ifdef STATS_ENABLE_EIGEN_WRAPPERS
 template<typename eT, typename T1, typename T2, typename rT = common_return_t<eT,T1,T2>, int iTr = Eigen::Dynamic, int iTc = Eigen::Dynamic>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-pcauchy(const EigenMat<eT,iTr,iTc>& X, const T1 mu_par, const T2 sigma_par, const bool log_form = false);
+pcauchy(const EigenMat<eT,iTr,iTc>& X, const T1 mu_par, const T2 sigma_par, const bool log_form = false, const bool lower_tail = true);
 #endif
 
 //
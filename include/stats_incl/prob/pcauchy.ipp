@@ -28,13 +28,26 @@
 namespace internal
 {
 
+// for z > 0, P(Z > z) = atan(1/z) / pi avoids the cancellation in 1/2 - atan(z) / pi
+
+template<typename T>
+statslib_constexpr
+T
+pcauchy_upper_compute(const T z)
+noexcept
+{
+    return( z > T(0) ? \
+                stmath::atan(T(1) / z) / T(GCEM_PI) :
+                T(0.5) - stmath::atan(z) / T(GCEM_PI) );
+}
+
 template<typename T>
 statslib_constexpr
 T
-pcauchy_compute(const T z)
+pcauchy_compute(const T z, const bool lower_tail)
 noexcept
 {
-    return( T(0.5) + stmath::atan(z) / T(GCEM_PI) );
+    return pcauchy_upper_compute(lower_tail ? -z : z);
 }
 
 template<typename T>
@@ -65,26 +78,26 @@ noexcept
 template<typename T>
 statslib_constexpr
 T
-pcauchy_vals_check(const T x, const T mu_par, const T sigma_par, const bool log_form)
+pcauchy_vals_check(const T x, const T mu_par, const T sigma_par, const bool log_form, const bool lower_tail)
 noexcept
 {
     return( !cauchy_sanity_check(x,mu_par,sigma_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
             GCINT::any_inf(x,mu_par,sigma_par) ? \
-                log_if(pcauchy_limit_vals(x,mu_par,sigma_par),log_form) :
+                log_if(tail_if(pcauchy_limit_vals(x,mu_par,sigma_par),lower_tail),log_form) :
             //
-            log_if(pcauchy_compute((x-mu_par)/sigma_par), log_form) );
+            log_if(pcauchy_compute((x-mu_par)/sigma_par,lower_tail), log_form) );
 }
 
 template<typename T1, typename T2, typename T3, typename TC = common_return_t<T1,T2,T3>>
 statslib_constexpr
 TC
-pcauchy_type_check(const T1 x, const T2 mu_par, const T3 sigma_par, const bool log_form)
+pcauchy_type_check(const T1 x, const T2 mu_par, const T3 sigma_par, const bool log_form, const bool lower_tail)
 noexcept
 {
     return pcauchy_vals_check(static_cast<TC>(x),static_cast<TC>(mu_par),
-                              static_cast<TC>(sigma_par),log_form);
+                              static_cast<TC>(sigma_par),log_form,lower_tail);
 }
 
 }
@@ -96,6 +109,7 @@ noexcept
  * @param mu_par the location parameter, a real-valued input.
  * @param sigma_par the scale parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return the cumulative distribution function evaluated at \c x.
  * 
@@ -106,10 +120,10 @@ noexcept
 template<typename T1, typename T2, typename T3>
 statslib_constexpr
 common_return_t<T1,T2,T3>
-pcauchy(const T1 x, const T2 mu_par, const T3 sigma_par, const bool log_form)
+pcauchy(const T1 x, const T2 mu_par, const T3 sigma_par, const bool log_form, const bool lower_tail)
 noexcept
 {
-    return internal::pcauchy_type_check(x,mu_par,sigma_par,log_form);
+    return internal::pcauchy_type_check(x,mu_par,sigma_par,log_form,lower_tail);
 }
 
 //
@@ -122,10 +136,10 @@ namespace internal
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 void
-pcauchy_vec(const eT* __stats_pointer_settings__ vals_in, const T1 mu_par, const T2 sigma_par, const bool log_form, 
+pcauchy_vec(const eT* __stats_pointer_settings__ vals_in, const T1 mu_par, const T2 sigma_par, const bool log_form, const bool lower_tail,
                   rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(pcauchy,vals_in,vals_out,num_elem,mu_par,sigma_par,log_form);
+    EVAL_DIST_FN_VEC(pcauchy,vals_in,vals_out,num_elem,mu_par,sigma_par,log_form,lower_tail);
 }
 #endif
 
@@ -138,6 +152,7 @@ pcauchy_vec(const eT* __stats_pointer_settings__ vals_in, const T1 mu_par, const
  * @param mu_par the location parameter, a real-valued input.
  * @param sigma_par the scale parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a vector of CDF values corresponding to the elements of \c x.
  * 
@@ -152,9 +167,9 @@ pcauchy_vec(const eT* __stats_pointer_settings__ vals_in, const T1 mu_par, const
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 std::vector<rT>
-pcauchy(const std::vector<eT>& x, const T1 mu_par, const T2 sigma_par, const bool log_form)
+pcauchy(const std::vector<eT>& x, const T1 mu_par, const T2 sigma_par, const bool log_form, const bool lower_tail)
 {
-    STDVEC_DIST_FN(pcauchy_vec,mu_par,sigma_par,log_form);
+    STDVEC_DIST_FN(pcauchy_vec,mu_par,sigma_par,log_form,lower_tail);
 }
 #endif
 
@@ -165,6 +180,7 @@ pcauchy(const std::vector<eT>& x, const T1 mu_par, const T2 sigma_par, const boo
  * @param mu_par the location parameter, a real-valued input.
  * @param sigma_par the scale parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -180,17 +196,17 @@ pcauchy(const std::vector<eT>& x, const T1 mu_par, const T2 sigma_par, const boo
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 ArmaMat<rT>
-pcauchy(const ArmaMat<eT>& X, const T1 mu_par, const T2 sigma_par, const bool log_form)
+pcauchy(const ArmaMat<eT>& X, const T1 mu_par, const T2 sigma_par, const bool log_form, const bool lower_tail)
 {
-    ARMA_DIST_FN(pcauchy_vec,mu_par,sigma_par,log_form);
+    ARMA_DIST_FN(pcauchy_vec,mu_par,sigma_par,log_form,lower_tail);
 }
 
 template<typename mT, typename tT, typename T1, typename T2>
 statslib_inline
 mT
-pcauchy(const ArmaGen<mT,tT>& X, const T1 mu_par, const T2 sigma_par, const bool log_form)
+pcauchy(const ArmaGen<mT,tT>& X, const T1 mu_par, const T2 sigma_par, const bool log_form, const bool lower_tail)
 {
-    return pcauchy(X.eval(),mu_par,sigma_par,log_form);
+    return pcauchy(X.eval(),mu_par,sigma_par,log_form,lower_tail);
 }
 #endif
 
@@ -201,6 +217,7 @@ pcauchy(const ArmaGen<mT,tT>& X, const T1 mu_par, const T2 sigma_par, const bool
  * @param mu_par the location parameter, a real-valued input.
  * @param sigma_par the scale parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -214,9 +231,9 @@ pcauchy(const ArmaGen<mT,tT>& X, const T1 mu_par, const T2 sigma_par, const bool
 template<typename eT, typename T1, typename T2, typename rT, bool To>
 statslib_inline
 BlazeMat<rT,To>
-pcauchy(const BlazeMat<eT,To>& X, const T1 mu_par, const T2 sigma_par, const bool log_form)
+pcauchy(const BlazeMat<eT,To>& X, const T1 mu_par, const T2 sigma_par, const bool log_form, const bool lower_tail)
 {
-    BLAZE_DIST_FN(pcauchy_vec,mu_par,sigma_par,log_form);
+    BLAZE_DIST_FN(pcauchy_vec,mu_par,sigma_par,log_form,lower_tail);
 }
 #endif
 
@@ -227,6 +244,7 @@ pcauchy(const BlazeMat<eT,To>& X, const T1 mu_par, const T2 sigma_par, const boo
  * @param mu_par the location parameter, a real-valued input.
  * @param sigma_par the scale parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -240,8 +258,8 @@ pcauchy(const BlazeMat<eT,To>& X, const T1 mu_par, const T2 sigma_par, const boo
 template<typename eT, typename T1, typename T2, typename rT, int iTr, int iTc>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-pcauchy(const EigenMat<eT,iTr,iTc>& X, const T1 mu_par, const T2 sigma_par, const bool log_form)
+pcauchy(const EigenMat<eT,iTr,iTc>& X, const T1 mu_par, const T2 sigma_par, const bool log_form, const bool lower_tail)
 {
-    EIGEN_DIST_FN(pcauchy_vec,mu_par,sigma_par,log_form);
+    EIGEN_DIST_FN(pcauchy_vec,mu_par,sigma_par,log_form,lower_tail);
 }
 #endif
@@ -31,7 +31,7 @@
 template<typename T1, typename T2>
 statslib_constexpr
 common_return_t<T1,T2>
-pchisq(const T1 x, const T2 dof_par, const bool log_form = false) noexcept;
+pchisq(const T1 x, const T2 dof_par, const bool log_form = false, const bool lower_tail = true) noexcept;
 
 //
 // vector/matrix input
@@ -40,33 +40,33 @@ pchisq(const T1 x, const T2 dof_par, const bool log_form = false) noexcept;
 template<typename eT, typename T1, typename rT = common_return_t<eT,T1>>
 statslib_inline
 std::vector<rT>
-pchisq(const std::vector<eT>& x, const T1 dof_par, const bool log_form = false);
+pchisq(const std::vector<eT>& x, const T1 dof_par, const bool log_form = false, const bool lower_tail = true);
 #endif
 
 #ifdef STATS_ENABLE_ARMA_WRAPPERS
 template<typename eT, typename T1, typename rT = common_return_t<eT,T1>>
 statslib_inline
 ArmaMat<rT>
-pchisq(const ArmaMat<eT>& X, const T1 dof_par, const bool log_form = false);
+pchisq(const ArmaMat<eT>& X, const T1 dof_par, const bool log_form = false, const bool lower_tail = true);
 
 template<typename mT, typename tT, typename T1>
 statslib_inline
 mT 
-pchisq(const ArmaGen<mT,tT>& X, const T1 dof_par, const bool log_form = false);
+pchisq(const ArmaGen<mT,tT>& X, const T1 dof_par, const bool log_form = false, const bool lower_tail = true);
 #endif
 
 #ifdef STATS_ENABLE_BLAZE_WRAPPERS
 template<typename eT, typename T1, typename rT = common_return_t<eT,T1>, bool To = blaze::columnMajor>
 statslib_inline
 BlazeMat<rT,To>
-pchisq(const BlazeMat<eT,To>& X, const T1 dof_par, const bool log_form = false);
+pchisq(const BlazeMat<eT,To>& X, const T1 dof_par, const bool log_form = false, const bool lower_tail = true);
 #endif
 
 #ifdef STATS_ENABLE_EIGEN_WRAPPERS
 template<typename eT, typename T1, typename rT = common_return_t<eT,T1>, int iTr = Eigen::Dynamic, int iTc = Eigen::Dynamic>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-pchisq(const EigenMat<eT,iTr,iTc>& X, const T1 dof_par, const bool log_form = false);
+pchisq(const EigenMat<eT,iTr,iTc>& X, const T1 dof_par, const bool log_form = false, const bool lower_tail = true);
 #endif
 
 //
@@ -31,42 +31,42 @@ namespace internal
 template<typename T>
 statslib_constexpr
 T
-pchisq_compute(const T x, const T dof_par)
+pchisq_compute(const T x, const T dof_par, const bool log_form, const bool lower_tail)
 noexcept
 {
-    return gcem::incomplete_gamma(dof_par/T(2),x/T(2));
+    return pgamma_compute(x,dof_par/T(2),T(2),log_form,lower_tail);
 }
 
 template<typename T>
 statslib_constexpr
 T
-pchisq_vals_check(const T x, const T dof_par, const bool log_form)
+pchisq_vals_check(const T x, const T dof_par, const bool log_form, const bool lower_tail)
 noexcept
 {
     return( !chisq_sanity_check(x,dof_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
             STLIM<T>::epsilon() > x ? \
-                log_zero_if<T>(log_form) : 
+                log_if(tail_if(T(0),lower_tail),log_form) : 
             // now x > 0 cases
             dof_par == T(0) ? \
-                log_one_if<T>(log_form) :
+                log_if(tail_if(T(1),lower_tail),log_form) :
             //
             GCINT::is_posinf(x) ? \
-                log_one_if<T>(log_form) :
+                log_if(tail_if(T(1),lower_tail),log_form) :
             GCINT::is_posinf(dof_par) ? \
-                log_zero_if<T>(log_form) :
+                log_if(tail_if(T(0),lower_tail),log_form) :
             //
-            log_if(pchisq_compute(x,dof_par), log_form) );
+            pchisq_compute(x,dof_par,log_form,lower_tail) );
 }
 
 template<typename T1, typename T2, typename TC = common_return_t<T1,T2>>
 statslib_constexpr
 TC
-pchisq_type_check(const T1 x, const T2 dof_par, const bool log_form)
+pchisq_type_check(const T1 x, const T2 dof_par, const bool log_form, const bool lower_tail)
 noexcept
 {
-    return pchisq_vals_check(static_cast<TC>(x),static_cast<TC>(dof_par),log_form);
+    return pchisq_vals_check(static_cast<TC>(x),static_cast<TC>(dof_par),log_form,lower_tail);
 }
 
 }
@@ -77,6 +77,7 @@ noexcept
  * @param x a real-valued input.
  * @param dof_par the degrees of freedom parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return the cumulative distribution function evaluated at \c x.
  * 
@@ -87,10 +88,10 @@ noexcept
 template<typename T1, typename T2>
 statslib_constexpr
 common_return_t<T1,T2>
-pchisq(const T1 x, const T2 dof_par, const bool log_form)
+pchisq(const T1 x, const T2 dof_par, const bool log_form, const bool lower_tail)
 noexcept
 {
-    return internal::pchisq_type_check(x,dof_par,log_form);
+    return internal::pchisq_type_check(x,dof_par,log_form,lower_tail);
 }
 
 //
@@ -103,10 +104,24 @@ namespace internal
 template<typename eT, typename T1, typename rT>
 statslib_inline
 void
-pchisq_vec(const eT* __stats_pointer_settings__ vals_in, const T1 dof_par, const bool log_form, 
+pchisq_vec(const eT* __stats_pointer_settings__ vals_in, const T1 dof_par, const bool log_form, const bool lower_tail,
                  rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(pchisq,vals_in,vals_out,num_elem,dof_par,log_form);
+    const rT dof_r = static_cast<rT>(dof_par);
+
+    if (log_form || !GCINT::is_finite(dof_r) || !(dof_r > rT(0))) {
+        EVAL_DIST_FN_VEC(pchisq,vals_in,vals_out,num_elem,dof_par,log_form,lower_tail);
+        return;
+    }
+
+    pgamma_batch_compute(vals_in,dof_r/rT(2),rT(2),lower_tail,vals_out,num_elem);
+
+    for (ullint_t j=ullint_t(0); j < num_elem; ++j)
+    {
+        if (GCINT::is_nan(vals_out[j])) {
+            vals_out[j] = pchisq(vals_in[j],dof_par,log_form,lower_tail);
+        }
+    }
 }
 #endif
 
@@ -118,6 +133,7 @@ pchisq_vec(const eT* __stats_pointer_settings__ vals_in, const T1 dof_par, const
  * @param x a standard vector.
  * @param dof_par the degrees of freedom parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a vector of CDF values corresponding to the elements of \c x.
  * 
@@ -132,9 +148,9 @@ pchisq_vec(const eT* __stats_pointer_settings__ vals_in, const T1 dof_par, const
 template<typename eT, typename T1, typename rT>
 statslib_inline
 std::vector<rT>
-pchisq(const std::vector<eT>& x, const T1 dof_par, const bool log_form)
+pchisq(const std::vector<eT>& x, const T1 dof_par, const bool log_form, const bool lower_tail)
 {
-    STDVEC_DIST_FN(pchisq_vec,dof_par,log_form);
+    STDVEC_DIST_FN(pchisq_vec,dof_par,log_form,lower_tail);
 }
 #endif
 
@@ -144,6 +160,7 @@ pchisq(const std::vector<eT>& x, const T1 dof_par, const bool log_form)
  * @param X a matrix of input values.
  * @param dof_par the degrees of freedom parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -159,17 +176,17 @@ pchisq(const std::vector<eT>& x, const T1 dof_par, const bool log_form)
 template<typename eT, typename T1, typename rT>
 statslib_inline
 ArmaMat<rT>
-pchisq(const ArmaMat<eT>& X, const T1 dof_par, const bool log_form)
+pchisq(const ArmaMat<eT>& X, const T1 dof_par, const bool log_form, const bool lower_tail)
 {
-    ARMA_DIST_FN(pchisq_vec,dof_par,log_form);
+    ARMA_DIST_FN(pchisq_vec,dof_par,log_form,lower_tail);
 }
 
 template<typename mT, typename tT, typename T1>
 statslib_inline
 mT
-pchisq(const ArmaGen<mT,tT>& X, const T1 dof_par, const bool log_form)
+pchisq(const ArmaGen<mT,tT>& X, const T1 dof_par, const bool log_form, const bool lower_tail)
 {
-    return pchisq(X.eval(),dof_par,log_form);
+    return pchisq(X.eval(),dof_par,log_form,lower_tail);
 }
 #endif
 
@@ -179,6 +196,7 @@ pchisq(const ArmaGen<mT,tT>& X, const T1 dof_par, const bool log_form)
  * @param X a matrix of input values.
  * @param dof_par the degrees of freedom parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -192,9 +210,9 @@ pchisq(const ArmaGen<mT,tT>& X, const T1 dof_par, const bool log_form)
 template<typename eT, typename T1, typename rT, bool To>
 statslib_inline
 BlazeMat<rT,To>
-pchisq(const BlazeMat<eT,To>& X, const T1 dof_par, const bool log_form)
+pchisq(const BlazeMat<eT,To>& X, const T1 dof_par, const bool log_form, const bool lower_tail)
 {
-    BLAZE_DIST_FN(pchisq_vec,dof_par,log_form);
+    BLAZE_DIST_FN(pchisq_vec,dof_par,log_form,lower_tail);
 }
 #endif
 
@@ -204,6 +222,7 @@ pchisq(const BlazeMat<eT,To>& X, const T1 dof_par, const bool log_form)
  * @param X a matrix of input values.
  * @param dof_par the degrees of freedom parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -217,8 +236,8 @@ pchisq(const BlazeMat<eT,To>& X, const T1 dof_par, const bool log_form)
 template<typename eT, typename T1, typename rT, int iTr, int iTc>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-pchisq(const EigenMat<eT,iTr,iTc>& X, const T1 dof_par, const bool log_form)
+pchisq(const EigenMat<eT,iTr,iTc>& X, const T1 dof_par, const bool log_form, const bool lower_tail)
 {
-    EIGEN_DIST_FN(pchisq_vec,dof_par,log_form);
+    EIGEN_DIST_FN(pchisq_vec,dof_par,log_form,lower_tail);
 }
 #endif
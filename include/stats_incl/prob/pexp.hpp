@@ -31,7 +31,7 @@
 template<typename T1, typename T2>
 statslib_constexpr
 common_return_t<T1,T2>
-pexp(const T1 x, const T2 rate_par, const bool log_form = false) noexcept;
+pexp(const T1 x, const T2 rate_par, const bool log_form = false, const bool lower_tail = true) noexcept;
 
 //
 // vector/matrix input
@@ -40,33 +40,33 @@ pexp(const T1 x, const T2 rate_par, const bool log_form = false) noexcept;
 template<typename eT, typename T1, typename rT = common_return_t<eT,T1>>
 statslib_inline
 std::vector<rT>
-pexp(const std::vector<eT>& x, const T1 rate_par, const bool log_form = false);
+pexp(const std::vector<eT>& x, const T1 rate_par, const bool log_form = false, const bool lower_tail = true);
 #endif
 
 #ifdef STATS_ENABLE_ARMA_WRAPPERS
 template<typename eT, typename T1, typename rT = common_return_t<eT,T1>>
 statslib_inline
 ArmaMat<rT>
-pexp(const ArmaMat<eT>& X, const T1 rate_par, const bool log_form = false);
+pexp(const ArmaMat<eT>& X, const T1 rate_par, const bool log_form = false, const bool lower_tail = true);
 
 template<typename mT, typename tT, typename T1>
 statslib_inline
 mT 
-pexp(const ArmaGen<mT,tT>& X, const T1 rate_par, const bool log_form = false);
+pexp(const ArmaGen<mT,tT>& X, const T1 rate_par, const bool log_form = false, const bool lower_tail = true);
 #endif
 
 #ifdef STATS_ENABLE_BLAZE_WRAPPERS
 template<typename eT, typename T1, typename rT = common_return_t<eT,T1>, bool To = blaze::columnMajor>
 statslib_inline
 BlazeMat<rT,To>
-pexp(const BlazeMat<eT,To>& X, const T1 rate_par, const bool log_form = false);
+pexp(const BlazeMat<eT,To>& X, const T1 rate_par, const bool log_form = false, const bool lower_tail = true);
 #endif
 
 #ifdef STATS_ENABLE_EIGEN_WRAPPERS
 template<typename eT, typename T1, typename rT = common_return_t<eT,T1>, int iTr = Eigen::Dynamic, int iTc = Eigen::Dynamic>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-pexp(const EigenMat<eT,iTr,iTc>& X, const T1 rate_par, const bool log_form = false);
+pexp(const EigenMat<eT,iTr,iTc>& X, const T1 rate_par, const bool log_form = false, const bool lower_tail = true);
 #endif
 
 //
@@ -31,36 +31,40 @@ namespace internal
 template<typename T>
 statslib_constexpr
 T
-pexp_compute(const T x, const T rate_par)
+pexp_compute(const T x, const T rate_par, const bool log_form, const bool lower_tail)
 {
     return( x <= T(0) ? \
-                T(0) :
+                log_if(tail_if(T(0),lower_tail),log_form) :
             // x > 0
             GCINT::is_posinf(rate_par) ? \
-                T(1) :
-            //
-            - stmath::expm1(-rate_par*x) );
+                log_if(tail_if(T(1),lower_tail),log_form) :
+            // P(X > x) = exp(-rate*x)
+            lower_tail ? \
+                log_if(- stmath::expm1(-rate_par*x),log_form) :
+            log_form ? \
+                - rate_par*x :
+                stmath::exp(-rate_par*x) );
 }
 
 template<typename T>
 statslib_constexpr
 T
-pexp_vals_check(const T x, const T rate_par, const bool log_form)
+pexp_vals_check(const T x, const T rate_par, const bool log_form, const bool lower_tail)
 noexcept
 {
     return( !exp_sanity_check(x,rate_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            log_if(pexp_compute(x,rate_par), log_form) );
+            pexp_compute(x,rate_par,log_form,lower_tail) );
 }
 
 template<typename T1, typename T2, typename TC = common_return_t<T1,T2>>
 statslib_constexpr
 TC
-pexp_type_check(const T1 x, const T2 rate_par, const bool log_form)
+pexp_type_check(const T1 x, const T2 rate_par, const bool log_form, const bool lower_tail)
 noexcept
 {
-    return pexp_vals_check(static_cast<TC>(x),static_cast<TC>(rate_par),log_form);
+    return pexp_vals_check(static_cast<TC>(x),static_cast<TC>(rate_par),log_form,lower_tail);
 }
 
 }
@@ -71,6 +75,7 @@ noexcept
  * @param x a real-valued input.
  * @param rate_par the rate parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return the cumulative distribution function evaluated at \c x.
  * 
@@ -81,10 +86,10 @@ noexcept
 template<typename T1, typename T2>
 statslib_constexpr
 common_return_t<T1,T2>
-pexp(const T1 x, const T2 rate_par, const bool log_form)
+pexp(const T1 x, const T2 rate_par, const bool log_form, const bool lower_tail)
 noexcept
 {
-    return internal::pexp_type_check(x,rate_par,log_form);
+    return internal::pexp_type_check(x,rate_par,log_form,lower_tail);
 }
 
 //
@@ -97,10 +102,10 @@ namespace internal
 template<typename eT, typename T1, typename rT>
 statslib_inline
 void
-pexp_vec(const eT* __stats_pointer_settings__ vals_in, const T1 rate_par, const bool log_form, 
+pexp_vec(const eT* __stats_pointer_settings__ vals_in, const T1 rate_par, const bool log_form, const bool lower_tail,
                rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(pexp,vals_in,vals_out,num_elem,rate_par,log_form);
+    EVAL_DIST_FN_VEC(pexp,vals_in,vals_out,num_elem,rate_par,log_form,lower_tail);
 }
 #endif
 
@@ -112,6 +117,7 @@ pexp_vec(const eT* __stats_pointer_settings__ vals_in, const T1 rate_par, const
  * @param x a standard vector.
  * @param rate_par the rate parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a vector of CDF values corresponding to the elements of \c x.
  * 
@@ -126,9 +132,9 @@ pexp_vec(const eT* __stats_pointer_settings__ vals_in, const T1 rate_par, const
 template<typename eT, typename T1, typename rT>
 statslib_inline
 std::vector<rT>
-pexp(const std::vector<eT>& x, const T1 rate_par, const bool log_form)
+pexp(const std::vector<eT>& x, const T1 rate_par, const bool log_form, const bool lower_tail)
 {
-    STDVEC_DIST_FN(pexp_vec,rate_par,log_form);
+    STDVEC_DIST_FN(pexp_vec,rate_par,log_form,lower_tail);
 }
 #endif
 
@@ -138,6 +144,7 @@ pexp(const std::vector<eT>& x, const T1 rate_par, const bool log_form)
  * @param X a matrix of input values.
  * @param rate_par the rate parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -153,17 +160,17 @@ pexp(const std::vector<eT>& x, const T1 rate_par, const bool log_form)
 template<typename eT, typename T1, typename rT>
 statslib_inline
 ArmaMat<rT>
-pexp(const ArmaMat<eT>& X, const T1 rate_par, const bool log_form)
+pexp(const ArmaMat<eT>& X, const T1 rate_par, const bool log_form, const bool lower_tail)
 {
-    ARMA_DIST_FN(pexp_vec,rate_par,log_form);
+    ARMA_DIST_FN(pexp_vec,rate_par,log_form,lower_tail);
 }
 
 template<typename mT, typename tT, typename T1>
 statslib_inline
 mT
-pexp(const ArmaGen<mT,tT>& X, const T1 rate_par, const bool log_form)
+pexp(const ArmaGen<mT,tT>& X, const T1 rate_par, const bool log_form, const bool lower_tail)
 {
-    return pexp(X.eval(),rate_par,log_form);
+    return pexp(X.eval(),rate_par,log_form,lower_tail);
 }
 #endif
 
@@ -173,6 +180,7 @@ pexp(const ArmaGen<mT,tT>& X, const T1 rate_par, const bool log_form)
  * @param X a matrix of input values.
  * @param rate_par the rate parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -186,9 +194,9 @@ pexp(const ArmaGen<mT,tT>& X, const T1 rate_par, const bool log_form)
 template<typename eT, typename T1, typename rT, bool To>
 statslib_inline
 BlazeMat<rT,To>
-pexp(const BlazeMat<eT,To>& X, const T1 rate_par, const bool log_form)
+pexp(const BlazeMat<eT,To>& X, const T1 rate_par, const bool log_form, const bool lower_tail)
 {
-    BLAZE_DIST_FN(pexp_vec,rate_par,log_form);
+    BLAZE_DIST_FN(pexp_vec,rate_par,log_form,lower_tail);
 }
 #endif
 
@@ -198,6 +206,7 @@ pexp(const BlazeMat<eT,To>& X, const T1 rate_par, const bool log_form)
  * @param X a matrix of input values.
  * @param rate_par the rate parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -211,8 +220,8 @@ pexp(const BlazeMat<eT,To>& X, const T1 rate_par, const bool log_form)
 template<typename eT, typename T1, typename rT, int iTr, int iTc>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-pexp(const EigenMat<eT,iTr,iTc>& X, const T1 rate_par, const bool log_form)
+pexp(const EigenMat<eT,iTr,iTc>& X, const T1 rate_par, const bool log_form, const bool lower_tail)
 {
-    EIGEN_DIST_FN(pexp_vec,rate_par,log_form);
+    EIGEN_DIST_FN(pexp_vec,rate_par,log_form,lower_tail);
 }
 #endif
@@ -28,61 +28,65 @@
 namespace internal
 {
 
+// with z = df1*x/df2: P(X <= x) = I_{z/(1+z)}(a,b) and P(X > x) = I_{1/(1+z)}(b,a)
+
 template<typename T>
 statslib_constexpr
 T
-pf_compute(const T x, const T a_par, const T b_par)
+pf_compute(const T z, const T a_par, const T b_par, const bool lower_tail)
 {
-    return gcem::incomplete_beta(a_par,b_par, x / (T(1) + x));
+    return( lower_tail ? \
+                gcem::incomplete_beta(a_par,b_par, z / (T(1) + z)) :
+                gcem::incomplete_beta(b_par,a_par, T(1) / (T(1) + z)) );
 }
 
 template<typename T>
 statslib_constexpr
 T
-pf_limit_vals_dof(const T x, const T df1_par, const T df2_par, const bool log_form)
+pf_limit_vals_dof(const T x, const T df1_par, const T df2_par, const bool log_form, const bool lower_tail)
 noexcept
 {
     return( // df1 == +Inf and df2 == +Inf
             GCINT::all_posinf(df1_par,df2_par) ? \
                 x > T(1) ? \
-                    log_one_if<T>(log_form) :
+                    log_if(tail_if(T(1),lower_tail),log_form) :
                 x == T(1) ? \
                     log_if(T(0.5),log_form) :
-                    log_zero_if<T>(log_form) :
-            // df1 == +Inf
+                    log_if(tail_if(T(0),lower_tail),log_form) :
+            // df1 == +Inf: X = df2 / chi^2(df2)
             GCINT::is_posinf(df1_par) ? \
-                T(1) - pchisq(df2_par/x,df2_par,log_form) :
+                pchisq(df2_par/x,df2_par,log_form,!lower_tail) :
             // df2 == +Inf
-                pchisq(x*df1_par,df1_par,log_form) );
+                pchisq(x*df1_par,df1_par,log_form,lower_tail) );
 }
 
 template<typename T>
 statslib_constexpr
 T
-pf_vals_check(const T x, const T df1_par, const T df2_par, const bool log_form)
+pf_vals_check(const T x, const T df1_par, const T df2_par, const bool log_form, const bool lower_tail)
 {
     return( !f_sanity_check(x,df1_par,df2_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
             STLIM<T>::epsilon() > x ? \
-                log_zero_if<T>(log_form) :
+                log_if(tail_if(T(0),lower_tail),log_form) :
             GCINT::is_posinf(x) ? \
-                log_one_if<T>(log_form) :
+                log_if(tail_if(T(1),lower_tail),log_form) :
             //
             GCINT::any_posinf(df1_par,df2_par) ? \
-                pf_limit_vals_dof(x,df1_par,df2_par,log_form) :
+                pf_limit_vals_dof(x,df1_par,df2_par,log_form,lower_tail) :
             //
-            log_if(pf_compute(df1_par*x/df2_par,df1_par/T(2),df2_par/T(2)), log_form) );
+            log_if(pf_compute(df1_par*x/df2_par,df1_par/T(2),df2_par/T(2),lower_tail), log_form) );
 }
 
 template<typename T1, typename T2, typename T3, typename TC = common_return_t<T1,T2,T3>>
 statslib_constexpr
 TC
-pf_type_check(const T1 x, const T2 df1_par, const T3 df2_par, const bool log_form)
+pf_type_check(const T1 x, const T2 df1_par, const T3 df2_par, const bool log_form, const bool lower_tail)
 noexcept
 {
     return pf_vals_check(static_cast<TC>(x),static_cast<TC>(df1_par),
-                         static_cast<TC>(df2_par),log_form);
+                         static_cast<TC>(df2_par),log_form,lower_tail);
 }
 
 }
@@ -94,6 +98,7 @@ noexcept
  * @param df1_par a degrees of freedom parameter, a real-valued input.
  * @param df2_par a degrees of freedom parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return the cumulative distribution function evaluated at \c x.
  * 
@@ -104,10 +109,10 @@ noexcept
 template<typename T1, typename T2, typename T3>
 statslib_constexpr
 common_return_t<T1,T2,T3>
-pf(const T1 x, const T2 df1_par, const T3 df2_par, const bool log_form)
+pf(const T1 x, const T2 df1_par, const T3 df2_par, const bool log_form, const bool lower_tail)
 noexcept
 {
-    return internal::pf_type_check(x,df1_par,df2_par,log_form);
+    return internal::pf_type_check(x,df1_par,df2_par,log_form,lower_tail);
 }
 
 //
@@ -120,10 +125,39 @@ namespace internal
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 void
-pf_vec(const eT* __stats_pointer_settings__ vals_in, const T1 df1_par, const T2 df2_par, const bool log_form, 
+pf_vec(const eT* __stats_pointer_settings__ vals_in, const T1 df1_par, const T2 df2_par, const bool log_form, const bool lower_tail,
              rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(pf,vals_in,vals_out,num_elem,df1_par,df2_par,log_form);
+    const rT df1_r = static_cast<rT>(df1_par);
+    const rT df2_r = static_cast<rT>(df2_par);
+
+    if (log_form || !GCINT::all_finite(df1_r,df2_r) || !(df1_r >= STLIM<rT>::epsilon()) || !(df2_r >= STLIM<rT>::epsilon())) {
+        EVAL_DIST_FN_VEC(pf,vals_in,vals_out,num_elem,df1_par,df2_par,log_form,lower_tail);
+        return;
+    }
+
+    // with z = df1*x/df2, the batch incomplete beta function at z/(1+z), with 1/(1+z) formed directly;
+    // x < eps and non-finite x are set to NaN there, and replaced by their scalar values
+
+    std::vector<rT> y_vals(num_elem);
+
+    for (ullint_t j=ullint_t(0); j < num_elem; ++j)
+    {
+        const rT x_j = static_cast<rT>(vals_in[j]);
+        const rT z_j = (x_j >= STLIM<rT>::epsilon() && x_j < STLIM<rT>::infinity()) ? df1_r*x_j/df2_r : STLIM<rT>::quiet_NaN();
+
+        vals_out[j] = z_j / (rT(1) + z_j);
+        y_vals[j] = rT(1) / (rT(1) + z_j);
+    }
+
+    incomplete_beta_vec(df1_r/rT(2),df2_r/rT(2),vals_out,y_vals.data(),lower_tail,vals_out,num_elem);
+
+    for (ullint_t j=ullint_t(0); j < num_elem; ++j)
+    {
+        if (GCINT::is_nan(vals_out[j])) {
+            vals_out[j] = pf(vals_in[j],df1_par,df2_par,log_form,lower_tail);
+        }
+    }
 }
 #endif
 
@@ -136,6 +170,7 @@ pf_vec(const eT* __stats_pointer_settings__ vals_in, const T1 df1_par, const T2
  * @param df1_par a degrees of freedom parameter, a real-valued input.
  * @param df2_par a degrees of freedom parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a vector of CDF values corresponding to the elements of \c x.
  * 
@@ -150,9 +185,9 @@ pf_vec(const eT* __stats_pointer_settings__ vals_in, const T1 df1_par, const T2
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 std::vector<rT>
-pf(const std::vector<eT>& x, const T1 df1_par, const T2 df2_par, const bool log_form)
+pf(const std::vector<eT>& x, const T1 df1_par, const T2 df2_par, const bool log_form, const bool lower_tail)
 {
-    STDVEC_DIST_FN(pf_vec,df1_par,df2_par,log_form);
+    STDVEC_DIST_FN(pf_vec,df1_par,df2_par,log_form,lower_tail);
 }
 #endif
 
@@ -163,6 +198,7 @@ pf(const std::vector<eT>& x, const T1 df1_par, const T2 df2_par, const bool log_
  * @param df1_par a degrees of freedom parameter, a real-valued input.
  * @param df2_par a degrees of freedom parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -178,17 +214,17 @@ pf(const std::vector<eT>& x, const T1 df1_par, const T2 df2_par, const bool log_
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 ArmaMat<rT>
-pf(const ArmaMat<eT>& X, const T1 df1_par, const T2 df2_par, const bool log_form)
+pf(const ArmaMat<eT>& X, const T1 df1_par, const T2 df2_par, const bool log_form, const bool lower_tail)
 {
-    ARMA_DIST_FN(pf_vec,df1_par,df2_par,log_form);
+    ARMA_DIST_FN(pf_vec,df1_par,df2_par,log_form,lower_tail);
 }
 
 template<typename mT, typename tT, typename T1, typename T2>
 statslib_inline
 mT
-pf(const ArmaGen<mT,tT>& X, const T1 df1_par, const T2 df2_par, const bool log_form)
+pf(const ArmaGen<mT,tT>& X, const T1 df1_par, const T2 df2_par, const bool log_form, const bool lower_tail)
 {
-    return pf(X.eval(),df1_par,df2_par,log_form);
+    return pf(X.eval(),df1_par,df2_par,log_form,lower_tail);
 }
 #endif
 
@@ -199,6 +235,7 @@ pf(const ArmaGen<mT,tT>& X, const T1 df1_par, const T2 df2_par, const bool log_f
  * @param df1_par a degrees of freedom parameter, a real-valued input.
  * @param df2_par a degrees of freedom parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -212,9 +249,9 @@ pf(const ArmaGen<mT,tT>& X, const T1 df1_par, const T2 df2_par, const bool log_f
 template<typename eT, typename T1, typename T2, typename rT, bool To>
 statslib_inline
 BlazeMat<rT,To>
-pf(const BlazeMat<eT,To>& X, const T1 df1_par, const T2 df2_par, const bool log_form)
+pf(const BlazeMat<eT,To>& X, const T1 df1_par, const T2 df2_par, const bool log_form, const bool lower_tail)
 {
-    BLAZE_DIST_FN(pf_vec,df1_par,df2_par,log_form);
+    BLAZE_DIST_FN(pf_vec,df1_par,df2_par,log_form,lower_tail);
 }
 #endif
 
@@ -225,6 +262,7 @@ pf(const BlazeMat<eT,To>& X, const T1 df1_par, const T2 df2_par, const bool log_
  * @param df1_par a degrees of freedom parameter, a real-valued input.
  * @param df2_par a degrees of freedom parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -238,8 +276,8 @@ pf(const BlazeMat<eT,To>& X, const T1 df1_par, const T2 df2_par, const bool log_
 template<typename eT, typename T1, typename T2, typename rT, int iTr, int iTc>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-pf(const EigenMat<eT,iTr,iTc>& X, const T1 df1_par, const T2 df2_par, const bool log_form)
+pf(const EigenMat<eT,iTr,iTc>& X, const T1 df1_par, const T2 df2_par, const bool log_form, const bool lower_tail)
 {
-    EIGEN_DIST_FN(pf_vec,df1_par,df2_par,log_form);
+    EIGEN_DIST_FN(pf_vec,df1_par,df2_par,log_form,lower_tail);
 }
 #endif
@@ -28,13 +28,116 @@
 namespace internal
 {
 
+// regularized incomplete gamma functions, P(a,z) and Q(a,z) = 1 - P(a,z): away from the lower tail, Q comes from
+// the Legendre continued fraction, P = 1 - Q; otherwise P comes from gcem, Q = 1 - P. On the log scale, both tails
+// are computed without forming the probability, so that they extend past the smallest double.
+
 template<typename T>
 statslib_constexpr
 T
-pgamma_compute(const T x, const T shape_par, const T scale_par)
+pgamma_log_front_d(const T a_par, const T d_val)
 noexcept
 {
-    return gcem::incomplete_gamma(shape_par,x/scale_par);
+    return( - a_par*(d_val - stmath::log1p(d_val)) + T(0.5)*stmath::log(a_par) - T(0.5)*T(GCEM_LOG_2PI) - lgamma_stirling_err(a_par) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+pgamma_log_front(const T a_par, const T z)
+noexcept
+{   // log( exp(-z) z^a / Gamma(a) ), for large a without the O(a*eps) cancellation of -z + a log(z) - lgamma(a)
+    return( a_par < T(32) ? \
+                a_par*stmath::log(z) - z - stmath::lgamma(a_par) :
+                pgamma_log_front_d(a_par,(z - a_par) / a_par) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+pgamma_upper_cf(const T a_par, const T z, const int depth)
+noexcept
+{   // Legendre continued fraction for Q(a,z); converges quickly for z > a + 2*sqrt(a)
+    return( depth < 100 ? \
+                (z + T(2*depth + 1) - a_par) - T(depth + 1)*(T(depth + 1) - a_par) / pgamma_upper_cf(a_par,z,depth+1) :
+                (z + T(2*depth + 1) - a_par) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+pgamma_log_upper_cf(const T a_par, const T z)
+noexcept
+{
+    return pgamma_log_front(a_par,z) - stmath::log(pgamma_upper_cf(a_par,z,0));
+}
+
+template<typename T>
+statslib_constexpr
+T
+pgamma_lower_series(const T a_par, const T z, const T term, const T sum_val, const int depth)
+noexcept
+{   // sum_{n >= 0} z^n / ((a+1) ... (a+n))
+    return( depth < 1000 && term > STLIM<T>::epsilon() * sum_val ? \
+                pgamma_lower_series(a_par,z,term*z/(a_par + T(depth + 1)),sum_val + term*z/(a_par + T(depth + 1)),depth+1) :
+                sum_val );
+}
+
+template<typename T>
+statslib_constexpr
+T
+pgamma_log_lower_series(const T a_par, const T z)
+noexcept
+{
+    return pgamma_log_front(a_par,z) - stmath::log(a_par) + stmath::log(pgamma_lower_series(a_par,z,T(1),T(1),0));
+}
+
+template<typename T>
+statslib_constexpr
+bool
+pgamma_use_cf(const T a_par, const T z)
+noexcept
+{
+    return( z > a_par + T(1) && z > a_par + T(2) * stmath::sqrt(a_par) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+pgamma_tail_compute(const T a_par, const T z, const bool lower_tail)
+noexcept
+{
+    return( pgamma_use_cf(a_par,z) ? \
+                tail_if(stmath::exp(pgamma_log_upper_cf(a_par,z)),!lower_tail) :
+                tail_if(static_cast<T>(gcem::incomplete_gamma(a_par,z)),lower_tail) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+pgamma_log_tail_compute(const T a_par, const T z, const bool lower_tail)
+noexcept
+{
+    return( pgamma_use_cf(a_par,z) ? \
+                lower_tail ? \
+                    stmath::log1p(- stmath::exp(pgamma_log_upper_cf(a_par,z))) :
+                    pgamma_log_upper_cf(a_par,z) :
+            // P(a,z) underflows: z well below a
+            lower_tail && pgamma_log_front(a_par,z) - stmath::log(a_par) < stmath::log(STLIM<T>::min()) ? \
+                pgamma_log_lower_series(a_par,z) :
+            //
+                stmath::log(tail_if(static_cast<T>(gcem::incomplete_gamma(a_par,z)),lower_tail)) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+pgamma_compute(const T x, const T shape_par, const T scale_par, const bool log_form, const bool lower_tail)
+noexcept
+{
+    return( log_form ? \
+                pgamma_log_tail_compute(shape_par,x/scale_par,lower_tail) :
+                pgamma_tail_compute(shape_par,x/scale_par,lower_tail) );
 }
 
 template<typename T>
@@ -61,7 +164,7 @@ noexcept
 template<typename T>
 statslib_constexpr
 T
-pgamma_vals_check(const T x, const T shape_par, const T scale_par, const bool log_form)
+pgamma_vals_check(const T x, const T shape_par, const T scale_par, const bool log_form, const bool lower_tail)
 noexcept
 {
     return( !gamma_sanity_check(x,shape_par,scale_par) ? \
@@ -71,22 +174,22 @@ noexcept
                 STLIM<T>::quiet_NaN() :
             //
             STLIM<T>::epsilon() > x ? \
-                log_zero_if<T>(log_form) :
+                log_if(tail_if(T(0),lower_tail),log_form) :
             //
             GCINT::any_posinf(x,shape_par,scale_par) || shape_par == T(0) ? \
-                log_if(pgamma_limit_vals(x,shape_par,scale_par), log_form) :
+                log_if(tail_if(pgamma_limit_vals(x,shape_par,scale_par),lower_tail), log_form) :
             //
-            log_if(pgamma_compute(x,shape_par,scale_par), log_form) );
+            pgamma_compute(x,shape_par,scale_par,log_form,lower_tail) );
 }
 
 template<typename T1, typename T2, typename T3, typename TC = common_return_t<T1,T2,T3>>
 statslib_constexpr
 TC
-pgamma_type_check(const T1 x, const T2 shape_par, const T3 scale_par, const bool log_form)
+pgamma_type_check(const T1 x, const T2 shape_par, const T3 scale_par, const bool log_form, const bool lower_tail)
 noexcept
 {
     return pgamma_vals_check(static_cast<TC>(x),static_cast<TC>(shape_par),
-                             static_cast<TC>(scale_par),log_form);
+                             static_cast<TC>(scale_par),log_form,lower_tail);
 }
 
 }
@@ -98,6 +201,7 @@ noexcept
  * @param shape_par the shape parameter, a real-valued input.
  * @param scale_par the scale parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return the cumulative distribution function evaluated at \c x.
  *
@@ -108,10 +212,10 @@ noexcept
 template<typename T1, typename T2, typename T3>
 statslib_constexpr
 common_return_t<T1,T2,T3>
-pgamma(const T1 x, const T2 shape_par, const T3 scale_par, const bool log_form)
+pgamma(const T1 x, const T2 shape_par, const T3 scale_par, const bool log_form, const bool lower_tail)
 noexcept
 {
-    return internal::pgamma_type_check(x,shape_par,scale_par,log_form);
+    return internal::pgamma_type_check(x,shape_par,scale_par,log_form,lower_tail);
 }
 
 //
@@ -121,13 +225,48 @@ namespace internal
 {
 
 #ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+// finite shape > 0 and scale > 0: the elements with eps <= x < Inf through the batch incomplete gamma function;
+// the others are set to NaN, to be replaced by the caller's scalar values
+
+template<typename eT, typename rT>
+statslib_inline
+void
+pgamma_batch_compute(const eT* __stats_pointer_settings__ vals_in, const rT shape_par, const rT scale_par, const bool lower_tail,
+                           rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    for (ullint_t j=ullint_t(0); j < num_elem; ++j)
+    {
+        const rT x_j = static_cast<rT>(vals_in[j]);
+
+        vals_out[j] = (x_j >= STLIM<rT>::epsilon() && x_j < STLIM<rT>::infinity()) ? x_j / scale_par : STLIM<rT>::quiet_NaN();
+    }
+
+    incomplete_gamma_vec(shape_par,vals_out,lower_tail,vals_out,num_elem);
+}
+
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 void
-pgamma_vec(const eT* __stats_pointer_settings__ vals_in, const T1 shape_par, const T2 scale_par, const bool log_form, 
+pgamma_vec(const eT* __stats_pointer_settings__ vals_in, const T1 shape_par, const T2 scale_par, const bool log_form, const bool lower_tail,
                  rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(pgamma,vals_in,vals_out,num_elem,shape_par,scale_par,log_form);
+    const rT shape_r = static_cast<rT>(shape_par);
+    const rT scale_r = static_cast<rT>(scale_par);
+
+    if (log_form || !GCINT::all_finite(shape_r,scale_r) || !(shape_r > rT(0)) || !(scale_r > rT(0))) {
+        EVAL_DIST_FN_VEC(pgamma,vals_in,vals_out,num_elem,shape_par,scale_par,log_form,lower_tail);
+        return;
+    }
+
+    pgamma_batch_compute(vals_in,shape_r,scale_r,lower_tail,vals_out,num_elem);
+
+    for (ullint_t j=ullint_t(0); j < num_elem; ++j)
+    {
+        if (GCINT::is_nan(vals_out[j])) {
+            vals_out[j] = pgamma(vals_in[j],shape_par,scale_par,log_form,lower_tail);
+        }
+    }
 }
 #endif
 
@@ -140,6 +279,7 @@ pgamma_vec(const eT* __stats_pointer_settings__ vals_in, const T1 shape_par, con
  * @param shape_par the shape parameter, a real-valued input.
  * @param scale_par the scale parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a vector of CDF values corresponding to the elements of \c x.
  * 
@@ -154,9 +294,9 @@ pgamma_vec(const eT* __stats_pointer_settings__ vals_in, const T1 shape_par, con
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 std::vector<rT>
-pgamma(const std::vector<eT>& x, const T1 shape_par, const T2 scale_par, const bool log_form)
+pgamma(const std::vector<eT>& x, const T1 shape_par, const T2 scale_par, const bool log_form, const bool lower_tail)
 {
-    STDVEC_DIST_FN(pgamma_vec,shape_par,scale_par,log_form);
+    STDVEC_DIST_FN(pgamma_vec,shape_par,scale_par,log_form,lower_tail);
 }
 #endif
 
@@ -167,6 +307,7 @@ pgamma(const std::vector<eT>& x, const T1 shape_par, const T2 scale_par, const b
  * @param shape_par the shape parameter, a real-valued input.
  * @param scale_par the scale parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -182,17 +323,17 @@ pgamma(const std::vector<eT>& x, const T1 shape_par, const T2 scale_par, const b
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 ArmaMat<rT>
-pgamma(const ArmaMat<eT>& X, const T1 shape_par, const T2 scale_par, const bool log_form)
+pgamma(const ArmaMat<eT>& X, const T1 shape_par, const T2 scale_par, const bool log_form, const bool lower_tail)
 {
-    ARMA_DIST_FN(pgamma_vec,shape_par,scale_par,log_form);
+    ARMA_DIST_FN(pgamma_vec,shape_par,scale_par,log_form,lower_tail);
 }
 
 template<typename mT, typename tT, typename T1, typename T2>
 statslib_inline
 mT
-pgamma(const ArmaGen<mT,tT>& X, const T1 shape_par, const T2 scale_par, const bool log_form)
+pgamma(const ArmaGen<mT,tT>& X, const T1 shape_par, const T2 scale_par, const bool log_form, const bool lower_tail)
 {
-    return pgamma(X.eval(),shape_par,scale_par,log_form);
+    return pgamma(X.eval(),shape_par,scale_par,log_form,lower_tail);
 }
 #endif
 
@@ -203,6 +344,7 @@ pgamma(const ArmaGen<mT,tT>& X, const T1 shape_par, const T2 scale_par, const bo
  * @param shape_par the shape parameter, a real-valued input.
  * @param scale_par the scale parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -216,9 +358,9 @@ pgamma(const ArmaGen<mT,tT>& X, const T1 shape_par, const T2 scale_par, const bo
 template<typename eT, typename T1, typename T2, typename rT, bool To>
 statslib_inline
 BlazeMat<rT,To>
-pgamma(const BlazeMat<eT,To>& X, const T1 shape_par, const T2 scale_par, const bool log_form)
+pgamma(const BlazeMat<eT,To>& X, const T1 shape_par, const T2 scale_par, const bool log_form, const bool lower_tail)
 {
-    BLAZE_DIST_FN(pgamma_vec,shape_par,scale_par,log_form);
+    BLAZE_DIST_FN(pgamma_vec,shape_par,scale_par,log_form,lower_tail);
 }
 #endif
 
@@ -229,6 +371,7 @@ pgamma(const BlazeMat<eT,To>& X, const T1 shape_par, const T2 scale_par, const b
  * @param shape_par the shape parameter, a real-valued input.
  * @param scale_par the scale parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -242,8 +385,8 @@ pgamma(const BlazeMat<eT,To>& X, const T1 shape_par, const T2 scale_par, const b
 template<typename eT, typename T1, typename T2, typename rT, int iTr, int iTc>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-pgamma(const EigenMat<eT,iTr,iTc>& X, const T1 shape_par, const T2 scale_par, const bool log_form)
+pgamma(const EigenMat<eT,iTr,iTc>& X, const T1 shape_par, const T2 scale_par, const bool log_form, const bool lower_tail)
 {
-    EIGEN_DIST_FN(pgamma_vec,shape_par,scale_par,log_form);
+    EIGEN_DIST_FN(pgamma_vec,shape_par,scale_par,log_form,lower_tail);
 }
 #endif
@@ -31,51 +31,51 @@ namespace internal
 template<typename T>
 statslib_constexpr
 T
-pinvgamma_compute(const T recip_inp, const T shape_par, const T recip_par, const bool log_form)
+pinvgamma_compute(const T recip_inp, const T shape_par, const T recip_par, const bool log_form, const bool lower_tail)
 noexcept
-{
-    return log_if(T(1) - pgamma(recip_inp,shape_par,recip_par), log_form);
+{   // P(X <= x) = P(1/X >= 1/x): the tails swap
+    return pgamma(recip_inp,shape_par,recip_par,log_form,!lower_tail);
 }
 
 template<typename T>
 statslib_constexpr
 T
-pinvgamma_limit_vals(const T recip_inp, const T shape_par, const T rate_par, const bool log_form)
+pinvgamma_limit_vals(const T recip_inp, const T shape_par, const T rate_par, const bool log_form, const bool lower_tail)
 noexcept
 {
     return( rate_par == T(0) ? \
-                pinvgamma_compute(recip_inp, shape_par, STLIM<T>::infinity(), log_form) :
+                pinvgamma_compute(recip_inp, shape_par, STLIM<T>::infinity(), log_form, lower_tail) :
             //
             GCINT::is_posinf(rate_par) ? \
-                pinvgamma_compute(recip_inp, shape_par, T(0), log_form) :
+                pinvgamma_compute(recip_inp, shape_par, T(0), log_form, lower_tail) :
             //
-                pinvgamma_compute(recip_inp, shape_par, T(1)/rate_par, log_form) );
+                pinvgamma_compute(recip_inp, shape_par, T(1)/rate_par, log_form, lower_tail) );
 }
 
 template<typename T>
 statslib_constexpr
 T
-pinvgamma_vals_check(const T x, const T shape_par, const T rate_par, const bool log_form)
+pinvgamma_vals_check(const T x, const T shape_par, const T rate_par, const bool log_form, const bool lower_tail)
 noexcept
 {
     return( !invgamma_sanity_check(x,shape_par,rate_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
             x < T(0) ? \
-                log_zero_if<T>(log_form) :
+                log_if(tail_if(T(0),lower_tail),log_form) :
             //
             pinvgamma_limit_vals( (x == T(0) ? STLIM<T>::infinity() : (GCINT::is_posinf(x) ? T(0) : T(1)/x)),
-                                  shape_par, rate_par, log_form ));
+                                  shape_par, rate_par, log_form, lower_tail ));
 }
 
 template<typename T1, typename T2, typename T3, typename TC = common_return_t<T1,T2,T3>>
 statslib_constexpr
 TC
-pinvgamma_type_check(const T1 x, const T2 shape_par, const T3 rate_par, const bool log_form)
+pinvgamma_type_check(const T1 x, const T2 shape_par, const T3 rate_par, const bool log_form, const bool lower_tail)
 noexcept
 {
     return pinvgamma_vals_check(static_cast<TC>(x),static_cast<TC>(shape_par),
-                                static_cast<TC>(rate_par),log_form);
+                                static_cast<TC>(rate_par),log_form,lower_tail);
 }
 
 }
@@ -87,6 +87,7 @@ noexcept
  * @param shape_par the shape parameter, a real-valued input.
  * @param rate_par the rate parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return the cumulative distribution function evaluated at \c x.
  *
@@ -97,10 +98,10 @@ noexcept
 template<typename T1, typename T2, typename T3>
 statslib_constexpr
 common_return_t<T1,T2,T3>
-pinvgamma(const T1 x, const T2 shape_par, const T3 rate_par, const bool log_form)
+pinvgamma(const T1 x, const T2 shape_par, const T3 rate_par, const bool log_form, const bool lower_tail)
 noexcept
 {
-    return internal::pinvgamma_type_check(x,shape_par,rate_par,log_form);
+    return internal::pinvgamma_type_check(x,shape_par,rate_par,log_form,lower_tail);
 }
 
 //
@@ -113,10 +114,10 @@ namespace internal
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 void
-pinvgamma_vec(const eT* __stats_pointer_settings__ vals_in, const T1 shape_par, const T2 rate_par, const bool log_form, 
+pinvgamma_vec(const eT* __stats_pointer_settings__ vals_in, const T1 shape_par, const T2 rate_par, const bool log_form, const bool lower_tail,
                     rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(pinvgamma,vals_in,vals_out,num_elem,shape_par,rate_par,log_form);
+    EVAL_DIST_FN_VEC(pinvgamma,vals_in,vals_out,num_elem,shape_par,rate_par,log_form,lower_tail);
 }
 #endif
 
@@ -129,6 +130,7 @@ pinvgamma_vec(const eT* __stats_pointer_settings__ vals_in, const T1 shape_par,
  * @param shape_par the shape parameter, a real-valued input.
  * @param rate_par the rate parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a vector of CDF values corresponding to the elements of \c x.
  * 
@@ -143,9 +145,9 @@ pinvgamma_vec(const eT* __stats_pointer_settings__ vals_in, const T1 shape_par,
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 std::vector<rT>
-pinvgamma(const std::vector<eT>& x, const T1 shape_par, const T2 rate_par, const bool log_form)
+pinvgamma(const std::vector<eT>& x, const T1 shape_par, const T2 rate_par, const bool log_form, const bool lower_tail)
 {
-    STDVEC_DIST_FN(pinvgamma_vec,shape_par,rate_par,log_form);
+    STDVEC_DIST_FN(pinvgamma_vec,shape_par,rate_par,log_form,lower_tail);
 }
 #endif
 
@@ -156,6 +158,7 @@ pinvgamma(const std::vector<eT>& x, const T1 shape_par, const T2 rate_par, const
  * @param shape_par the shape parameter, a real-valued input.
  * @param rate_par the rate parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -171,17 +174,17 @@ pinvgamma(const std::vector<eT>& x, const T1 shape_par, const T2 rate_par, const
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 ArmaMat<rT>
-pinvgamma(const ArmaMat<eT>& X, const T1 shape_par, const T2 rate_par, const bool log_form)
+pinvgamma(const ArmaMat<eT>& X, const T1 shape_par, const T2 rate_par, const bool log_form, const bool lower_tail)
 {
-    ARMA_DIST_FN(pinvgamma_vec,shape_par,rate_par,log_form);
+    ARMA_DIST_FN(pinvgamma_vec,shape_par,rate_par,log_form,lower_tail);
 }
 
 template<typename mT, typename tT, typename T1, typename T2>
 statslib_inline
 mT
-pinvgamma(const ArmaGen<mT,tT>& X, const T1 shape_par, const T2 rate_par, const bool log_form)
+pinvgamma(const ArmaGen<mT,tT>& X, const T1 shape_par, const T2 rate_par, const bool log_form, const bool lower_tail)
 {
-    return pinvgamma(X.eval(),shape_par,rate_par,log_form);
+    return pinvgamma(X.eval(),shape_par,rate_par,log_form,lower_tail);
 }
 #endif
 
@@ -192,6 +195,7 @@ pinvgamma(const ArmaGen<mT,tT>& X, const T1 shape_par, const T2 rate_par, const
  * @param shape_par the shape parameter, a real-valued input.
  * @param rate_par the rate parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -205,9 +209,9 @@ pinvgamma(const ArmaGen<mT,tT>& X, const T1 shape_par, const T2 rate_par, const
 template<typename eT, typename T1, typename T2, typename rT, bool To>
 statslib_inline
 BlazeMat<rT,To>
-pinvgamma(const BlazeMat<eT,To>& X, const T1 shape_par, const T2 rate_par, const bool log_form)
+pinvgamma(const BlazeMat<eT,To>& X, const T1 shape_par, const T2 rate_par, const bool log_form, const bool lower_tail)
 {
-    BLAZE_DIST_FN(pinvgamma_vec,shape_par,rate_par,log_form);
+    BLAZE_DIST_FN(pinvgamma_vec,shape_par,rate_par,log_form,lower_tail);
 }
 #endif
 
@@ -218,6 +222,7 @@ pinvgamma(const BlazeMat<eT,To>& X, const T1 shape_par, const T2 rate_par, const
  * @param shape_par the shape parameter, a real-valued input.
  * @param rate_par the rate parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -231,8 +236,8 @@ pinvgamma(const BlazeMat<eT,To>& X, const T1 shape_par, const T2 rate_par, const
 template<typename eT, typename T1, typename T2, typename rT, int iTr, int iTc>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-pinvgamma(const EigenMat<eT,iTr,iTc>& X, const T1 shape_par, const T2 rate_par, const bool log_form)
+pinvgamma(const EigenMat<eT,iTr,iTc>& X, const T1 shape_par, const T2 rate_par, const bool log_form, const bool lower_tail)
 {
-    EIGEN_DIST_FN(pinvgamma_vec,shape_par,rate_par,log_form);
+    EIGEN_DIST_FN(pinvgamma_vec,shape_par,rate_par,log_form,lower_tail);
 }
 #endif
@@ -31,10 +31,23 @@ namespace internal
 template<typename T>
 statslib_constexpr
 T
-pkumaraswamy_compute(const T x, const T a_par, const T b_par)
+pkumaraswamy_log_upper(const T x, const T a_par, const T b_par)
+noexcept
+{   // log P(X > x) = b * log(1 - x^a)
+    return b_par * stmath::log1p(- stmath::pow(x, a_par));
+}
+
+template<typename T>
+statslib_constexpr
+T
+pkumaraswamy_compute(const T x, const T a_par, const T b_par, const bool log_form, const bool lower_tail)
 noexcept
 {
-    return T(1) - stmath::pow(T(1) - stmath::pow(x, a_par), b_par);
+    return( lower_tail ? \
+                log_if(- stmath::expm1(pkumaraswamy_log_upper(x,a_par,b_par)),log_form) :
+            log_form ? \
+                pkumaraswamy_log_upper(x,a_par,b_par) :
+                stmath::exp(pkumaraswamy_log_upper(x,a_par,b_par)) );
 }
 
 template<typename T>
@@ -60,31 +73,31 @@ noexcept
 template<typename T>
 statslib_constexpr
 T
-pkumaraswamy_vals_check(const T x, const T a_par, const T b_par, const bool log_form)
+pkumaraswamy_vals_check(const T x, const T a_par, const T b_par, const bool log_form, const bool lower_tail)
 noexcept
 {
     return( !beta_sanity_check(x,a_par,b_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
             x <= T(0) ? \
-                log_zero_if<T>(log_form) :
+                log_if(tail_if(T(0),lower_tail),log_form) :
             x >= T(1) ? \
-                log_if(T(1),log_form) :
+                log_if(tail_if(T(1),lower_tail),log_form) :
             //
             (a_par == T(0) || b_par == T(0) || GCINT::any_posinf(a_par,b_par)) ? \
-                log_if(pkumaraswamy_limit_vals(x,a_par,b_par),log_form) :
+                log_if(tail_if(pkumaraswamy_limit_vals(x,a_par,b_par),lower_tail),log_form) :
             //
-            log_if(pkumaraswamy_compute(x,a_par,b_par), log_form) );
+            pkumaraswamy_compute(x,a_par,b_par,log_form,lower_tail) );
 }
 
 template<typename T1, typename T2, typename T3, typename TC = common_return_t<T1,T2,T3>>
 statslib_constexpr
 TC
-pkumaraswamy_type_check(const T1 x, const T2 a_par, const T3 b_par, const bool log_form)
+pkumaraswamy_type_check(const T1 x, const T2 a_par, const T3 b_par, const bool log_form, const bool lower_tail)
 noexcept
 {
     return pkumaraswamy_vals_check(static_cast<TC>(x), static_cast<TC>(a_par),
-                                   static_cast<TC>(b_par), log_form);
+                                   static_cast<TC>(b_par), log_form, lower_tail);
 }
 
 }
@@ -96,6 +109,7 @@ noexcept
  * @param a_par a real-valued shape parameter.
  * @param b_par a real-valued shape parameter.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return the cumulative distribution function evaluated at \c x.
  * 
@@ -106,10 +120,10 @@ noexcept
 template<typename T1, typename T2, typename T3>
 statslib_constexpr
 common_return_t<T1,T2,T3>
-pkumaraswamy(const T1 x, const T2 a_par, const T3 b_par, const bool log_form)
+pkumaraswamy(const T1 x, const T2 a_par, const T3 b_par, const bool log_form, const bool lower_tail)
 noexcept
 {
-    return internal::pkumaraswamy_type_check(x,a_par,b_par,log_form);
+    return internal::pkumaraswamy_type_check(x,a_par,b_par,log_form,lower_tail);
 }
 
 //
@@ -122,10 +136,10 @@ namespace internal
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 void
-pkumaraswamy_vec(const eT* __stats_pointer_settings__ vals_in, const T1 a_par, const T2 b_par, const bool log_form, 
+pkumaraswamy_vec(const eT* __stats_pointer_settings__ vals_in, const T1 a_par, const T2 b_par, const bool log_form, const bool lower_tail,
                  rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(pkumaraswamy,vals_in,vals_out,num_elem,a_par,b_par,log_form);
+    EVAL_DIST_FN_VEC(pkumaraswamy,vals_in,vals_out,num_elem,a_par,b_par,log_form,lower_tail);
 }
 #endif
 
@@ -138,6 +152,7 @@ pkumaraswamy_vec(const eT* __stats_pointer_settings__ vals_in, const T1 a_par, c
  * @param a_par a real-valued shape parameter.
  * @param b_par a real-valued shape parameter.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a vector of CDF values corresponding to the elements of \c x.
  * 
@@ -152,9 +167,9 @@ pkumaraswamy_vec(const eT* __stats_pointer_settings__ vals_in, const T1 a_par, c
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 std::vector<rT>
-pkumaraswamy(const std::vector<eT>& x, const T1 a_par, const T2 b_par, const bool log_form)
+pkumaraswamy(const std::vector<eT>& x, const T1 a_par, const T2 b_par, const bool log_form, const bool lower_tail)
 {
-    STDVEC_DIST_FN(pkumaraswamy_vec,a_par,b_par,log_form);
+    STDVEC_DIST_FN(pkumaraswamy_vec,a_par,b_par,log_form,lower_tail);
 }
 #endif
 
@@ -165,6 +180,7 @@ pkumaraswamy(const std::vector<eT>& x, const T1 a_par, const T2 b_par, const boo
  * @param a_par a real-valued shape parameter.
  * @param b_par a real-valued shape parameter.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -180,17 +196,17 @@ pkumaraswamy(const std::vector<eT>& x, const T1 a_par, const T2 b_par, const boo
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 ArmaMat<rT>
-pkumaraswamy(const ArmaMat<eT>& X, const T1 a_par, const T2 b_par, const bool log_form)
+pkumaraswamy(const ArmaMat<eT>& X, const T1 a_par, const T2 b_par, const bool log_form, const bool lower_tail)
 {
-    ARMA_DIST_FN(pkumaraswamy_vec,a_par,b_par,log_form);
+    ARMA_DIST_FN(pkumaraswamy_vec,a_par,b_par,log_form,lower_tail);
 }
 
 template<typename mT, typename tT, typename T1, typename T2>
 statslib_inline
 mT
-pkumaraswamy(const ArmaGen<mT,tT>& X, const T1 a_par, const T2 b_par, const bool log_form)
+pkumaraswamy(const ArmaGen<mT,tT>& X, const T1 a_par, const T2 b_par, const bool log_form, const bool lower_tail)
 {
-    return pkumaraswamy(X.eval(),a_par,b_par,log_form);
+    return pkumaraswamy(X.eval(),a_par,b_par,log_form,lower_tail);
 }
 #endif
 
@@ -201,6 +217,7 @@ pkumaraswamy(const ArmaGen<mT,tT>& X, const T1 a_par, const T2 b_par, const bool
  * @param a_par a real-valued shape parameter.
  * @param b_par a real-valued shape parameter.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -214,9 +231,9 @@ pkumaraswamy(const ArmaGen<mT,tT>& X, const T1 a_par, const T2 b_par, const bool
 template<typename eT, typename T1, typename T2, typename rT, bool To>
 statslib_inline
 BlazeMat<rT,To>
-pkumaraswamy(const BlazeMat<eT,To>& X, const T1 a_par, const T2 b_par, const bool log_form)
+pkumaraswamy(const BlazeMat<eT,To>& X, const T1 a_par, const T2 b_par, const bool log_form, const bool lower_tail)
 {
-    BLAZE_DIST_FN(pkumaraswamy_vec,a_par,b_par,log_form);
+    BLAZE_DIST_FN(pkumaraswamy_vec,a_par,b_par,log_form,lower_tail);
 }
 #endif
 
@@ -227,6 +244,7 @@ pkumaraswamy(const BlazeMat<eT,To>& X, const T1 a_par, const T2 b_par, const boo
  * @param a_par a real-valued shape parameter.
  * @param b_par a real-valued shape parameter.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  *
@@ -240,8 +258,8 @@ pkumaraswamy(const BlazeMat<eT,To>& X, const T1 a_par, const T2 b_par, const boo
 template<typename eT, typename T1, typename T2, typename rT, int iTr, int iTc>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-pkumaraswamy(const EigenMat<eT,iTr,iTc>& X, const T1 a_par, const T2 b_par, const bool log_form)
+pkumaraswamy(const EigenMat<eT,iTr,iTc>& X, const T1 a_par, const T2 b_par, const bool log_form, const bool lower_tail)
 {
-    EIGEN_DIST_FN(pkumaraswamy_vec,a_par,b_par,log_form);
+    EIGEN_DIST_FN(pkumaraswamy_vec,a_par,b_par,log_form,lower_tail);
 }
 #endif
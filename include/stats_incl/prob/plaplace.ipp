@@ -28,12 +28,31 @@
 namespace internal
 {
 
+// for z < 0, P(X <= mu + z) = exp(z/sigma)/2; the upper tail follows by symmetry
+
 template<typename T>
 statslib_constexpr
 T
-plaplace_compute(const T z, const T sigma_par)
+plaplace_lower_compute(const T z, const T sigma_par, const bool log_form)
+noexcept
+{
+    return( z < T(0) ? \
+                log_form ? \
+                    z / sigma_par - T(GCEM_LOG_2) :
+                    T(0.5) * stmath::exp(z / sigma_par) :
+            // z >= 0
+                log_form ? \
+                    stmath::log1p(- T(0.5) * stmath::exp(-z / sigma_par)) :
+                    T(1) - T(0.5) * stmath::exp(-z / sigma_par) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+plaplace_compute(const T z, const T sigma_par, const bool log_form, const bool lower_tail)
+noexcept
 {
-    return( T(0.5) + T(0.5)*gcem::sgn(z)*(T(1) - stmath::exp(-stmath::abs(z) / sigma_par)) );
+    return plaplace_lower_compute(lower_tail ? z : -z, sigma_par, log_form);
 }
 
 template<typename T>
@@ -67,26 +86,26 @@ noexcept
 template<typename T>
 statslib_constexpr
 T
-plaplace_vals_check(const T x, const T mu_par, const T sigma_par, const bool log_form)
+plaplace_vals_check(const T x, const T mu_par, const T sigma_par, const bool log_form, const bool lower_tail)
 noexcept
 {
     return( !laplace_sanity_check(x,mu_par,sigma_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
             GCINT::any_inf(x,mu_par,sigma_par) || sigma_par == T(0) ? \
-                log_if(plaplace_limit_vals(x,mu_par,sigma_par),log_form) :
+                log_if(tail_if(plaplace_limit_vals(x,mu_par,sigma_par),lower_tail),log_form) :
             //
-            log_if(plaplace_compute(x - mu_par,sigma_par), log_form) );
+            plaplace_compute(x - mu_par,sigma_par,log_form,lower_tail) );
 }
 
 template<typename T1, typename T2, typename T3, typename TC = common_return_t<T1,T2,T3>>
 statslib_constexpr
 TC
-plaplace_type_check(const T1 x, const T2 mu_par, const T3 sigma_par, const bool log_form)
+plaplace_type_check(const T1 x, const T2 mu_par, const T3 sigma_par, const bool log_form, const bool lower_tail)
 noexcept
 {
     return plaplace_vals_check(static_cast<TC>(x),static_cast<TC>(mu_par),
-                               static_cast<TC>(sigma_par),log_form);
+                               static_cast<TC>(sigma_par),log_form,lower_tail);
 }
 
 }
@@ -98,6 +117,7 @@ noexcept
  * @param mu_par the location parameter, a real-valued input.
  * @param sigma_par the scale parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return the cumulative distribution function evaluated at \c x.
  * 
@@ -108,10 +128,10 @@ noexcept
 template<typename T1, typename T2, typename T3>
 statslib_constexpr
 common_return_t<T1,T2,T3>
-plaplace(const T1 x, const T2 mu_par, const T3 sigma_par, const bool log_form)
+plaplace(const T1 x, const T2 mu_par, const T3 sigma_par, const bool log_form, const bool lower_tail)
 noexcept
 {
-    return internal::plaplace_type_check(x,mu_par,sigma_par,log_form);
+    return internal::plaplace_type_check(x,mu_par,sigma_par,log_form,lower_tail);
 }
 
 //
@@ -124,10 +144,10 @@ namespace internal
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 void
-plaplace_vec(const eT* __stats_pointer_settings__ vals_in, const T1 mu_par, const T2 sigma_par, const bool log_form, 
+plaplace_vec(const eT* __stats_pointer_settings__ vals_in, const T1 mu_par, const T2 sigma_par, const bool log_form, const bool lower_tail,
                    rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(plaplace,vals_in,vals_out,num_elem,mu_par,sigma_par,log_form);
+    EVAL_DIST_FN_VEC(plaplace,vals_in,vals_out,num_elem,mu_par,sigma_par,log_form,lower_tail);
 }
 #endif
 
@@ -140,6 +160,7 @@ plaplace_vec(const eT* __stats_pointer_settings__ vals_in, const T1 mu_par, cons
  * @param mu_par the location parameter, a real-valued input.
  * @param sigma_par the scale parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a vector of CDF values corresponding to the elements of \c x.
  * 
@@ -154,9 +175,9 @@ plaplace_vec(const eT* __stats_pointer_settings__ vals_in, const T1 mu_par, cons
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 std::vector<rT>
-plaplace(const std::vector<eT>& x, const T1 mu_par, const T2 sigma_par, const bool log_form)
+plaplace(const std::vector<eT>& x, const T1 mu_par, const T2 sigma_par, const bool log_form, const bool lower_tail)
 {
-    STDVEC_DIST_FN(plaplace_vec,mu_par,sigma_par,log_form);
+    STDVEC_DIST_FN(plaplace_vec,mu_par,sigma_par,log_form,lower_tail);
 }
 #endif
 
@@ -167,6 +188,7 @@ plaplace(const std::vector<eT>& x, const T1 mu_par, const T2 sigma_par, const bo
  * @param mu_par the location parameter, a real-valued input.
  * @param sigma_par the scale parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -182,17 +204,17 @@ plaplace(const std::vector<eT>& x, const T1 mu_par, const T2 sigma_par, const bo
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 ArmaMat<rT>
-plaplace(const ArmaMat<eT>& X, const T1 mu_par, const T2 sigma_par, const bool log_form)
+plaplace(const ArmaMat<eT>& X, const T1 mu_par, const T2 sigma_par, const bool log_form, const bool lower_tail)
 {
-    ARMA_DIST_FN(plaplace_vec,mu_par,sigma_par,log_form);
+    ARMA_DIST_FN(plaplace_vec,mu_par,sigma_par,log_form,lower_tail);
 }
 
 template<typename mT, typename tT, typename T1, typename T2>
 statslib_inline
 mT
-plaplace(const ArmaGen<mT,tT>& X, const T1 mu_par, const T2 sigma_par, const bool log_form)
+plaplace(const ArmaGen<mT,tT>& X, const T1 mu_par, const T2 sigma_par, const bool log_form, const bool lower_tail)
 {
-    return plaplace(X.eval(),mu_par,sigma_par,log_form);
+    return plaplace(X.eval(),mu_par,sigma_par,log_form,lower_tail);
 }
 #endif
 
@@ -203,6 +225,7 @@ plaplace(const ArmaGen<mT,tT>& X, const T1 mu_par, const T2 sigma_par, const boo
  * @param mu_par the location parameter, a real-valued input.
  * @param sigma_par the scale parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -216,9 +239,9 @@ plaplace(const ArmaGen<mT,tT>& X, const T1 mu_par, const T2 sigma_par, const boo
 template<typename eT, typename T1, typename T2, typename rT, bool To>
 statslib_inline
 BlazeMat<rT,To>
-plaplace(const BlazeMat<eT,To>& X, const T1 mu_par, const T2 sigma_par, const bool log_form)
+plaplace(const BlazeMat<eT,To>& X, const T1 mu_par, const T2 sigma_par, const bool log_form, const bool lower_tail)
 {
-    BLAZE_DIST_FN(plaplace_vec,mu_par,sigma_par,log_form);
+    BLAZE_DIST_FN(plaplace_vec,mu_par,sigma_par,log_form,lower_tail);
 }
 #endif
 
@@ -229,6 +252,7 @@ plaplace(const BlazeMat<eT,To>& X, const T1 mu_par, const T2 sigma_par, const bo
  * @param mu_par the location parameter, a real-valued input.
  * @param sigma_par the scale parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -242,8 +266,8 @@ plaplace(const BlazeMat<eT,To>& X, const T1 mu_par, const T2 sigma_par, const bo
 template<typename eT, typename T1, typename T2, typename rT, int iTr, int iTc>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-plaplace(const EigenMat<eT,iTr,iTc>& X, const T1 mu_par, const T2 sigma_par, const bool log_form)
+plaplace(const EigenMat<eT,iTr,iTc>& X, const T1 mu_par, const T2 sigma_par, const bool log_form, const bool lower_tail)
 {
-    EIGEN_DIST_FN(plaplace_vec,mu_par,sigma_par,log_form);
+    EIGEN_DIST_FN(plaplace_vec,mu_par,sigma_par,log_form,lower_tail);
 }
 #endif
@@ -31,25 +31,25 @@ namespace internal
 template<typename T>
 statslib_constexpr
 T
-plnorm_vals_check(const T x, const T mu_par, const T sigma_par, const bool log_form)
+plnorm_vals_check(const T x, const T mu_par, const T sigma_par, const bool log_form, const bool lower_tail)
 {
     return( !lnorm_sanity_check(x,mu_par,sigma_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
             STLIM<T>::epsilon() > x ? \
-                log_zero_if<T>(log_form) :
+                log_if(tail_if(T(0),lower_tail),log_form) :
             //
-            pnorm(stmath::log(x),mu_par,sigma_par,log_form) );
+            pnorm(stmath::log(x),mu_par,sigma_par,log_form,lower_tail) );
 }
 
 template<typename T1, typename T2, typename T3, typename TC = common_return_t<T1,T2,T3>>
 statslib_constexpr
 TC
-plnorm_type_check(const T1 x, const T2 mu_par, const T3 sigma_par, const bool log_form)
+plnorm_type_check(const T1 x, const T2 mu_par, const T3 sigma_par, const bool log_form, const bool lower_tail)
 noexcept
 {
     return plnorm_vals_check(static_cast<TC>(x),static_cast<TC>(mu_par),
-                             static_cast<TC>(sigma_par),log_form);
+                             static_cast<TC>(sigma_par),log_form,lower_tail);
 }
 
 }
@@ -61,6 +61,7 @@ noexcept
  * @param mu_par the mean parameter, a real-valued input.
  * @param sigma_par the standard deviation parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return the cumulative distribution function evaluated at \c x.
  * 
@@ -71,10 +72,10 @@ noexcept
 template<typename T1, typename T2, typename T3>
 statslib_constexpr
 common_return_t<T1,T2,T3>
-plnorm(const T1 x, const T2 mu_par, const T3 sigma_par, const bool log_form)
+plnorm(const T1 x, const T2 mu_par, const T3 sigma_par, const bool log_form, const bool lower_tail)
 noexcept
 {
-    return internal::plnorm_type_check(x,mu_par,sigma_par,log_form);
+    return internal::plnorm_type_check(x,mu_par,sigma_par,log_form,lower_tail);
 }
 
 //
@@ -87,10 +88,39 @@ namespace internal
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 void
-plnorm_vec(const eT* __stats_pointer_settings__ vals_in, const T1 mu_par, const T2 sigma_par, const bool log_form, 
+plnorm_vec(const eT* __stats_pointer_settings__ vals_in, const T1 mu_par, const T2 sigma_par, const bool log_form, const bool lower_tail,
                  rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(plnorm,vals_in,vals_out,num_elem,mu_par,sigma_par,log_form);
+    const rT mu_r = static_cast<rT>(mu_par);
+    const rT sigma_r = static_cast<rT>(sigma_par);
+
+    if (log_form || !GCINT::all_finite(mu_r,sigma_r) || !(sigma_r > rT(0))) {
+        EVAL_DIST_FN_VEC(plnorm,vals_in,vals_out,num_elem,mu_par,sigma_par,log_form,lower_tail);
+        return;
+    }
+
+    // log(x) through the normal CDF's batch erfc path; x below epsilon, and non-finite inputs, are then
+    // replaced by their scalar values
+
+    std::vector<rT> log_vals(num_elem);
+
+    for (ullint_t j=ullint_t(0); j < num_elem; ++j)
+    {
+        const rT x_j = static_cast<rT>(vals_in[j]);
+
+        log_vals[j] = x_j >= STLIM<rT>::epsilon() ? std::log(x_j) : rT(0);
+    }
+
+    pnorm_vec(log_vals.data(),mu_r,sigma_r,log_form,lower_tail,vals_out,num_elem);
+
+    for (ullint_t j=ullint_t(0); j < num_elem; ++j)
+    {
+        const rT x_j = static_cast<rT>(vals_in[j]);
+
+        if (!(x_j >= STLIM<rT>::epsilon()) || !GCINT::is_finite(x_j)) {
+            vals_out[j] = plnorm(x_j,mu_r,sigma_r,log_form,lower_tail);
+        }
+    }
 }
 #endif
 
@@ -103,6 +133,7 @@ plnorm_vec(const eT* __stats_pointer_settings__ vals_in, const T1 mu_par, const
  * @param mu_par the location parameter, a real-valued input.
  * @param sigma_par the scale parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a vector of CDF values corresponding to the elements of \c x.
  * 
@@ -117,9 +148,9 @@ plnorm_vec(const eT* __stats_pointer_settings__ vals_in, const T1 mu_par, const
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 std::vector<rT>
-plnorm(const std::vector<eT>& x, const T1 mu_par, const T2 sigma_par, const bool log_form)
+plnorm(const std::vector<eT>& x, const T1 mu_par, const T2 sigma_par, const bool log_form, const bool lower_tail)
 {
-    STDVEC_DIST_FN(plnorm_vec,mu_par,sigma_par,log_form);
+    STDVEC_DIST_FN(plnorm_vec,mu_par,sigma_par,log_form,lower_tail);
 }
 #endif
 
@@ -130,6 +161,7 @@ plnorm(const std::vector<eT>& x, const T1 mu_par, const T2 sigma_par, const bool
  * @param mu_par the location parameter, a real-valued input.
  * @param sigma_par the scale parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -145,17 +177,17 @@ plnorm(const std::vector<eT>& x, const T1 mu_par, const T2 sigma_par, const bool
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 ArmaMat<rT>
-plnorm(const ArmaMat<eT>& X, const T1 mu_par, const T2 sigma_par, const bool log_form)
+plnorm(const ArmaMat<eT>& X, const T1 mu_par, const T2 sigma_par, const bool log_form, const bool lower_tail)
 {
-    ARMA_DIST_FN(plnorm_vec,mu_par,sigma_par,log_form);
+    ARMA_DIST_FN(plnorm_vec,mu_par,sigma_par,log_form,lower_tail);
 }
 
 template<typename mT, typename tT, typename T1, typename T2>
 statslib_inline
 mT
-plnorm(const ArmaGen<mT,tT>& X, const T1 mu_par, const T2 sigma_par, const bool log_form)
+plnorm(const ArmaGen<mT,tT>& X, const T1 mu_par, const T2 sigma_par, const bool log_form, const bool lower_tail)
 {
-    return plnorm(X.eval(),mu_par,sigma_par,log_form);
+    return plnorm(X.eval(),mu_par,sigma_par,log_form,lower_tail);
 }
 #endif
 
@@ -166,6 +198,7 @@ plnorm(const ArmaGen<mT,tT>& X, const T1 mu_par, const T2 sigma_par, const bool
  * @param mu_par the location parameter, a real-valued input.
  * @param sigma_par the scale parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -179,9 +212,9 @@ plnorm(const ArmaGen<mT,tT>& X, const T1 mu_par, const T2 sigma_par, const bool
 template<typename eT, typename T1, typename T2, typename rT, bool To>
 statslib_inline
 BlazeMat<rT,To>
-plnorm(const BlazeMat<eT,To>& X, const T1 mu_par, const T2 sigma_par, const bool log_form)
+plnorm(const BlazeMat<eT,To>& X, const T1 mu_par, const T2 sigma_par, const bool log_form, const bool lower_tail)
 {
-    BLAZE_DIST_FN(plnorm_vec,mu_par,sigma_par,log_form);
+    BLAZE_DIST_FN(plnorm_vec,mu_par,sigma_par,log_form,lower_tail);
 }
 #endif
 
@@ -192,6 +225,7 @@ plnorm(const BlazeMat<eT,To>& X, const T1 mu_par, const T2 sigma_par, const bool
  * @param mu_par the location parameter, a real-valued input.
  * @param sigma_par the scale parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -205,8 +239,8 @@ plnorm(const BlazeMat<eT,To>& X, const T1 mu_par, const T2 sigma_par, const bool
 template<typename eT, typename T1, typename T2, typename rT, int iTr, int iTc>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-plnorm(const EigenMat<eT,iTr,iTc>& X, const T1 mu_par, const T2 sigma_par, const bool log_form)
+plnorm(const EigenMat<eT,iTr,iTc>& X, const T1 mu_par, const T2 sigma_par, const bool log_form, const bool lower_tail)
 {
-    EIGEN_DIST_FN(plnorm_vec,mu_par,sigma_par,log_form);
+    EIGEN_DIST_FN(plnorm_vec,mu_par,sigma_par,log_form,lower_tail);
 }
 #endif
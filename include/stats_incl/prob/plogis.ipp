@@ -28,12 +28,31 @@
 namespace internal
 {
 
+// P(X <= mu + sigma*z) = 1 / (1 + exp(-z)), evaluated so that neither tail cancels; the upper tail follows by symmetry
+
 template<typename T>
 statslib_constexpr
 T
-plogis_compute(const T z)
+plogis_lower_compute(const T z, const bool log_form)
+noexcept
+{
+    return( z < T(0) ? \
+                log_form ? \
+                    z - stmath::log1p(stmath::exp(z)) :
+                    stmath::exp(z) / (T(1) + stmath::exp(z)) :
+            // z >= 0
+                log_form ? \
+                    - stmath::log1p(stmath::exp(-z)) :
+                    T(1) / (T(1) + stmath::exp(-z)) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+plogis_compute(const T z, const bool log_form, const bool lower_tail)
+noexcept
 {
-    return( T(0.5)*( T(1) + gcem::tanh(z) ) );
+    return plogis_lower_compute(lower_tail ? z : -z, log_form);
 }
 
 template<typename T>
@@ -67,25 +86,25 @@ noexcept
 template<typename T>
 statslib_constexpr
 T
-plogis_vals_check(const T x, const T mu_par, const T sigma_par, const bool log_form)
+plogis_vals_check(const T x, const T mu_par, const T sigma_par, const bool log_form, const bool lower_tail)
 {
     return( !logis_sanity_check(x,mu_par,sigma_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
             GCINT::any_inf(x,mu_par,sigma_par) || sigma_par == T(0) ? \
-                log_if(plogis_limit_vals(x,mu_par,sigma_par),log_form) :
+                log_if(tail_if(plogis_limit_vals(x,mu_par,sigma_par),lower_tail),log_form) :
             //
-            log_if(plogis_compute((x-mu_par)/(2*sigma_par)), log_form) );
+            plogis_compute((x-mu_par)/sigma_par,log_form,lower_tail) );
 }
 
 template<typename T1, typename T2, typename T3, typename TC = common_return_t<T1,T2,T3>>
 statslib_constexpr
 TC
-plogis_type_check(const T1 x, const T2 mu_par, const T3 sigma_par, const bool log_form)
+plogis_type_check(const T1 x, const T2 mu_par, const T3 sigma_par, const bool log_form, const bool lower_tail)
 noexcept
 {
     return plogis_vals_check(static_cast<TC>(x),static_cast<TC>(mu_par),
-                             static_cast<TC>(sigma_par),log_form);
+                             static_cast<TC>(sigma_par),log_form,lower_tail);
 }
 
 }
@@ -97,6 +116,7 @@ noexcept
  * @param mu_par the location parameter, a real-valued input.
  * @param sigma_par the scale parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return the cumulative distribution function evaluated at \c x.
  * 
@@ -107,10 +127,10 @@ noexcept
 template<typename T1, typename T2, typename T3>
 statslib_constexpr
 common_return_t<T1,T2,T3>
-plogis(const T1 x, const T2 mu_par, const T3 sigma_par, const bool log_form)
+plogis(const T1 x, const T2 mu_par, const T3 sigma_par, const bool log_form, const bool lower_tail)
 noexcept
 {
-    return internal::plogis_type_check(x,mu_par,sigma_par,log_form);
+    return internal::plogis_type_check(x,mu_par,sigma_par,log_form,lower_tail);
 }
 
 //
@@ -123,10 +143,10 @@ namespace internal
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 void
-plogis_vec(const eT* __stats_pointer_settings__ vals_in, const T1 mu_par, const T2 sigma_par, const bool log_form, 
+plogis_vec(const eT* __stats_pointer_settings__ vals_in, const T1 mu_par, const T2 sigma_par, const bool log_form, const bool lower_tail,
                  rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(plogis,vals_in,vals_out,num_elem,mu_par,sigma_par,log_form);
+    EVAL_DIST_FN_VEC(plogis,vals_in,vals_out,num_elem,mu_par,sigma_par,log_form,lower_tail);
 }
 #endif
 
@@ -139,6 +159,7 @@ plogis_vec(const eT* __stats_pointer_settings__ vals_in, const T1 mu_par, const
  * @param mu_par the location parameter, a real-valued input.
  * @param sigma_par the scale parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a vector of CDF values corresponding to the elements of \c x.
  * 
@@ -153,9 +174,9 @@ plogis_vec(const eT* __stats_pointer_settings__ vals_in, const T1 mu_par, const
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 std::vector<rT>
-plogis(const std::vector<eT>& x, const T1 mu_par, const T2 sigma_par, const bool log_form)
+plogis(const std::vector<eT>& x, const T1 mu_par, const T2 sigma_par, const bool log_form, const bool lower_tail)
 {
-    STDVEC_DIST_FN(plogis_vec,mu_par,sigma_par,log_form);
+    STDVEC_DIST_FN(plogis_vec,mu_par,sigma_par,log_form,lower_tail);
 }
 #endif
 
@@ -166,6 +187,7 @@ plogis(const std::vector<eT>& x, const T1 mu_par, const T2 sigma_par, const bool
  * @param mu_par the location parameter, a real-valued input.
  * @param sigma_par the scale parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -181,17 +203,17 @@ plogis(const std::vector<eT>& x, const T1 mu_par, const T2 sigma_par, const bool
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 ArmaMat<rT>
-plogis(const ArmaMat<eT>& X, const T1 mu_par, const T2 sigma_par, const bool log_form)
+plogis(const ArmaMat<eT>& X, const T1 mu_par, const T2 sigma_par, const bool log_form, const bool lower_tail)
 {
-    ARMA_DIST_FN(plogis_vec,mu_par,sigma_par,log_form);
+    ARMA_DIST_FN(plogis_vec,mu_par,sigma_par,log_form,lower_tail);
 }
 
 template<typename mT, typename tT, typename T1, typename T2>
 statslib_inline
 mT
-plogis(const ArmaGen<mT,tT>& X, const T1 mu_par, const T2 sigma_par, const bool log_form)
+plogis(const ArmaGen<mT,tT>& X, const T1 mu_par, const T2 sigma_par, const bool log_form, const bool lower_tail)
 {
-    return plogis(X.eval(),mu_par,sigma_par,log_form);
+    return plogis(X.eval(),mu_par,sigma_par,log_form,lower_tail);
 }
 #endif
 
@@ -202,6 +224,7 @@ plogis(const ArmaGen<mT,tT>& X, const T1 mu_par, const T2 sigma_par, const bool
  * @param mu_par the location parameter, a real-valued input.
  * @param sigma_par the scale parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -215,9 +238,9 @@ plogis(const ArmaGen<mT,tT>& X, const T1 mu_par, const T2 sigma_par, const bool
 template<typename eT, typename T1, typename T2, typename rT, bool To>
 statslib_inline
 BlazeMat<rT,To>
-plogis(const BlazeMat<eT,To>& X, const T1 mu_par, const T2 sigma_par, const bool log_form)
+plogis(const BlazeMat<eT,To>& X, const T1 mu_par, const T2 sigma_par, const bool log_form, const bool lower_tail)
 {
-    BLAZE_DIST_FN(plogis_vec,mu_par,sigma_par,log_form);
+    BLAZE_DIST_FN(plogis_vec,mu_par,sigma_par,log_form,lower_tail);
 }
 #endif
 
@@ -228,6 +251,7 @@ plogis(const BlazeMat<eT,To>& X, const T1 mu_par, const T2 sigma_par, const bool
  * @param mu_par the location parameter, a real-valued input.
  * @param sigma_par the scale parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -241,8 +265,8 @@ plogis(const BlazeMat<eT,To>& X, const T1 mu_par, const T2 sigma_par, const bool
 template<typename eT, typename T1, typename T2, typename rT, int iTr, int iTc>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-plogis(const EigenMat<eT,iTr,iTc>& X, const T1 mu_par, const T2 sigma_par, const bool log_form)
+plogis(const EigenMat<eT,iTr,iTc>& X, const T1 mu_par, const T2 sigma_par, const bool log_form, const bool lower_tail)
 {
-    EIGEN_DIST_FN(plogis_vec,mu_par,sigma_par,log_form);
+    EIGEN_DIST_FN(plogis_vec,mu_par,sigma_par,log_form,lower_tail);
 }
 #endif
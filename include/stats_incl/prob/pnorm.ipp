@@ -28,12 +28,65 @@
 namespace internal
 {
 
+// upper tail, Q(z) = erfc(z/sqrt(2))/2: for z >= 2 through the continued fraction for the Mills ratio,
+// Q(z)/phi(z) = 1/(z + 1/(z + 2/(z + 3/(z + ...)))), which keeps full relative precision (and, on the log scale, range)
+// far into the tail; the lower tail is P(Z <= z) = Q(-z)
+
+template<typename T>
+statslib_constexpr
+T
+pnorm_mills_cf(const T z, const int depth)
+noexcept
+{
+    return( depth < 100 ? \
+                z + T(depth + 1) / pnorm_mills_cf(z,depth+1) :
+                z );
+}
+
+template<typename T>
+statslib_constexpr
+T
+pnorm_log_upper_cf(const T z)
+noexcept
+{
+    return( - z*z / T(2) - T(0.5)*T(GCEM_LOG_2PI) - stmath::log(pnorm_mills_cf(z,0)) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+pnorm_upper_compute(const T z)
+noexcept
+{
+    return( z >= T(2) ? \
+                stmath::exp(pnorm_log_upper_cf(z)) :
+            z > - T(2) ? \
+                T(0.5) * (T(1) - stmath::erf(z / T(GCEM_SQRT_2))) :
+                T(1) - stmath::exp(pnorm_log_upper_cf(-z)) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+pnorm_log_upper_compute(const T z)
+noexcept
+{
+    return( z >= T(2) ? \
+                pnorm_log_upper_cf(z) :
+            z > - T(2) ? \
+                stmath::log(T(0.5) * (T(1) - stmath::erf(z / T(GCEM_SQRT_2)))) :
+                stmath::log1p(- stmath::exp(pnorm_log_upper_cf(-z))) );
+}
+
 template<typename T>
 statslib_constexpr
 T
-pnorm_compute(const T z)
+pnorm_compute(const T z, const bool log_form, const bool lower_tail)
+noexcept
 {
-    return( T(0.5) * (T(1) + stmath::erf(z / GCEM_SQRT_2)) );
+    return( log_form ? \
+                pnorm_log_upper_compute(lower_tail ? -z : z) :
+                pnorm_upper_compute(lower_tail ? -z : z) );
 }
 
 template<typename T>
@@ -71,25 +124,25 @@ noexcept
 template<typename T>
 statslib_constexpr
 T
-pnorm_vals_check(const T x, const T mu_par, const T sigma_par, const bool log_form)
+pnorm_vals_check(const T x, const T mu_par, const T sigma_par, const bool log_form, const bool lower_tail)
 {
     return( !norm_sanity_check(x,mu_par,sigma_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
             GCINT::any_inf(x,mu_par,sigma_par) || sigma_par == T(0) ? \
-                log_if(pnorm_limit_vals(x,mu_par,sigma_par),log_form) :
+                log_if(tail_if(pnorm_limit_vals(x,mu_par,sigma_par),lower_tail),log_form) :
             //
-            log_if(pnorm_compute((x-mu_par)/sigma_par), log_form) );
+            pnorm_compute((x-mu_par)/sigma_par,log_form,lower_tail) );
 }
 
 template<typename T1, typename T2, typename T3, typename TC = common_return_t<T1,T2,T3>>
 statslib_constexpr
 TC
-pnorm_type_check(const T1 x, const T2 mu_par, const T3 sigma_par, const bool log_form)
+pnorm_type_check(const T1 x, const T2 mu_par, const T3 sigma_par, const bool log_form, const bool lower_tail)
 noexcept
 {
     return pnorm_vals_check(static_cast<TC>(x),static_cast<TC>(mu_par),
-                            static_cast<TC>(sigma_par),log_form);
+                            static_cast<TC>(sigma_par),log_form,lower_tail);
 }
 
 }
@@ -101,6 +154,7 @@ noexcept
  * @param mu_par the mean parameter, a real-valued input.
  * @param sigma_par the standard deviation parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return the cumulative distribution function evaluated at \c x.
  *
@@ -111,10 +165,10 @@ noexcept
 template<typename T1, typename T2, typename T3>
 statslib_constexpr
 common_return_t<T1,T2,T3>
-pnorm(const T1 x, const T2 mu_par, const T3 sigma_par, const bool log_form)
+pnorm(const T1 x, const T2 mu_par, const T3 sigma_par, const bool log_form, const bool lower_tail)
 noexcept
 {
-    return internal::pnorm_type_check(x,mu_par,sigma_par,log_form);
+    return internal::pnorm_type_check(x,mu_par,sigma_par,log_form,lower_tail);
 }
 
 //
@@ -127,10 +181,34 @@ namespace internal
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 void
-pnorm_vec(const eT* __stats_pointer_settings__ vals_in, const T1 mu_par, const T2 sigma_par, const bool log_form, 
+pnorm_vec(const eT* __stats_pointer_settings__ vals_in, const T1 mu_par, const T2 sigma_par, const bool log_form, const bool lower_tail,
                 rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(pnorm,vals_in,vals_out,num_elem,mu_par,sigma_par,log_form);
+    const rT mu_r = static_cast<rT>(mu_par);
+    const rT sigma_r = static_cast<rT>(sigma_par);
+
+    if (log_form || !GCINT::all_finite(mu_r,sigma_r) || !(sigma_r > rT(0))) {
+        EVAL_DIST_FN_VEC(pnorm,vals_in,vals_out,num_elem,mu_par,sigma_par,log_form,lower_tail);
+        return;
+    }
+
+    // standardized inputs through the batch erfc, with P(X <= x) = erfc(-z/sqrt(2))/2 and P(X > x) = erfc(z/sqrt(2))/2;
+    // non-finite inputs are then replaced by their scalar values
+
+    for (ullint_t j=ullint_t(0); j < num_elem; ++j)
+    {
+        const rT z_j = (static_cast<rT>(vals_in[j]) - mu_r) / sigma_r;
+
+        vals_out[j] = (lower_tail ? - z_j : z_j) / rT(GCEM_SQRT_2);
+    }
+
+    erfc_vec(vals_out,vals_out,num_elem);
+
+    for (ullint_t j=ullint_t(0); j < num_elem; ++j)
+    {
+        vals_out[j] = GCINT::is_finite(vals_in[j]) ? vals_out[j] / rT(2) :
+                                                     pnorm(vals_in[j],mu_par,sigma_par,log_form,lower_tail);
+    }
 }
 #endif
 
@@ -143,6 +221,7 @@ pnorm_vec(const eT* __stats_pointer_settings__ vals_in, const T1 mu_par, const T
  * @param mu_par the mean parameter, a real-valued input.
  * @param sigma_par the standard deviation parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a vector of CDF values corresponding to the elements of \c x.
  * 
@@ -157,9 +236,9 @@ pnorm_vec(const eT* __stats_pointer_settings__ vals_in, const T1 mu_par, const T
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 std::vector<rT>
-pnorm(const std::vector<eT>& x, const T1 mu_par, const T2 sigma_par, const bool log_form)
+pnorm(const std::vector<eT>& x, const T1 mu_par, const T2 sigma_par, const bool log_form, const bool lower_tail)
 {
-    STDVEC_DIST_FN(pnorm_vec,mu_par,sigma_par,log_form);
+    STDVEC_DIST_FN(pnorm_vec,mu_par,sigma_par,log_form,lower_tail);
 }
 #endif
 
@@ -170,6 +249,7 @@ pnorm(const std::vector<eT>& x, const T1 mu_par, const T2 sigma_par, const bool
  * @param mu_par the mean parameter, a real-valued input.
  * @param sigma_par the standard deviation parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -185,17 +265,17 @@ pnorm(const std::vector<eT>& x, const T1 mu_par, const T2 sigma_par, const bool
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 ArmaMat<rT>
-pnorm(const ArmaMat<eT>& X, const T1 mu_par, const T2 sigma_par, const bool log_form)
+pnorm(const ArmaMat<eT>& X, const T1 mu_par, const T2 sigma_par, const bool log_form, const bool lower_tail)
 {
-    ARMA_DIST_FN(pnorm_vec,mu_par,sigma_par,log_form);
+    ARMA_DIST_FN(pnorm_vec,mu_par,sigma_par,log_form,lower_tail);
 }
 
 template<typename mT, typename tT, typename T1, typename T2>
 statslib_inline
 mT
-pnorm(const ArmaGen<mT,tT>& X, const T1 mu_par, const T2 sigma_par, const bool log_form)
+pnorm(const ArmaGen<mT,tT>& X, const T1 mu_par, const T2 sigma_par, const bool log_form, const bool lower_tail)
 {
-    return pnorm(X.eval(),mu_par,sigma_par,log_form);
+    return pnorm(X.eval(),mu_par,sigma_par,log_form,lower_tail);
 }
 #endif
 
@@ -206,6 +286,7 @@ pnorm(const ArmaGen<mT,tT>& X, const T1 mu_par, const T2 sigma_par, const bool l
  * @param mu_par the mean parameter, a real-valued input.
  * @param sigma_par the standard deviation parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -219,9 +300,9 @@ pnorm(const ArmaGen<mT,tT>& X, const T1 mu_par, const T2 sigma_par, const bool l
 template<typename eT, typename T1, typename T2, typename rT, bool To>
 statslib_inline
 BlazeMat<rT,To>
-pnorm(const BlazeMat<eT,To>& X, const T1 mu_par, const T2 sigma_par, const bool log_form)
+pnorm(const BlazeMat<eT,To>& X, const T1 mu_par, const T2 sigma_par, const bool log_form, const bool lower_tail)
 {
-    BLAZE_DIST_FN(pnorm_vec,mu_par,sigma_par,log_form);
+    BLAZE_DIST_FN(pnorm_vec,mu_par,sigma_par,log_form,lower_tail);
 }
 #endif
 
@@ -232,6 +313,7 @@ pnorm(const BlazeMat<eT,To>& X, const T1 mu_par, const T2 sigma_par, const bool
  * @param mu_par the mean parameter, a real-valued input.
  * @param sigma_par the standard deviation parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -245,8 +327,8 @@ pnorm(const BlazeMat<eT,To>& X, const T1 mu_par, const T2 sigma_par, const bool
 template<typename eT, typename T1, typename T2, typename rT, int iTr, int iTc>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-pnorm(const EigenMat<eT,iTr,iTc>& X, const T1 mu_par, const T2 sigma_par, const bool log_form)
+pnorm(const EigenMat<eT,iTr,iTc>& X, const T1 mu_par, const T2 sigma_par, const bool log_form, const bool lower_tail)
 {
-    EIGEN_DIST_FN(pnorm_vec,mu_par,sigma_par,log_form);
+    EIGEN_DIST_FN(pnorm_vec,mu_par,sigma_par,log_form,lower_tail);
 }
 #endif
@@ -30,7 +30,7 @@
 
 template<typename T>
 statslib_constexpr
-return_t<T> ppois(const llint_t x, const T rate_par, const bool log_form = false) noexcept;
+return_t<T> ppois(const llint_t x, const T rate_par, const bool log_form = false, const bool lower_tail = true) noexcept;
 
 //
 // vector/matrix input
@@ -39,33 +39,33 @@ return_t<T> ppois(const llint_t x, const T rate_par, const bool log_form = false
 template<typename eT, typename T1, typename rT = common_return_t<eT,T1>>
 statslib_inline
 std::vector<rT>
-ppois(const std::vector<eT>& x, const T1 rate_par, const bool log_form = false);
+ppois(const std::vector<eT>& x, const T1 rate_par, const bool log_form = false, const bool lower_tail = true);
 #endif
 
 #ifdef STATS_ENABLE_ARMA_WRAPPERS
 template<typename eT, typename T1, typename rT = common_return_t<eT,T1>>
 statslib_inline
 ArmaMat<rT>
-ppois(const ArmaMat<eT>& X, const T1 rate_par, const bool log_form = false);
+ppois(const ArmaMat<eT>& X, const T1 rate_par, const bool log_form = false, const bool lower_tail = true);
 
 template<typename mT, typename tT, typename T1>
 statslib_inline
 mT 
-ppois(const ArmaGen<mT,tT>& X, const T1 rate_par, const bool log_form = false);
+ppois(const ArmaGen<mT,tT>& X, const T1 rate_par, const bool log_form = false, const bool lower_tail = true);
 #endif
 
 #ifdef STATS_ENABLE_BLAZE_WRAPPERS
 template<typename eT, typename T1, typename rT = common_return_t<eT,T1>, bool To = blaze::columnMajor>
 statslib_inline
 BlazeMat<rT,To>
-ppois(const BlazeMat<eT,To>& X, const T1 rate_par, const bool log_form = false);
+ppois(const BlazeMat<eT,To>& X, const T1 rate_par, const bool log_form = false, const bool lower_tail = true);
 #endif
 
 #ifdef STATS_ENABLE_EIGEN_WRAPPERS
 template<typename eT, typename T1, typename rT = common_return_t<eT,T1>, int iTr = Eigen::Dynamic, int iTc = Eigen::Dynamic>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-ppois(const EigenMat<eT,iTr,iTc>& X, const T1 rate_par, const bool log_form = false);
+ppois(const EigenMat<eT,iTr,iTc>& X, const T1 rate_par, const bool log_form = false, const bool lower_tail = true);
 #endif
 
 //
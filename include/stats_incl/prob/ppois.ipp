@@ -28,51 +28,165 @@
 namespace internal
 {
 
+// P(X <= x) = Q(x+1, rate) and P(X > x) = P(x+1, rate), where P and Q are the regularized incomplete gamma functions
+
 template<typename T>
 statslib_constexpr
 T
-ppois_compute_recur(const llint_t x, const T rate_par, const llint_t r_count)
-{   // caution: integer overflow can occur when calculating factorial values
-    return( x == llint_t(0) ? \
-                T(1) :
-            x == llint_t(1) ? \
-                T(1) + rate_par :
-            //
-            r_count == llint_t(0) ? \
-                T(1) + ppois_compute_recur(x,rate_par,r_count+1) :
-            //
-            r_count < x ? \
-                    stmath::pow(rate_par,r_count) / gcem::factorial(r_count) + ppois_compute_recur(x,rate_par,r_count+1) :  
-                    stmath::pow(rate_par,r_count) / gcem::factorial(r_count) );
+ppois_pmf_sum(const llint_t r_count, const T rate_par, const T term, const T sum_val)
+noexcept
+{   // sum the pmf terms downward from x, using f(r-1) = f(r) * r / rate
+    return( r_count == llint_t(0) ? \
+                sum_val :
+                ppois_pmf_sum(r_count - llint_t(1), rate_par, term * T(r_count) / rate_par, 
+                              sum_val + term * T(r_count) / rate_par) );
 }
 
 template<typename T>
 statslib_constexpr
 T
-ppois_compute(const llint_t x, const T rate_par)
+ppois_pmf_sum_begin(const llint_t x, const T rate_par, const T term)
+noexcept
 {
-    return( rate_par > T(10) || x > llint_t(15) ? \
-            // switch to incomplete gamma function
-                T(1) - gcem::incomplete_gamma(T(x+1),rate_par) :
-            // else
-                stmath::exp(-rate_par) * ppois_compute_recur(x,rate_par,0U) );
+    return ppois_pmf_sum(x,rate_par,term,term);
+}
+
+template<typename T>
+statslib_constexpr
+T
+ppois_pmf_sum_up(const llint_t k, const llint_t x, const T rate_par, const T term, const T sum_val)
+noexcept
+{   // sum the pmf terms upward from 0, using f(k+1) = f(k) * rate / (k+1); for rate < x, where f(x) may underflow
+    return( k == x ? \
+                sum_val :
+                ppois_pmf_sum_up(k + llint_t(1), x, rate_par, term * rate_par / T(k + 1), 
+                                 sum_val + term * rate_par / T(k + 1)) );
 }
 
 template<typename T>
 statslib_constexpr
 T
-ppois_vals_check(const llint_t x, const T rate_par, const bool log_form)
+ppois_log_pmf(const llint_t x, const T rate_par)
+noexcept
+{
+    return( x < llint_t(32) ? \
+                T(x)*stmath::log(rate_par) - rate_par - log_factorial<T>(x) :
+                pgamma_log_front(T(x + 1),rate_par) - stmath::log(rate_par) );
+}
+
+// log P(X > x) = log f(x+1) + log(1 + rate/(x+2) + rate^2/((x+2)(x+3)) + ...), for x < 32 and rate < x + 1,
+// where the terms decrease geometrically; the upper tail then keeps its magnitude even when it underflows
+
+template<typename T>
+statslib_constexpr
+T
+ppois_upper_series(const T k, const T rate_par, const T term, const T sum_val, const int iter)
+noexcept
+{
+    return( term < STLIM<T>::epsilon() * sum_val || iter >= 200 ? \
+                sum_val :
+                ppois_upper_series(k + T(1), rate_par, term * rate_par / (k + T(1)), 
+                                   sum_val + term * rate_par / (k + T(1)), iter + 1) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+ppois_log_upper_small(const llint_t x, const T rate_par)
+noexcept
+{
+    return ppois_log_pmf(x + llint_t(1),rate_par) + stmath::log(ppois_upper_series(T(x + 1),rate_par,T(1),T(1),0));
+}
+
+template<typename T>
+statslib_constexpr
+bool
+ppois_use_small(const llint_t x, const T rate_par)
+noexcept
+{
+    return( x < llint_t(32) && rate_par < T(x + 1) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+ppois_upper_gamma(const T a_par, const T z)
+noexcept
+{
+    return stmath::exp(pgamma_log_upper_cf(a_par,z));
+}
+
+template<typename T>
+statslib_constexpr
+bool
+ppois_use_cf(const llint_t x, const T rate_par)
+noexcept
+{
+    return( rate_par > T(x + 1) + T(2) * stmath::sqrt(T(x + 1)) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+ppois_clamp_one(const T val)
+noexcept
+{
+    return( val > T(1) ? T(1) : val );
+}
+
+template<typename T>
+statslib_constexpr
+T
+ppois_compute_lower(const llint_t x, const T rate_par)
+noexcept
+{
+    return( x < llint_t(32) ? \
+                ppois_clamp_one(rate_par < T(x) ? \
+                    ppois_pmf_sum_up(llint_t(0),x,rate_par,stmath::exp(-rate_par),stmath::exp(-rate_par)) :
+                    ppois_pmf_sum_begin(x,rate_par,stmath::exp(ppois_log_pmf(x,rate_par)))) :
+            ppois_use_cf(x,rate_par) ? \
+                ppois_upper_gamma(T(x + 1),rate_par) :
+                T(1) - gcem::incomplete_gamma(T(x + 1),rate_par) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+ppois_compute(const llint_t x, const T rate_par, const bool lower_tail)
+noexcept
+{
+    return( lower_tail ? \
+                ppois_compute_lower(x,rate_par) :
+            // upper tail
+            ppois_use_small(x,rate_par) ? \
+                stmath::exp(ppois_log_upper_small(x,rate_par)) :
+            rate_par < T(x + 1) ? \
+                gcem::incomplete_gamma(T(x + 1),rate_par) :
+                T(1) - ppois_compute_lower(x,rate_par) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+ppois_vals_check(const llint_t x, const T rate_par, const bool log_form, const bool lower_tail)
+noexcept
 {
     return( !pois_sanity_check(rate_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
             x < llint_t(0) ? \
-                log_zero_if<T>(log_form) :
+                log_if(tail_if(T(0),lower_tail),log_form) :
             //
+            rate_par == T(0) ? \
+                log_if(tail_if(T(1),lower_tail),log_form) :
             GCINT::is_posinf(rate_par) ? \
-                log_zero_if<T>(log_form) :
+                log_if(tail_if(T(0),lower_tail),log_form) :
+            //
+            log_form && ppois_use_small(x,rate_par) ? \
+                (lower_tail ? stmath::log1p(- stmath::exp(ppois_log_upper_small(x,rate_par))) :
+                              ppois_log_upper_small(x,rate_par)) :
             //
-            log_if(ppois_compute(x,rate_par), log_form) );
+            log_if(ppois_compute(x,rate_par,lower_tail), log_form) );
 }
 
 }
@@ -83,6 +197,7 @@ ppois_vals_check(const llint_t x, const T rate_par, const bool log_form)
  * @param x a non-negative integral-valued input.
  * @param rate_par the rate parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return the cumulative distribution function evaluated at \c x.
  * 
@@ -93,10 +208,10 @@ ppois_vals_check(const llint_t x, const T rate_par, const bool log_form)
 template<typename T>
 statslib_constexpr
 return_t<T>
-ppois(const llint_t x, const T rate_par, const bool log_form)
+ppois(const llint_t x, const T rate_par, const bool log_form, const bool lower_tail)
 noexcept
 {
-    return internal::ppois_vals_check(x,static_cast<return_t<T>>(rate_par),log_form);
+    return internal::ppois_vals_check(x,static_cast<return_t<T>>(rate_par),log_form,lower_tail);
 }
 
 //
@@ -106,13 +221,140 @@ namespace internal
 {
 
 #ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+// sorted input: carry F(x) (or 1 - F(x), walking backward) and f(x) between neighbouring elements,
+// restarting from a scalar evaluation across wide gaps or once the pmf term underflows
+
+template<typename eT, typename rT>
+statslib_inline
+void
+ppois_vec_sorted(const eT* __stats_pointer_settings__ vals_in, const rT rate_par, const bool log_form, const bool lower_tail,
+                       rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    const llint_t max_gap = llint_t(64);
+
+    bool anchored = false;
+    llint_t x_prev = llint_t(0);
+    rT tail_val = rT(0);
+    rT pmf_val = rT(0);
+
+    for (ullint_t i=ullint_t(0); i < num_elem; ++i)
+    {
+        const ullint_t j = lower_tail ? i : num_elem - i - ullint_t(1);
+        const llint_t x_j = static_cast<llint_t>(vals_in[j]);
+
+        if (x_j < llint_t(0)) {
+            vals_out[j] = log_if(tail_if(rT(0),lower_tail),log_form);
+            continue;
+        }
+
+        const llint_t x_gap = lower_tail ? x_j - x_prev : x_prev - x_j;
+
+        if (!anchored || x_gap > max_gap || pmf_val < STLIM<rT>::min())
+        {
+            tail_val = ppois(x_j,rate_par,false,lower_tail);
+            pmf_val = std::exp(ppois_log_pmf(x_j,rate_par));
+            anchored = true;
+        }
+        else if (lower_tail)
+        {   // F(k) = F(k-1) + f(k)
+            for (llint_t k = x_prev + 1; k <= x_j; ++k) {
+                pmf_val *= rate_par / rT(k);
+                tail_val += pmf_val;
+            }
+        }
+        else
+        {   // 1 - F(k-1) = 1 - F(k) + f(k)
+            for (llint_t k = x_prev; k > x_j; --k) {
+                tail_val += pmf_val;
+                pmf_val *= rT(k) / rate_par;
+            }
+        }
+
+        tail_val = std::min(tail_val,rT(1));
+        x_prev = x_j;
+
+        vals_out[j] = log_form ? std::log(tail_val) : tail_val;
+    }
+}
+
 template<typename eT, typename T1, typename rT>
 statslib_inline
 void
-ppois_vec(const eT* __stats_pointer_settings__ vals_in, const T1 rate_par, const bool log_form, 
+ppois_vec(const eT* __stats_pointer_settings__ vals_in, const T1 rate_par, const bool log_form, const bool lower_tail,
                 rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(ppois,vals_in,vals_out,num_elem,rate_par,log_form);
+    const rT rate_r = static_cast<rT>(rate_par);
+
+    if (pois_sanity_check(rate_r) && rate_r > rT(0) && !GCINT::is_posinf(rate_r) && is_sorted_vec(vals_in,num_elem)) {
+        ppois_vec_sorted(vals_in,rate_r,log_form,lower_tail,vals_out,num_elem);
+        return;
+    }
+
+    llint_t x_min = STLIM<llint_t>::max();
+    llint_t x_max = llint_t(-1);
+
+    for (ullint_t j=ullint_t(0); j < num_elem; ++j)
+    {
+        const llint_t x_j = static_cast<llint_t>(vals_in[j]);
+
+        if (x_j >= llint_t(0)) {
+            x_min = std::min(x_min,x_j);
+            x_max = std::max(x_max,x_j);
+        }
+    }
+
+    if (x_max < llint_t(0) || !pois_sanity_check(rate_r) || rate_r == rT(0) || GCINT::is_posinf(rate_r) 
+            || ullint_t(x_max - x_min) > ullint_t(4)*num_elem + ullint_t(1024))
+    {
+        EVAL_DIST_FN_VEC(ppois,vals_in,vals_out,num_elem,rate_r,log_form,lower_tail);
+        return;
+    }
+
+    // one cumulative pass over [x_min, x_max]: pmf terms are generated outward from the mode,
+    // so nothing underflows prematurely, then accumulated away from a single scalar evaluation
+
+    std::vector<rT> cdf_vals(x_max - x_min + 1);
+
+    const llint_t x_mode = rate_r >= rT(x_max) ? x_max : rate_r <= rT(x_min) ? x_min : static_cast<llint_t>(rate_r);
+
+    cdf_vals[x_mode - x_min] = std::exp(ppois_log_pmf(x_mode,rate_r));
+
+    for (llint_t x = x_mode + 1; x <= x_max; ++x) {
+        cdf_vals[x - x_min] = cdf_vals[x - x_min - 1] * rate_r / rT(x);
+    }
+
+    for (llint_t x = x_mode - 1; x >= x_min; --x) {
+        cdf_vals[x - x_min] = cdf_vals[x - x_min + 1] * rT(x + 1) / rate_r;
+    }
+
+    if (lower_tail) {
+        // F(x) = F(x-1) + f(x)
+        rT running_val = ppois(x_min,rate_r,false,true);
+        cdf_vals[0] = running_val;
+
+        for (size_t i = 1; i < cdf_vals.size(); ++i) {
+            running_val = std::min(running_val + cdf_vals[i], rT(1));
+            cdf_vals[i] = running_val;
+        }
+    } else {
+        // 1 - F(x-1) = 1 - F(x) + f(x)
+        rT running_val = ppois(x_max,rate_r,false,false);
+
+        for (size_t i = cdf_vals.size(); i-- > 0; ) {
+            const rT pmf_val = cdf_vals[i];
+            cdf_vals[i] = running_val;
+            running_val = std::min(running_val + pmf_val, rT(1));
+        }
+    }
+
+    for (ullint_t j=ullint_t(0); j < num_elem; ++j)
+    {
+        const llint_t x_j = static_cast<llint_t>(vals_in[j]);
+        const rT val_j = x_j < llint_t(0) ? tail_if(rT(0),lower_tail) : cdf_vals[x_j - x_min];
+
+        vals_out[j] = log_form ? std::log(val_j) : val_j;
+    }
 }
 #endif
 
@@ -124,6 +366,7 @@ ppois_vec(const eT* __stats_pointer_settings__ vals_in, const T1 rate_par, const
  * @param x a standard vector.
  * @param rate_par the rate parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a vector of CDF values corresponding to the elements of \c x.
  * 
@@ -138,9 +381,9 @@ ppois_vec(const eT* __stats_pointer_settings__ vals_in, const T1 rate_par, const
 template<typename eT, typename T1, typename rT>
 statslib_inline
 std::vector<rT>
-ppois(const std::vector<eT>& x, const T1 rate_par, const bool log_form)
+ppois(const std::vector<eT>& x, const T1 rate_par, const bool log_form, const bool lower_tail)
 {
-    STDVEC_DIST_FN(ppois_vec,rate_par,log_form);
+    STDVEC_DIST_FN(ppois_vec,rate_par,log_form,lower_tail);
 }
 #endif
 
@@ -150,6 +393,7 @@ ppois(const std::vector<eT>& x, const T1 rate_par, const bool log_form)
  * @param X a matrix of input values.
  * @param rate_par the rate parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -165,17 +409,17 @@ ppois(const std::vector<eT>& x, const T1 rate_par, const bool log_form)
 template<typename eT, typename T1, typename rT>
 statslib_inline
 ArmaMat<rT>
-ppois(const ArmaMat<eT>& X, const T1 rate_par, const bool log_form)
+ppois(const ArmaMat<eT>& X, const T1 rate_par, const bool log_form, const bool lower_tail)
 {
-    ARMA_DIST_FN(ppois_vec,rate_par,log_form);
+    ARMA_DIST_FN(ppois_vec,rate_par,log_form,lower_tail);
 }
 
 template<typename mT, typename tT, typename T1>
 statslib_inline
 mT
-ppois(const ArmaGen<mT,tT>& X, const T1 rate_par, const bool log_form)
+ppois(const ArmaGen<mT,tT>& X, const T1 rate_par, const bool log_form, const bool lower_tail)
 {
-    return ppois(X.eval(),rate_par,log_form);
+    return ppois(X.eval(),rate_par,log_form,lower_tail);
 }
 #endif
 
@@ -185,6 +429,7 @@ ppois(const ArmaGen<mT,tT>& X, const T1 rate_par, const bool log_form)
  * @param X a matrix of input values.
  * @param rate_par the rate parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -198,9 +443,9 @@ ppois(const ArmaGen<mT,tT>& X, const T1 rate_par, const bool log_form)
 template<typename eT, typename T1, typename rT, bool To>
 statslib_inline
 BlazeMat<rT,To>
-ppois(const BlazeMat<eT,To>& X, const T1 rate_par, const bool log_form)
+ppois(const BlazeMat<eT,To>& X, const T1 rate_par, const bool log_form, const bool lower_tail)
 {
-    BLAZE_DIST_FN(ppois_vec,rate_par,log_form);
+    BLAZE_DIST_FN(ppois_vec,rate_par,log_form,lower_tail);
 }
 #endif
 
@@ -210,6 +455,7 @@ ppois(const BlazeMat<eT,To>& X, const T1 rate_par, const bool log_form)
  * @param X a matrix of input values.
  * @param rate_par the rate parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -223,8 +469,8 @@ ppois(const BlazeMat<eT,To>& X, const T1 rate_par, const bool log_form)
 template<typename eT, typename T1, typename rT, int iTr, int iTc>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-ppois(const EigenMat<eT,iTr,iTc>& X, const T1 rate_par, const bool log_form)
+ppois(const EigenMat<eT,iTr,iTc>& X, const T1 rate_par, const bool log_form, const bool lower_tail)
 {
-    EIGEN_DIST_FN(ppois_vec,rate_par,log_form);
+    EIGEN_DIST_FN(ppois_vec,rate_par,log_form,lower_tail);
 }
 #endif
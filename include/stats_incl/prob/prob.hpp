@@ -25,9 +25,7 @@
 #include "pbeta.hpp"
 #include "pbinom.hpp"
 #include "pcauchy.hpp"
-#include "pchisq.hpp"
 #include "pexp.hpp"
-#include "pf.hpp"
 #include "pgamma.hpp"
 #include "pinvgamma.hpp"
 #include "pkumaraswamy.hpp"
@@ -41,7 +39,12 @@
 #include "pweibull.hpp"
 
 // these depend on one of the above
+#include "pchisq.hpp"
+#include "pf.hpp"
 #include "plnorm.hpp"
 
+// batch p-values for hypothesis tests
+#include "pbatch.hpp"
+
 
 #endif
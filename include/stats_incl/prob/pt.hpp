@@ -31,7 +31,7 @@
 template<typename T1, typename T2>
 statslib_constexpr
 common_return_t<T1,T2>
-pt(const T1 x, const T2 dof_par, const bool log_form = false) noexcept;
+pt(const T1 x, const T2 dof_par, const bool log_form = false, const bool lower_tail = true) noexcept;
 
 //
 // vector/matrix input
@@ -40,33 +40,33 @@ pt(const T1 x, const T2 dof_par, const bool log_form = false) noexcept;
 template<typename eT, typename T1, typename rT = common_return_t<eT,T1>>
 statslib_inline
 std::vector<rT>
-pt(const std::vector<eT>& x, const T1 dof_par, const bool log_form = false);
+pt(const std::vector<eT>& x, const T1 dof_par, const bool log_form = false, const bool lower_tail = true);
 #endif
 
 #ifdef STATS_ENABLE_ARMA_WRAPPERS
 template<typename eT, typename T1, typename rT = common_return_t<eT,T1>>
 statslib_inline
 ArmaMat<rT>
-pt(const ArmaMat<eT>& X, const T1 dof_par, const bool log_form = false);
+pt(const ArmaMat<eT>& X, const T1 dof_par, const bool log_form = false, const bool lower_tail = true);
 
 template<typename mT, typename tT, typename T1>
 statslib_inline
 mT 
-pt(const ArmaGen<mT,tT>& X, const T1 dof_par, const bool log_form = false);
+pt(const ArmaGen<mT,tT>& X, const T1 dof_par, const bool log_form = false, const bool lower_tail = true);
 #endif
 
 #ifdef STATS_ENABLE_BLAZE_WRAPPERS
 template<typename eT, typename T1, typename rT = common_return_t<eT,T1>, bool To = blaze::columnMajor>
 statslib_inline
 BlazeMat<rT,To>
-pt(const BlazeMat<eT,To>& X, const T1 dof_par, const bool log_form = false);
+pt(const BlazeMat<eT,To>& X, const T1 dof_par, const bool log_form = false, const bool lower_tail = true);
 #endif
 
 #ifdef STATS_ENABLE_EIGEN_WRAPPERS
 template<typename eT, typename T1, typename rT = common_return_t<eT,T1>, int iTr = Eigen::Dynamic, int iTc = Eigen::Dynamic>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-pt(const EigenMat<eT,iTr,iTc>& X, const T1 dof_par, const bool log_form = false);
+pt(const EigenMat<eT,iTr,iTc>& X, const T1 dof_par, const bool log_form = false, const bool lower_tail = true);
 #endif
 
 //
@@ -58,12 +58,25 @@ pt_compute_main(const T x, const T r_par)
 template<typename T>
 statslib_constexpr
 T
-pt_compute(const T x, const T r_par)
+pt_compute_dof2(const T x, const T s_val)
+noexcept
+{   // 1/2 + x / (2 sqrt(x^2 + 2)), rearranged to avoid cancellation for x < 0
+    return( x < T(0) ? \
+                T(1) / (s_val * (s_val - x)) :
+                T(1) - T(1) / (s_val * (s_val + x)) );
+}
+
+// the upper tail is P(T > x) = P(T <= -x); the forms below lose no precision for large |x| on the lower side
+
+template<typename T>
+statslib_constexpr
+T
+pt_compute_lower(const T x, const T r_par)
 {
     return( r_par == T(1) ? \
-                pcauchy_compute(x) :
+                pcauchy_compute(x,true) :
             r_par == T(2) ? \
-                T(0.5) + x / (T(2) * stmath::sqrt(x*x + T(2)) ) :
+                pt_compute_dof2(x,stmath::sqrt(x*x + T(2))) :
             //
             pt_compute_main(x,T(r_par)) );
 }
@@ -71,29 +84,231 @@ pt_compute(const T x, const T r_par)
 template<typename T>
 statslib_constexpr
 T
-pt_vals_check(const T x, const T dof_par, const bool log_form)
+pt_compute(const T x, const T r_par, const bool lower_tail)
+{
+    return pt_compute_lower(lower_tail ? x : -x, r_par);
+}
+
+// integer degrees of freedom (Abramowitz and Stegun, 26.7.3-4): with theta = atan(|x|/sqrt(n)),
+// s = sin(theta) and c = cos(theta), the central mass P(|T| <= |x|) is the finite sum
+//   n even, m = n/2:        s sum_{k<m} a_k c^{2k},                  a_{k+1} = a_k (k + 1/2)/(k + 1)
+//   n odd,  m = (n-1)/2:    (2/pi) (theta + s c sum_{k<m} b_k c^{2k}), b_{k+1} = b_k (k + 1)/(k + 3/2)
+// with a_0 = b_0 = 1. The full series sum to one, so the two-sided tail P(|T| > |x|) is the remainder
+// from k = m. That remainder is summed directly once c^2 < 4/5, and kept on the log scale to avoid underflow;
+// for n <= 30, the central mass is then at most 0.99, so 1 - P(|T| <= |x|) loses no more than two digits
+
+template<typename T>
+statslib_constexpr
+bool
+pt_int_series_check(const T dof_par)
+noexcept
+{
+    return( dof_par >= T(3) && dof_par <= T(30) && stmath::floor(dof_par) == dof_par );
+}
+
+template<typename T>
+statslib_constexpr
+T
+pt_int_coef_ratio(const T k, const bool odd_dof)
+noexcept
+{
+    return( odd_dof ? (k + T(1)) / (k + T(1.5)) : (k + T(0.5)) / (k + T(1)) );
+}
+
+// a_m or b_m
+template<typename T>
+statslib_constexpr
+T
+pt_int_coef(const T m, const bool odd_dof, const T k = T(0), const T coef = T(1))
+noexcept
+{
+    return( k < m ? \
+                pt_int_coef(m,odd_dof,k+T(1),coef*pt_int_coef_ratio(k,odd_dof)) :
+                coef );
+}
+
+template<typename T>
+statslib_constexpr
+T
+pt_int_sum_finite(const T c2, const T m, const bool odd_dof, const T k = T(0), const T term = T(1), const T sum_val = T(0))
+noexcept
+{
+    return( k < m ? \
+                pt_int_sum_finite(c2,m,odd_dof,k+T(1),term*pt_int_coef_ratio(k,odd_dof)*c2,sum_val+term) :
+                sum_val );
+}
+
+// remainder sum, normalized by its first term; the terms shrink by a factor of at most c^2 < 4/5
+template<typename T>
+statslib_constexpr
+T
+pt_int_sum_tail(const T c2, const bool odd_dof, const T k, const T term = T(1), const T sum_val = T(0), const int iter = 0)
+noexcept
+{
+    return( term > STLIM<T>::epsilon() * sum_val && iter < 250 ? \
+                pt_int_sum_tail(c2,odd_dof,k+T(1),term*pt_int_coef_ratio(k,odd_dof)*c2,sum_val+term,iter+1) :
+                sum_val );
+}
+
+// log P(|T| > |x|) for c^2 < 4/5
+template<typename T>
+statslib_constexpr
+T
+pt_int_log_tail(const T s_val, const T c2, const T m, const bool odd_dof, const T coef_m)
+noexcept
+{
+    return( stmath::log(s_val) + stmath::log(coef_m) + m*stmath::log(c2) \
+                + stmath::log(pt_int_sum_tail(c2,odd_dof,m)) \
+                + (odd_dof ? T(0.5)*stmath::log(c2) + stmath::log(T(2) / T(GCEM_PI)) : T(0)) );
+}
+
+// P(|T| <= |x|) for c^2 >= 4/5
+template<typename T>
+statslib_constexpr
+T
+pt_int_central(const T x_abs, const T dof_par, const T s_val, const T c2, const T m, const bool odd_dof)
+noexcept
+{
+    return( odd_dof ? \
+                T(2) / T(GCEM_PI) * ( stmath::atan(x_abs / stmath::sqrt(dof_par)) \
+                    + s_val * stmath::sqrt(c2) * pt_int_sum_finite(c2,m,odd_dof) ) :
+                s_val * pt_int_sum_finite(c2,m,odd_dof) );
+}
+
+// P(T <= -|x|) = P(|T| > |x|)/2 and P(T <= |x|) = (1 + P(|T| <= |x|))/2
+
+template<typename T>
+statslib_constexpr
+T
+pt_int_tail_side(const T x_abs, const T dof_par, const T s_val, const T c2, const T m, const bool odd_dof, const T coef_m,
+                 const bool log_form)
+noexcept
+{
+    return( c2 < T(0.8) ? \
+                exp_if(pt_int_log_tail(s_val,c2,m,odd_dof,coef_m) - T(GCEM_LOG_2), !log_form) :
+                log_if((T(1) - pt_int_central(x_abs,dof_par,s_val,c2,m,odd_dof)) / T(2), log_form) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+pt_int_center_side(const T x_abs, const T dof_par, const T s_val, const T c2, const T m, const bool odd_dof, const T coef_m,
+                   const bool log_form)
+noexcept
+{
+    return( c2 < T(0.8) ? \
+                (log_form ? stmath::log1p(- stmath::exp(pt_int_log_tail(s_val,c2,m,odd_dof,coef_m)) / T(2)) :
+                            T(1) - stmath::exp(pt_int_log_tail(s_val,c2,m,odd_dof,coef_m)) / T(2)) :
+                log_if((T(1) + pt_int_central(x_abs,dof_par,s_val,c2,m,odd_dof)) / T(2), log_form) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+pt_int_compute_tail(const bool tail_side, const T x_abs, const T dof_par, const T m, const bool odd_dof, const T coef_m,
+                    const bool log_form)
+noexcept
+{
+    return( tail_side ? \
+                pt_int_tail_side(x_abs,dof_par,x_abs / stmath::sqrt(dof_par + x_abs*x_abs),dof_par / (dof_par + x_abs*x_abs),
+                                 m,odd_dof,coef_m,log_form) :
+                pt_int_center_side(x_abs,dof_par,x_abs / stmath::sqrt(dof_par + x_abs*x_abs),dof_par / (dof_par + x_abs*x_abs),
+                                   m,odd_dof,coef_m,log_form) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+pt_int_m(const T dof_par)
+noexcept
+{
+    return stmath::floor(dof_par / T(2));
+}
+
+template<typename T>
+statslib_constexpr
+bool
+pt_int_odd(const T dof_par)
+noexcept
+{
+    return( stmath::floor(dof_par / T(2)) * T(2) != dof_par );
+}
+
+// coef_m = pt_int_coef(pt_int_m(dof_par),pt_int_odd(dof_par)) depends only on the degrees of freedom
+template<typename T>
+statslib_constexpr
+T
+pt_int_compute(const T x, const T dof_par, const T coef_m, const bool log_form, const bool lower_tail)
+noexcept
+{
+    return pt_int_compute_tail((x < T(0)) == lower_tail,stmath::abs(x),dof_par,pt_int_m(dof_par),pt_int_odd(dof_par),
+                               coef_m,log_form);
+}
+
+// large degrees of freedom: Hill's (1970, Algorithm 395) normalizing transformation, P(T > t) = P(Z > z(t));
+// the relative error in the tails is below 1e-9 for n > 1e5, where the beta continued fraction converges slowly
+
+template<typename T>
+statslib_constexpr
+T
+pt_large_dof_z_poly(const T y, const T coef_b)
+noexcept
+{
+    return( ((((- T(0.4)*y - T(3.3))*y - T(24))*y - T(85.5)) / (T(0.8)*y*y + T(100) + coef_b) + y + T(3)) / coef_b + T(1) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+pt_large_dof_z(const T y, const T coef_a)
+noexcept
+{
+    return pt_large_dof_z_poly(y,T(48)*coef_a*coef_a) * stmath::sqrt(y);
+}
+
+template<typename T>
+statslib_constexpr
+T
+pt_large_dof_compute(const T x, const T dof_par, const bool log_form, const bool lower_tail)
+noexcept
+{
+    return( x < T(0) ? \
+                pnorm(- pt_large_dof_z((dof_par - T(0.5))*stmath::log1p((x/dof_par)*x),dof_par - T(0.5)),
+                      T(0),T(1),log_form,lower_tail) :
+                pnorm(pt_large_dof_z((dof_par - T(0.5))*stmath::log1p((x/dof_par)*x),dof_par - T(0.5)),
+                      T(0),T(1),log_form,lower_tail) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+pt_vals_check(const T x, const T dof_par, const bool log_form, const bool lower_tail)
 {
     return( !t_sanity_check(x,dof_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
             GCINT::is_posinf(x) ? \
-                log_one_if<T>(log_form) :
+                log_if(tail_if(T(1),lower_tail),log_form) :
             GCINT::is_neginf(x) ? \
-                log_zero_if<T>(log_form) :
+                log_if(tail_if(T(0),lower_tail),log_form) :
             //
             GCINT::is_posinf(dof_par) ? \
-                pnorm(x,T(0),T(1),log_form) :
+                pnorm(x,T(0),T(1),log_form,lower_tail) :
+            dof_par > T(1e05) ? \
+                pt_large_dof_compute(x,dof_par,log_form,lower_tail) :
+            pt_int_series_check(dof_par) ? \
+                pt_int_compute(x,dof_par,pt_int_coef(pt_int_m(dof_par),pt_int_odd(dof_par)),log_form,lower_tail) :
             //
-            log_if(pt_compute(x,dof_par), log_form) );
+            log_if(pt_compute(x,dof_par,lower_tail), log_form) );
 }
 
 template<typename T1, typename T2, typename TC = common_return_t<T1,T2>>
 statslib_constexpr
 TC
-pt_type_check(const T1 x, const T2 dof_par, const bool log_form)
+pt_type_check(const T1 x, const T2 dof_par, const bool log_form, const bool lower_tail)
 noexcept
 {
-    return pt_vals_check(static_cast<TC>(x),static_cast<TC>(dof_par),log_form);
+    return pt_vals_check(static_cast<TC>(x),static_cast<TC>(dof_par),log_form,lower_tail);
 }
 
 }
@@ -104,6 +319,7 @@ noexcept
  * @param x a real-valued input.
  * @param dof_par the degrees of freedom parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return the cumulative distribution function evaluated at \c x.
  * 
@@ -114,10 +330,10 @@ noexcept
 template<typename T1, typename T2>
 statslib_constexpr
 common_return_t<T1,T2>
-pt(const T1 x, const T2 dof_par, const bool log_form)
+pt(const T1 x, const T2 dof_par, const bool log_form, const bool lower_tail)
 noexcept
 {
-    return internal::pt_type_check(x,dof_par,log_form);
+    return internal::pt_type_check(x,dof_par,log_form,lower_tail);
 }
 
 //
@@ -127,13 +343,78 @@ namespace internal
 {
 
 #ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+// other degrees of freedom, through the batch incomplete beta function: P(|T| > |x|) = I_{dof/(dof+x^2)}(dof/2,1/2),
+// with both dof/(dof+x^2) and x^2/(dof+x^2) formed directly; non-finite x are replaced by their scalar values
+
+template<typename eT, typename rT>
+statslib_inline
+void
+pt_beta_batch_compute(const eT* __stats_pointer_settings__ vals_in, const rT dof_par, const bool lower_tail,
+                            rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    std::vector<rT> y_vals(num_elem);
+
+    for (ullint_t j=ullint_t(0); j < num_elem; ++j)
+    {
+        const rT x_j = static_cast<rT>(vals_in[j]);
+        const rT w_j = GCINT::is_finite(x_j) ? x_j*x_j : STLIM<rT>::quiet_NaN();
+
+        vals_out[j] = dof_par / (dof_par + w_j);
+        y_vals[j] = w_j / (dof_par + w_j);
+    }
+
+    incomplete_beta_vec(dof_par/rT(2),rT(0.5),vals_out,y_vals.data(),true,vals_out,num_elem);
+
+    for (ullint_t j=ullint_t(0); j < num_elem; ++j)
+    {
+        const rT x_j = static_cast<rT>(vals_in[j]);
+        const rT tail_val = vals_out[j] / rT(2);
+
+        vals_out[j] = GCINT::is_nan(tail_val) ? pt(x_j,dof_par,false,lower_tail) :
+                      (x_j > rT(0)) == lower_tail ? rT(1) - tail_val : tail_val;
+    }
+}
+
+// integer degrees of freedom, with the series coefficient passed in; non-finite x are replaced by their scalar values
+
+template<typename eT, typename T>
+statslib_inline
+T
+pt_int_vals_check(const eT x, const T dof_par, const T coef_m, const bool log_form, const bool lower_tail)
+noexcept
+{
+    return( (GCINT::is_nan(static_cast<T>(x)) || GCINT::is_inf(static_cast<T>(x))) ? \
+                pt(static_cast<T>(x),dof_par,log_form,lower_tail) :
+                pt_int_compute(static_cast<T>(x),dof_par,coef_m,log_form,lower_tail) );
+}
+
 template<typename eT, typename T1, typename rT>
 statslib_inline
 void
-pt_vec(const eT* __stats_pointer_settings__ vals_in, const T1 dof_par, const bool log_form, 
+pt_vec(const eT* __stats_pointer_settings__ vals_in, const T1 dof_par, const bool log_form, const bool lower_tail,
              rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(pt,vals_in,vals_out,num_elem,dof_par,log_form);
+    const rT dof_r = static_cast<rT>(dof_par);
+
+    // dof = 1 and 2 keep their closed forms, through the scalar function
+
+    if (!log_form && dof_r != rT(1) && dof_r != rT(2) && !pt_int_series_check(dof_r)
+            && dof_r >= STLIM<rT>::epsilon() && dof_r <= rT(1e05)) {
+        pt_beta_batch_compute(vals_in,dof_r,lower_tail,vals_out,num_elem);
+        return;
+    }
+
+    if (!pt_int_series_check(dof_r)) {
+        EVAL_DIST_FN_VEC(pt,vals_in,vals_out,num_elem,dof_par,log_form,lower_tail);
+        return;
+    }
+
+    // integer degrees of freedom: the series coefficient depends only on dof_par, so it is computed once
+
+    const rT coef_m = pt_int_coef(pt_int_m(dof_r),pt_int_odd(dof_r));
+
+    EVAL_DIST_FN_VEC(pt_int_vals_check,vals_in,vals_out,num_elem,dof_r,coef_m,log_form,lower_tail);
 }
 #endif
 
@@ -145,6 +426,7 @@ pt_vec(const eT* __stats_pointer_settings__ vals_in, const T1 dof_par, const boo
  * @param x a standard vector.
  * @param dof_par the degrees of freedom parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a vector of CDF values corresponding to the elements of \c x.
  * 
@@ -159,9 +441,9 @@ pt_vec(const eT* __stats_pointer_settings__ vals_in, const T1 dof_par, const boo
 template<typename eT, typename T1, typename rT>
 statslib_inline
 std::vector<rT>
-pt(const std::vector<eT>& x, const T1 dof_par, const bool log_form)
+pt(const std::vector<eT>& x, const T1 dof_par, const bool log_form, const bool lower_tail)
 {
-    STDVEC_DIST_FN(pt_vec,dof_par,log_form);
+    STDVEC_DIST_FN(pt_vec,dof_par,log_form,lower_tail);
 }
 #endif
 
@@ -171,6 +453,7 @@ pt(const std::vector<eT>& x, const T1 dof_par, const bool log_form)
  * @param X a matrix of input values.
  * @param dof_par the degrees of freedom parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -186,17 +469,17 @@ pt(const std::vector<eT>& x, const T1 dof_par, const bool log_form)
 template<typename eT, typename T1, typename rT>
 statslib_inline
 ArmaMat<rT>
-pt(const ArmaMat<eT>& X, const T1 dof_par, const bool log_form)
+pt(const ArmaMat<eT>& X, const T1 dof_par, const bool log_form, const bool lower_tail)
 {
-    ARMA_DIST_FN(pt_vec,dof_par,log_form);
+    ARMA_DIST_FN(pt_vec,dof_par,log_form,lower_tail);
 }
 
 template<typename mT, typename tT, typename T1>
 statslib_inline
 mT
-pt(const ArmaGen<mT,tT>& X, const T1 dof_par, const bool log_form)
+pt(const ArmaGen<mT,tT>& X, const T1 dof_par, const bool log_form, const bool lower_tail)
 {
-    return pt(X.eval(),dof_par,log_form);
+    return pt(X.eval(),dof_par,log_form,lower_tail);
 }
 #endif
 
@@ -206,6 +489,7 @@ pt(const ArmaGen<mT,tT>& X, const T1 dof_par, const bool log_form)
  * @param X a matrix of input values.
  * @param dof_par the degrees of freedom parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -219,9 +503,9 @@ pt(const ArmaGen<mT,tT>& X, const T1 dof_par, const bool log_form)
 template<typename eT, typename T1, typename rT, bool To>
 statslib_inline
 BlazeMat<rT,To>
-pt(const BlazeMat<eT,To>& X, const T1 dof_par, const bool log_form)
+pt(const BlazeMat<eT,To>& X, const T1 dof_par, const bool log_form, const bool lower_tail)
 {
-    BLAZE_DIST_FN(pt_vec,dof_par,log_form);
+    BLAZE_DIST_FN(pt_vec,dof_par,log_form,lower_tail);
 }
 #endif
 
@@ -231,6 +515,7 @@ pt(const BlazeMat<eT,To>& X, const T1 dof_par, const bool log_form)
  * @param X a matrix of input values.
  * @param dof_par the degrees of freedom parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -244,8 +529,8 @@ pt(const BlazeMat<eT,To>& X, const T1 dof_par, const bool log_form)
 template<typename eT, typename T1, typename rT, int iTr, int iTc>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-pt(const EigenMat<eT,iTr,iTc>& X, const T1 dof_par, const bool log_form)
+pt(const EigenMat<eT,iTr,iTc>& X, const T1 dof_par, const bool log_form, const bool lower_tail)
 {
-    EIGEN_DIST_FN(pt_vec,dof_par,log_form);
+    EIGEN_DIST_FN(pt_vec,dof_par,log_form,lower_tail);
 }
 #endif
@@ -31,20 +31,22 @@ namespace internal
 template<typename T>
 statslib_constexpr
 T
-punif_compute(const T x, const T a_par, const T b_par)
+punif_compute(const T x, const T a_par, const T b_par, const bool lower_tail)
 {
     return( x <= a_par ? \
-                T(0) :
+                tail_if(T(0),lower_tail) :
             x >= b_par ? \
-                T(1) :
+                tail_if(T(1),lower_tail) :
             //
-                (x-a_par) / (b_par-a_par) );
+            lower_tail ? \
+                (x-a_par) / (b_par-a_par) :
+                (b_par-x) / (b_par-a_par) );
 }
 
 template<typename T>
 statslib_constexpr
 T
-punif_vals_check(const T x, const T a_par, const T b_par, const bool log_form)
+punif_vals_check(const T x, const T a_par, const T b_par, const bool log_form, const bool lower_tail)
 {
     return( !unif_sanity_check(x,a_par,b_par) ? \
                 STLIM<T>::quiet_NaN() :
@@ -52,17 +54,17 @@ punif_vals_check(const T x, const T a_par, const T b_par, const bool log_form)
             GCINT::all_inf(a_par,b_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            log_if(punif_compute(x,a_par,b_par), log_form) );
+            log_if(punif_compute(x,a_par,b_par,lower_tail), log_form) );
 }
 
 template<typename T1, typename T2, typename T3, typename TC = common_return_t<T1,T2,T3>>
 statslib_constexpr
 TC
-punif_type_check(const T1 x, const T2 a_par, const T3 b_par, const bool log_form)
+punif_type_check(const T1 x, const T2 a_par, const T3 b_par, const bool log_form, const bool lower_tail)
 noexcept
 {
     return punif_vals_check(static_cast<TC>(x),static_cast<TC>(a_par),
-                           static_cast<TC>(b_par),log_form);
+                           static_cast<TC>(b_par),log_form,lower_tail);
 }
 
 }
@@ -74,6 +76,7 @@ noexcept
  * @param a_par the lower bound parameter, a real-valued input.
  * @param b_par the upper bound parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return the cumulative distribution function evaluated at \c x.
  * 
@@ -84,10 +87,10 @@ noexcept
 template<typename T1, typename T2, typename T3>
 statslib_constexpr
 common_return_t<T1,T2,T3>
-punif(const T1 x, const T2 a_par, const T3 b_par, const bool log_form)
+punif(const T1 x, const T2 a_par, const T3 b_par, const bool log_form, const bool lower_tail)
 noexcept
 {
-    return internal::punif_type_check(x,a_par,b_par,log_form);
+    return internal::punif_type_check(x,a_par,b_par,log_form,lower_tail);
 }
 
 //
@@ -100,10 +103,10 @@ namespace internal
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 void
-punif_vec(const eT* __stats_pointer_settings__ vals_in, const T1 a_par, const T2 b_par, const bool log_form, 
+punif_vec(const eT* __stats_pointer_settings__ vals_in, const T1 a_par, const T2 b_par, const bool log_form, const bool lower_tail,
                 rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(punif,vals_in,vals_out,num_elem,a_par,b_par,log_form);
+    EVAL_DIST_FN_VEC(punif,vals_in,vals_out,num_elem,a_par,b_par,log_form,lower_tail);
 }
 #endif
 
@@ -116,6 +119,7 @@ punif_vec(const eT* __stats_pointer_settings__ vals_in, const T1 a_par, const T2
  * @param a_par a real-valued shape parameter.
  * @param b_par a real-valued shape parameter.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a vector of CDF values corresponding to the elements of \c x.
  * 
@@ -130,9 +134,9 @@ punif_vec(const eT* __stats_pointer_settings__ vals_in, const T1 a_par, const T2
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 std::vector<rT>
-punif(const std::vector<eT>& x, const T1 a_par, const T2 b_par, const bool log_form)
+punif(const std::vector<eT>& x, const T1 a_par, const T2 b_par, const bool log_form, const bool lower_tail)
 {
-    STDVEC_DIST_FN(punif_vec,a_par,b_par,log_form);
+    STDVEC_DIST_FN(punif_vec,a_par,b_par,log_form,lower_tail);
 }
 #endif
 
@@ -143,6 +147,7 @@ punif(const std::vector<eT>& x, const T1 a_par, const T2 b_par, const bool log_f
  * @param a_par a real-valued shape parameter.
  * @param b_par a real-valued shape parameter.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -158,17 +163,17 @@ punif(const std::vector<eT>& x, const T1 a_par, const T2 b_par, const bool log_f
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 ArmaMat<rT>
-punif(const ArmaMat<eT>& X, const T1 a_par, const T2 b_par, const bool log_form)
+punif(const ArmaMat<eT>& X, const T1 a_par, const T2 b_par, const bool log_form, const bool lower_tail)
 {
-    ARMA_DIST_FN(punif_vec,a_par,b_par,log_form);
+    ARMA_DIST_FN(punif_vec,a_par,b_par,log_form,lower_tail);
 }
 
 template<typename mT, typename tT, typename T1, typename T2>
 statslib_inline
 mT
-punif(const ArmaGen<mT,tT>& X, const T1 a_par, const T2 b_par, const bool log_form)
+punif(const ArmaGen<mT,tT>& X, const T1 a_par, const T2 b_par, const bool log_form, const bool lower_tail)
 {
-    return punif(X.eval(),a_par,b_par,log_form);
+    return punif(X.eval(),a_par,b_par,log_form,lower_tail);
 }
 #endif
 
@@ -179,6 +184,7 @@ punif(const ArmaGen<mT,tT>& X, const T1 a_par, const T2 b_par, const bool log_fo
  * @param a_par a real-valued shape parameter.
  * @param b_par a real-valued shape parameter.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -192,9 +198,9 @@ punif(const ArmaGen<mT,tT>& X, const T1 a_par, const T2 b_par, const bool log_fo
 template<typename eT, typename T1, typename T2, typename rT, bool To>
 statslib_inline
 BlazeMat<rT,To>
-punif(const BlazeMat<eT,To>& X, const T1 a_par, const T2 b_par, const bool log_form)
+punif(const BlazeMat<eT,To>& X, const T1 a_par, const T2 b_par, const bool log_form, const bool lower_tail)
 {
-    BLAZE_DIST_FN(punif_vec,a_par,b_par,log_form);
+    BLAZE_DIST_FN(punif_vec,a_par,b_par,log_form,lower_tail);
 }
 #endif
 
@@ -205,6 +211,7 @@ punif(const BlazeMat<eT,To>& X, const T1 a_par, const T2 b_par, const bool log_f
  * @param a_par a real-valued shape parameter.
  * @param b_par a real-valued shape parameter.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  *
@@ -218,8 +225,8 @@ punif(const BlazeMat<eT,To>& X, const T1 a_par, const T2 b_par, const bool log_f
 template<typename eT, typename T1, typename T2, typename rT, int iTr, int iTc>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-punif(const EigenMat<eT,iTr,iTc>& X, const T1 a_par, const T2 b_par, const bool log_form)
+punif(const EigenMat<eT,iTr,iTc>& X, const T1 a_par, const T2 b_par, const bool log_form, const bool lower_tail)
 {
-    EIGEN_DIST_FN(punif_vec,a_par,b_par,log_form);
+    EIGEN_DIST_FN(punif_vec,a_par,b_par,log_form,lower_tail);
 }
 #endif
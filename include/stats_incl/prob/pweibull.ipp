@@ -31,10 +31,14 @@ namespace internal
 template<typename T>
 statslib_constexpr
 T
-pweibull_compute(const T x, const T shape_par)
+pweibull_compute(const T x, const T shape_par, const bool log_form, const bool lower_tail)
 noexcept
-{
-    return( - stmath::expm1(-stmath::pow(x,shape_par)) );
+{   // P(X > x) = exp(-(x/scale)^k)
+    return( lower_tail ? \
+                log_if(- stmath::expm1(-stmath::pow(x,shape_par)),log_form) :
+            log_form ? \
+                - stmath::pow(x,shape_par) :
+                stmath::exp(-stmath::pow(x,shape_par)) );
 }
 
 template<typename T>
@@ -64,29 +68,29 @@ noexcept
 template<typename T>
 statslib_constexpr
 T
-pweibull_vals_check(const T x, const T shape_par, const T scale_par, const bool log_form)
+pweibull_vals_check(const T x, const T shape_par, const T scale_par, const bool log_form, const bool lower_tail)
 noexcept
 {
     return( !weibull_sanity_check(x,shape_par,scale_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
             x < STLIM<T>::epsilon() ? \
-                log_zero_if<T>(log_form) :
+                log_if(tail_if(T(0),lower_tail),log_form) :
             //
             GCINT::any_inf(x,shape_par,scale_par) ? \
-                log_if(pweibull_limit_vals(x,shape_par,scale_par), log_form) :
+                log_if(tail_if(pweibull_limit_vals(x,shape_par,scale_par),lower_tail), log_form) :
             //
-            log_if(pweibull_compute(x/scale_par,shape_par), log_form) );
+            pweibull_compute(x/scale_par,shape_par,log_form,lower_tail) );
 }
 
 template<typename T1, typename T2, typename T3, typename TC = common_return_t<T1,T2,T3>>
 statslib_constexpr
 TC
-pweibull_type_check(const T1 x, const T2 shape_par, const T3 scale_par, const bool log_form)
+pweibull_type_check(const T1 x, const T2 shape_par, const T3 scale_par, const bool log_form, const bool lower_tail)
 noexcept
 {
     return pweibull_vals_check(static_cast<TC>(x),static_cast<TC>(shape_par),
-                               static_cast<TC>(scale_par),log_form);
+                               static_cast<TC>(scale_par),log_form,lower_tail);
 }
 
 }
@@ -98,6 +102,7 @@ noexcept
  * @param shape_par the shape parameter, a real-valued input.
  * @param scale_par the scale parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return the cumulative distribution function evaluated at \c x.
  * 
@@ -108,10 +113,10 @@ noexcept
 template<typename T1, typename T2, typename T3>
 statslib_constexpr
 common_return_t<T1,T2,T3>
-pweibull(const T1 x, const T2 shape_par, const T3 scale_par, const bool log_form)
+pweibull(const T1 x, const T2 shape_par, const T3 scale_par, const bool log_form, const bool lower_tail)
 noexcept
 {
-    return internal::pweibull_type_check(x,shape_par,scale_par,log_form);
+    return internal::pweibull_type_check(x,shape_par,scale_par,log_form,lower_tail);
 }
 
 //
@@ -124,10 +129,10 @@ namespace internal
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 void
-pweibull_vec(const eT* __stats_pointer_settings__ vals_in, const T1 shape_par, const T2 scale_par, const bool log_form, 
+pweibull_vec(const eT* __stats_pointer_settings__ vals_in, const T1 shape_par, const T2 scale_par, const bool log_form, const bool lower_tail,
                    rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(pweibull,vals_in,vals_out,num_elem,shape_par,scale_par,log_form);
+    EVAL_DIST_FN_VEC(pweibull,vals_in,vals_out,num_elem,shape_par,scale_par,log_form,lower_tail);
 }
 #endif
 
@@ -140,6 +145,7 @@ pweibull_vec(const eT* __stats_pointer_settings__ vals_in, const T1 shape_par, c
  * @param shape_par the shape parameter, a real-valued input.
  * @param scale_par the scale parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a vector of CDF values corresponding to the elements of \c x.
  * 
@@ -154,9 +160,9 @@ pweibull_vec(const eT* __stats_pointer_settings__ vals_in, const T1 shape_par, c
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 std::vector<rT>
-pweibull(const std::vector<eT>& x, const T1 shape_par, const T2 scale_par, const bool log_form)
+pweibull(const std::vector<eT>& x, const T1 shape_par, const T2 scale_par, const bool log_form, const bool lower_tail)
 {
-    STDVEC_DIST_FN(pweibull_vec,shape_par,scale_par,log_form);
+    STDVEC_DIST_FN(pweibull_vec,shape_par,scale_par,log_form,lower_tail);
 }
 #endif
 
@@ -167,6 +173,7 @@ pweibull(const std::vector<eT>& x, const T1 shape_par, const T2 scale_par, const
  * @param shape_par the shape parameter, a real-valued input.
  * @param scale_par the scale parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -182,17 +189,17 @@ pweibull(const std::vector<eT>& x, const T1 shape_par, const T2 scale_par, const
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 ArmaMat<rT>
-pweibull(const ArmaMat<eT>& X, const T1 shape_par, const T2 scale_par, const bool log_form)
+pweibull(const ArmaMat<eT>& X, const T1 shape_par, const T2 scale_par, const bool log_form, const bool lower_tail)
 {
-    ARMA_DIST_FN(pweibull_vec,shape_par,scale_par,log_form);
+    ARMA_DIST_FN(pweibull_vec,shape_par,scale_par,log_form,lower_tail);
 }
 
 template<typename mT, typename tT, typename T1, typename T2>
 statslib_inline
 mT
-pweibull(const ArmaGen<mT,tT>& X, const T1 shape_par, const T2 scale_par, const bool log_form)
+pweibull(const ArmaGen<mT,tT>& X, const T1 shape_par, const T2 scale_par, const bool log_form, const bool lower_tail)
 {
-    return pweibull(X.eval(),shape_par,scale_par,log_form);
+    return pweibull(X.eval(),shape_par,scale_par,log_form,lower_tail);
 }
 #endif
 
@@ -203,6 +210,7 @@ pweibull(const ArmaGen<mT,tT>& X, const T1 shape_par, const T2 scale_par, const
  * @param shape_par the shape parameter, a real-valued input.
  * @param scale_par the scale parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -216,9 +224,9 @@ pweibull(const ArmaGen<mT,tT>& X, const T1 shape_par, const T2 scale_par, const
 template<typename eT, typename T1, typename T2, typename rT, bool To>
 statslib_inline
 BlazeMat<rT,To>
-pweibull(const BlazeMat<eT,To>& X, const T1 shape_par, const T2 scale_par, const bool log_form)
+pweibull(const BlazeMat<eT,To>& X, const T1 shape_par, const T2 scale_par, const bool log_form, const bool lower_tail)
 {
-    BLAZE_DIST_FN(pweibull_vec,shape_par,scale_par,log_form);
+    BLAZE_DIST_FN(pweibull_vec,shape_par,scale_par,log_form,lower_tail);
 }
 #endif
 
@@ -229,6 +237,7 @@ pweibull(const BlazeMat<eT,To>& X, const T1 shape_par, const T2 scale_par, const
  * @param shape_par the shape parameter, a real-valued input.
  * @param scale_par the scale parameter, a real-valued input.
  * @param log_form return the log-probability or the true form.
+ * @param lower_tail return the lower-tail probability, \f$ P(X \leq x) \f$, or the upper tail, \f$ P(X > x) \f$.
  *
  * @return a matrix of CDF values corresponding to the elements of \c X.
  * 
@@ -242,8 +251,8 @@ pweibull(const BlazeMat<eT,To>& X, const T1 shape_par, const T2 scale_par, const
 template<typename eT, typename T1, typename T2, typename rT, int iTr, int iTc>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-pweibull(const EigenMat<eT,iTr,iTc>& X, const T1 shape_par, const T2 scale_par, const bool log_form)
+pweibull(const EigenMat<eT,iTr,iTc>& X, const T1 shape_par, const T2 scale_par, const bool log_form, const bool lower_tail)
 {
-    EIGEN_DIST_FN(pweibull_vec,shape_par,scale_par,log_form);
+    EIGEN_DIST_FN(pweibull_vec,shape_par,scale_par,log_form,lower_tail);
 }
 #endif
@@ -31,7 +31,7 @@
 template<typename T1, typename T2>
 statslib_constexpr
 common_return_t<T1,T2>
-qbern(const T1 p, const T2 prob_par) noexcept;
+qbern(const T1 p, const T2 prob_par, const bool lower_tail = true, const bool log_p = false) noexcept;
 
 //
 // vector/matrix input
@@ -40,33 +40,33 @@ qbern(const T1 p, const T2 prob_par) noexcept;
 template<typename eT, typename T1, typename rT = common_return_t<eT,T1>>
 statslib_inline
 std::vector<rT>
-qbern(const std::vector<eT>& x, const T1 prob_par);
+qbern(const std::vector<eT>& x, const T1 prob_par, const bool lower_tail = true, const bool log_p = false);
 #endif
 
 #ifdef STATS_ENABLE_ARMA_WRAPPERS
 template<typename eT, typename T1, typename rT = common_return_t<eT,T1>>
 statslib_inline
 ArmaMat<rT>
-qbern(const ArmaMat<eT>& X, const T1 prob_par);
+qbern(const ArmaMat<eT>& X, const T1 prob_par, const bool lower_tail = true, const bool log_p = false);
 
 template<typename mT, typename tT, typename T1>
 statslib_inline
 mT 
-qbern(const ArmaGen<mT,tT>& X, const T1 prob_par);
+qbern(const ArmaGen<mT,tT>& X, const T1 prob_par, const bool lower_tail = true, const bool log_p = false);
 #endif
 
 #ifdef STATS_ENABLE_BLAZE_WRAPPERS
 template<typename eT, typename T1, typename rT = common_return_t<eT,T1>, bool To = blaze::columnMajor>
 statslib_inline
 BlazeMat<rT,To>
-qbern(const BlazeMat<eT,To>& X, const T1 prob_par);
+qbern(const BlazeMat<eT,To>& X, const T1 prob_par, const bool lower_tail = true, const bool log_p = false);
 #endif
 
 #ifdef STATS_ENABLE_EIGEN_WRAPPERS
 template<typename eT, typename T1, typename rT = common_return_t<eT,T1>, int iTr = Eigen::Dynamic, int iTc = Eigen::Dynamic>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-qbern(const EigenMat<eT,iTr,iTc>& X, const T1 prob_par);
+qbern(const EigenMat<eT,iTr,iTc>& X, const T1 prob_par, const bool lower_tail = true, const bool log_p = false);
 #endif
 
 //
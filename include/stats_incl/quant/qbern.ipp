@@ -31,16 +31,16 @@ namespace internal
 template<typename T>
 statslib_constexpr
 T
-qbern_compute(const T p, const T prob_par)
+qbern_compute(const T p, const T prob_par, const bool lower_tail, const bool log_p)
 noexcept
 {
     return( !bern_sanity_check(prob_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            !prob_val_check(p) ? \
+            !prob_val_check(p,log_p) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            p > (T(1) - prob_par) ? \
+            (lower_tail ? prob_lower(p,lower_tail,log_p) > (T(1) - prob_par) : prob_upper(p,lower_tail,log_p) < prob_par) ? \
                 llint_t(1) : 
                 llint_t(0) );
 }
@@ -48,10 +48,10 @@ noexcept
 template<typename T1, typename T2, typename TC = common_return_t<T1,T2>>
 statslib_constexpr
 TC
-qbern_type_check(const T1 p, const T2 prob_par)
+qbern_type_check(const T1 p, const T2 prob_par, const bool lower_tail, const bool log_p)
 noexcept
 {
-    return qbern_compute(static_cast<TC>(p),static_cast<TC>(prob_par));
+    return qbern_compute(static_cast<TC>(p),static_cast<TC>(prob_par),lower_tail,log_p);
 }
 
 }
@@ -61,6 +61,8 @@ noexcept
  *
  * @param p a real-valued input.
  * @param prob_par the probability parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return the quantile function evaluated at \c p.
  * 
@@ -71,10 +73,10 @@ noexcept
 template<typename T1, typename T2>
 statslib_constexpr
 common_return_t<T1,T2> // not llint_t so we can return NaN
-qbern(const T1 p, const T2 prob_par)
+qbern(const T1 p, const T2 prob_par, const bool lower_tail, const bool log_p)
 noexcept
 {
-    return internal::qbern_type_check(p,prob_par);
+    return internal::qbern_type_check(p,prob_par,lower_tail,log_p);
 }
 
 //
@@ -87,10 +89,10 @@ namespace internal
 template<typename eT, typename T1, typename rT>
 statslib_inline
 void
-qbern_vec(const eT* __stats_pointer_settings__ vals_in, const T1 prob_par,
+qbern_vec(const eT* __stats_pointer_settings__ vals_in, const T1 prob_par, const bool lower_tail, const bool log_p,
                 rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(qbern,vals_in,vals_out,num_elem,prob_par);
+    EVAL_DIST_FN_VEC(qbern,vals_in,vals_out,num_elem,prob_par,lower_tail,log_p);
 }
 #endif
 
@@ -101,6 +103,8 @@ qbern_vec(const eT* __stats_pointer_settings__ vals_in, const T1 prob_par,
  *
  * @param x a standard vector.
  * @param prob_par the probability parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return a vector of quantile values corresponding to the elements of \c x.
  * 
@@ -115,9 +119,9 @@ qbern_vec(const eT* __stats_pointer_settings__ vals_in, const T1 prob_par,
 template<typename eT, typename T1, typename rT>
 statslib_inline
 std::vector<rT>
-qbern(const std::vector<eT>& x, const T1 prob_par)
+qbern(const std::vector<eT>& x, const T1 prob_par, const bool lower_tail, const bool log_p)
 {
-    STDVEC_DIST_FN(qbern_vec,prob_par);
+    STDVEC_DIST_FN(qbern_vec,prob_par,lower_tail,log_p);
 }
 #endif
 
@@ -126,6 +130,8 @@ qbern(const std::vector<eT>& x, const T1 prob_par)
  *
  * @param X a matrix of input values.
  * @param prob_par the probability parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -141,17 +147,17 @@ qbern(const std::vector<eT>& x, const T1 prob_par)
 template<typename eT, typename T1, typename rT>
 statslib_inline
 ArmaMat<rT>
-qbern(const ArmaMat<eT>& X, const T1 prob_par)
+qbern(const ArmaMat<eT>& X, const T1 prob_par, const bool lower_tail, const bool log_p)
 {
-    ARMA_DIST_FN(qbern_vec,prob_par);
+    ARMA_DIST_FN(qbern_vec,prob_par,lower_tail,log_p);
 }
 
 template<typename mT, typename tT, typename T1>
 statslib_inline
 mT
-qbern(const ArmaGen<mT,tT>& X, const T1 prob_par)
+qbern(const ArmaGen<mT,tT>& X, const T1 prob_par, const bool lower_tail, const bool log_p)
 {
-    return qbern(X.eval(),prob_par);
+    return qbern(X.eval(),prob_par,lower_tail,log_p);
 }
 #endif
 
@@ -160,6 +166,8 @@ qbern(const ArmaGen<mT,tT>& X, const T1 prob_par)
  *
  * @param X a matrix of input values.
  * @param prob_par the probability parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -173,9 +181,9 @@ qbern(const ArmaGen<mT,tT>& X, const T1 prob_par)
 template<typename eT, typename T1, typename rT, bool To>
 statslib_inline
 BlazeMat<rT,To>
-qbern(const BlazeMat<eT,To>& X, const T1 prob_par)
+qbern(const BlazeMat<eT,To>& X, const T1 prob_par, const bool lower_tail, const bool log_p)
 {
-    BLAZE_DIST_FN(qbern_vec,prob_par);
+    BLAZE_DIST_FN(qbern_vec,prob_par,lower_tail,log_p);
 }
 #endif
 
@@ -184,6 +192,8 @@ qbern(const BlazeMat<eT,To>& X, const T1 prob_par)
  *
  * @param X a matrix of input values.
  * @param prob_par the probability parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -197,8 +207,8 @@ qbern(const BlazeMat<eT,To>& X, const T1 prob_par)
 template<typename eT, typename T1, typename rT, int iTr, int iTc>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-qbern(const EigenMat<eT,iTr,iTc>& X, const T1 prob_par)
+qbern(const EigenMat<eT,iTr,iTc>& X, const T1 prob_par, const bool lower_tail, const bool log_p)
 {
-    EIGEN_DIST_FN(qbern_vec,prob_par);
+    EIGEN_DIST_FN(qbern_vec,prob_par,lower_tail,log_p);
 }
 #endif
@@ -31,7 +31,7 @@
 template<typename T1, typename T2, typename T3>
 statslib_constexpr
 common_return_t<T1,T2,T3>
-qbeta(const T1 p, const T2 a_par, const T3 b_par) noexcept;
+qbeta(const T1 p, const T2 a_par, const T3 b_par, const bool lower_tail = true, const bool log_p = false) noexcept;
 
 //
 // vector/matrix input
@@ -40,33 +40,33 @@ qbeta(const T1 p, const T2 a_par, const T3 b_par) noexcept;
 template<typename eT, typename T1, typename T2, typename rT = common_return_t<eT,T1,T2>>
 statslib_inline
 std::vector<rT>
-qbeta(const std::vector<eT>& x, const T1 a_par, const T2 b_par);
+qbeta(const std::vector<eT>& x, const T1 a_par, const T2 b_par, const bool lower_tail = true, const bool log_p = false, ullint_t* n_iter_out = nullptr);
 #endif
 
 #ifdef STATS_ENABLE_ARMA_WRAPPERS
 template<typename eT, typename T1, typename T2, typename rT = common_return_t<eT,T1,T2>>
 statslib_inline
 ArmaMat<rT>
-qbeta(const ArmaMat<eT>& X, const T1 a_par, const T2 b_par);
+qbeta(const ArmaMat<eT>& X, const T1 a_par, const T2 b_par, const bool lower_tail = true, const bool log_p = false, ullint_t* n_iter_out = nullptr);
 
 template<typename mT, typename tT, typename T1, typename T2>
 statslib_inline
 mT
-qbeta(const ArmaGen<mT,tT>& X, const T1 a_par, const T2 b_par);
+qbeta(const ArmaGen<mT,tT>& X, const T1 a_par, const T2 b_par, const bool lower_tail = true, const bool log_p = false, ullint_t* n_iter_out = nullptr);
 #endif
 
 #ifdef STATS_ENABLE_BLAZE_WRAPPERS
 template<typename eT, typename T1, typename T2, typename rT = common_return_t<eT,T1,T2>, bool To = blaze::columnMajor>
 statslib_inline
 BlazeMat<rT,To>
-qbeta(const BlazeMat<eT,To>& X, const T1 a_par, const T2 b_par);
+qbeta(const BlazeMat<eT,To>& X, const T1 a_par, const T2 b_par, const bool lower_tail = true, const bool log_p = false, ullint_t* n_iter_out = nullptr);
 #endif
 
 #ifdef STATS_ENABLE_EIGEN_WRAPPERS
 template<typename eT, typename T1, typename T2, typename rT = common_return_t<eT,T1,T2>, int iTr = Eigen::Dynamic, int iTc = Eigen::Dynamic>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-qbeta(const EigenMat<eT,iTr,iTc>& X, const T1 a_par, const T2 b_par);
+qbeta(const EigenMat<eT,iTr,iTc>& X, const T1 a_par, const T2 b_par, const bool lower_tail = true, const bool log_p = false, ullint_t* n_iter_out = nullptr);
 #endif
 
 //
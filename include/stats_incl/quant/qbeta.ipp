@@ -31,10 +31,12 @@ namespace internal
 template<typename T>
 statslib_constexpr
 T
-qbeta_compute(const T p, const T a_par, const T b_par)
+qbeta_compute(const T p, const T a_par, const T b_par, const bool lower_tail, const bool log_p)
 noexcept
-{
-    return gcem::incomplete_beta_inv(a_par,b_par,p);
+{   // upper tail: I_{1-x}(b,a) = q
+    return( invert_upper_tail(p,lower_tail,log_p) ? \
+                T(1) - static_cast<T>(gcem::incomplete_beta_inv(b_par,a_par,prob_upper(p,lower_tail,log_p))) :
+                static_cast<T>(gcem::incomplete_beta_inv(a_par,b_par,prob_lower(p,lower_tail,log_p))) );
 }
 
 template<typename T>
@@ -63,33 +65,33 @@ noexcept
 template<typename T>
 statslib_constexpr
 T
-qbeta_vals_check(const T p, const T a_par, const T b_par)
+qbeta_vals_check(const T p, const T a_par, const T b_par, const bool lower_tail, const bool log_p)
 noexcept
 {
     return( !beta_sanity_check(a_par,b_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            !prob_val_check(p) ? \
+            !prob_val_check(p,log_p) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            p == T(0) ? \
+            prob_lower_is_zero(p,lower_tail,log_p) ? \
                 T(0) :
-            p == T(1) ? \
+            prob_upper_is_zero(p,lower_tail,log_p) ? \
                 T(1) :
             //
             (a_par == T(0) || b_par == T(0) || GCINT::any_posinf(a_par,b_par)) ? \
-                qbeta_limit_vals(p,a_par,b_par) :
+                qbeta_limit_vals(prob_lower(p,lower_tail,log_p),a_par,b_par) :
             //
-            qbeta_compute(p,a_par,b_par) );
+            qbeta_compute(p,a_par,b_par,lower_tail,log_p) );
 }
 
 template<typename T1, typename T2, typename T3, typename TC = common_return_t<T1,T2,T3>>
 statslib_constexpr
 TC
-qbeta_type_check(const T1 p, const T2 a_par, const T3 b_par)
+qbeta_type_check(const T1 p, const T2 a_par, const T3 b_par, const bool lower_tail, const bool log_p)
 noexcept
 {
-    return qbeta_vals_check(static_cast<TC>(p),static_cast<TC>(a_par),static_cast<TC>(b_par));
+    return qbeta_vals_check(static_cast<TC>(p),static_cast<TC>(a_par),static_cast<TC>(b_par),lower_tail,log_p);
 }
 
 }
@@ -100,6 +102,8 @@ noexcept
  * @param p a real-valued input.
  * @param a_par shape parameter, a real-valued input.
  * @param b_par shape parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return the quantile function evaluated at \c p.
  * 
@@ -110,10 +114,10 @@ noexcept
 template<typename T1, typename T2, typename T3>
 statslib_constexpr
 common_return_t<T1,T2,T3>
-qbeta(const T1 p, const T2 a_par, const T3 b_par)
+qbeta(const T1 p, const T2 a_par, const T3 b_par, const bool lower_tail, const bool log_p)
 noexcept
 {
-    return internal::qbeta_type_check(p,a_par,b_par);
+    return internal::qbeta_type_check(p,a_par,b_par,lower_tail,log_p);
 }
 
 //
@@ -123,13 +127,162 @@ namespace internal
 {
 
 #ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+// inverse of the regularized incomplete beta function, I_x(a,b) = p, by Halley iterations;
+// the cold-start guess follows Numerical Recipes (3rd ed., Sec. 6.4.1)
+
+template<typename T>
+statslib_inline
+T
+qbeta_initial_guess(const T p, const T a_par, const T b_par)
+{
+    if (a_par >= T(1) && b_par >= T(1)) {
+        const T pp = (p < T(0.5)) ? p : T(1) - p;
+        const T t_val = std::sqrt(- T(2) * std::log(pp));
+
+        T z_val = (T(2.30753) + t_val*T(0.27061)) / (T(1) + t_val*(T(0.99229) + t_val*T(0.04481))) - t_val;
+        z_val = (p < T(0.5)) ? - z_val : z_val;
+
+        const T al_val = (z_val*z_val - T(3)) / T(6);
+        const T h_val = T(2) / (T(1) / (T(2)*a_par - T(1)) + T(1) / (T(2)*b_par - T(1)));
+        const T w_val = z_val*std::sqrt(al_val + h_val) / h_val 
+                        - (T(1) / (T(2)*b_par - T(1)) - T(1) / (T(2)*a_par - T(1))) * (al_val + T(5)/T(6) - T(2) / (T(3)*h_val));
+
+        return a_par / (a_par + b_par*std::exp(T(2)*w_val));
+    }
+
+    const T t_val = std::exp(a_par*std::log(a_par / (a_par + b_par))) / a_par;
+    const T u_val = std::exp(b_par*std::log(b_par / (a_par + b_par))) / b_par;
+    const T w_val = t_val + u_val;
+
+    return (p < t_val / w_val) ? std::pow(a_par*w_val*p, T(1) / a_par) : T(1) - std::pow(b_par*w_val*(T(1) - p), T(1) / b_par);
+}
+
+template<typename T>
+statslib_inline
+T
+qbeta_halley(const T p, const T a_par, const T b_par, const T lbeta_ab, const T x_init, ullint_t& n_iter)
+{
+    const int max_iter = 64;
+    // Halley converges cubically: once a step falls below eps^(1/3) (scaled), the next would be below eps
+    const T err_tol = T(0.1) * std::cbrt(STLIM<T>::epsilon());
+
+    T x_val = x_init;
+
+    for (int iter = 0; iter < max_iter; ++iter)
+    {
+        ++n_iter;
+
+        const T err_val = static_cast<T>(gcem::incomplete_beta(a_par,b_par,x_val)) - p;
+        const T dens_val = std::exp((a_par - T(1))*std::log(x_val) + (b_par - T(1))*std::log1p(-x_val) - lbeta_ab);
+
+        if (!(dens_val > T(0))) {
+            return STLIM<T>::quiet_NaN();
+        }
+
+        const T newton_step = err_val / dens_val;
+        const T halley_step = newton_step / (T(1) - T(0.5)*std::min(T(1), newton_step*((a_par - T(1))/x_val - (b_par - T(1))/(T(1) - x_val))));
+
+        const T x_prev = x_val;
+        x_val -= halley_step;
+
+        if (x_val <= T(0)) {
+            x_val = T(0.5) * x_prev;
+        }
+
+        if (x_val >= T(1)) {
+            x_val = T(0.5) * (x_prev + T(1));
+        }
+
+        if (std::abs(halley_step) < err_tol * std::min(x_val,T(1) - x_val)) {
+            return x_val;
+        }
+    }
+
+    return STLIM<T>::quiet_NaN();
+}
+
+// solve I_x(a,b) = p elementwise, writing x to vals_out and returning the number of Halley iterations;
+// for sorted input each solve is seeded by extrapolating from the previous roots
+
+template<typename eT, typename rT>
+statslib_inline
+ullint_t
+qbeta_inv_vec(const eT* __stats_pointer_settings__ vals_in, const rT a_par, const rT b_par,
+                    rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    const rT lbeta_ab = std::lgamma(a_par) + std::lgamma(b_par) - std::lgamma(a_par + b_par);
+    const bool warm_start = is_sorted_vec(vals_in,num_elem);
+
+    ullint_t n_iter = ullint_t(0);
+    ullint_t n_roots = ullint_t(0);
+    rT p_0 = rT(0), x_0 = rT(0), p_1 = rT(0), x_1 = rT(0), p_2 = rT(0), x_2 = rT(0);
+
+    for (ullint_t j=ullint_t(0); j < num_elem; ++j)
+    {
+        const rT p_j = static_cast<rT>(vals_in[j]);
+
+        if (!(p_j > rT(0) && p_j < rT(1))) {
+            vals_out[j] = (p_j == rT(0) || p_j == rT(1)) ? p_j : STLIM<rT>::quiet_NaN();
+            continue;
+        }
+
+        rT x_init = qbeta_initial_guess(p_j,a_par,b_par);
+
+        if (warm_start && n_roots > ullint_t(0)) {
+            // divided-difference extrapolation through up to three previous roots
+            const rT dd_1 = n_roots > ullint_t(1) ? (x_2 - x_1) / (p_2 - p_1) : rT(0);
+            const rT dd_2 = n_roots > ullint_t(2) ? (dd_1 - (x_1 - x_0) / (p_1 - p_0)) / (p_2 - p_0) : rT(0);
+
+            const rT x_ext = x_2 + (p_j - p_2) * (dd_1 + dd_2 * (p_j - p_1));
+
+            x_init = (x_ext > rT(0) && x_ext < rT(1)) ? x_ext : x_2;
+        }
+
+        rT x_j = qbeta_halley(p_j,a_par,b_par,lbeta_ab,x_init,n_iter);
+
+        if (GCINT::is_nan(x_j) && warm_start) {
+            x_j = qbeta_halley(p_j,a_par,b_par,lbeta_ab,qbeta_initial_guess(p_j,a_par,b_par),n_iter);
+        }
+
+        if (GCINT::is_nan(x_j)) {
+            x_j = static_cast<rT>(gcem::incomplete_beta_inv(a_par,b_par,p_j));
+        }
+
+        vals_out[j] = x_j;
+
+        if (p_j != p_2 || n_roots == ullint_t(0)) {
+            p_0 = p_1; x_0 = x_1;
+            p_1 = p_2; x_1 = x_2;
+            p_2 = p_j; x_2 = x_j;
+            ++n_roots;
+        }
+    }
+
+    return n_iter;
+}
+
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 void
-qbeta_vec(const eT* __stats_pointer_settings__ vals_in, const T1 a_par, const T2 b_par, 
+qbeta_vec(const eT* __stats_pointer_settings__ vals_in, const T1 a_par, const T2 b_par, const bool lower_tail, const bool log_p, ullint_t* n_iter_out,
                 rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(qbeta,vals_in,vals_out,num_elem,a_par,b_par);
+    const rT a_r = static_cast<rT>(a_par);
+    const rT b_r = static_cast<rT>(b_par);
+
+    ullint_t n_iter = ullint_t(0);
+
+    // the Halley solver works on lower-tail probabilities; other inputs take the tail-aware scalar path
+    if (lower_tail && !log_p && beta_sanity_check(a_r,b_r) && a_r > rT(0) && b_r > rT(0) && !GCINT::any_posinf(a_r,b_r)) {
+        n_iter = qbeta_inv_vec(vals_in,a_r,b_r,vals_out,num_elem);
+    } else {
+        EVAL_DIST_FN_VEC(qbeta,vals_in,vals_out,num_elem,a_par,b_par,lower_tail,log_p);
+    }
+
+    if (n_iter_out != nullptr) {
+        *n_iter_out = n_iter;
+    }
 }
 #endif
 
@@ -141,6 +294,9 @@ qbeta_vec(const eT* __stats_pointer_settings__ vals_in, const T1 a_par, const T2
  * @param x a standard vector.
  * @param a_par a real-valued shape parameter.
  * @param b_par a real-valued shape parameter.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
+ * @param n_iter_out if not \c nullptr, receives the total number of Halley iterations used by the root-finder.
  *
  * @return a vector of quantile values corresponding to the elements of \c x.
  * 
@@ -155,9 +311,9 @@ qbeta_vec(const eT* __stats_pointer_settings__ vals_in, const T1 a_par, const T2
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 std::vector<rT>
-qbeta(const std::vector<eT>& x, const T1 a_par, const T2 b_par)
+qbeta(const std::vector<eT>& x, const T1 a_par, const T2 b_par, const bool lower_tail, const bool log_p, ullint_t* n_iter_out)
 {
-    STDVEC_DIST_FN(qbeta_vec,a_par,b_par);
+    STDVEC_DIST_FN(qbeta_vec,a_par,b_par,lower_tail,log_p,n_iter_out);
 }
 #endif
 
@@ -167,6 +323,9 @@ qbeta(const std::vector<eT>& x, const T1 a_par, const T2 b_par)
  * @param X a matrix of input values.
  * @param a_par a real-valued shape parameter.
  * @param b_par a real-valued shape parameter.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
+ * @param n_iter_out if not \c nullptr, receives the total number of Halley iterations used by the root-finder.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -182,17 +341,17 @@ qbeta(const std::vector<eT>& x, const T1 a_par, const T2 b_par)
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 ArmaMat<rT>
-qbeta(const ArmaMat<eT>& X, const T1 a_par, const T2 b_par)
+qbeta(const ArmaMat<eT>& X, const T1 a_par, const T2 b_par, const bool lower_tail, const bool log_p, ullint_t* n_iter_out)
 {
-    ARMA_DIST_FN(qbeta_vec,a_par,b_par);
+    ARMA_DIST_FN(qbeta_vec,a_par,b_par,lower_tail,log_p,n_iter_out);
 }
 
 template<typename mT, typename tT, typename T1, typename T2>
 statslib_inline
 mT
-qbeta(const ArmaGen<mT,tT>& X, const T1 a_par, const T2 b_par)
+qbeta(const ArmaGen<mT,tT>& X, const T1 a_par, const T2 b_par, const bool lower_tail, const bool log_p, ullint_t* n_iter_out)
 {
-    return qbeta(X.eval(),a_par,b_par);
+    return qbeta(X.eval(),a_par,b_par,lower_tail,log_p,n_iter_out);
 }
 #endif
 
@@ -202,6 +361,9 @@ qbeta(const ArmaGen<mT,tT>& X, const T1 a_par, const T2 b_par)
  * @param X a matrix of input values.
  * @param a_par a real-valued shape parameter.
  * @param b_par a real-valued shape parameter.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
+ * @param n_iter_out if not \c nullptr, receives the total number of Halley iterations used by the root-finder.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -215,9 +377,9 @@ qbeta(const ArmaGen<mT,tT>& X, const T1 a_par, const T2 b_par)
 template<typename eT, typename T1, typename T2, typename rT, bool To>
 statslib_inline
 BlazeMat<rT,To>
-qbeta(const BlazeMat<eT,To>& X, const T1 a_par, const T2 b_par)
+qbeta(const BlazeMat<eT,To>& X, const T1 a_par, const T2 b_par, const bool lower_tail, const bool log_p, ullint_t* n_iter_out)
 {
-    BLAZE_DIST_FN(qbeta_vec,a_par,b_par);
+    BLAZE_DIST_FN(qbeta_vec,a_par,b_par,lower_tail,log_p,n_iter_out);
 }
 #endif
 
@@ -227,6 +389,9 @@ qbeta(const BlazeMat<eT,To>& X, const T1 a_par, const T2 b_par)
  * @param X a matrix of input values.
  * @param a_par a real-valued shape parameter.
  * @param b_par a real-valued shape parameter.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
+ * @param n_iter_out if not \c nullptr, receives the total number of Halley iterations used by the root-finder.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -240,8 +405,8 @@ qbeta(const BlazeMat<eT,To>& X, const T1 a_par, const T2 b_par)
 template<typename eT, typename T1, typename T2, typename rT, int iTr, int iTc>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-qbeta(const EigenMat<eT,iTr,iTc>& X, const T1 a_par, const T2 b_par)
+qbeta(const EigenMat<eT,iTr,iTc>& X, const T1 a_par, const T2 b_par, const bool lower_tail, const bool log_p, ullint_t* n_iter_out)
 {
-    EIGEN_DIST_FN(qbeta_vec,a_par,b_par);
+    EIGEN_DIST_FN(qbeta_vec,a_par,b_par,lower_tail,log_p,n_iter_out);
 }
 #endif
@@ -31,7 +31,7 @@
 template<typename T1, typename T2>
 statslib_constexpr
 common_return_t<T1,T2>
-qbinom(const T1 p, const llint_t n_trials_par, const T2 prob_par) noexcept;
+qbinom(const T1 p, const llint_t n_trials_par, const T2 prob_par, const bool lower_tail = true, const bool log_p = false) noexcept;
 
 //
 // vector/matrix input
@@ -40,33 +40,33 @@ qbinom(const T1 p, const llint_t n_trials_par, const T2 prob_par) noexcept;
 template<typename eT, typename T1, typename rT = common_return_t<eT,T1>>
 statslib_inline
 std::vector<rT>
-qbinom(const std::vector<eT>& x, const llint_t n_trials_par, const T1 prob_par);
+qbinom(const std::vector<eT>& x, const llint_t n_trials_par, const T1 prob_par, const bool lower_tail = true, const bool log_p = false);
 #endif
 
 #ifdef STATS_ENABLE_ARMA_WRAPPERS
 template<typename eT, typename T1, typename rT = common_return_t<eT,T1>>
 statslib_inline
 ArmaMat<rT>
-qbinom(const ArmaMat<eT>& X, const llint_t n_trials_par, const T1 prob_par);
+qbinom(const ArmaMat<eT>& X, const llint_t n_trials_par, const T1 prob_par, const bool lower_tail = true, const bool log_p = false);
 
 template<typename mT, typename tT, typename T1>
 statslib_inline
 mT
-qbinom(const ArmaGen<mT,tT>& X, const llint_t n_trials_par, const T1 prob_par);
+qbinom(const ArmaGen<mT,tT>& X, const llint_t n_trials_par, const T1 prob_par, const bool lower_tail = true, const bool log_p = false);
 #endif
 
 #ifdef STATS_ENABLE_BLAZE_WRAPPERS
 template<typename eT, typename T1, typename rT = common_return_t<eT,T1>, bool To = blaze::columnMajor>
 statslib_inline
 BlazeMat<rT,To>
-qbinom(const BlazeMat<eT,To>& X, const llint_t n_trials_par, const T1 prob_par);
+qbinom(const BlazeMat<eT,To>& X, const llint_t n_trials_par, const T1 prob_par, const bool lower_tail = true, const bool log_p = false);
 #endif
 
 #ifdef STATS_ENABLE_EIGEN_WRAPPERS
 template<typename eT, typename T1, typename rT = common_return_t<eT,T1>, int iTr = Eigen::Dynamic, int iTc = Eigen::Dynamic>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-qbinom(const EigenMat<eT,iTr,iTc>& X, const llint_t n_trials_par, const T1 prob_par);
+qbinom(const EigenMat<eT,iTr,iTc>& X, const llint_t n_trials_par, const T1 prob_par, const bool lower_tail = true, const bool log_p = false);
 #endif
 
 //
@@ -28,44 +28,111 @@
 namespace internal
 {
 
+// pbinom is O(1), so start at a Cornish-Fisher guess and step to the smallest x with F(x) >= p;
+// an upper-tail p is matched against P(X > x) <= p, without forming 1 - p
+
+template<typename T>
+statslib_constexpr
+bool
+qbinom_reached(const T p, const llint_t n_trials_par, const T prob_par, const llint_t count, const bool lower_tail)
+noexcept
+{
+    return( lower_tail ? \
+                pbinom(count,n_trials_par,prob_par) >= p :
+                pbinom(count,n_trials_par,prob_par,false,false) <= p );
+}
+
 template<typename T>
 statslib_constexpr
 T
-qbinom_recur(const T p, const llint_t n_trials_par, const T prob_par, const T value, const llint_t count)
+qbinom_search_left(const T p, const llint_t n_trials_par, const T prob_par, const llint_t count, const bool lower_tail)
 noexcept
 {
-    return( value < p ? \
-                qbinom_recur(p,n_trials_par,prob_par, pbinom(count,n_trials_par,prob_par), count + 1) :
-                count - llint_t(1) );
+    return( count == llint_t(0) ? \
+                T(0) :
+            !qbinom_reached(p,n_trials_par,prob_par,count - llint_t(1),lower_tail) ? \
+                static_cast<T>(count) :
+                qbinom_search_left(p,n_trials_par,prob_par,count - llint_t(1),lower_tail) );
 }
 
 template<typename T>
 statslib_constexpr
 T
-qbinom_vals_check(const T p, const llint_t n_trials_par, const T prob_par)
+qbinom_search_right(const T p, const llint_t n_trials_par, const T prob_par, const llint_t count, const bool lower_tail)
+noexcept
+{
+    return( count >= n_trials_par || qbinom_reached(p,n_trials_par,prob_par,count,lower_tail) ? \
+                static_cast<T>(count) :
+                qbinom_search_right(p,n_trials_par,prob_par,count + llint_t(1),lower_tail) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+qbinom_search_begin(const T p, const llint_t n_trials_par, const T prob_par, const llint_t count, const bool lower_tail)
+noexcept
+{
+    return( qbinom_reached(p,n_trials_par,prob_par,count,lower_tail) ? \
+                qbinom_search_left(p,n_trials_par,prob_par,count,lower_tail) :
+                qbinom_search_right(p,n_trials_par,prob_par,count + llint_t(1),lower_tail) );
+}
+
+template<typename T>
+statslib_constexpr
+llint_t
+qbinom_clamp_guess(const T guess, const llint_t n_trials_par)
+noexcept
+{
+    return( !(guess > T(0)) ? \
+                llint_t(0) :
+            guess > T(n_trials_par) ? \
+                n_trials_par :
+                static_cast<llint_t>(guess) );
+}
+
+template<typename T>
+statslib_constexpr
+llint_t
+qbinom_initial_guess(const llint_t n_trials_par, const T prob_par, const T z)
+noexcept
+{
+    return qbinom_clamp_guess(n_trials_par*prob_par + z*stmath::sqrt(n_trials_par*prob_par*(T(1) - prob_par))
+                                + (T(1) - T(2)*prob_par)*(z*z - T(1))/T(6) + T(0.5), n_trials_par);
+}
+
+template<typename T>
+statslib_constexpr
+T
+qbinom_vals_check(const T p, const llint_t n_trials_par, const T prob_par, const bool lower_tail, const bool log_p)
 noexcept
 {
     return( !binom_sanity_check(n_trials_par,prob_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            !prob_val_check(p) ? \
+            !prob_val_check(p,log_p) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            p == T(0) ? \
+            prob_lower_is_zero(p,lower_tail,log_p) ? \
                 T(0) :
-            p == T(1) ? \
+            prob_upper_is_zero(p,lower_tail,log_p) ? \
                 static_cast<T>(n_trials_par) :
             //
-            qbinom_recur(p,n_trials_par,prob_par,T(0),llint_t(0)) );
+            n_trials_par == llint_t(0) || prob_par == T(0) ? \
+                T(0) :
+            prob_par == T(1) ? \
+                static_cast<T>(n_trials_par) :
+            //
+            qbinom_search_begin(exp_if(p,log_p),n_trials_par,prob_par,
+                                qbinom_initial_guess(n_trials_par,prob_par,qnorm(p,T(0),T(1),lower_tail,log_p)),lower_tail) );
 }
 
 template<typename T1, typename T2, typename TC = common_return_t<T1,T2>>
 statslib_constexpr
 TC
-qbinom_type_check(const T1 p, const llint_t n_trials_par, const T2 prob_par)
+qbinom_type_check(const T1 p, const llint_t n_trials_par, const T2 prob_par, const bool lower_tail, const bool log_p)
 noexcept
 {
-    return qbinom_vals_check(static_cast<TC>(p),n_trials_par,static_cast<TC>(prob_par));
+    return qbinom_vals_check(static_cast<TC>(p),n_trials_par,static_cast<TC>(prob_par),lower_tail,log_p);
 }
 
 }
@@ -76,6 +143,8 @@ noexcept
  * @param p a real-valued input.
  * @param n_trials_par the number of trials, a non-negative integral-valued input.
  * @param prob_par the probability parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return the quantile function evaluated at \c p.
  * 
@@ -86,10 +155,10 @@ noexcept
 template<typename T1, typename T2>
 statslib_constexpr
 common_return_t<T1,T2>
-qbinom(const T1 p, const llint_t n_trials_par, const T2 prob_par)
+qbinom(const T1 p, const llint_t n_trials_par, const T2 prob_par, const bool lower_tail, const bool log_p)
 noexcept
 {
-    return internal::qbinom_type_check(p,n_trials_par,prob_par);
+    return internal::qbinom_type_check(p,n_trials_par,prob_par,lower_tail,log_p);
 }
 
 //
@@ -99,13 +168,73 @@ namespace internal
 {
 
 #ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+// sorted input: the quantiles are nondecreasing, so carry q, F(q), and f(q) forward and step
+// up the pmf recurrence, restarting from a scalar evaluation after long runs or pmf underflow
+
+template<typename eT, typename rT>
+statslib_inline
+void
+qbinom_vec_sorted(const eT* __stats_pointer_settings__ vals_in, const llint_t n_trials_par, const rT prob_par, 
+                        rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    const llint_t max_steps = llint_t(64);
+    const rT odds_val = prob_par / (rT(1) - prob_par);
+
+    bool anchored = false;
+    llint_t q_val = llint_t(0);
+    rT cdf_val = rT(0);
+    rT pmf_val = rT(0);
+
+    for (ullint_t j=ullint_t(0); j < num_elem; ++j)
+    {
+        const rT p_j = static_cast<rT>(vals_in[j]);
+
+        if (p_j == rT(0) || p_j == rT(1)) {
+            vals_out[j] = qbinom(p_j,n_trials_par,prob_par);
+            continue;
+        }
+
+        llint_t n_steps = llint_t(0);
+
+        if (anchored) {
+            // smallest q such that F(q) >= p
+            while (cdf_val < p_j && q_val < n_trials_par && n_steps < max_steps && pmf_val >= STLIM<rT>::min()) {
+                ++q_val;
+                pmf_val *= odds_val * rT(n_trials_par - q_val + 1) / rT(q_val);
+                cdf_val += pmf_val;
+                ++n_steps;
+            }
+        }
+
+        if (!anchored || (cdf_val < p_j && q_val < n_trials_par))
+        {
+            q_val = static_cast<llint_t>(qbinom(p_j,n_trials_par,prob_par));
+            cdf_val = pbinom(q_val,n_trials_par,prob_par);
+            pmf_val = std::exp(pbinom_log_pmf(q_val,n_trials_par,prob_par));
+            anchored = true;
+        }
+
+        vals_out[j] = static_cast<rT>(q_val);
+    }
+}
+
 template<typename eT, typename T1, typename rT>
 statslib_inline
 void
-qbinom_vec(const eT* __stats_pointer_settings__ vals_in, const llint_t n_trials_par, const T1 prob_par, 
+qbinom_vec(const eT* __stats_pointer_settings__ vals_in, const llint_t n_trials_par, const T1 prob_par, const bool lower_tail, const bool log_p, 
                  rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(qbinom,vals_in,vals_out,num_elem,n_trials_par,prob_par);
+    const rT prob_r = static_cast<rT>(prob_par);
+
+    if (lower_tail && !log_p && binom_sanity_check(n_trials_par,prob_r) && n_trials_par > llint_t(0) && prob_r > rT(0) && prob_r < rT(1)
+            && is_sorted_vec(vals_in,num_elem) && vals_in[0] >= eT(0) && vals_in[num_elem-1] <= eT(1))
+    {
+        qbinom_vec_sorted(vals_in,n_trials_par,prob_r,vals_out,num_elem);
+        return;
+    }
+
+    EVAL_DIST_FN_VEC(qbinom,vals_in,vals_out,num_elem,n_trials_par,prob_par,lower_tail,log_p);
 }
 #endif
 
@@ -117,6 +246,8 @@ qbinom_vec(const eT* __stats_pointer_settings__ vals_in, const llint_t n_trials_
  * @param x a standard vector.
  * @param n_trials_par the number of trials, a non-negative integral-valued input.
  * @param prob_par the probability parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return a vector of quantile values corresponding to the elements of \c x.
  * 
@@ -131,9 +262,9 @@ qbinom_vec(const eT* __stats_pointer_settings__ vals_in, const llint_t n_trials_
 template<typename eT, typename T1, typename rT>
 statslib_inline
 std::vector<rT>
-qbinom(const std::vector<eT>& x, const llint_t n_trials_par, const T1 prob_par)
+qbinom(const std::vector<eT>& x, const llint_t n_trials_par, const T1 prob_par, const bool lower_tail, const bool log_p)
 {
-    STDVEC_DIST_FN(qbinom_vec,n_trials_par,prob_par);
+    STDVEC_DIST_FN(qbinom_vec,n_trials_par,prob_par,lower_tail,log_p);
 }
 #endif
 
@@ -143,6 +274,8 @@ qbinom(const std::vector<eT>& x, const llint_t n_trials_par, const T1 prob_par)
  * @param X a matrix of input values.
  * @param n_trials_par the number of trials, a non-negative integral-valued input.
  * @param prob_par the probability parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -156,17 +289,17 @@ qbinom(const std::vector<eT>& x, const llint_t n_trials_par, const T1 prob_par)
 template<typename eT, typename T1, typename rT>
 statslib_inline
 ArmaMat<rT>
-qbinom(const ArmaMat<eT>& X, const llint_t n_trials_par, const T1 prob_par)
+qbinom(const ArmaMat<eT>& X, const llint_t n_trials_par, const T1 prob_par, const bool lower_tail, const bool log_p)
 {
-    ARMA_DIST_FN(qbinom_vec,n_trials_par,prob_par);
+    ARMA_DIST_FN(qbinom_vec,n_trials_par,prob_par,lower_tail,log_p);
 }
 
 template<typename mT, typename tT, typename T1>
 statslib_inline
 mT
-qbinom(const ArmaGen<mT,tT>& X, const llint_t n_trials_par, const T1 prob_par)
+qbinom(const ArmaGen<mT,tT>& X, const llint_t n_trials_par, const T1 prob_par, const bool lower_tail, const bool log_p)
 {
-    return qbinom(X.eval(),n_trials_par,prob_par);
+    return qbinom(X.eval(),n_trials_par,prob_par,lower_tail,log_p);
 }
 #endif
 
@@ -176,6 +309,8 @@ qbinom(const ArmaGen<mT,tT>& X, const llint_t n_trials_par, const T1 prob_par)
  * @param X a matrix of input values.
  * @param n_trials_par the number of trials, a non-negative integral-valued input.
  * @param prob_par the probability parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -189,9 +324,9 @@ qbinom(const ArmaGen<mT,tT>& X, const llint_t n_trials_par, const T1 prob_par)
 template<typename eT, typename T1, typename rT, bool To>
 statslib_inline
 BlazeMat<rT,To>
-qbinom(const BlazeMat<eT,To>& X, const llint_t n_trials_par, const T1 prob_par)
+qbinom(const BlazeMat<eT,To>& X, const llint_t n_trials_par, const T1 prob_par, const bool lower_tail, const bool log_p)
 {
-    BLAZE_DIST_FN(qbinom_vec,n_trials_par,prob_par);
+    BLAZE_DIST_FN(qbinom_vec,n_trials_par,prob_par,lower_tail,log_p);
 }
 #endif
 
@@ -201,6 +336,8 @@ qbinom(const BlazeMat<eT,To>& X, const llint_t n_trials_par, const T1 prob_par)
  * @param X a matrix of input values.
  * @param n_trials_par the number of trials, a non-negative integral-valued input.
  * @param prob_par the probability parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -214,8 +351,8 @@ qbinom(const BlazeMat<eT,To>& X, const llint_t n_trials_par, const T1 prob_par)
 template<typename eT, typename T1, typename rT, int iTr, int iTc>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-qbinom(const EigenMat<eT,iTr,iTc>& X, const llint_t n_trials_par, const T1 prob_par)
+qbinom(const EigenMat<eT,iTr,iTc>& X, const llint_t n_trials_par, const T1 prob_par, const bool lower_tail, const bool log_p)
 {
-    EIGEN_DIST_FN(qbinom_vec,n_trials_par,prob_par);
+    EIGEN_DIST_FN(qbinom_vec,n_trials_par,prob_par,lower_tail,log_p);
 }
 #endif
@@ -31,7 +31,7 @@
 template<typename T1, typename T2, typename T3>
 statslib_constexpr
 common_return_t<T1,T2,T3>
-qcauchy(const T1 p, const T2 mu_par, const T3 sigma_par) noexcept;
+qcauchy(const T1 p, const T2 mu_par, const T3 sigma_par, const bool lower_tail = true, const bool log_p = false) noexcept;
 
 //
 // vector/matrix input
@@ -40,33 +40,33 @@ qcauchy(const T1 p, const T2 mu_par, const T3 sigma_par) noexcept;
 template<typename eT, typename T1, typename T2, typename rT = common_return_t<eT,T1,T2>>
 statslib_inline
 std::vector<rT>
-qcauchy(const std::vector<eT>& x, const T1 mu_par, const T2 sigma_par);
+qcauchy(const std::vector<eT>& x, const T1 mu_par, const T2 sigma_par, const bool lower_tail = true, const bool log_p = false);
 #endif
 
 #ifdef STATS_ENABLE_ARMA_WRAPPERS
 template<typename eT, typename T1, typename T2, typename rT = common_return_t<eT,T1,T2>>
 statslib_inline
 ArmaMat<rT>
-qcauchy(const ArmaMat<eT>& X, const T1 mu_par, const T2 sigma_par);
+qcauchy(const ArmaMat<eT>& X, const T1 mu_par, const T2 sigma_par, const bool lower_tail = true, const bool log_p = false);
 
 template<typename mT, typename tT, typename T1, typename T2>
 statslib_inline
 mT
-qcauchy(const ArmaGen<mT,tT>& X, const T1 mu_par, const T2 sigma_par);
+qcauchy(const ArmaGen<mT,tT>& X, const T1 mu_par, const T2 sigma_par, const bool lower_tail = true, const bool log_p = false);
 #endif
 
 #ifdef STATS_ENABLE_BLAZE_WRAPPERS
 template<typename eT, typename T1, typename T2, typename rT = common_return_t<eT,T1,T2>, bool To = blaze::columnMajor>
 statslib_inline
 BlazeMat<rT,To>
-qcauchy(const BlazeMat<eT,To>& X, const T1 mu_par, const T2 sigma_par);
+qcauchy(const BlazeMat<eT,To>& X, const T1 mu_par, const T2 sigma_par, const bool lower_tail = true, const bool log_p = false);
 #endif
 
 #ifdef STATS_ENABLE_EIGEN_WRAPPERS
 template<typename eT, typename T1, typename T2, typename rT = common_return_t<eT,T1,T2>, int iTr = Eigen::Dynamic, int iTc = Eigen::Dynamic>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-qcauchy(const EigenMat<eT,iTr,iTc>& X, const T1 mu_par, const T2 sigma_par);
+qcauchy(const EigenMat<eT,iTr,iTc>& X, const T1 mu_par, const T2 sigma_par, const bool lower_tail = true, const bool log_p = false);
 #endif
 
 //
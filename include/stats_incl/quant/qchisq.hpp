@@ -31,7 +31,7 @@
 template<typename T1, typename T2>
 statslib_constexpr
 common_return_t<T1,T2>
-qchisq(const T1 p, const T2 dof_par) noexcept;
+qchisq(const T1 p, const T2 dof_par, const bool lower_tail = true, const bool log_p = false) noexcept;
 
 //
 // vector/matrix input
@@ -40,33 +40,33 @@ qchisq(const T1 p, const T2 dof_par) noexcept;
 template<typename eT, typename T1, typename rT = common_return_t<eT,T1>>
 statslib_inline
 std::vector<rT>
-qchisq(const std::vector<eT>& x, const T1 dof_par);
+qchisq(const std::vector<eT>& x, const T1 dof_par, const bool lower_tail = true, const bool log_p = false, ullint_t* n_iter_out = nullptr);
 #endif
 
 #ifdef STATS_ENABLE_ARMA_WRAPPERS
 template<typename eT, typename T1, typename rT = common_return_t<eT,T1>>
 statslib_inline
 ArmaMat<rT>
-qchisq(const ArmaMat<eT>& X, const T1 dof_par);
+qchisq(const ArmaMat<eT>& X, const T1 dof_par, const bool lower_tail = true, const bool log_p = false, ullint_t* n_iter_out = nullptr);
 
 template<typename mT, typename tT, typename T1>
 statslib_inline
 mT 
-qchisq(const ArmaGen<mT,tT>& X, const T1 dof_par);
+qchisq(const ArmaGen<mT,tT>& X, const T1 dof_par, const bool lower_tail = true, const bool log_p = false, ullint_t* n_iter_out = nullptr);
 #endif
 
 #ifdef STATS_ENABLE_BLAZE_WRAPPERS
 template<typename eT, typename T1, typename rT = common_return_t<eT,T1>, bool To = blaze::columnMajor>
 statslib_inline
 BlazeMat<rT,To>
-qchisq(const BlazeMat<eT,To>& X, const T1 dof_par);
+qchisq(const BlazeMat<eT,To>& X, const T1 dof_par, const bool lower_tail = true, const bool log_p = false, ullint_t* n_iter_out = nullptr);
 #endif
 
 #ifdef STATS_ENABLE_EIGEN_WRAPPERS
 template<typename eT, typename T1, typename rT = common_return_t<eT,T1>, int iTr = Eigen::Dynamic, int iTc = Eigen::Dynamic>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-qchisq(const EigenMat<eT,iTr,iTc>& X, const T1 dof_par);
+qchisq(const EigenMat<eT,iTr,iTc>& X, const T1 dof_par, const bool lower_tail = true, const bool log_p = false, ullint_t* n_iter_out = nullptr);
 #endif
 
 //
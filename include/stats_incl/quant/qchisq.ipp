@@ -31,39 +31,39 @@ namespace internal
 template<typename T>
 statslib_constexpr
 T
-qchisq_compute(const T p, const T dof_par)
+qchisq_compute(const T p, const T dof_par, const bool lower_tail, const bool log_p)
 noexcept
 {
-    return( T(2)*gcem::incomplete_gamma_inv(dof_par/T(2),p) );
+    return( T(2)*qgamma_std_compute(p,dof_par/T(2),lower_tail,log_p) );
 }
 
 template<typename T>
 statslib_constexpr
 T
-qchisq_vals_check(const T p, const T dof_par)
+qchisq_vals_check(const T p, const T dof_par, const bool lower_tail, const bool log_p)
 noexcept
 {
     return( !chisq_sanity_check(dof_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            !prob_val_check(p) ? \
+            !prob_val_check(p,log_p) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            p == T(0) ? \
+            prob_lower_is_zero(p,lower_tail,log_p) ? \
                 T(0) :
-            p == T(1) ? \
+            prob_upper_is_zero(p,lower_tail,log_p) ? \
                 STLIM<T>::infinity() :
             //
-            qchisq_compute(p,dof_par) );
+            qchisq_compute(p,dof_par,lower_tail,log_p) );
 }
 
 template<typename T1, typename T2, typename TC = common_return_t<T1,T2>>
 statslib_constexpr
 TC
-qchisq_type_check(const T1 p, const T2 dof_par)
+qchisq_type_check(const T1 p, const T2 dof_par, const bool lower_tail, const bool log_p)
 noexcept
 {
-    return qchisq_vals_check(static_cast<TC>(p),static_cast<TC>(dof_par));
+    return qchisq_vals_check(static_cast<TC>(p),static_cast<TC>(dof_par),lower_tail,log_p);
 }
 
 }
@@ -73,6 +73,8 @@ noexcept
  *
  * @param p a real-valued input.
  * @param dof_par the degrees of freedom parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return the quantile function evaluated at \c x.
  * 
@@ -83,10 +85,10 @@ noexcept
 template<typename T1, typename T2>
 statslib_constexpr
 common_return_t<T1,T2>
-qchisq(const T1 p, const T2 dof_par)
+qchisq(const T1 p, const T2 dof_par, const bool lower_tail, const bool log_p)
 noexcept
 {
-    return internal::qchisq_type_check(p,dof_par);
+    return internal::qchisq_type_check(p,dof_par,lower_tail,log_p);
 }
 
 //
@@ -99,10 +101,26 @@ namespace internal
 template<typename eT, typename T1, typename rT>
 statslib_inline
 void
-qchisq_vec(const eT* __stats_pointer_settings__ vals_in, const T1 dof_par, 
+qchisq_vec(const eT* __stats_pointer_settings__ vals_in, const T1 dof_par, const bool lower_tail, const bool log_p, ullint_t* n_iter_out,
                  rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(qchisq,vals_in,vals_out,num_elem,dof_par);
+    const rT dof_r = static_cast<rT>(dof_par);
+
+    ullint_t n_iter = ullint_t(0);
+
+    if (lower_tail && !log_p && chisq_sanity_check(dof_r) && dof_r > rT(0) && !GCINT::is_posinf(dof_r)) {
+        n_iter = qgamma_inv_vec(vals_in,dof_r/rT(2),false,vals_out,num_elem);
+
+        for (ullint_t j=ullint_t(0); j < num_elem; ++j) {
+            vals_out[j] *= rT(2);
+        }
+    } else {
+        EVAL_DIST_FN_VEC(qchisq,vals_in,vals_out,num_elem,dof_par,lower_tail,log_p);
+    }
+
+    if (n_iter_out != nullptr) {
+        *n_iter_out = n_iter;
+    }
 }
 #endif
 
@@ -113,6 +131,9 @@ qchisq_vec(const eT* __stats_pointer_settings__ vals_in, const T1 dof_par,
  *
  * @param x a standard vector.
  * @param dof_par the degrees of freedom parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
+ * @param n_iter_out if not \c nullptr, receives the total number of Halley iterations used by the root-finder.
  *
  * @return a vector of quantile values corresponding to the elements of \c x.
  * 
@@ -127,9 +148,9 @@ qchisq_vec(const eT* __stats_pointer_settings__ vals_in, const T1 dof_par,
 template<typename eT, typename T1, typename rT>
 statslib_inline
 std::vector<rT>
-qchisq(const std::vector<eT>& x, const T1 dof_par)
+qchisq(const std::vector<eT>& x, const T1 dof_par, const bool lower_tail, const bool log_p, ullint_t* n_iter_out)
 {
-    STDVEC_DIST_FN(qchisq_vec,dof_par);
+    STDVEC_DIST_FN(qchisq_vec,dof_par,lower_tail,log_p,n_iter_out);
 }
 #endif
 
@@ -138,6 +159,9 @@ qchisq(const std::vector<eT>& x, const T1 dof_par)
  *
  * @param X a matrix of input values.
  * @param dof_par the degrees of freedom parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
+ * @param n_iter_out if not \c nullptr, receives the total number of Halley iterations used by the root-finder.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -153,17 +177,17 @@ qchisq(const std::vector<eT>& x, const T1 dof_par)
 template<typename eT, typename T1, typename rT>
 statslib_inline
 ArmaMat<rT>
-qchisq(const ArmaMat<eT>& X, const T1 dof_par)
+qchisq(const ArmaMat<eT>& X, const T1 dof_par, const bool lower_tail, const bool log_p, ullint_t* n_iter_out)
 {
-    ARMA_DIST_FN(qchisq_vec,dof_par);
+    ARMA_DIST_FN(qchisq_vec,dof_par,lower_tail,log_p,n_iter_out);
 }
 
 template<typename mT, typename tT, typename T1>
 statslib_inline
 mT
-qchisq(const ArmaGen<mT,tT>& X, const T1 dof_par)
+qchisq(const ArmaGen<mT,tT>& X, const T1 dof_par, const bool lower_tail, const bool log_p, ullint_t* n_iter_out)
 {
-    return qchisq(X.eval(),dof_par);
+    return qchisq(X.eval(),dof_par,lower_tail,log_p,n_iter_out);
 }
 #endif
 
@@ -172,6 +196,9 @@ qchisq(const ArmaGen<mT,tT>& X, const T1 dof_par)
  *
  * @param X a matrix of input values.
  * @param dof_par the degrees of freedom parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
+ * @param n_iter_out if not \c nullptr, receives the total number of Halley iterations used by the root-finder.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -185,9 +212,9 @@ qchisq(const ArmaGen<mT,tT>& X, const T1 dof_par)
 template<typename eT, typename T1, typename rT, bool To>
 statslib_inline
 BlazeMat<rT,To>
-qchisq(const BlazeMat<eT,To>& X, const T1 dof_par)
+qchisq(const BlazeMat<eT,To>& X, const T1 dof_par, const bool lower_tail, const bool log_p, ullint_t* n_iter_out)
 {
-    BLAZE_DIST_FN(qchisq_vec,dof_par);
+    BLAZE_DIST_FN(qchisq_vec,dof_par,lower_tail,log_p,n_iter_out);
 }
 #endif
 
@@ -196,6 +223,9 @@ qchisq(const BlazeMat<eT,To>& X, const T1 dof_par)
  *
  * @param X a matrix of input values.
  * @param dof_par the degrees of freedom parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
+ * @param n_iter_out if not \c nullptr, receives the total number of Halley iterations used by the root-finder.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -209,8 +239,8 @@ qchisq(const BlazeMat<eT,To>& X, const T1 dof_par)
 template<typename eT, typename T1, typename rT, int iTr, int iTc>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-qchisq(const EigenMat<eT,iTr,iTc>& X, const T1 dof_par)
+qchisq(const EigenMat<eT,iTr,iTc>& X, const T1 dof_par, const bool lower_tail, const bool log_p, ullint_t* n_iter_out)
 {
-    EIGEN_DIST_FN(qchisq_vec,dof_par);
+    EIGEN_DIST_FN(qchisq_vec,dof_par,lower_tail,log_p,n_iter_out);
 }
 #endif
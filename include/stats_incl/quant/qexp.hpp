@@ -31,7 +31,7 @@
 template<typename T1, typename T2>
 statslib_constexpr
 common_return_t<T1,T2>
-qexp(const T1 p, const T2 rate_par) noexcept;
+qexp(const T1 p, const T2 rate_par, const bool lower_tail = true, const bool log_p = false) noexcept;
 
 //
 // vector/matrix input
@@ -40,33 +40,33 @@ qexp(const T1 p, const T2 rate_par) noexcept;
 template<typename eT, typename T1, typename rT = common_return_t<eT,T1>>
 statslib_inline
 std::vector<rT>
-qexp(const std::vector<eT>& x, const T1 rate_par);
+qexp(const std::vector<eT>& x, const T1 rate_par, const bool lower_tail = true, const bool log_p = false);
 #endif
 
 #ifdef STATS_ENABLE_ARMA_WRAPPERS
 template<typename eT, typename T1, typename rT = common_return_t<eT,T1>>
 statslib_inline
 ArmaMat<rT>
-qexp(const ArmaMat<eT>& X, const T1 rate_par);
+qexp(const ArmaMat<eT>& X, const T1 rate_par, const bool lower_tail = true, const bool log_p = false);
 
 template<typename mT, typename tT, typename T1>
 statslib_inline
 mT 
-qexp(const ArmaGen<mT,tT>& X, const T1 rate_par);
+qexp(const ArmaGen<mT,tT>& X, const T1 rate_par, const bool lower_tail = true, const bool log_p = false);
 #endif
 
 #ifdef STATS_ENABLE_BLAZE_WRAPPERS
 template<typename eT, typename T1, typename rT = common_return_t<eT,T1>, bool To = blaze::columnMajor>
 statslib_inline
 BlazeMat<rT,To>
-qexp(const BlazeMat<eT,To>& X, const T1 rate_par);
+qexp(const BlazeMat<eT,To>& X, const T1 rate_par, const bool lower_tail = true, const bool log_p = false);
 #endif
 
 #ifdef STATS_ENABLE_EIGEN_WRAPPERS
 template<typename eT, typename T1, typename rT = common_return_t<eT,T1>, int iTr = Eigen::Dynamic, int iTc = Eigen::Dynamic>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-qexp(const EigenMat<eT,iTr,iTc>& X, const T1 rate_par);
+qexp(const EigenMat<eT,iTr,iTc>& X, const T1 rate_par, const bool lower_tail = true, const bool log_p = false);
 #endif
 
 //
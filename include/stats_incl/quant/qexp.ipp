@@ -31,39 +31,39 @@ namespace internal
 template<typename T>
 statslib_constexpr
 T
-qexp_compute(const T p, const T rate_par)
+qexp_compute(const T p, const T rate_par, const bool lower_tail, const bool log_p)
 noexcept
 {
-    return( - stmath::log( T(1) - p ) / rate_par );
+    return( - log_prob_upper(p,lower_tail,log_p) / rate_par );
 }
 
 template<typename T>
 statslib_constexpr
 T
-qexp_vals_check(const T p, const T rate_par)
+qexp_vals_check(const T p, const T rate_par, const bool lower_tail, const bool log_p)
 noexcept
 {
     return( !exp_sanity_check(rate_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            !prob_val_check(p) ? \
+            !prob_val_check(p,log_p) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            p == T(0) ? \
+            prob_lower_is_zero(p,lower_tail,log_p) ? \
                 T(0) :
-            p == T(1) ? \
+            prob_upper_is_zero(p,lower_tail,log_p) ? \
                 STLIM<T>::infinity() :
             //
-            qexp_compute(p,rate_par) );
+            qexp_compute(p,rate_par,lower_tail,log_p) );
 }
 
 template<typename T1, typename T2, typename TC = common_return_t<T1,T2>>
 statslib_constexpr
 TC
-qexp_type_check(const T1 p, const T2 rate_par)
+qexp_type_check(const T1 p, const T2 rate_par, const bool lower_tail, const bool log_p)
 noexcept
 {
-    return qexp_vals_check(static_cast<TC>(p),static_cast<TC>(rate_par));
+    return qexp_vals_check(static_cast<TC>(p),static_cast<TC>(rate_par),lower_tail,log_p);
 }
 
 }
@@ -73,6 +73,8 @@ noexcept
  *
  * @param p a real-valued input.
  * @param rate_par the rate parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return the quantile function evaluated at \c p.
  * 
@@ -83,10 +85,10 @@ noexcept
 template<typename T1, typename T2>
 statslib_constexpr
 common_return_t<T1,T2>
-qexp(const T1 p, const T2 rate_par)
+qexp(const T1 p, const T2 rate_par, const bool lower_tail, const bool log_p)
 noexcept
 {
-    return internal::qexp_type_check(p,rate_par);
+    return internal::qexp_type_check(p,rate_par,lower_tail,log_p);
 }
 
 //
@@ -99,10 +101,10 @@ namespace internal
 template<typename eT, typename T1, typename rT>
 statslib_inline
 void
-qexp_vec(const eT* __stats_pointer_settings__ vals_in, const T1 rate_par, 
+qexp_vec(const eT* __stats_pointer_settings__ vals_in, const T1 rate_par, const bool lower_tail, const bool log_p, 
                  rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(qexp,vals_in,vals_out,num_elem,rate_par);
+    EVAL_DIST_FN_VEC(qexp,vals_in,vals_out,num_elem,rate_par,lower_tail,log_p);
 }
 #endif
 
@@ -113,6 +115,8 @@ qexp_vec(const eT* __stats_pointer_settings__ vals_in, const T1 rate_par,
  *
  * @param x a standard vector.
  * @param rate_par the rate parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return a vector of quantile values corresponding to the elements of \c x.
  * 
@@ -127,9 +131,9 @@ qexp_vec(const eT* __stats_pointer_settings__ vals_in, const T1 rate_par,
 template<typename eT, typename T1, typename rT>
 statslib_inline
 std::vector<rT>
-qexp(const std::vector<eT>& x, const T1 rate_par)
+qexp(const std::vector<eT>& x, const T1 rate_par, const bool lower_tail, const bool log_p)
 {
-    STDVEC_DIST_FN(qexp_vec,rate_par);
+    STDVEC_DIST_FN(qexp_vec,rate_par,lower_tail,log_p);
 }
 #endif
 
@@ -138,6 +142,8 @@ qexp(const std::vector<eT>& x, const T1 rate_par)
  *
  * @param X a matrix of input values.
  * @param rate_par the rate parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -153,17 +159,17 @@ qexp(const std::vector<eT>& x, const T1 rate_par)
 template<typename eT, typename T1, typename rT>
 statslib_inline
 ArmaMat<rT>
-qexp(const ArmaMat<eT>& X, const T1 rate_par)
+qexp(const ArmaMat<eT>& X, const T1 rate_par, const bool lower_tail, const bool log_p)
 {
-    ARMA_DIST_FN(qexp_vec,rate_par);
+    ARMA_DIST_FN(qexp_vec,rate_par,lower_tail,log_p);
 }
 
 template<typename mT, typename tT, typename T1>
 statslib_inline
 mT
-qexp(const ArmaGen<mT,tT>& X, const T1 rate_par)
+qexp(const ArmaGen<mT,tT>& X, const T1 rate_par, const bool lower_tail, const bool log_p)
 {
-    return qexp(X.eval(),rate_par);
+    return qexp(X.eval(),rate_par,lower_tail,log_p);
 }
 #endif
 
@@ -172,6 +178,8 @@ qexp(const ArmaGen<mT,tT>& X, const T1 rate_par)
  *
  * @param X a matrix of input values.
  * @param rate_par the rate parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -185,9 +193,9 @@ qexp(const ArmaGen<mT,tT>& X, const T1 rate_par)
 template<typename eT, typename T1, typename rT, bool To>
 statslib_inline
 BlazeMat<rT,To>
-qexp(const BlazeMat<eT,To>& X, const T1 rate_par)
+qexp(const BlazeMat<eT,To>& X, const T1 rate_par, const bool lower_tail, const bool log_p)
 {
-    BLAZE_DIST_FN(qexp_vec,rate_par);
+    BLAZE_DIST_FN(qexp_vec,rate_par,lower_tail,log_p);
 }
 #endif
 
@@ -196,6 +204,8 @@ qexp(const BlazeMat<eT,To>& X, const T1 rate_par)
  *
  * @param X a matrix of input values.
  * @param rate_par the rate parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -209,8 +219,8 @@ qexp(const BlazeMat<eT,To>& X, const T1 rate_par)
 template<typename eT, typename T1, typename rT, int iTr, int iTc>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-qexp(const EigenMat<eT,iTr,iTc>& X, const T1 rate_par)
+qexp(const EigenMat<eT,iTr,iTc>& X, const T1 rate_par, const bool lower_tail, const bool log_p)
 {
-    EIGEN_DIST_FN(qexp_vec,rate_par);
+    EIGEN_DIST_FN(qexp_vec,rate_par,lower_tail,log_p);
 }
 #endif
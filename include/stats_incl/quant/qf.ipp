@@ -40,16 +40,27 @@ noexcept
 template<typename T>
 statslib_constexpr
 T
-qf_compute(const T p, const T a_par, const T b_par)
+qf_compute_adj_upper(const T I_inv_val, const T ab_ratio)
+noexcept
+{   // I_inv_val = 1 - I^{-1}(a,b,p), the complement computed directly
+    return( (T(1) - I_inv_val) / (ab_ratio*I_inv_val) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+qf_compute(const T p, const T a_par, const T b_par, const bool lower_tail, const bool log_p)
 noexcept
 {
-    return qf_compute_adj(gcem::incomplete_beta_inv(a_par,b_par,p),a_par/b_par);
+    return( invert_upper_tail(p,lower_tail,log_p) ? \
+                qf_compute_adj_upper(static_cast<T>(gcem::incomplete_beta_inv(b_par,a_par,prob_upper(p,lower_tail,log_p))),a_par/b_par) :
+                qf_compute_adj(static_cast<T>(gcem::incomplete_beta_inv(a_par,b_par,prob_lower(p,lower_tail,log_p))),a_par/b_par) );
 }
 
 template<typename T>
 statslib_constexpr
 T
-qf_limit_vals_dof(const T p, const T df1_par, const T df2_par)
+qf_limit_vals_dof(const T p, const T df1_par, const T df2_par, const bool lower_tail, const bool log_p)
 noexcept
 {
     return( // df1 == +Inf and df2 == +Inf
@@ -57,41 +68,41 @@ noexcept
                 T(1) :
             // df1 == +Inf
             GCINT::is_posinf(df1_par) ? \
-                df2_par / qchisq(T(1)-p,df2_par) :
+                df2_par / qchisq(p,df2_par,!lower_tail,log_p) :
             // df2 == +Inf
-                qchisq(p,df1_par) / df1_par );
+                qchisq(p,df1_par,lower_tail,log_p) / df1_par );
 }
 
 template<typename T>
 statslib_constexpr
 T
-qf_vals_check(const T p, const T df1_par, const T df2_par)
+qf_vals_check(const T p, const T df1_par, const T df2_par, const bool lower_tail, const bool log_p)
 noexcept
 {
     return( !f_sanity_check(df1_par,df2_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            !prob_val_check(p) ? \
+            !prob_val_check(p,log_p) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            p == T(0) ? \
+            prob_lower_is_zero(p,lower_tail,log_p) ? \
                 T(0) :
-            p == T(1) ? \
+            prob_upper_is_zero(p,lower_tail,log_p) ? \
                 STLIM<T>::infinity() :
             // 0 < p < 1
             GCINT::any_posinf(df1_par,df2_par) ? \
-                qf_limit_vals_dof(p,df1_par,df2_par) :
+                qf_limit_vals_dof(p,df1_par,df2_par,lower_tail,log_p) :
             //
-            qf_compute(p,df1_par/T(2),df2_par/T(2)) );
+            qf_compute(p,df1_par/T(2),df2_par/T(2),lower_tail,log_p) );
 }
 
 template<typename T1, typename T2, typename T3, typename TC = common_return_t<T1,T2,T3>>
 statslib_constexpr
 TC
-qf_type_check(const T1 p, const T2 df1_par, const T3 df2_par)
+qf_type_check(const T1 p, const T2 df1_par, const T3 df2_par, const bool lower_tail, const bool log_p)
 noexcept
 {
-    return qf_vals_check(static_cast<TC>(p),static_cast<TC>(df1_par),static_cast<TC>(df2_par));
+    return qf_vals_check(static_cast<TC>(p),static_cast<TC>(df1_par),static_cast<TC>(df2_par),lower_tail,log_p);
 }
 
 }
@@ -102,6 +113,8 @@ noexcept
  * @param p a real-valued input.
  * @param df1_par a degrees of freedom parameter, a real-valued input.
  * @param df2_par a degrees of freedom parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return the quantile function evaluated at \c p.
  * 
@@ -112,10 +125,10 @@ noexcept
 template<typename T1, typename T2, typename T3>
 statslib_constexpr
 common_return_t<T1,T2,T3>
-qf(const T1 p, const T2 df1_par, const T3 df2_par)
+qf(const T1 p, const T2 df1_par, const T3 df2_par, const bool lower_tail, const bool log_p)
 noexcept
 {
-    return internal::qf_type_check(p,df1_par,df2_par);
+    return internal::qf_type_check(p,df1_par,df2_par,lower_tail,log_p);
 }
 
 //
@@ -128,10 +141,29 @@ namespace internal
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 void
-qf_vec(const eT* __stats_pointer_settings__ vals_in, const T1 df1_par, const T2 df2_par, 
+qf_vec(const eT* __stats_pointer_settings__ vals_in, const T1 df1_par, const T2 df2_par, const bool lower_tail, const bool log_p, ullint_t* n_iter_out,
              rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(qf,vals_in,vals_out,num_elem,df1_par,df2_par);
+    const rT df1_r = static_cast<rT>(df1_par);
+    const rT df2_r = static_cast<rT>(df2_par);
+    const rT a_r = df1_r / rT(2);
+    const rT b_r = df2_r / rT(2);
+
+    ullint_t n_iter = ullint_t(0);
+
+    if (lower_tail && !log_p && f_sanity_check(df1_r,df2_r) && !GCINT::any_posinf(df1_r,df2_r)) {
+        n_iter = qbeta_inv_vec(vals_in,a_r,b_r,vals_out,num_elem);
+
+        for (ullint_t j=ullint_t(0); j < num_elem; ++j) {
+            vals_out[j] = qf_compute_adj(vals_out[j],a_r/b_r);
+        }
+    } else {
+        EVAL_DIST_FN_VEC(qf,vals_in,vals_out,num_elem,df1_par,df2_par,lower_tail,log_p);
+    }
+
+    if (n_iter_out != nullptr) {
+        *n_iter_out = n_iter;
+    }
 }
 #endif
 
@@ -143,6 +175,9 @@ qf_vec(const eT* __stats_pointer_settings__ vals_in, const T1 df1_par, const T2
  * @param x a standard vector.
  * @param df1_par a degrees of freedom parameter, a real-valued input.
  * @param df2_par a degrees of freedom parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
+ * @param n_iter_out if not \c nullptr, receives the total number of Halley iterations used by the root-finder.
  *
  * @return a vector of quantile values corresponding to the elements of \c x.
  * 
@@ -157,9 +192,9 @@ qf_vec(const eT* __stats_pointer_settings__ vals_in, const T1 df1_par, const T2
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 std::vector<rT>
-qf(const std::vector<eT>& x, const T1 df1_par, const T2 df2_par)
+qf(const std::vector<eT>& x, const T1 df1_par, const T2 df2_par, const bool lower_tail, const bool log_p, ullint_t* n_iter_out)
 {
-    STDVEC_DIST_FN(qf_vec,df1_par,df2_par);
+    STDVEC_DIST_FN(qf_vec,df1_par,df2_par,lower_tail,log_p,n_iter_out);
 }
 #endif
 
@@ -169,6 +204,9 @@ qf(const std::vector<eT>& x, const T1 df1_par, const T2 df2_par)
  * @param X a matrix of input values.
  * @param df1_par a degrees of freedom parameter, a real-valued input.
  * @param df2_par a degrees of freedom parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
+ * @param n_iter_out if not \c nullptr, receives the total number of Halley iterations used by the root-finder.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -184,17 +222,17 @@ qf(const std::vector<eT>& x, const T1 df1_par, const T2 df2_par)
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 ArmaMat<rT>
-qf(const ArmaMat<eT>& X, const T1 df1_par, const T2 df2_par)
+qf(const ArmaMat<eT>& X, const T1 df1_par, const T2 df2_par, const bool lower_tail, const bool log_p, ullint_t* n_iter_out)
 {
-    ARMA_DIST_FN(qf_vec,df1_par,df2_par);
+    ARMA_DIST_FN(qf_vec,df1_par,df2_par,lower_tail,log_p,n_iter_out);
 }
 
 template<typename mT, typename tT, typename T1, typename T2>
 statslib_inline
 mT
-qf(const ArmaGen<mT,tT>& X, const T1 df1_par, const T2 df2_par)
+qf(const ArmaGen<mT,tT>& X, const T1 df1_par, const T2 df2_par, const bool lower_tail, const bool log_p, ullint_t* n_iter_out)
 {
-    return qf(X.eval(),df1_par,df2_par);
+    return qf(X.eval(),df1_par,df2_par,lower_tail,log_p,n_iter_out);
 }
 #endif
 
@@ -204,6 +242,9 @@ qf(const ArmaGen<mT,tT>& X, const T1 df1_par, const T2 df2_par)
  * @param X a matrix of input values.
  * @param df1_par a degrees of freedom parameter, a real-valued input.
  * @param df2_par a degrees of freedom parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
+ * @param n_iter_out if not \c nullptr, receives the total number of Halley iterations used by the root-finder.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -217,9 +258,9 @@ qf(const ArmaGen<mT,tT>& X, const T1 df1_par, const T2 df2_par)
 template<typename eT, typename T1, typename T2, typename rT, bool To>
 statslib_inline
 BlazeMat<rT,To>
-qf(const BlazeMat<eT,To>& X, const T1 df1_par, const T2 df2_par)
+qf(const BlazeMat<eT,To>& X, const T1 df1_par, const T2 df2_par, const bool lower_tail, const bool log_p, ullint_t* n_iter_out)
 {
-    BLAZE_DIST_FN(qf_vec,df1_par,df2_par);
+    BLAZE_DIST_FN(qf_vec,df1_par,df2_par,lower_tail,log_p,n_iter_out);
 }
 #endif
 
@@ -229,6 +270,9 @@ qf(const BlazeMat<eT,To>& X, const T1 df1_par, const T2 df2_par)
  * @param X a matrix of input values.
  * @param df1_par a degrees of freedom parameter, a real-valued input.
  * @param df2_par a degrees of freedom parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
+ * @param n_iter_out if not \c nullptr, receives the total number of Halley iterations used by the root-finder.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -242,8 +286,8 @@ qf(const BlazeMat<eT,To>& X, const T1 df1_par, const T2 df2_par)
 template<typename eT, typename T1, typename T2, typename rT, int iTr, int iTc>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-qf(const EigenMat<eT,iTr,iTc>& X, const T1 df1_par, const T2 df2_par)
+qf(const EigenMat<eT,iTr,iTc>& X, const T1 df1_par, const T2 df2_par, const bool lower_tail, const bool log_p, ullint_t* n_iter_out)
 {
-    EIGEN_DIST_FN(qf_vec,df1_par,df2_par);
+    EIGEN_DIST_FN(qf_vec,df1_par,df2_par,lower_tail,log_p,n_iter_out);
 }
 #endif
@@ -28,13 +28,117 @@
 namespace internal
 {
 
+// upper tail: Newton's method on log Q(a,x) = log q, using d/dx log Q(a,x) = - f(x) / Q(a,x), f(x) = exp(-x) x^(a-1) / Gamma(a);
+// log Q is concave (a >= 1) or convex (a < 1), so the iterates settle on one side of the root
+
 template<typename T>
 statslib_constexpr
 T
-qgamma_compute(const T p, const T shape_par, const T scale_par)
+qgamma_upper_newton_step(const T log_q, const T shape_par, const T log_Q, const T x)
 noexcept
 {
-    return( scale_par*gcem::incomplete_gamma_inv(shape_par,p) );
+    return( (log_Q - log_q) * stmath::exp(log_Q - pgamma_log_front(shape_par,x) + stmath::log(x)) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+qgamma_upper_newton(const T log_q, const T shape_par, const T x, const int iter) noexcept;
+
+template<typename T>
+statslib_constexpr
+T
+qgamma_upper_newton_next(const T log_q, const T shape_par, const T x, const T x_new, const int iter)
+noexcept
+{
+    return( !(x_new > T(0)) ? \
+                qgamma_upper_newton(log_q,shape_par,x/T(2),iter+1) :
+            iter >= 100 || stmath::abs(x_new - x) <= T(4)*STLIM<T>::epsilon()*x_new ? \
+                x_new :
+                qgamma_upper_newton(log_q,shape_par,x_new,iter+1) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+qgamma_upper_newton(const T log_q, const T shape_par, const T x, const int iter)
+noexcept
+{
+    return qgamma_upper_newton_next(log_q,shape_par,x,
+                                    x + qgamma_upper_newton_step(log_q,shape_par,pgamma_log_tail_compute(shape_par,x,false),x),
+                                    iter);
+}
+
+// starting values: away from the far tail, the lower-tail inverse at 1 - q; beyond that, the larger of the
+// Wilson-Hilferty approximation and the leading term of log Q(a,x) ~ -x + (a-1) log(x) - log Gamma(a)
+
+template<typename T>
+statslib_constexpr
+T
+qgamma_upper_wh(const T z, const T shape_par)
+noexcept
+{
+    return( shape_par*stmath::pow(T(1) - T(1)/(T(9)*shape_par) + z/(T(3)*stmath::sqrt(shape_par)), 3) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+qgamma_upper_asymp(const T log_q, const T shape_par)
+noexcept
+{
+    return( - log_q + (shape_par - T(1))*stmath::log(- log_q) - stmath::lgamma(shape_par) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+qgamma_upper_init_far(const T x_wh, const T x_asymp, const T shape_par)
+noexcept
+{
+    return( x_wh > T(0) || x_asymp > T(0) ? \
+                (x_wh > x_asymp ? x_wh : x_asymp) :
+                shape_par );
+}
+
+template<typename T>
+statslib_constexpr
+T
+qgamma_upper_init(const T log_q, const T shape_par)
+noexcept
+{
+    return( log_q > stmath::log(T(1e-03)) ? \
+                static_cast<T>(gcem::incomplete_gamma_inv(shape_par,- stmath::expm1(log_q))) :
+                qgamma_upper_init_far(qgamma_upper_wh(qnorm(log_q,T(0),T(1),false,true),shape_par),
+                                      qgamma_upper_asymp(log_q,shape_par),shape_par) );
+}
+
+// standard (unit scale) gamma quantile for either tail: the upper tail is solved directly when p describes
+// an upper-tail probability below 1/2, and lower-tail probabilities below the smallest double use
+// P(a,x) ~ x^a / Gamma(a+1)
+
+template<typename T>
+statslib_constexpr
+T
+qgamma_std_compute(const T p, const T shape_par, const bool lower_tail, const bool log_p)
+noexcept
+{
+    return( invert_upper_tail(p,lower_tail,log_p) ? \
+                qgamma_upper_newton(log_prob_upper(p,lower_tail,log_p),shape_par,
+                                    qgamma_upper_init(log_prob_upper(p,lower_tail,log_p),shape_par),0) :
+            log_prob_lower(p,lower_tail,log_p) < stmath::log(STLIM<T>::min()) ? \
+                stmath::exp((log_prob_lower(p,lower_tail,log_p) + stmath::lgamma(shape_par + T(1))) / shape_par) :
+            //
+                static_cast<T>(gcem::incomplete_gamma_inv(shape_par,prob_lower(p,lower_tail,log_p))) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+qgamma_compute(const T p, const T shape_par, const T scale_par, const bool lower_tail, const bool log_p)
+noexcept
+{
+    return( scale_par*qgamma_std_compute(p,shape_par,lower_tail,log_p) );
 }
 
 template<typename T>
@@ -55,33 +159,33 @@ noexcept
 template<typename T>
 statslib_constexpr
 T
-qgamma_vals_check(const T p, const T shape_par, const T scale_par)
+qgamma_vals_check(const T p, const T shape_par, const T scale_par, const bool lower_tail, const bool log_p)
 noexcept
 {
     return( !gamma_sanity_check(shape_par,scale_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            !prob_val_check(p) ? \
+            !prob_val_check(p,log_p) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            p == T(0) ? \
+            prob_lower_is_zero(p,lower_tail,log_p) ? \
                 T(0) :
-            p == T(1) ? \
+            prob_upper_is_zero(p,lower_tail,log_p) ? \
                 STLIM<T>::infinity() :
             //
             GCINT::any_posinf(shape_par,scale_par) || shape_par == T(0) ? \
                 qgamma_limit_vals(shape_par,scale_par) :
             //
-            qgamma_compute(p,shape_par,scale_par) );
+            qgamma_compute(p,shape_par,scale_par,lower_tail,log_p) );
 }
 
 template<typename T1, typename T2, typename T3, typename TC = common_return_t<T1,T2,T3>>
 statslib_constexpr
 TC
-qgamma_type_check(const T1 x, const T2 shape_par, const T3 scale_par)
+qgamma_type_check(const T1 x, const T2 shape_par, const T3 scale_par, const bool lower_tail, const bool log_p)
 noexcept
 {
-    return qgamma_vals_check(static_cast<TC>(x),static_cast<TC>(shape_par),static_cast<TC>(scale_par));
+    return qgamma_vals_check(static_cast<TC>(x),static_cast<TC>(shape_par),static_cast<TC>(scale_par),lower_tail,log_p);
 }
 
 }
@@ -92,6 +196,8 @@ noexcept
  * @param p a real-valued input.
  * @param shape_par the shape parameter, a real-valued input.
  * @param scale_par the scale parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return the quantile function evaluated at \c p.
  *
@@ -102,10 +208,10 @@ noexcept
 template<typename T1, typename T2, typename T3>
 statslib_constexpr
 common_return_t<T1,T2,T3>
-qgamma(const T1 p, const T2 shape_par, const T3 scale_par)
+qgamma(const T1 p, const T2 shape_par, const T3 scale_par, const bool lower_tail, const bool log_p)
 noexcept
 {
-    return internal::qgamma_type_check(p,shape_par,scale_par);
+    return internal::qgamma_type_check(p,shape_par,scale_par,lower_tail,log_p);
 }
 
 //
@@ -115,13 +221,157 @@ namespace internal
 {
 
 #ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+// inverse of the regularized lower incomplete gamma function, P(a,x) = p, by Halley iterations;
+// the cold-start guess follows Numerical Recipes (3rd ed., Sec. 6.2.1)
+
+template<typename T>
+statslib_inline
+T
+qgamma_initial_guess(const T p, const T shape_par)
+{
+    if (shape_par > T(1)) {
+        const T pp = (p < T(0.5)) ? p : T(1) - p;
+        const T t_val = std::sqrt(- T(2) * std::log(pp));
+        
+        T z_val = (T(2.30753) + t_val*T(0.27061)) / (T(1) + t_val*(T(0.99229) + t_val*T(0.04481))) - t_val;
+        z_val = (p < T(0.5)) ? - z_val : z_val;
+
+        const T w_val = T(1) - T(1) / (T(9)*shape_par) - z_val / (T(3)*std::sqrt(shape_par));
+
+        return std::max(T(1e-03), shape_par*w_val*w_val*w_val);
+    }
+
+    const T t_val = T(1) - shape_par*(T(0.253) + shape_par*T(0.12));
+
+    return (p < t_val) ? std::pow(p / t_val, T(1) / shape_par) : T(1) - std::log1p(- (p - t_val) / (T(1) - t_val));
+}
+
+template<typename T>
+statslib_inline
+T
+qgamma_halley(const T p, const T shape_par, const T lgamma_shape, const T x_init, ullint_t& n_iter)
+{
+    const int max_iter = 64;
+    // Halley converges cubically: once a step falls below eps^(1/3) (scaled), the next would be below eps
+    const T err_tol = T(0.1) * std::cbrt(STLIM<T>::epsilon());
+
+    T x_val = x_init;
+
+    for (int iter = 0; iter < max_iter; ++iter)
+    {
+        ++n_iter;
+
+        const T err_val = static_cast<T>(gcem::incomplete_gamma(shape_par,x_val)) - p;
+        const T dens_val = std::exp((shape_par - T(1))*std::log(x_val) - x_val - lgamma_shape);
+
+        if (!(dens_val > T(0))) {
+            return STLIM<T>::quiet_NaN();
+        }
+
+        const T newton_step = err_val / dens_val;
+        const T halley_step = newton_step / (T(1) - T(0.5)*std::min(T(1), newton_step*((shape_par - T(1))/x_val - T(1))));
+
+        const T x_prev = x_val;
+        x_val -= halley_step;
+
+        if (x_val <= T(0)) {
+            x_val = T(0.5) * x_prev;
+        }
+
+        if (std::abs(halley_step) < err_tol * x_val) {
+            return x_val;
+        }
+    }
+
+    return STLIM<T>::quiet_NaN();
+}
+
+// solve P(a,x) = p (or 1 - p) elementwise, writing x to vals_out and returning the number of Halley iterations;
+// for sorted input each solve is seeded by extrapolating from the previous roots
+
+template<typename eT, typename rT>
+statslib_inline
+ullint_t
+qgamma_inv_vec(const eT* __stats_pointer_settings__ vals_in, const rT shape_par, const bool complement_p,
+                     rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    const rT lgamma_shape = std::lgamma(shape_par);
+    const bool warm_start = is_sorted_vec(vals_in,num_elem);
+
+    ullint_t n_iter = ullint_t(0);
+    ullint_t n_roots = ullint_t(0);
+    rT p_0 = rT(0), x_0 = rT(0), p_1 = rT(0), x_1 = rT(0), p_2 = rT(0), x_2 = rT(0);
+
+    for (ullint_t j=ullint_t(0); j < num_elem; ++j)
+    {
+        const rT p_j = complement_p ? rT(1) - static_cast<rT>(vals_in[j]) : static_cast<rT>(vals_in[j]);
+
+        if (!(p_j > rT(0) && p_j < rT(1))) {
+            vals_out[j] = p_j == rT(0) ? rT(0) : p_j == rT(1) ? STLIM<rT>::infinity() : STLIM<rT>::quiet_NaN();
+            continue;
+        }
+
+        rT x_init = qgamma_initial_guess(p_j,shape_par);
+
+        if (warm_start && n_roots > ullint_t(0)) {
+            // divided-difference extrapolation through up to three previous roots
+            const rT dd_1 = n_roots > ullint_t(1) ? (x_2 - x_1) / (p_2 - p_1) : rT(0);
+            const rT dd_2 = n_roots > ullint_t(2) ? (dd_1 - (x_1 - x_0) / (p_1 - p_0)) / (p_2 - p_0) : rT(0);
+
+            const rT x_ext = x_2 + (p_j - p_2) * (dd_1 + dd_2 * (p_j - p_1));
+
+            x_init = (x_ext > rT(0)) ? x_ext : x_2;
+        }
+
+        rT x_j = qgamma_halley(p_j,shape_par,lgamma_shape,x_init,n_iter);
+
+        if (GCINT::is_nan(x_j) && warm_start) {
+            x_j = qgamma_halley(p_j,shape_par,lgamma_shape,qgamma_initial_guess(p_j,shape_par),n_iter);
+        }
+
+        if (GCINT::is_nan(x_j)) {
+            x_j = static_cast<rT>(gcem::incomplete_gamma_inv(shape_par,p_j));
+        }
+
+        vals_out[j] = x_j;
+
+        if (p_j != p_2 || n_roots == ullint_t(0)) {
+            p_0 = p_1; x_0 = x_1;
+            p_1 = p_2; x_1 = x_2;
+            p_2 = p_j; x_2 = x_j;
+            ++n_roots;
+        }
+    }
+
+    return n_iter;
+}
+
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 void
-qgamma_vec(const eT* __stats_pointer_settings__ vals_in, const T1 shape_par, const T2 scale_par, 
+qgamma_vec(const eT* __stats_pointer_settings__ vals_in, const T1 shape_par, const T2 scale_par, const bool lower_tail, const bool log_p, ullint_t* n_iter_out,
                  rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(qgamma,vals_in,vals_out,num_elem,shape_par,scale_par);
+    const rT shape_r = static_cast<rT>(shape_par);
+    const rT scale_r = static_cast<rT>(scale_par);
+
+    ullint_t n_iter = ullint_t(0);
+
+    // the Halley solver works on lower-tail probabilities; other inputs take the tail-aware scalar path
+    if (lower_tail && !log_p && gamma_sanity_check(shape_r,scale_r) && shape_r > rT(0) && scale_r > rT(0) && !GCINT::any_posinf(shape_r,scale_r)) {
+        n_iter = qgamma_inv_vec(vals_in,shape_r,false,vals_out,num_elem);
+
+        for (ullint_t j=ullint_t(0); j < num_elem; ++j) {
+            vals_out[j] *= scale_r;
+        }
+    } else {
+        EVAL_DIST_FN_VEC(qgamma,vals_in,vals_out,num_elem,shape_par,scale_par,lower_tail,log_p);
+    }
+
+    if (n_iter_out != nullptr) {
+        *n_iter_out = n_iter;
+    }
 }
 #endif
 
@@ -133,6 +383,9 @@ qgamma_vec(const eT* __stats_pointer_settings__ vals_in, const T1 shape_par, con
  * @param x a standard vector.
  * @param shape_par the shape parameter, a real-valued input.
  * @param scale_par the scale parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
+ * @param n_iter_out if not \c nullptr, receives the total number of Halley iterations used by the root-finder.
  *
  * @return a vector of quantile values corresponding to the elements of \c x.
  * 
@@ -147,9 +400,9 @@ qgamma_vec(const eT* __stats_pointer_settings__ vals_in, const T1 shape_par, con
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 std::vector<rT>
-qgamma(const std::vector<eT>& x, const T1 shape_par, const T2 scale_par)
+qgamma(const std::vector<eT>& x, const T1 shape_par, const T2 scale_par, const bool lower_tail, const bool log_p, ullint_t* n_iter_out)
 {
-    STDVEC_DIST_FN(qgamma_vec,shape_par,scale_par);
+    STDVEC_DIST_FN(qgamma_vec,shape_par,scale_par,lower_tail,log_p,n_iter_out);
 }
 #endif
 
@@ -159,6 +412,9 @@ qgamma(const std::vector<eT>& x, const T1 shape_par, const T2 scale_par)
  * @param X a matrix of input values.
  * @param shape_par the shape parameter, a real-valued input.
  * @param scale_par the scale parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
+ * @param n_iter_out if not \c nullptr, receives the total number of Halley iterations used by the root-finder.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -174,17 +430,17 @@ qgamma(const std::vector<eT>& x, const T1 shape_par, const T2 scale_par)
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 ArmaMat<rT>
-qgamma(const ArmaMat<eT>& X, const T1 shape_par, const T2 scale_par)
+qgamma(const ArmaMat<eT>& X, const T1 shape_par, const T2 scale_par, const bool lower_tail, const bool log_p, ullint_t* n_iter_out)
 {
-    ARMA_DIST_FN(qgamma_vec,shape_par,scale_par);
+    ARMA_DIST_FN(qgamma_vec,shape_par,scale_par,lower_tail,log_p,n_iter_out);
 }
 
 template<typename mT, typename tT, typename T1, typename T2>
 statslib_inline
 mT
-qgamma(const ArmaGen<mT,tT>& X, const T1 shape_par, const T2 scale_par)
+qgamma(const ArmaGen<mT,tT>& X, const T1 shape_par, const T2 scale_par, const bool lower_tail, const bool log_p, ullint_t* n_iter_out)
 {
-    return qgamma(X.eval(),shape_par,scale_par);
+    return qgamma(X.eval(),shape_par,scale_par,lower_tail,log_p,n_iter_out);
 }
 #endif
 
@@ -194,6 +450,9 @@ qgamma(const ArmaGen<mT,tT>& X, const T1 shape_par, const T2 scale_par)
  * @param X a matrix of input values.
  * @param shape_par the shape parameter, a real-valued input.
  * @param scale_par the scale parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
+ * @param n_iter_out if not \c nullptr, receives the total number of Halley iterations used by the root-finder.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -207,9 +466,9 @@ qgamma(const ArmaGen<mT,tT>& X, const T1 shape_par, const T2 scale_par)
 template<typename eT, typename T1, typename T2, typename rT, bool To>
 statslib_inline
 BlazeMat<rT,To>
-qgamma(const BlazeMat<eT,To>& X, const T1 shape_par, const T2 scale_par)
+qgamma(const BlazeMat<eT,To>& X, const T1 shape_par, const T2 scale_par, const bool lower_tail, const bool log_p, ullint_t* n_iter_out)
 {
-    BLAZE_DIST_FN(qgamma_vec,shape_par,scale_par);
+    BLAZE_DIST_FN(qgamma_vec,shape_par,scale_par,lower_tail,log_p,n_iter_out);
 }
 #endif
 
@@ -219,6 +478,9 @@ qgamma(const BlazeMat<eT,To>& X, const T1 shape_par, const T2 scale_par)
  * @param X a matrix of input values.
  * @param shape_par the shape parameter, a real-valued input.
  * @param scale_par the scale parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
+ * @param n_iter_out if not \c nullptr, receives the total number of Halley iterations used by the root-finder.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -232,8 +494,8 @@ qgamma(const BlazeMat<eT,To>& X, const T1 shape_par, const T2 scale_par)
 template<typename eT, typename T1, typename T2, typename rT, int iTr, int iTc>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-qgamma(const EigenMat<eT,iTr,iTc>& X, const T1 shape_par, const T2 scale_par)
+qgamma(const EigenMat<eT,iTr,iTc>& X, const T1 shape_par, const T2 scale_par, const bool lower_tail, const bool log_p, ullint_t* n_iter_out)
 {
-    EIGEN_DIST_FN(qgamma_vec,shape_par,scale_par);
+    EIGEN_DIST_FN(qgamma_vec,shape_par,scale_par,lower_tail,log_p,n_iter_out);
 }
 #endif
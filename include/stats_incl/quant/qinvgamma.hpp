@@ -31,7 +31,7 @@
 template<typename T1, typename T2, typename T3>
 statslib_constexpr
 common_return_t<T1,T2,T3>
-qinvgamma(const T1 p, const T2 shape_par, const T3 rate_par) noexcept;
+qinvgamma(const T1 p, const T2 shape_par, const T3 rate_par, const bool lower_tail = true, const bool log_p = false) noexcept;
 
 //
 // vector/matrix input
@@ -40,33 +40,33 @@ qinvgamma(const T1 p, const T2 shape_par, const T3 rate_par) noexcept;
 template<typename eT, typename T1, typename T2, typename rT = common_return_t<eT,T1,T2>>
 statslib_inline
 std::vector<rT>
-qinvgamma(const std::vector<eT>& x, const T1 shape_par, const T2 rate_par);
+qinvgamma(const std::vector<eT>& x, const T1 shape_par, const T2 rate_par, const bool lower_tail = true, const bool log_p = false, ullint_t* n_iter_out = nullptr);
 #endif
 
 #ifdef STATS_ENABLE_ARMA_WRAPPERS
 template<typename eT, typename T1, typename T2, typename rT = common_return_t<eT,T1,T2>>
 statslib_inline
 ArmaMat<rT>
-qinvgamma(const ArmaMat<eT>& X, const T1 shape_par, const T2 rate_par);
+qinvgamma(const ArmaMat<eT>& X, const T1 shape_par, const T2 rate_par, const bool lower_tail = true, const bool log_p = false, ullint_t* n_iter_out = nullptr);
 
 template<typename mT, typename tT, typename T1, typename T2>
 statslib_inline
 mT
-qinvgamma(const ArmaGen<mT,tT>& X, const T1 shape_par, const T2 rate_par);
+qinvgamma(const ArmaGen<mT,tT>& X, const T1 shape_par, const T2 rate_par, const bool lower_tail = true, const bool log_p = false, ullint_t* n_iter_out = nullptr);
 #endif
 
 #ifdef STATS_ENABLE_BLAZE_WRAPPERS
 template<typename eT, typename T1, typename T2, typename rT = common_return_t<eT,T1,T2>, bool To = blaze::columnMajor>
 statslib_inline
 BlazeMat<rT,To>
-qinvgamma(const BlazeMat<eT,To>& X, const T1 shape_par, const T2 rate_par);
+qinvgamma(const BlazeMat<eT,To>& X, const T1 shape_par, const T2 rate_par, const bool lower_tail = true, const bool log_p = false, ullint_t* n_iter_out = nullptr);
 #endif
 
 #ifdef STATS_ENABLE_EIGEN_WRAPPERS
 template<typename eT, typename T1, typename T2, typename rT = common_return_t<eT,T1,T2>, int iTr = Eigen::Dynamic, int iTc = Eigen::Dynamic>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-qinvgamma(const EigenMat<eT,iTr,iTc>& X, const T1 shape_par, const T2 rate_par);
+qinvgamma(const EigenMat<eT,iTr,iTc>& X, const T1 shape_par, const T2 rate_par, const bool lower_tail = true, const bool log_p = false, ullint_t* n_iter_out = nullptr);
 #endif
 
 //
@@ -31,10 +31,10 @@ namespace internal
 template<typename T>
 statslib_constexpr
 T
-qinvgamma_compute(const T p, const T shape_par, const T rate_par)
+qinvgamma_compute(const T p, const T shape_par, const T rate_par, const bool lower_tail, const bool log_p)
 noexcept
-{
-    return( rate_par / gcem::incomplete_gamma_inv(shape_par,T(1)-p) );
+{   // P(X <= x) = Q(a, rate / x): the tails swap
+    return( rate_par / qgamma_std_compute(p,shape_par,!lower_tail,log_p) );
 }
 
 template<typename T>
@@ -55,33 +55,33 @@ noexcept
 template<typename T>
 statslib_constexpr
 T
-qinvgamma_vals_check(const T p, const T shape_par, const T rate_par)
+qinvgamma_vals_check(const T p, const T shape_par, const T rate_par, const bool lower_tail, const bool log_p)
 noexcept
 {
     return( !invgamma_sanity_check(shape_par,rate_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            !prob_val_check(p) ? \
+            !prob_val_check(p,log_p) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            p == T(0) ? \
+            prob_lower_is_zero(p,lower_tail,log_p) ? \
                 T(0) :
-            p == T(1) ? \
+            prob_upper_is_zero(p,lower_tail,log_p) ? \
                 STLIM<T>::infinity() :
             //
             GCINT::any_posinf(shape_par,rate_par) || shape_par == T(0) || rate_par == T(0) ? \
                 qinvgamma_limit_vals(shape_par,rate_par) :
             //
-            qinvgamma_compute(p,shape_par,rate_par) );
+            qinvgamma_compute(p,shape_par,rate_par,lower_tail,log_p) );
 }
 
 template<typename T1, typename T2, typename T3, typename TC = common_return_t<T1,T2,T3>>
 statslib_constexpr
 TC
-qinvgamma_type_check(const T1 x, const T2 shape_par, const T3 rate_par)
+qinvgamma_type_check(const T1 x, const T2 shape_par, const T3 rate_par, const bool lower_tail, const bool log_p)
 noexcept
 {
-    return qinvgamma_vals_check(static_cast<TC>(x),static_cast<TC>(shape_par),static_cast<TC>(rate_par));
+    return qinvgamma_vals_check(static_cast<TC>(x),static_cast<TC>(shape_par),static_cast<TC>(rate_par),lower_tail,log_p);
 }
 
 }
@@ -92,6 +92,8 @@ noexcept
  * @param p a real-valued input.
  * @param shape_par the shape parameter, a real-valued input.
  * @param rate_par the rate parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return the quantile function evaluated at \c p.
  *
@@ -102,10 +104,10 @@ noexcept
 template<typename T1, typename T2, typename T3>
 statslib_constexpr
 common_return_t<T1,T2,T3>
-qinvgamma(const T1 p, const T2 shape_par, const T3 rate_par)
+qinvgamma(const T1 p, const T2 shape_par, const T3 rate_par, const bool lower_tail, const bool log_p)
 noexcept
 {
-    return internal::qinvgamma_type_check(p,shape_par,rate_par);
+    return internal::qinvgamma_type_check(p,shape_par,rate_par,lower_tail,log_p);
 }
 
 //
@@ -118,10 +120,28 @@ namespace internal
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 void
-qinvgamma_vec(const eT* __stats_pointer_settings__ vals_in, const T1 shape_par, const T2 rate_par, 
+qinvgamma_vec(const eT* __stats_pointer_settings__ vals_in, const T1 shape_par, const T2 rate_par, const bool lower_tail, const bool log_p, ullint_t* n_iter_out,
                     rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(qinvgamma,vals_in,vals_out,num_elem,shape_par,rate_par);
+    const rT shape_r = static_cast<rT>(shape_par);
+    const rT rate_r = static_cast<rT>(rate_par);
+
+    ullint_t n_iter = ullint_t(0);
+
+    if (!log_p && invgamma_sanity_check(shape_r,rate_r) && shape_r > rT(0) && rate_r > rT(0) && !GCINT::any_posinf(shape_r,rate_r)) {
+        // X = rate / Y with Y ~ Gamma(shape,1), so F^{-1}(p) = rate / P^{-1}(shape, 1 - p), or rate / P^{-1}(shape, p) for upper-tail p
+        n_iter = qgamma_inv_vec(vals_in,shape_r,lower_tail,vals_out,num_elem);
+
+        for (ullint_t j=ullint_t(0); j < num_elem; ++j) {
+            vals_out[j] = rate_r / vals_out[j];
+        }
+    } else {
+        EVAL_DIST_FN_VEC(qinvgamma,vals_in,vals_out,num_elem,shape_par,rate_par,lower_tail,log_p);
+    }
+
+    if (n_iter_out != nullptr) {
+        *n_iter_out = n_iter;
+    }
 }
 #endif
 
@@ -133,6 +153,9 @@ qinvgamma_vec(const eT* __stats_pointer_settings__ vals_in, const T1 shape_par,
  * @param x a standard vector.
  * @param shape_par the shape parameter, a real-valued input.
  * @param rate_par the rate parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
+ * @param n_iter_out if not \c nullptr, receives the total number of Halley iterations used by the root-finder.
  *
  * @return a vector of quantile values corresponding to the elements of \c x.
  * 
@@ -147,9 +170,9 @@ qinvgamma_vec(const eT* __stats_pointer_settings__ vals_in, const T1 shape_par,
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 std::vector<rT>
-qinvgamma(const std::vector<eT>& x, const T1 shape_par, const T2 rate_par)
+qinvgamma(const std::vector<eT>& x, const T1 shape_par, const T2 rate_par, const bool lower_tail, const bool log_p, ullint_t* n_iter_out)
 {
-    STDVEC_DIST_FN(qinvgamma_vec,shape_par,rate_par);
+    STDVEC_DIST_FN(qinvgamma_vec,shape_par,rate_par,lower_tail,log_p,n_iter_out);
 }
 #endif
 
@@ -159,6 +182,9 @@ qinvgamma(const std::vector<eT>& x, const T1 shape_par, const T2 rate_par)
  * @param X a matrix of input values.
  * @param shape_par the shape parameter, a real-valued input.
  * @param rate_par the rate parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
+ * @param n_iter_out if not \c nullptr, receives the total number of Halley iterations used by the root-finder.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -174,17 +200,17 @@ qinvgamma(const std::vector<eT>& x, const T1 shape_par, const T2 rate_par)
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 ArmaMat<rT>
-qinvgamma(const ArmaMat<eT>& X, const T1 shape_par, const T2 rate_par)
+qinvgamma(const ArmaMat<eT>& X, const T1 shape_par, const T2 rate_par, const bool lower_tail, const bool log_p, ullint_t* n_iter_out)
 {
-    ARMA_DIST_FN(qinvgamma_vec,shape_par,rate_par);
+    ARMA_DIST_FN(qinvgamma_vec,shape_par,rate_par,lower_tail,log_p,n_iter_out);
 }
 
 template<typename mT, typename tT, typename T1, typename T2>
 statslib_inline
 mT
-qinvgamma(const ArmaGen<mT,tT>& X, const T1 shape_par, const T2 rate_par)
+qinvgamma(const ArmaGen<mT,tT>& X, const T1 shape_par, const T2 rate_par, const bool lower_tail, const bool log_p, ullint_t* n_iter_out)
 {
-    return qinvgamma(X.eval(),shape_par,rate_par);
+    return qinvgamma(X.eval(),shape_par,rate_par,lower_tail,log_p,n_iter_out);
 }
 #endif
 
@@ -194,6 +220,9 @@ qinvgamma(const ArmaGen<mT,tT>& X, const T1 shape_par, const T2 rate_par)
  * @param X a matrix of input values.
  * @param shape_par the shape parameter, a real-valued input.
  * @param rate_par the rate parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
+ * @param n_iter_out if not \c nullptr, receives the total number of Halley iterations used by the root-finder.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -207,9 +236,9 @@ qinvgamma(const ArmaGen<mT,tT>& X, const T1 shape_par, const T2 rate_par)
 template<typename eT, typename T1, typename T2, typename rT, bool To>
 statslib_inline
 BlazeMat<rT,To>
-qinvgamma(const BlazeMat<eT,To>& X, const T1 shape_par, const T2 rate_par)
+qinvgamma(const BlazeMat<eT,To>& X, const T1 shape_par, const T2 rate_par, const bool lower_tail, const bool log_p, ullint_t* n_iter_out)
 {
-    BLAZE_DIST_FN(qinvgamma_vec,shape_par,rate_par);
+    BLAZE_DIST_FN(qinvgamma_vec,shape_par,rate_par,lower_tail,log_p,n_iter_out);
 }
 #endif
 
@@ -219,6 +248,9 @@ qinvgamma(const BlazeMat<eT,To>& X, const T1 shape_par, const T2 rate_par)
  * @param X a matrix of input values.
  * @param shape_par the shape parameter, a real-valued input.
  * @param rate_par the rate parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
+ * @param n_iter_out if not \c nullptr, receives the total number of Halley iterations used by the root-finder.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -232,8 +264,8 @@ qinvgamma(const BlazeMat<eT,To>& X, const T1 shape_par, const T2 rate_par)
 template<typename eT, typename T1, typename T2, typename rT, int iTr, int iTc>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-qinvgamma(const EigenMat<eT,iTr,iTc>& X, const T1 shape_par, const T2 rate_par)
+qinvgamma(const EigenMat<eT,iTr,iTc>& X, const T1 shape_par, const T2 rate_par, const bool lower_tail, const bool log_p, ullint_t* n_iter_out)
 {
-    EIGEN_DIST_FN(qinvgamma_vec,shape_par,rate_par);
+    EIGEN_DIST_FN(qinvgamma_vec,shape_par,rate_par,lower_tail,log_p,n_iter_out);
 }
 #endif
@@ -31,10 +31,10 @@ namespace internal
 template<typename T>
 statslib_constexpr
 T
-qkumaraswamy_compute(const T p, const T a_par, const T b_par)
+qkumaraswamy_compute(const T p, const T a_par, const T b_par, const bool lower_tail, const bool log_p)
 noexcept
 {
-    return stmath::pow(T(1) - stmath::pow(T(1) - p, T(1) / b_par), T(1) / a_par);
+    return stmath::pow(- stmath::expm1(log_prob_upper(p,lower_tail,log_p) / b_par), T(1) / a_par);
 }
 
 template<typename T>
@@ -63,33 +63,33 @@ noexcept
 template<typename T>
 statslib_constexpr
 T
-qkumaraswamy_vals_check(const T p, const T a_par, const T b_par)
+qkumaraswamy_vals_check(const T p, const T a_par, const T b_par, const bool lower_tail, const bool log_p)
 noexcept
 {
     return( !beta_sanity_check(a_par,b_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            !prob_val_check(p) ? \
+            !prob_val_check(p,log_p) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            p == T(0) ? \
+            prob_lower_is_zero(p,lower_tail,log_p) ? \
                 T(0) :
-            p == T(1) ? \
+            prob_upper_is_zero(p,lower_tail,log_p) ? \
                 T(1) :
             //
             (a_par == T(0) || b_par == T(0) || GCINT::any_posinf(a_par,b_par)) ? \
-                qkumaraswamy_limit_vals(p,a_par,b_par) :
+                qkumaraswamy_limit_vals(prob_lower(p,lower_tail,log_p),a_par,b_par) :
             //
-            qkumaraswamy_compute(p,a_par,b_par) );
+            qkumaraswamy_compute(p,a_par,b_par,lower_tail,log_p) );
 }
 
 template<typename T1, typename T2, typename T3, typename TC = common_return_t<T1,T2,T3>>
 statslib_constexpr
 TC
-qkumaraswamy_type_check(const T1 p, const T2 a_par, const T3 b_par)
+qkumaraswamy_type_check(const T1 p, const T2 a_par, const T3 b_par, const bool lower_tail, const bool log_p)
 noexcept
 {
-    return qkumaraswamy_vals_check(static_cast<TC>(p),static_cast<TC>(a_par),static_cast<TC>(b_par));
+    return qkumaraswamy_vals_check(static_cast<TC>(p),static_cast<TC>(a_par),static_cast<TC>(b_par),lower_tail,log_p);
 }
 
 }
@@ -100,6 +100,8 @@ noexcept
  * @param p a real-valued input.
  * @param a_par shape parameter, a real-valued input.
  * @param b_par shape parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return the quantile function evaluated at \c p.
  * 
@@ -110,10 +112,10 @@ noexcept
 template<typename T1, typename T2, typename T3>
 statslib_constexpr
 common_return_t<T1,T2,T3>
-qkumaraswamy(const T1 p, const T2 a_par, const T3 b_par)
+qkumaraswamy(const T1 p, const T2 a_par, const T3 b_par, const bool lower_tail, const bool log_p)
 noexcept
 {
-    return internal::qkumaraswamy_type_check(p,a_par,b_par);
+    return internal::qkumaraswamy_type_check(p,a_par,b_par,lower_tail,log_p);
 }
 
 //
@@ -126,10 +128,10 @@ namespace internal
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 void
-qkumaraswamy_vec(const eT* __stats_pointer_settings__ vals_in, const T1 a_par, const T2 b_par, 
+qkumaraswamy_vec(const eT* __stats_pointer_settings__ vals_in, const T1 a_par, const T2 b_par, const bool lower_tail, const bool log_p, 
                 rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(qkumaraswamy,vals_in,vals_out,num_elem,a_par,b_par);
+    EVAL_DIST_FN_VEC(qkumaraswamy,vals_in,vals_out,num_elem,a_par,b_par,lower_tail,log_p);
 }
 #endif
 
@@ -141,6 +143,8 @@ qkumaraswamy_vec(const eT* __stats_pointer_settings__ vals_in, const T1 a_par, c
  * @param x a standard vector.
  * @param a_par a real-valued shape parameter.
  * @param b_par a real-valued shape parameter.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return a vector of quantile values corresponding to the elements of \c x.
  * 
@@ -155,9 +159,9 @@ qkumaraswamy_vec(const eT* __stats_pointer_settings__ vals_in, const T1 a_par, c
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 std::vector<rT>
-qkumaraswamy(const std::vector<eT>& x, const T1 a_par, const T2 b_par)
+qkumaraswamy(const std::vector<eT>& x, const T1 a_par, const T2 b_par, const bool lower_tail, const bool log_p)
 {
-    STDVEC_DIST_FN(qkumaraswamy_vec,a_par,b_par);
+    STDVEC_DIST_FN(qkumaraswamy_vec,a_par,b_par,lower_tail,log_p);
 }
 #endif
 
@@ -167,6 +171,8 @@ qkumaraswamy(const std::vector<eT>& x, const T1 a_par, const T2 b_par)
  * @param X a matrix of input values.
  * @param a_par a real-valued shape parameter.
  * @param b_par a real-valued shape parameter.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -182,17 +188,17 @@ qkumaraswamy(const std::vector<eT>& x, const T1 a_par, const T2 b_par)
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 ArmaMat<rT>
-qkumaraswamy(const ArmaMat<eT>& X, const T1 a_par, const T2 b_par)
+qkumaraswamy(const ArmaMat<eT>& X, const T1 a_par, const T2 b_par, const bool lower_tail, const bool log_p)
 {
-    ARMA_DIST_FN(qkumaraswamy_vec,a_par,b_par);
+    ARMA_DIST_FN(qkumaraswamy_vec,a_par,b_par,lower_tail,log_p);
 }
 
 template<typename mT, typename tT, typename T1, typename T2>
 statslib_inline
 mT
-qkumaraswamy(const ArmaGen<mT,tT>& X, const T1 a_par, const T2 b_par)
+qkumaraswamy(const ArmaGen<mT,tT>& X, const T1 a_par, const T2 b_par, const bool lower_tail, const bool log_p)
 {
-    return qkumaraswamy(X.eval(),a_par,b_par);
+    return qkumaraswamy(X.eval(),a_par,b_par,lower_tail,log_p);
 }
 #endif
 
@@ -202,6 +208,8 @@ qkumaraswamy(const ArmaGen<mT,tT>& X, const T1 a_par, const T2 b_par)
  * @param X a matrix of input values.
  * @param a_par a real-valued shape parameter.
  * @param b_par a real-valued shape parameter.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -215,9 +223,9 @@ qkumaraswamy(const ArmaGen<mT,tT>& X, const T1 a_par, const T2 b_par)
 template<typename eT, typename T1, typename T2, typename rT, bool To>
 statslib_inline
 BlazeMat<rT,To>
-qkumaraswamy(const BlazeMat<eT,To>& X, const T1 a_par, const T2 b_par)
+qkumaraswamy(const BlazeMat<eT,To>& X, const T1 a_par, const T2 b_par, const bool lower_tail, const bool log_p)
 {
-    BLAZE_DIST_FN(qkumaraswamy_vec,a_par,b_par);
+    BLAZE_DIST_FN(qkumaraswamy_vec,a_par,b_par,lower_tail,log_p);
 }
 #endif
 
@@ -227,6 +235,8 @@ qkumaraswamy(const BlazeMat<eT,To>& X, const T1 a_par, const T2 b_par)
  * @param X a matrix of input values.
  * @param a_par a real-valued shape parameter.
  * @param b_par a real-valued shape parameter.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -240,8 +250,8 @@ qkumaraswamy(const BlazeMat<eT,To>& X, const T1 a_par, const T2 b_par)
 template<typename eT, typename T1, typename T2, typename rT, int iTr, int iTc>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-qkumaraswamy(const EigenMat<eT,iTr,iTc>& X, const T1 a_par, const T2 b_par)
+qkumaraswamy(const EigenMat<eT,iTr,iTc>& X, const T1 a_par, const T2 b_par, const bool lower_tail, const bool log_p)
 {
-    EIGEN_DIST_FN(qkumaraswamy_vec,a_par,b_par);
+    EIGEN_DIST_FN(qkumaraswamy_vec,a_par,b_par,lower_tail,log_p);
 }
 #endif
@@ -31,34 +31,34 @@ namespace internal
 template<typename T>
 statslib_constexpr
 T
-qlnorm_compute(const T p, const T mu_par, const T sigma_par)
+qlnorm_compute(const T p, const T mu_par, const T sigma_par, const bool lower_tail, const bool log_p)
 noexcept
 {
-    return stmath::exp(qnorm(p,mu_par,sigma_par));
+    return stmath::exp(qnorm(p,mu_par,sigma_par,lower_tail,log_p));
 }
 
 template<typename T>
 statslib_constexpr
 T
-qlnorm_vals_check(const T p, const T mu_par, const T sigma_par)
+qlnorm_vals_check(const T p, const T mu_par, const T sigma_par, const bool lower_tail, const bool log_p)
 noexcept
 {
     return( !lnorm_sanity_check(mu_par,sigma_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            !prob_val_check(p) ? \
+            !prob_val_check(p,log_p) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            qlnorm_compute(p,mu_par,sigma_par) );
+            qlnorm_compute(p,mu_par,sigma_par,lower_tail,log_p) );
 }
 
 template<typename T1, typename T2, typename T3, typename TC = common_return_t<T1,T2,T3>>
 statslib_constexpr
 TC
-qlnorm_type_check(const T1 p, const T2 mu_par, const T3 sigma_par)
+qlnorm_type_check(const T1 p, const T2 mu_par, const T3 sigma_par, const bool lower_tail, const bool log_p)
 noexcept
 {
-    return qlnorm_vals_check(static_cast<TC>(p),static_cast<TC>(mu_par),static_cast<TC>(sigma_par));
+    return qlnorm_vals_check(static_cast<TC>(p),static_cast<TC>(mu_par),static_cast<TC>(sigma_par),lower_tail,log_p);
 }
 
 }
@@ -69,6 +69,8 @@ noexcept
  * @param p a real-valued input.
  * @param mu_par the mean parameter, a real-valued input.
  * @param sigma_par the standard deviation parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return the quantile function evaluated at \c p.
  * 
@@ -79,10 +81,10 @@ noexcept
 template<typename T1, typename T2, typename T3>
 statslib_constexpr
 common_return_t<T1,T2,T3>
-qlnorm(const T1 p, const T2 mu_par, const T3 sigma_par)
+qlnorm(const T1 p, const T2 mu_par, const T3 sigma_par, const bool lower_tail, const bool log_p)
 noexcept
 {
-    return internal::qlnorm_type_check(p,mu_par,sigma_par);
+    return internal::qlnorm_type_check(p,mu_par,sigma_par,lower_tail,log_p);
 }
 
 //
@@ -95,10 +97,27 @@ namespace internal
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 void
-qlnorm_vec(const eT* __stats_pointer_settings__ vals_in, const T1 mu_par, const T2 sigma_par, 
+qlnorm_vec(const eT* __stats_pointer_settings__ vals_in, const T1 mu_par, const T2 sigma_par, const bool lower_tail, const bool log_p, 
                  rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(qlnorm,vals_in,vals_out,num_elem,mu_par,sigma_par);
+    const rT mu_r = static_cast<rT>(mu_par);
+    const rT sigma_r = static_cast<rT>(sigma_par);
+
+    if (!GCINT::all_finite(mu_r,sigma_r) || !(sigma_r > rT(0))) {
+        EVAL_DIST_FN_VEC(qlnorm,vals_in,vals_out,num_elem,mu_par,sigma_par,lower_tail,log_p);
+        return;
+    }
+
+    // exp of the batch standard normal quantile; probabilities of 0 and 1, and invalid inputs, come back
+    // non-finite and are replaced by their scalar values
+
+    qnorm_std_vec(vals_in,lower_tail,log_p,vals_out,num_elem);
+
+    for (ullint_t j=ullint_t(0); j < num_elem; ++j)
+    {
+        vals_out[j] = GCINT::is_finite(vals_out[j]) ? std::exp(mu_r + sigma_r*vals_out[j]) :
+                                                      qlnorm(vals_in[j],mu_par,sigma_par,lower_tail,log_p);
+    }
 }
 #endif
 
@@ -110,6 +129,8 @@ qlnorm_vec(const eT* __stats_pointer_settings__ vals_in, const T1 mu_par, const
  * @param x a standard vector.
  * @param mu_par the location parameter, a real-valued input.
  * @param sigma_par the scale parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return a vector of quantile values corresponding to the elements of \c x.
  * 
@@ -124,9 +145,9 @@ qlnorm_vec(const eT* __stats_pointer_settings__ vals_in, const T1 mu_par, const
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 std::vector<rT>
-qlnorm(const std::vector<eT>& x, const T1 mu_par, const T2 sigma_par)
+qlnorm(const std::vector<eT>& x, const T1 mu_par, const T2 sigma_par, const bool lower_tail, const bool log_p)
 {
-    STDVEC_DIST_FN(qlnorm_vec,mu_par,sigma_par);
+    STDVEC_DIST_FN(qlnorm_vec,mu_par,sigma_par,lower_tail,log_p);
 }
 #endif
 
@@ -136,6 +157,8 @@ qlnorm(const std::vector<eT>& x, const T1 mu_par, const T2 sigma_par)
  * @param X a matrix of input values.
  * @param mu_par the location parameter, a real-valued input.
  * @param sigma_par the scale parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -151,17 +174,17 @@ qlnorm(const std::vector<eT>& x, const T1 mu_par, const T2 sigma_par)
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 ArmaMat<rT>
-qlnorm(const ArmaMat<eT>& X, const T1 mu_par, const T2 sigma_par)
+qlnorm(const ArmaMat<eT>& X, const T1 mu_par, const T2 sigma_par, const bool lower_tail, const bool log_p)
 {
-    ARMA_DIST_FN(qlnorm_vec,mu_par,sigma_par);
+    ARMA_DIST_FN(qlnorm_vec,mu_par,sigma_par,lower_tail,log_p);
 }
 
 template<typename mT, typename tT, typename T1, typename T2>
 statslib_inline
 mT
-qlnorm(const ArmaGen<mT,tT>& X, const T1 mu_par, const T2 sigma_par)
+qlnorm(const ArmaGen<mT,tT>& X, const T1 mu_par, const T2 sigma_par, const bool lower_tail, const bool log_p)
 {
-    return qlnorm(X.eval(),mu_par,sigma_par);
+    return qlnorm(X.eval(),mu_par,sigma_par,lower_tail,log_p);
 }
 #endif
 
@@ -171,6 +194,8 @@ qlnorm(const ArmaGen<mT,tT>& X, const T1 mu_par, const T2 sigma_par)
  * @param X a matrix of input values.
  * @param mu_par the location parameter, a real-valued input.
  * @param sigma_par the scale parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  *
@@ -184,9 +209,9 @@ qlnorm(const ArmaGen<mT,tT>& X, const T1 mu_par, const T2 sigma_par)
 template<typename eT, typename T1, typename T2, typename rT, bool To>
 statslib_inline
 BlazeMat<rT,To>
-qlnorm(const BlazeMat<eT,To>& X, const T1 mu_par, const T2 sigma_par)
+qlnorm(const BlazeMat<eT,To>& X, const T1 mu_par, const T2 sigma_par, const bool lower_tail, const bool log_p)
 {
-    BLAZE_DIST_FN(qlnorm_vec,mu_par,sigma_par);
+    BLAZE_DIST_FN(qlnorm_vec,mu_par,sigma_par,lower_tail,log_p);
 }
 #endif
 
@@ -196,6 +221,8 @@ qlnorm(const BlazeMat<eT,To>& X, const T1 mu_par, const T2 sigma_par)
  * @param X a matrix of input values.
  * @param mu_par the location parameter, a real-valued input.
  * @param sigma_par the scale parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -209,8 +236,8 @@ qlnorm(const BlazeMat<eT,To>& X, const T1 mu_par, const T2 sigma_par)
 template<typename eT, typename T1, typename T2, typename rT, int iTr, int iTc>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-qlnorm(const EigenMat<eT,iTr,iTc>& X, const T1 mu_par, const T2 sigma_par)
+qlnorm(const EigenMat<eT,iTr,iTc>& X, const T1 mu_par, const T2 sigma_par, const bool lower_tail, const bool log_p)
 {
-    EIGEN_DIST_FN(qlnorm_vec,mu_par,sigma_par);
+    EIGEN_DIST_FN(qlnorm_vec,mu_par,sigma_par,lower_tail,log_p);
 }
 #endif
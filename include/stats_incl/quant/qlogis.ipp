@@ -31,22 +31,22 @@ namespace internal
 template<typename T>
 statslib_constexpr
 T
-qlogis_compute(const T p, const T mu_par, const T sigma_par)
+qlogis_compute(const T p, const T mu_par, const T sigma_par, const bool lower_tail, const bool log_p)
 noexcept
 {
-    return( mu_par + sigma_par*stmath::log(p/(T(1) - p)) );
+    return( mu_par + sigma_par*(log_prob_lower(p,lower_tail,log_p) - log_prob_upper(p,lower_tail,log_p)) );
 }
 
 template<typename T>
 statslib_constexpr
 T
-qlogis_vals_check(const T p, const T mu_par, const T sigma_par)
+qlogis_vals_check(const T p, const T mu_par, const T sigma_par, const bool lower_tail, const bool log_p)
 noexcept
 {
     return( !logis_sanity_check(mu_par,sigma_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            !prob_val_check(p) ? \
+            !prob_val_check(p,log_p) ? \
                 STLIM<T>::quiet_NaN() :
             //
             GCINT::is_posinf(sigma_par) ? \
@@ -55,25 +55,25 @@ noexcept
             sigma_par == T(0) ? \
                 mu_par :
             //
-            p == T(0) ? \
+            prob_lower_is_zero(p,lower_tail,log_p) ? \
                 GCINT::is_posinf(mu_par) ? \
                       STLIM<T>::quiet_NaN() :
                     - STLIM<T>::infinity() :
-            p == T(1) ? \
+            prob_upper_is_zero(p,lower_tail,log_p) ? \
                 GCINT::is_neginf(mu_par) ? \
                     STLIM<T>::quiet_NaN() :
                     STLIM<T>::infinity() :
             //
-            qlogis_compute(p,mu_par,sigma_par) );
+            qlogis_compute(p,mu_par,sigma_par,lower_tail,log_p) );
 }
 
 template<typename T1, typename T2, typename T3, typename TC = common_return_t<T1,T2,T3>>
 statslib_constexpr
 TC
-qlogis_type_check(const T1 p, const T2 mu_par, const T3 sigma_par)
+qlogis_type_check(const T1 p, const T2 mu_par, const T3 sigma_par, const bool lower_tail, const bool log_p)
 noexcept
 {
-    return qlogis_vals_check(static_cast<TC>(p),static_cast<TC>(mu_par),static_cast<TC>(sigma_par));
+    return qlogis_vals_check(static_cast<TC>(p),static_cast<TC>(mu_par),static_cast<TC>(sigma_par),lower_tail,log_p);
 }
 
 }
@@ -84,6 +84,8 @@ noexcept
  * @param p a real-valued input.
  * @param mu_par the location parameter, a real-valued input.
  * @param sigma_par the scale parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return the quantile function evaluated at \c p.
  * 
@@ -94,10 +96,10 @@ noexcept
 template<typename T1, typename T2, typename T3>
 statslib_constexpr
 common_return_t<T1,T2,T3>
-qlogis(const T1 p, const T2 mu_par, const T3 sigma_par)
+qlogis(const T1 p, const T2 mu_par, const T3 sigma_par, const bool lower_tail, const bool log_p)
 noexcept
 {
-    return internal::qlogis_type_check(p,mu_par,sigma_par);
+    return internal::qlogis_type_check(p,mu_par,sigma_par,lower_tail,log_p);
 }
 
 //
@@ -110,10 +112,10 @@ namespace internal
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 void
-qlogis_vec(const eT* __stats_pointer_settings__ vals_in, const T1 mu_par, const T2 sigma_par, 
+qlogis_vec(const eT* __stats_pointer_settings__ vals_in, const T1 mu_par, const T2 sigma_par, const bool lower_tail, const bool log_p, 
                  rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(qlogis,vals_in,vals_out,num_elem,mu_par,sigma_par);
+    EVAL_DIST_FN_VEC(qlogis,vals_in,vals_out,num_elem,mu_par,sigma_par,lower_tail,log_p);
 }
 #endif
 
@@ -125,6 +127,8 @@ qlogis_vec(const eT* __stats_pointer_settings__ vals_in, const T1 mu_par, const
  * @param x a standard vector.
  * @param mu_par the location parameter, a real-valued input.
  * @param sigma_par the scale parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return a vector of quantile values corresponding to the elements of \c x.
  * 
@@ -139,9 +143,9 @@ qlogis_vec(const eT* __stats_pointer_settings__ vals_in, const T1 mu_par, const
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 std::vector<rT>
-qlogis(const std::vector<eT>& x, const T1 mu_par, const T2 sigma_par)
+qlogis(const std::vector<eT>& x, const T1 mu_par, const T2 sigma_par, const bool lower_tail, const bool log_p)
 {
-    STDVEC_DIST_FN(qlogis_vec,mu_par,sigma_par);
+    STDVEC_DIST_FN(qlogis_vec,mu_par,sigma_par,lower_tail,log_p);
 }
 #endif
 
@@ -151,6 +155,8 @@ qlogis(const std::vector<eT>& x, const T1 mu_par, const T2 sigma_par)
  * @param X a matrix of input values.
  * @param mu_par the location parameter, a real-valued input.
  * @param sigma_par the scale parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -166,17 +172,17 @@ qlogis(const std::vector<eT>& x, const T1 mu_par, const T2 sigma_par)
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 ArmaMat<rT>
-qlogis(const ArmaMat<eT>& X, const T1 mu_par, const T2 sigma_par)
+qlogis(const ArmaMat<eT>& X, const T1 mu_par, const T2 sigma_par, const bool lower_tail, const bool log_p)
 {
-    ARMA_DIST_FN(qlogis_vec,mu_par,sigma_par);
+    ARMA_DIST_FN(qlogis_vec,mu_par,sigma_par,lower_tail,log_p);
 }
 
 template<typename mT, typename tT, typename T1, typename T2>
 statslib_inline
 mT
-qlogis(const ArmaGen<mT,tT>& X, const T1 mu_par, const T2 sigma_par)
+qlogis(const ArmaGen<mT,tT>& X, const T1 mu_par, const T2 sigma_par, const bool lower_tail, const bool log_p)
 {
-    return qlogis(X.eval(),mu_par,sigma_par);
+    return qlogis(X.eval(),mu_par,sigma_par,lower_tail,log_p);
 }
 #endif
 
@@ -186,6 +192,8 @@ qlogis(const ArmaGen<mT,tT>& X, const T1 mu_par, const T2 sigma_par)
  * @param X a matrix of input values.
  * @param mu_par the location parameter, a real-valued input.
  * @param sigma_par the scale parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -199,9 +207,9 @@ qlogis(const ArmaGen<mT,tT>& X, const T1 mu_par, const T2 sigma_par)
 template<typename eT, typename T1, typename T2, typename rT, bool To>
 statslib_inline
 BlazeMat<rT,To>
-qlogis(const BlazeMat<eT,To>& X, const T1 mu_par, const T2 sigma_par)
+qlogis(const BlazeMat<eT,To>& X, const T1 mu_par, const T2 sigma_par, const bool lower_tail, const bool log_p)
 {
-    BLAZE_DIST_FN(qlogis_vec,mu_par,sigma_par);
+    BLAZE_DIST_FN(qlogis_vec,mu_par,sigma_par,lower_tail,log_p);
 }
 #endif
 
@@ -211,6 +219,8 @@ qlogis(const BlazeMat<eT,To>& X, const T1 mu_par, const T2 sigma_par)
  * @param X a matrix of input values.
  * @param mu_par the location parameter, a real-valued input.
  * @param sigma_par the scale parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -224,8 +234,8 @@ qlogis(const BlazeMat<eT,To>& X, const T1 mu_par, const T2 sigma_par)
 template<typename eT, typename T1, typename T2, typename rT, int iTr, int iTc>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-qlogis(const EigenMat<eT,iTr,iTc>& X, const T1 mu_par, const T2 sigma_par)
+qlogis(const EigenMat<eT,iTr,iTc>& X, const T1 mu_par, const T2 sigma_par, const bool lower_tail, const bool log_p)
 {
-    EIGEN_DIST_FN(qlogis_vec,mu_par,sigma_par);
+    EIGEN_DIST_FN(qlogis_vec,mu_par,sigma_par,lower_tail,log_p);
 }
 #endif
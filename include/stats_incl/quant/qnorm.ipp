@@ -28,25 +28,54 @@
 namespace internal
 {
 
+// q = P(X <= x) - 1/2, formed without cancellation from whichever tail p describes
+
+template<typename T>
+statslib_constexpr
+T
+qnorm_ppnd_q(const T p, const bool lower_tail, const bool log_p)
+noexcept
+{
+    return( lower_tail ? \
+                prob_lower(p,lower_tail,log_p) - T(0.5) :
+                T(0.5) - prob_upper(p,lower_tail,log_p) );
+}
+
+// Wichura's algorithm AS241 (PPND16; see misc/special_fns), with r = sqrt(-log(min(p, 1 - p))) in the tails
+// taken directly from log-probabilities
+
+template<typename T>
+statslib_constexpr
+T
+qnorm_ppnd(const T q, const T p, const bool lower_tail, const bool log_p)
+noexcept
+{
+    return( stmath::abs(q) <= T(0.425) ? \
+                ppnd16_central(q, T(0.180625) - q*q) :
+            q < T(0) ? \
+                - ppnd16_tail(stmath::sqrt(- log_prob_lower(p,lower_tail,log_p))) :
+                  ppnd16_tail(stmath::sqrt(- log_prob_upper(p,lower_tail,log_p))) );
+}
+
 template<typename T>
 statslib_constexpr
 T
-qnorm_compute(const T p, const T mu_par, const T sigma_par)
+qnorm_compute(const T p, const T mu_par, const T sigma_par, const bool lower_tail, const bool log_p)
 noexcept
 {
-    return( mu_par + T(GCEM_SQRT_2)*sigma_par*gcem::erf_inv( T(2)*p - T(1) ) );
+    return( mu_par + sigma_par*qnorm_ppnd(qnorm_ppnd_q(p,lower_tail,log_p),p,lower_tail,log_p) );
 }
 
 template<typename T>
 statslib_constexpr
 T
-qnorm_vals_check(const T p, const T mu_par, const T sigma_par)
+qnorm_vals_check(const T p, const T mu_par, const T sigma_par, const bool lower_tail, const bool log_p)
 noexcept
 {
     return( !logis_sanity_check(mu_par,sigma_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            !prob_val_check(p) ? \
+            !prob_val_check(p,log_p) ? \
                 STLIM<T>::quiet_NaN() :
             //
             GCINT::is_posinf(sigma_par) ? \
@@ -55,25 +84,25 @@ noexcept
             sigma_par == T(0) ? \
                 mu_par :
             //
-            p == T(0) ? \
+            prob_lower_is_zero(p,lower_tail,log_p) ? \
                 GCINT::is_posinf(mu_par) ? \
                       STLIM<T>::quiet_NaN() :
                     - STLIM<T>::infinity() :
-            p == T(1) ? \
+            prob_upper_is_zero(p,lower_tail,log_p) ? \
                 GCINT::is_neginf(mu_par) ? \
                     STLIM<T>::quiet_NaN() :
                     STLIM<T>::infinity() :
             //
-            qnorm_compute(p,mu_par,sigma_par) );
+            qnorm_compute(p,mu_par,sigma_par,lower_tail,log_p) );
 }
 
 template<typename T1, typename T2, typename T3, typename TC = common_return_t<T1,T2,T3>>
 statslib_constexpr
 TC
-qnorm_type_check(const T1 p, const T2 mu_par, const T3 sigma_par)
+qnorm_type_check(const T1 p, const T2 mu_par, const T3 sigma_par, const bool lower_tail, const bool log_p)
 noexcept
 {
-    return qnorm_vals_check(static_cast<TC>(p),static_cast<TC>(mu_par),static_cast<TC>(sigma_par));
+    return qnorm_vals_check(static_cast<TC>(p),static_cast<TC>(mu_par),static_cast<TC>(sigma_par),lower_tail,log_p);
 }
 
 }
@@ -84,6 +113,8 @@ noexcept
  * @param p a real-valued input.
  * @param mu_par the mean parameter, a real-valued input.
  * @param sigma_par the standard deviation parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return the quantile function evaluated at \c p.
  *
@@ -94,16 +125,18 @@ noexcept
 template<typename T1, typename T2, typename T3>
 statslib_constexpr
 common_return_t<T1,T2,T3>
-qnorm(const T1 p, const T2 mu_par, const T3 sigma_par)
+qnorm(const T1 p, const T2 mu_par, const T3 sigma_par, const bool lower_tail, const bool log_p)
 noexcept
 {
-    return internal::qnorm_type_check(p,mu_par,sigma_par);
+    return internal::qnorm_type_check(p,mu_par,sigma_par,lower_tail,log_p);
 }
 
 /**
  * Quantile function of the Standard Normal distribution
  *
  * @param p a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return the quantile function evaluated at \c p.
  *
@@ -114,10 +147,10 @@ noexcept
 template<typename T>
 statslib_constexpr
 return_t<T>
-qnorm(const T p)
+qnorm(const T p, const bool lower_tail, const bool log_p)
 noexcept
 {
-    return qnorm(p,return_t<T>(0),return_t<T>(1));
+    return qnorm(p,return_t<T>(0),return_t<T>(1),lower_tail,log_p);
 }
 
 //
@@ -127,13 +160,71 @@ namespace internal
 {
 
 #ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+// standard normal quantiles: near the median, |P(X <= x) - 1/2| <= 0.425, through the batch erf_inv, with
+// Phi^{-1}(p) = sqrt(2) erf_inv(2p - 1); in the tails, 2p - 1 would round away the digits of min(p, 1 - p), so
+// these go through the batch normal quantile, which works from the tail given. Probabilities of 0 and 1, and
+// invalid inputs, come back non-finite for the caller to resolve.
+
+template<typename eT, typename rT>
+statslib_inline
+void
+qnorm_std_vec(const eT* __stats_pointer_settings__ vals_in, const bool lower_tail, const bool log_p, 
+                    rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    std::vector<rT> central_vals, tail_vals;
+    std::vector<ullint_t> central_inds, tail_inds;
+
+    for (ullint_t j=ullint_t(0); j < num_elem; ++j)
+    {
+        const rT p_j = static_cast<rT>(vals_in[j]);
+        const rT p_tail = log_p ? std::exp(p_j) : p_j;
+        const rT q_j = lower_tail ? p_tail - rT(0.5) : rT(0.5) - p_tail;
+
+        if (std::abs(q_j) <= rT(0.425)) {
+            central_vals.push_back(rT(2) * q_j);
+            central_inds.push_back(j);
+        } else {
+            tail_vals.push_back(p_j);
+            tail_inds.push_back(j);
+        }
+    }
+
+    erf_inv_vec(central_vals.data(),central_vals.data(),central_vals.size());
+    norm_quantile_vec(tail_vals.data(),lower_tail,log_p,tail_vals.data(),tail_vals.size());
+
+    for (ullint_t k=ullint_t(0); k < central_inds.size(); ++k)
+    {
+        vals_out[central_inds[k]] = rT(GCEM_SQRT_2) * central_vals[k];
+    }
+
+    for (ullint_t k=ullint_t(0); k < tail_inds.size(); ++k)
+    {
+        vals_out[tail_inds[k]] = tail_vals[k];
+    }
+}
+
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 void
-qnorm_vec(const eT* __stats_pointer_settings__ vals_in, const T1 mu_par, const T2 sigma_par, 
+qnorm_vec(const eT* __stats_pointer_settings__ vals_in, const T1 mu_par, const T2 sigma_par, const bool lower_tail, const bool log_p, 
                 rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(qnorm,vals_in,vals_out,num_elem,mu_par,sigma_par);
+    const rT mu_r = static_cast<rT>(mu_par);
+    const rT sigma_r = static_cast<rT>(sigma_par);
+
+    if (!GCINT::all_finite(mu_r,sigma_r) || !(sigma_r > rT(0))) {
+        EVAL_DIST_FN_VEC(qnorm,vals_in,vals_out,num_elem,mu_par,sigma_par,lower_tail,log_p);
+        return;
+    }
+
+    qnorm_std_vec(vals_in,lower_tail,log_p,vals_out,num_elem);
+
+    for (ullint_t j=ullint_t(0); j < num_elem; ++j)
+    {
+        vals_out[j] = GCINT::is_finite(vals_out[j]) ? mu_r + sigma_r*vals_out[j] :
+                                                      qnorm(vals_in[j],mu_par,sigma_par,lower_tail,log_p);
+    }
 }
 #endif
 
@@ -145,6 +236,8 @@ qnorm_vec(const eT* __stats_pointer_settings__ vals_in, const T1 mu_par, const T
  * @param x a standard vector.
  * @param mu_par the mean parameter, a real-valued input.
  * @param sigma_par the standard deviation parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return a vector of quantile values corresponding to the elements of \c x.
  * 
@@ -159,9 +252,9 @@ qnorm_vec(const eT* __stats_pointer_settings__ vals_in, const T1 mu_par, const T
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 std::vector<rT>
-qnorm(const std::vector<eT>& x, const T1 mu_par, const T2 sigma_par)
+qnorm(const std::vector<eT>& x, const T1 mu_par, const T2 sigma_par, const bool lower_tail, const bool log_p)
 {
-    STDVEC_DIST_FN(qnorm_vec,mu_par,sigma_par);
+    STDVEC_DIST_FN(qnorm_vec,mu_par,sigma_par,lower_tail,log_p);
 }
 #endif
 
@@ -171,6 +264,8 @@ qnorm(const std::vector<eT>& x, const T1 mu_par, const T2 sigma_par)
  * @param X a matrix of input values.
  * @param mu_par the mean parameter, a real-valued input.
  * @param sigma_par the standard deviation parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -186,17 +281,17 @@ qnorm(const std::vector<eT>& x, const T1 mu_par, const T2 sigma_par)
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 ArmaMat<rT>
-qnorm(const ArmaMat<eT>& X, const T1 mu_par, const T2 sigma_par)
+qnorm(const ArmaMat<eT>& X, const T1 mu_par, const T2 sigma_par, const bool lower_tail, const bool log_p)
 {
-    ARMA_DIST_FN(qnorm_vec,mu_par,sigma_par);
+    ARMA_DIST_FN(qnorm_vec,mu_par,sigma_par,lower_tail,log_p);
 }
 
 template<typename mT, typename tT, typename T1, typename T2>
 statslib_inline
 mT
-qnorm(const ArmaGen<mT,tT>& X, const T1 mu_par, const T2 sigma_par)
+qnorm(const ArmaGen<mT,tT>& X, const T1 mu_par, const T2 sigma_par, const bool lower_tail, const bool log_p)
 {
-    return qnorm(X.eval(),mu_par,sigma_par);
+    return qnorm(X.eval(),mu_par,sigma_par,lower_tail,log_p);
 }
 #endif
 
@@ -206,6 +301,8 @@ qnorm(const ArmaGen<mT,tT>& X, const T1 mu_par, const T2 sigma_par)
  * @param X a matrix of input values.
  * @param mu_par the mean parameter, a real-valued input.
  * @param sigma_par the standard deviation parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -219,9 +316,9 @@ qnorm(const ArmaGen<mT,tT>& X, const T1 mu_par, const T2 sigma_par)
 template<typename eT, typename T1, typename T2, typename rT, bool To>
 statslib_inline
 BlazeMat<rT,To>
-qnorm(const BlazeMat<eT,To>& X, const T1 mu_par, const T2 sigma_par)
+qnorm(const BlazeMat<eT,To>& X, const T1 mu_par, const T2 sigma_par, const bool lower_tail, const bool log_p)
 {
-    BLAZE_DIST_FN(qnorm_vec,mu_par,sigma_par);
+    BLAZE_DIST_FN(qnorm_vec,mu_par,sigma_par,lower_tail,log_p);
 }
 #endif
 
@@ -231,6 +328,8 @@ qnorm(const BlazeMat<eT,To>& X, const T1 mu_par, const T2 sigma_par)
  * @param X a matrix of input values.
  * @param mu_par the mean parameter, a real-valued input.
  * @param sigma_par the standard deviation parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -244,8 +343,8 @@ qnorm(const BlazeMat<eT,To>& X, const T1 mu_par, const T2 sigma_par)
 template<typename eT, typename T1, typename T2, typename rT, int iTr, int iTc>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-qnorm(const EigenMat<eT,iTr,iTc>& X, const T1 mu_par, const T2 sigma_par)
+qnorm(const EigenMat<eT,iTr,iTc>& X, const T1 mu_par, const T2 sigma_par, const bool lower_tail, const bool log_p)
 {
-    EIGEN_DIST_FN(qnorm_vec,mu_par,sigma_par);
+    EIGEN_DIST_FN(qnorm_vec,mu_par,sigma_par,lower_tail,log_p);
 }
 #endif
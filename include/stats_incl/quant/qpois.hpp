@@ -31,7 +31,7 @@
 template<typename T1, typename T2>
 statslib_constexpr
 common_return_t<T1,T2>
-qpois(const T1 p, const T2 rate_par) noexcept;
+qpois(const T1 p, const T2 rate_par, const bool lower_tail = true, const bool log_p = false) noexcept;
 
 //
 // vector/matrix input
@@ -40,33 +40,33 @@ qpois(const T1 p, const T2 rate_par) noexcept;
 template<typename eT, typename T1, typename rT = common_return_t<eT,T1>>
 statslib_inline
 std::vector<rT>
-qpois(const std::vector<eT>& x, const T1 rate_par);
+qpois(const std::vector<eT>& x, const T1 rate_par, const bool lower_tail = true, const bool log_p = false);
 #endif
 
 #ifdef STATS_ENABLE_ARMA_WRAPPERS
 template<typename eT, typename T1, typename rT = common_return_t<eT,T1>>
 statslib_inline
 ArmaMat<rT>
-qpois(const ArmaMat<eT>& X, const T1 rate_par);
+qpois(const ArmaMat<eT>& X, const T1 rate_par, const bool lower_tail = true, const bool log_p = false);
 
 template<typename mT, typename tT, typename T1>
 statslib_inline
 mT
-qpois(const ArmaGen<mT,tT>& X, const T1 rate_par);
+qpois(const ArmaGen<mT,tT>& X, const T1 rate_par, const bool lower_tail = true, const bool log_p = false);
 #endif
 
 #ifdef STATS_ENABLE_BLAZE_WRAPPERS
 template<typename eT, typename T1, typename rT = common_return_t<eT,T1>, bool To = blaze::columnMajor>
 statslib_inline
 BlazeMat<rT,To>
-qpois(const BlazeMat<eT,To>& X, const T1 rate_par);
+qpois(const BlazeMat<eT,To>& X, const T1 rate_par, const bool lower_tail = true, const bool log_p = false);
 #endif
 
 #ifdef STATS_ENABLE_EIGEN_WRAPPERS
 template<typename eT, typename T1, typename rT = common_return_t<eT,T1>, int iTr = Eigen::Dynamic, int iTc = Eigen::Dynamic>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-qpois(const EigenMat<eT,iTr,iTc>& X, const T1 rate_par);
+qpois(const EigenMat<eT,iTr,iTc>& X, const T1 rate_par, const bool lower_tail = true, const bool log_p = false);
 #endif
 
 //
@@ -31,11 +31,11 @@ namespace internal
 template<typename T>
 statslib_constexpr
 T
-qpois_compute_right_search(const T p, const T rate_par, const T value, const llint_t count)
+qpois_compute_right_search(const T p, const T rate_par, const T value, const llint_t count, const bool lower_tail)
 noexcept
-{
-    return( value <= p ? \
-                qpois_compute_right_search(p,rate_par, ppois(count,rate_par,false), count + llint_t(1)) : 
+{   // with lower_tail = false, value and p are upper-tail probabilities, P(X > x)
+    return( (lower_tail ? value <= p : value > p) ? \
+                qpois_compute_right_search(p,rate_par, ppois(count,rate_par,false,lower_tail), count + llint_t(1), lower_tail) : 
             // else
             count > llint_t(0) ? 
                 static_cast<T>(count - llint_t(1)) : 
@@ -45,53 +45,53 @@ noexcept
 template<typename T>
 statslib_constexpr
 T
-qpois_compute_search_begin(const T p, const T rate_par, const llint_t count)
+qpois_compute_search_begin(const T p, const T rate_par, const llint_t count, const bool lower_tail)
 noexcept
 {
-    return qpois_compute_right_search(p,rate_par, ppois(count,rate_par,false), count);
+    return qpois_compute_right_search(p,rate_par, ppois(count,rate_par,false,lower_tail), count, lower_tail);
 }
 
 template<typename T>
 statslib_constexpr
 llint_t
-qpois_trunc_normal_approx(const T p, const T rate_par)
+qpois_trunc_normal_approx(const T p, const T rate_par, const bool lower_tail, const bool log_p)
 noexcept
 {
-    return static_cast<llint_t>( stmath::max( T(0), qnorm(p,rate_par,stmath::sqrt(rate_par)) - T(3) ) );
+    return static_cast<llint_t>( stmath::max( T(0), qnorm(p,rate_par,stmath::sqrt(rate_par),lower_tail,log_p) - T(3) ) );
 }
 
 template<typename T>
 statslib_constexpr
 T
-qpois_vals_check(const T p, const T rate_par)
+qpois_vals_check(const T p, const T rate_par, const bool lower_tail, const bool log_p)
 noexcept
 {
     return( !pois_sanity_check(rate_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            !prob_val_check(p) ? \
+            !prob_val_check(p,log_p) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            p == T(0) ? \
+            prob_lower_is_zero(p,lower_tail,log_p) ? \
                 T(0) :
             STLIM<T>::epsilon() > rate_par ? \
                 T(0) :
-            p == T(1) ? \
+            prob_upper_is_zero(p,lower_tail,log_p) ? \
                 STLIM<T>::infinity() :
             // rate < 11
             rate_par < T(11) ? \
-                qpois_compute_right_search(p,rate_par,T(0),llint_t(0)) :
+                qpois_compute_right_search(exp_if(p,log_p),rate_par,tail_if(T(0),lower_tail),llint_t(0),lower_tail) :
             // else use a normal approximation
-                qpois_compute_search_begin(p,rate_par,qpois_trunc_normal_approx(p,rate_par)) );
+                qpois_compute_search_begin(exp_if(p,log_p),rate_par,qpois_trunc_normal_approx(p,rate_par,lower_tail,log_p),lower_tail) );
 }
 
 template<typename T1, typename T2, typename TC = common_return_t<T1,T2>>
 statslib_constexpr
 TC
-qpois_type_check(const T1 p, const T2 rate_par)
+qpois_type_check(const T1 p, const T2 rate_par, const bool lower_tail, const bool log_p)
 noexcept
 {
-    return qpois_vals_check(static_cast<TC>(p),static_cast<TC>(rate_par));
+    return qpois_vals_check(static_cast<TC>(p),static_cast<TC>(rate_par),lower_tail,log_p);
 }
 
 }
@@ -101,6 +101,8 @@ noexcept
  *
  * @param p a real-valued input.
  * @param rate_par the rate parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return the quantile function evaluated at \c p.
  * 
@@ -111,10 +113,10 @@ noexcept
 template<typename T1, typename T2>
 statslib_constexpr
 common_return_t<T1,T2>
-qpois(const T1 p, const T2 rate_par)
+qpois(const T1 p, const T2 rate_par, const bool lower_tail, const bool log_p)
 noexcept
 {
-    return internal::qpois_type_check(p,rate_par);
+    return internal::qpois_type_check(p,rate_par,lower_tail,log_p);
 }
 
 //
@@ -124,13 +126,72 @@ namespace internal
 {
 
 #ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+// sorted input: the quantiles are nondecreasing, so carry q, F(q), and f(q) forward and step
+// up the pmf recurrence, restarting from a scalar evaluation after long runs or pmf underflow
+
+template<typename eT, typename rT>
+statslib_inline
+void
+qpois_vec_sorted(const eT* __stats_pointer_settings__ vals_in, const rT rate_par, 
+                       rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    const llint_t max_steps = llint_t(64);
+
+    bool anchored = false;
+    llint_t q_val = llint_t(0);
+    rT cdf_val = rT(0);
+    rT pmf_val = rT(0);
+
+    for (ullint_t j=ullint_t(0); j < num_elem; ++j)
+    {
+        const rT p_j = static_cast<rT>(vals_in[j]);
+
+        if (p_j == rT(0) || p_j == rT(1)) {
+            vals_out[j] = qpois(p_j,rate_par);
+            continue;
+        }
+
+        llint_t n_steps = llint_t(0);
+
+        if (anchored) {
+            // smallest q such that F(q) > p
+            while (cdf_val <= p_j && n_steps < max_steps && pmf_val >= STLIM<rT>::min()) {
+                ++q_val;
+                pmf_val *= rate_par / rT(q_val);
+                cdf_val += pmf_val;
+                ++n_steps;
+            }
+        }
+
+        if (!anchored || cdf_val <= p_j)
+        {
+            q_val = static_cast<llint_t>(qpois(p_j,rate_par));
+            cdf_val = ppois(q_val,rate_par,false);
+            pmf_val = std::exp(ppois_log_pmf(q_val,rate_par));
+            anchored = true;
+        }
+
+        vals_out[j] = static_cast<rT>(q_val);
+    }
+}
+
 template<typename eT, typename T1, typename rT>
 statslib_inline
 void
-qpois_vec(const eT* __stats_pointer_settings__ vals_in, const T1 rate_par, 
+qpois_vec(const eT* __stats_pointer_settings__ vals_in, const T1 rate_par, const bool lower_tail, const bool log_p, 
                  rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(qpois,vals_in,vals_out,num_elem,rate_par);
+    const rT rate_r = static_cast<rT>(rate_par);
+
+    if (lower_tail && !log_p && pois_sanity_check(rate_r) && rate_r >= STLIM<rT>::epsilon() && !GCINT::is_posinf(rate_r) 
+            && is_sorted_vec(vals_in,num_elem) && vals_in[0] >= eT(0) && vals_in[num_elem-1] <= eT(1))
+    {
+        qpois_vec_sorted(vals_in,rate_r,vals_out,num_elem);
+        return;
+    }
+
+    EVAL_DIST_FN_VEC(qpois,vals_in,vals_out,num_elem,rate_par,lower_tail,log_p);
 }
 #endif
 
@@ -141,6 +202,8 @@ qpois_vec(const eT* __stats_pointer_settings__ vals_in, const T1 rate_par,
  *
  * @param x a standard vector.
  * @param rate_par the rate parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return a vector of quantile values corresponding to the elements of \c x.
  * 
@@ -155,9 +218,9 @@ qpois_vec(const eT* __stats_pointer_settings__ vals_in, const T1 rate_par,
 template<typename eT, typename T1, typename rT>
 statslib_inline
 std::vector<rT>
-qpois(const std::vector<eT>& x, const T1 rate_par)
+qpois(const std::vector<eT>& x, const T1 rate_par, const bool lower_tail, const bool log_p)
 {
-    STDVEC_DIST_FN(qpois_vec,rate_par);
+    STDVEC_DIST_FN(qpois_vec,rate_par,lower_tail,log_p);
 }
 #endif
 
@@ -166,6 +229,8 @@ qpois(const std::vector<eT>& x, const T1 rate_par)
  *
  * @param X a matrix of input values.
  * @param rate_par the rate parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -181,17 +246,17 @@ qpois(const std::vector<eT>& x, const T1 rate_par)
 template<typename eT, typename T1, typename rT>
 statslib_inline
 ArmaMat<rT>
-qpois(const ArmaMat<eT>& X, const T1 rate_par)
+qpois(const ArmaMat<eT>& X, const T1 rate_par, const bool lower_tail, const bool log_p)
 {
-    ARMA_DIST_FN(qpois_vec,rate_par);
+    ARMA_DIST_FN(qpois_vec,rate_par,lower_tail,log_p);
 }
 
 template<typename mT, typename tT, typename T1>
 statslib_inline
 mT
-qpois(const ArmaGen<mT,tT>& X, const T1 rate_par)
+qpois(const ArmaGen<mT,tT>& X, const T1 rate_par, const bool lower_tail, const bool log_p)
 {
-    return qpois(X.eval(),rate_par);
+    return qpois(X.eval(),rate_par,lower_tail,log_p);
 }
 #endif
 
@@ -200,6 +265,8 @@ qpois(const ArmaGen<mT,tT>& X, const T1 rate_par)
  *
  * @param X a matrix of input values.
  * @param rate_par the rate parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -213,9 +280,9 @@ qpois(const ArmaGen<mT,tT>& X, const T1 rate_par)
 template<typename eT, typename T1, typename rT, bool To>
 statslib_inline
 BlazeMat<rT,To>
-qpois(const BlazeMat<eT,To>& X, const T1 rate_par)
+qpois(const BlazeMat<eT,To>& X, const T1 rate_par, const bool lower_tail, const bool log_p)
 {
-    BLAZE_DIST_FN(qpois_vec,rate_par);
+    BLAZE_DIST_FN(qpois_vec,rate_par,lower_tail,log_p);
 }
 #endif
 
@@ -224,6 +291,8 @@ qpois(const BlazeMat<eT,To>& X, const T1 rate_par)
  *
  * @param X a matrix of input values.
  * @param rate_par the rate parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -237,8 +306,8 @@ qpois(const BlazeMat<eT,To>& X, const T1 rate_par)
 template<typename eT, typename T1, typename rT, int iTr, int iTc>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-qpois(const EigenMat<eT,iTr,iTc>& X, const T1 rate_par)
+qpois(const EigenMat<eT,iTr,iTc>& X, const T1 rate_par, const bool lower_tail, const bool log_p)
 {
-    EIGEN_DIST_FN(qpois_vec,rate_par);
+    EIGEN_DIST_FN(qpois_vec,rate_par,lower_tail,log_p);
 }
 #endif
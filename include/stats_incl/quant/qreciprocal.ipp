@@ -31,42 +31,44 @@ namespace internal
 template<typename T>
 statslib_constexpr
 T
-qreciprocal_compute(const T p, const T a_par, const T b_par)
+qreciprocal_compute(const T p, const T a_par, const T b_par, const bool lower_tail, const bool log_p)
 noexcept
 {
-    return( a_par * stmath::pow(b_par / a_par, p) );
+    return( prob_lower(p,lower_tail,log_p) <= T(0.5) ? \
+                a_par * stmath::pow(b_par / a_par, prob_lower(p,lower_tail,log_p)) :
+                b_par * stmath::pow(a_par / b_par, prob_upper(p,lower_tail,log_p)) );
 }
 
 template<typename T>
 statslib_constexpr
 T
-qreciprocal_vals_check(const T p, const T a_par, const T b_par)
+qreciprocal_vals_check(const T p, const T a_par, const T b_par, const bool lower_tail, const bool log_p)
 noexcept
 {
     return( !reciprocal_sanity_check(a_par,b_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            !prob_val_check(p) ? \
+            !prob_val_check(p,log_p) ? \
                 STLIM<T>::quiet_NaN() :
             //
             GCINT::any_inf(a_par,b_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            p == T(0) ? \
+            prob_lower_is_zero(p,lower_tail,log_p) ? \
                 a_par :
-            p == T(1) ? \
+            prob_upper_is_zero(p,lower_tail,log_p) ? \
                 b_par :
             //
-            qreciprocal_compute(p,a_par,b_par) );
+            qreciprocal_compute(p,a_par,b_par,lower_tail,log_p) );
 }
 
 template<typename T1, typename T2, typename T3, typename TC = common_return_t<T1,T2,T3>>
 statslib_constexpr
 TC
-qreciprocal_type_check(const T1 p, const T2 a_par, const T3 b_par)
+qreciprocal_type_check(const T1 p, const T2 a_par, const T3 b_par, const bool lower_tail, const bool log_p)
 noexcept
 {
-    return qreciprocal_vals_check(static_cast<TC>(p),static_cast<TC>(a_par),static_cast<TC>(b_par));
+    return qreciprocal_vals_check(static_cast<TC>(p),static_cast<TC>(a_par),static_cast<TC>(b_par),lower_tail,log_p);
 }
 
 }
@@ -77,6 +79,8 @@ noexcept
  * @param p a real-valued input.
  * @param a_par the lower bound parameter, a real-valued input.
  * @param b_par the upper bound parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return the quantile function evaluated at \c p.
  * 
@@ -87,10 +91,10 @@ noexcept
 template<typename T1, typename T2, typename T3>
 statslib_constexpr
 common_return_t<T1,T2,T3>
-qreciprocal(const T1 p, const T2 a_par, const T3 b_par)
+qreciprocal(const T1 p, const T2 a_par, const T3 b_par, const bool lower_tail, const bool log_p)
 noexcept
 {
-    return internal::qreciprocal_type_check(p,a_par,b_par);
+    return internal::qreciprocal_type_check(p,a_par,b_par,lower_tail,log_p);
 }
 
 //
@@ -103,10 +107,10 @@ namespace internal
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 void
-qreciprocal_vec(const eT* __stats_pointer_settings__ vals_in, const T1 a_par, const T2 b_par, 
+qreciprocal_vec(const eT* __stats_pointer_settings__ vals_in, const T1 a_par, const T2 b_par, const bool lower_tail, const bool log_p, 
                 rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(qreciprocal,vals_in,vals_out,num_elem,a_par,b_par);
+    EVAL_DIST_FN_VEC(qreciprocal,vals_in,vals_out,num_elem,a_par,b_par,lower_tail,log_p);
 }
 #endif
 
@@ -118,6 +122,8 @@ qreciprocal_vec(const eT* __stats_pointer_settings__ vals_in, const T1 a_par, co
  * @param x a standard vector.
  * @param a_par a real-valued shape parameter.
  * @param b_par a real-valued shape parameter.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return a vector of quantile values corresponding to the elements of \c x.
  * 
@@ -132,9 +138,9 @@ qreciprocal_vec(const eT* __stats_pointer_settings__ vals_in, const T1 a_par, co
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 std::vector<rT>
-qreciprocal(const std::vector<eT>& x, const T1 a_par, const T2 b_par)
+qreciprocal(const std::vector<eT>& x, const T1 a_par, const T2 b_par, const bool lower_tail, const bool log_p)
 {
-    STDVEC_DIST_FN(qreciprocal_vec,a_par,b_par);
+    STDVEC_DIST_FN(qreciprocal_vec,a_par,b_par,lower_tail,log_p);
 }
 #endif
 
@@ -144,6 +150,8 @@ qreciprocal(const std::vector<eT>& x, const T1 a_par, const T2 b_par)
  * @param X a matrix of input values.
  * @param a_par a real-valued shape parameter.
  * @param b_par a real-valued shape parameter.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -159,17 +167,17 @@ qreciprocal(const std::vector<eT>& x, const T1 a_par, const T2 b_par)
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 ArmaMat<rT>
-qreciprocal(const ArmaMat<eT>& X, const T1 a_par, const T2 b_par)
+qreciprocal(const ArmaMat<eT>& X, const T1 a_par, const T2 b_par, const bool lower_tail, const bool log_p)
 {
-    ARMA_DIST_FN(qreciprocal_vec,a_par,b_par);
+    ARMA_DIST_FN(qreciprocal_vec,a_par,b_par,lower_tail,log_p);
 }
 
 template<typename mT, typename tT, typename T1, typename T2>
 statslib_inline
 mT
-qreciprocal(const ArmaGen<mT,tT>& X, const T1 a_par, const T2 b_par)
+qreciprocal(const ArmaGen<mT,tT>& X, const T1 a_par, const T2 b_par, const bool lower_tail, const bool log_p)
 {
-    return qreciprocal(X.eval(),a_par,b_par);
+    return qreciprocal(X.eval(),a_par,b_par,lower_tail,log_p);
 }
 #endif
 
@@ -179,6 +187,8 @@ qreciprocal(const ArmaGen<mT,tT>& X, const T1 a_par, const T2 b_par)
  * @param X a matrix of input values.
  * @param a_par a real-valued shape parameter.
  * @param b_par a real-valued shape parameter.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -192,9 +202,9 @@ qreciprocal(const ArmaGen<mT,tT>& X, const T1 a_par, const T2 b_par)
 template<typename eT, typename T1, typename T2, typename rT, bool To>
 statslib_inline
 BlazeMat<rT,To>
-qreciprocal(const BlazeMat<eT,To>& X, const T1 a_par, const T2 b_par)
+qreciprocal(const BlazeMat<eT,To>& X, const T1 a_par, const T2 b_par, const bool lower_tail, const bool log_p)
 {
-    BLAZE_DIST_FN(qreciprocal_vec,a_par,b_par);
+    BLAZE_DIST_FN(qreciprocal_vec,a_par,b_par,lower_tail,log_p);
 }
 #endif
 
@@ -204,6 +214,8 @@ qreciprocal(const BlazeMat<eT,To>& X, const T1 a_par, const T2 b_par)
  * @param X a matrix of input values.
  * @param a_par a real-valued shape parameter.
  * @param b_par    a real-valued shape parameter.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -217,8 +229,8 @@ qreciprocal(const BlazeMat<eT,To>& X, const T1 a_par, const T2 b_par)
 template<typename eT, typename T1, typename T2, typename rT, int iTr, int iTc>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-qreciprocal(const EigenMat<eT,iTr,iTc>& X, const T1 a_par, const T2 b_par)
+qreciprocal(const EigenMat<eT,iTr,iTc>& X, const T1 a_par, const T2 b_par, const bool lower_tail, const bool log_p)
 {
-    EIGEN_DIST_FN(qreciprocal_vec,a_par,b_par);
+    EIGEN_DIST_FN(qreciprocal_vec,a_par,b_par,lower_tail,log_p);
 }
 #endif
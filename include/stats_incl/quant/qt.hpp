@@ -31,7 +31,7 @@
 template<typename T1, typename T2>
 statslib_constexpr
 common_return_t<T1,T2>
-qt(const T1 p, const T2 dof_par) noexcept;
+qt(const T1 p, const T2 dof_par, const bool lower_tail = true, const bool log_p = false) noexcept;
 
 //
 // vector/matrix input
@@ -40,33 +40,33 @@ qt(const T1 p, const T2 dof_par) noexcept;
 template<typename eT, typename T1, typename rT = common_return_t<eT,T1>>
 statslib_inline
 std::vector<rT>
-qt(const std::vector<eT>& x, const T1 dof_par);
+qt(const std::vector<eT>& x, const T1 dof_par, const bool lower_tail = true, const bool log_p = false);
 #endif
 
 #ifdef STATS_ENABLE_ARMA_WRAPPERS
 template<typename eT, typename T1, typename rT = common_return_t<eT,T1>>
 statslib_inline
 ArmaMat<rT>
-qt(const ArmaMat<eT>& X, const T1 dof_par);
+qt(const ArmaMat<eT>& X, const T1 dof_par, const bool lower_tail = true, const bool log_p = false);
 
 template<typename mT, typename tT, typename T1>
 statslib_inline
 mT 
-qt(const ArmaGen<mT,tT>& X, const T1 dof_par);
+qt(const ArmaGen<mT,tT>& X, const T1 dof_par, const bool lower_tail = true, const bool log_p = false);
 #endif
 
 #ifdef STATS_ENABLE_BLAZE_WRAPPERS
 template<typename eT, typename T1, typename rT = common_return_t<eT,T1>, bool To = blaze::columnMajor>
 statslib_inline
 BlazeMat<rT,To>
-qt(const BlazeMat<eT,To>& X, const T1 dof_par);
+qt(const BlazeMat<eT,To>& X, const T1 dof_par, const bool lower_tail = true, const bool log_p = false);
 #endif
 
 #ifdef STATS_ENABLE_EIGEN_WRAPPERS
 template<typename eT, typename T1, typename rT = common_return_t<eT,T1>, int iTr = Eigen::Dynamic, int iTc = Eigen::Dynamic>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-qt(const EigenMat<eT,iTr,iTc>& X, const T1 dof_par);
+qt(const EigenMat<eT,iTr,iTc>& X, const T1 dof_par, const bool lower_tail = true, const bool log_p = false);
 #endif
 
 //
@@ -251,41 +251,220 @@ noexcept
                   qt_int_main_iter(0U,2*p,dof_par,T(0),T(0),T(0),T(0)) );
 }
 
+// four degrees of freedom: with alpha = 4p(1-p) and q = cos(acos(sqrt(alpha))/3) / sqrt(alpha),
+// F^{-1}(p) = sign(p - 1/2) 2 sqrt(q - 1) (Shaw, 2006)
+
+template<typename T>
+statslib_constexpr
+T
+qt_dof4_q(const T alpha_sqrt)
+noexcept
+{
+    return( stmath::cos(stmath::acos(alpha_sqrt) / T(3)) / alpha_sqrt );
+}
+
+template<typename T>
+statslib_constexpr
+T
+qt_dof4_compute(const T p)
+noexcept
+{
+    return( p < T(0.5) ? \
+                - T(2) * stmath::sqrt(qt_dof4_q(stmath::sqrt(T(4)*p*(T(1) - p))) - T(1)) :
+                  T(2) * stmath::sqrt(qt_dof4_q(stmath::sqrt(T(4)*p*(T(1) - p))) - T(1)) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+qt_lower_compute(const T p, const T dof_par)
+noexcept
+{
+    return( dof_par == T(2) ? \
+                (2*p - T(1)) / stmath::sqrt(2*p*(T(1) - p)) :
+            dof_par == T(4) ? \
+                qt_dof4_compute(p) :
+            // else
+                qt_int_main(p,dof_par) );
+}
+
+// by symmetry, an upper-tail probability q gives x = -F^{-1}(q); the iteration above is most accurate
+// below 1/2, and 1 - p is exact for p >= 1/2, so the smaller tail is always the one inverted
+
+template<typename T>
+statslib_constexpr
+T
+qt_compute(const T p, const T dof_par, const bool lower_tail, const bool log_p)
+noexcept
+{
+    return( prob_upper(p,lower_tail,log_p) < T(0.5) ? \
+                - qt_lower_compute(prob_upper(p,lower_tail,log_p),dof_par) :
+                  qt_lower_compute(prob_lower(p,lower_tail,log_p),dof_par) );
+}
+
+// integer and large degrees of freedom, where pt has fast specialised paths: with u = min(p, 1 - p),
+// y = |F^{-1}(p)| solves log P(T <= -y) = log(u), refined by Newton steps on the log scale from an
+// initial value, so that tails far below the smallest double keep full relative precision
+
+template<typename T>
+statslib_constexpr
+T qt_tail_newton(const T log_u, const T dof_par, const T y, const int iter) noexcept;
+
+template<typename T>
+statslib_constexpr
+T
+qt_tail_newton_next(const T log_u, const T dof_par, const T y, const T y_new, const int iter)
+noexcept
+{
+    return( iter >= 50 ? \
+                y_new :
+            y_new < T(0) ? \
+                qt_tail_newton(log_u,dof_par,y/T(2),iter+1) :
+            //
+            stmath::abs(y_new - y) <= T(4)*STLIM<T>::epsilon()*y_new ? \
+                y_new :
+                qt_tail_newton(log_u,dof_par,y_new,iter+1) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+qt_tail_newton_step(const T log_u, const T dof_par, const T y, const T log_cdf)
+noexcept
+{
+    return( y + (log_cdf - log_u) * stmath::exp(log_cdf - dt(y,dof_par,true)) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+qt_tail_newton(const T log_u, const T dof_par, const T y, const int iter)
+noexcept
+{
+    return qt_tail_newton_next(log_u,dof_par,y,qt_tail_newton_step(log_u,dof_par,y,pt(-y,dof_par,true,true)),iter);
+}
+
+// initial values: Hill's iteration or the closed forms above, and, once u underflows, the leading
+// term of P(T <= -y) ~ K y^{-n}, K = Gamma((n+1)/2) n^{(n-1)/2} / (sqrt(pi) Gamma(n/2))
+
+template<typename T>
+statslib_constexpr
+T
+qt_int_tail_asymp(const T log_u, const T dof_par)
+noexcept
+{
+    return stmath::exp( ( stmath::lgamma((dof_par + T(1))/T(2)) + (dof_par - T(1))/T(2)*stmath::log(dof_par) \
+                            - T(0.5)*T(GCEM_LOG_PI) - stmath::lgamma(dof_par/T(2)) - log_u ) / dof_par );
+}
+
+template<typename T>
+statslib_constexpr
+T
+qt_int_tail_newton(const T log_u, const T dof_par, const T y_init)
+noexcept
+{   // Hill's iteration can overflow for u near the smallest double
+    return( GCINT::is_finite(y_init) ? \
+                qt_tail_newton(log_u,dof_par,y_init,0) :
+                qt_tail_newton(log_u,dof_par,qt_int_tail_asymp(log_u,dof_par),0) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+qt_int_tail_compute(const T log_u, const T dof_par)
+noexcept
+{
+    return( log_u < stmath::log(STLIM<T>::min()) ? \
+                qt_tail_newton(log_u,dof_par,qt_int_tail_asymp(log_u,dof_par),0) :
+            dof_par == T(4) ? \
+                - qt_dof4_compute(stmath::exp(log_u)) :
+                qt_int_tail_newton(log_u,dof_par,- qt_lower_compute(stmath::exp(log_u),dof_par)) );
+}
+
+// large degrees of freedom: the Cornish-Fisher expansion of t in terms of a normal quantile
+// (Abramowitz and Stegun, 26.7.5), then Newton steps on the normalizing transformation used by pt
+
+template<typename T>
+statslib_constexpr
+T
+qt_large_dof_init(const T z, const T dof_par)
+noexcept
+{
+    return( z + ( z*(z*z + T(1))/T(4) \
+                  + ( z*(T(3) + z*z*(T(16) + T(5)*z*z))/T(96) \
+                      + z*(- T(15) + z*z*(T(17) + z*z*(T(19) + T(3)*z*z)))/T(384)/dof_par ) / dof_par ) / dof_par );
+}
+
+template<typename T>
+statslib_constexpr
+T
+qt_large_dof_tail_compute(const T log_u, const T dof_par)
+noexcept
+{
+    return qt_tail_newton(log_u,dof_par,qt_large_dof_init(- qnorm(log_u,T(0),T(1),true,true),dof_par),0);
+}
+
+template<typename T>
+statslib_constexpr
+T
+qt_tail_compute(const T log_u, const T dof_par)
+noexcept
+{
+    return( dof_par > T(1e05) ? \
+                qt_large_dof_tail_compute(log_u,dof_par) :
+                qt_int_tail_compute(log_u,dof_par) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+qt_fast_compute(const T p, const T dof_par, const bool lower_tail, const bool log_p)
+noexcept
+{
+    return( prob_upper(p,lower_tail,log_p) < T(0.5) ? \
+                  qt_tail_compute(log_prob_upper(p,lower_tail,log_p),dof_par) :
+            prob_lower(p,lower_tail,log_p) < T(0.5) ? \
+                - qt_tail_compute(log_prob_lower(p,lower_tail,log_p),dof_par) :
+            // p = 1/2
+                T(0) );
+}
+
 template<typename T>
 statslib_constexpr
 T
-qt_vals_check(const T p, const T dof_par)
+qt_vals_check(const T p, const T dof_par, const bool lower_tail, const bool log_p)
 noexcept
 {
     return( !t_sanity_check(dof_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            !prob_val_check(p) ? \
+            !prob_val_check(p,log_p) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            p == T(0) ? \
+            prob_lower_is_zero(p,lower_tail,log_p) ? \
                 - STLIM<T>::infinity() :
-            p == T(1) ? \
+            prob_upper_is_zero(p,lower_tail,log_p) ? \
                 STLIM<T>::infinity() :
             // Cauchy case, etc.
             dof_par == T(1) ? \
-                stmath::tan(GCEM_PI*(p - T(0.5))) :
-            dof_par == T(2) ? \
-                (2*p - T(1)) / stmath::sqrt(2*p*(T(1) - p)) :
+                qcauchy_tail_compute(prob_lower(p,lower_tail,log_p),prob_upper(p,lower_tail,log_p),T(0),T(1)) :
             // normal case
             dof_par == STLIM<T>::infinity() ? \
-                qnorm(p,T(0),T(1)) :
+                qnorm(p,T(0),T(1),lower_tail,log_p) :
+            // integer and large dof
+            dof_par > T(1e05) || pt_int_series_check(dof_par) ? \
+                qt_fast_compute(p,dof_par,lower_tail,log_p) :
             // else
-                qt_int_main(p,dof_par) );
+                qt_compute(p,dof_par,lower_tail,log_p) );
 }
 
 template<typename T1, typename T2, typename TC = common_return_t<T1,T2>>
 statslib_constexpr
 TC
-qt_type_check(const T1 p, const T2 dof_par)
+qt_type_check(const T1 p, const T2 dof_par, const bool lower_tail, const bool log_p)
 noexcept
 {
-    return qt_vals_check(static_cast<TC>(p),static_cast<TC>(dof_par));
+    return qt_vals_check(static_cast<TC>(p),static_cast<TC>(dof_par),lower_tail,log_p);
 }
 
 }
@@ -295,6 +474,8 @@ noexcept
  *
  * @param p a real-valued input.
  * @param dof_par the degrees of freedom parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return the quantile function evaluated at \c p.
  * 
@@ -305,10 +486,10 @@ noexcept
 template<typename T1, typename T2>
 statslib_constexpr
 common_return_t<T1,T2>
-qt(const T1 p, const T2 dof_par)
+qt(const T1 p, const T2 dof_par, const bool lower_tail, const bool log_p)
 noexcept
 {
-    return internal::qt_type_check(p,dof_par);
+    return internal::qt_type_check(p,dof_par,lower_tail,log_p);
 }
 
 //
@@ -321,10 +502,10 @@ namespace internal
 template<typename eT, typename T1, typename rT>
 statslib_inline
 void
-qt_vec(const eT* __stats_pointer_settings__ vals_in, const T1 dof_par, 
+qt_vec(const eT* __stats_pointer_settings__ vals_in, const T1 dof_par, const bool lower_tail, const bool log_p, 
              rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(qt,vals_in,vals_out,num_elem,dof_par);
+    EVAL_DIST_FN_VEC(qt,vals_in,vals_out,num_elem,dof_par,lower_tail,log_p);
 }
 #endif
 
@@ -335,6 +516,8 @@ qt_vec(const eT* __stats_pointer_settings__ vals_in, const T1 dof_par,
  *
  * @param x a standard vector.
  * @param dof_par the degrees of freedom parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return a vector of quantile values corresponding to the elements of \c x.
  * 
@@ -349,9 +532,9 @@ qt_vec(const eT* __stats_pointer_settings__ vals_in, const T1 dof_par,
 template<typename eT, typename T1, typename rT>
 statslib_inline
 std::vector<rT>
-qt(const std::vector<eT>& x, const T1 dof_par)
+qt(const std::vector<eT>& x, const T1 dof_par, const bool lower_tail, const bool log_p)
 {
-    STDVEC_DIST_FN(qt_vec,dof_par);
+    STDVEC_DIST_FN(qt_vec,dof_par,lower_tail,log_p);
 }
 #endif
 
@@ -360,6 +543,8 @@ qt(const std::vector<eT>& x, const T1 dof_par)
  *
  * @param X a matrix of input values.
  * @param dof_par the degrees of freedom parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -375,17 +560,17 @@ qt(const std::vector<eT>& x, const T1 dof_par)
 template<typename eT, typename T1, typename rT>
 statslib_inline
 ArmaMat<rT>
-qt(const ArmaMat<eT>& X, const T1 dof_par)
+qt(const ArmaMat<eT>& X, const T1 dof_par, const bool lower_tail, const bool log_p)
 {
-    ARMA_DIST_FN(qt_vec,dof_par);
+    ARMA_DIST_FN(qt_vec,dof_par,lower_tail,log_p);
 }
 
 template<typename mT, typename tT, typename T1>
 statslib_inline
 mT
-qt(const ArmaGen<mT,tT>& X, const T1 dof_par)
+qt(const ArmaGen<mT,tT>& X, const T1 dof_par, const bool lower_tail, const bool log_p)
 {
-    return qt(X.eval(),dof_par);
+    return qt(X.eval(),dof_par,lower_tail,log_p);
 }
 #endif
 
@@ -394,6 +579,8 @@ qt(const ArmaGen<mT,tT>& X, const T1 dof_par)
  *
  * @param X a matrix of input values.
  * @param dof_par the degrees of freedom parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -407,9 +594,9 @@ qt(const ArmaGen<mT,tT>& X, const T1 dof_par)
 template<typename eT, typename T1, typename rT, bool To>
 statslib_inline
 BlazeMat<rT,To>
-qt(const BlazeMat<eT,To>& X, const T1 dof_par)
+qt(const BlazeMat<eT,To>& X, const T1 dof_par, const bool lower_tail, const bool log_p)
 {
-    BLAZE_DIST_FN(qt_vec,dof_par);
+    BLAZE_DIST_FN(qt_vec,dof_par,lower_tail,log_p);
 }
 #endif
 
@@ -418,6 +605,8 @@ qt(const BlazeMat<eT,To>& X, const T1 dof_par)
  *
  * @param X a matrix of input values.
  * @param dof_par the degrees of freedom parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -431,8 +620,8 @@ qt(const BlazeMat<eT,To>& X, const T1 dof_par)
 template<typename eT, typename T1, typename rT, int iTr, int iTc>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-qt(const EigenMat<eT,iTr,iTc>& X, const T1 dof_par)
+qt(const EigenMat<eT,iTr,iTc>& X, const T1 dof_par, const bool lower_tail, const bool log_p)
 {
-    EIGEN_DIST_FN(qt_vec,dof_par);
+    EIGEN_DIST_FN(qt_vec,dof_par,lower_tail,log_p);
 }
 #endif
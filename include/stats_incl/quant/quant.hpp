@@ -23,13 +23,8 @@
 
 #include "qbern.hpp"
 #include "qbeta.hpp"
-#include "qbinom.hpp"
 #include "qcauchy.hpp"
-#include "qchisq.hpp"
 #include "qexp.hpp"
-#include "qf.hpp"
-#include "qgamma.hpp"
-#include "qinvgamma.hpp"
 #include "qkumaraswamy.hpp"
 #include "qlaplace.hpp"
 #include "qlogis.hpp"
@@ -41,6 +36,11 @@
 #include "qweibull.hpp"
 
 // these depend on one of the above
+#include "qbinom.hpp"
+#include "qgamma.hpp"
+#include "qchisq.hpp"
+#include "qf.hpp"
+#include "qinvgamma.hpp"
 #include "qlnorm.hpp"
 
 #endif
@@ -31,42 +31,44 @@ namespace internal
 template<typename T>
 statslib_constexpr
 T
-qunif_compute(const T p, const T a_par, const T b_par)
+qunif_compute(const T p, const T a_par, const T b_par, const bool lower_tail, const bool log_p)
 noexcept
 {
-    return( a_par + p*(b_par-a_par) );
+    return( prob_lower(p,lower_tail,log_p) <= T(0.5) ? \
+                a_par + prob_lower(p,lower_tail,log_p)*(b_par-a_par) :
+                b_par - prob_upper(p,lower_tail,log_p)*(b_par-a_par) );
 }
 
 template<typename T>
 statslib_constexpr
 T
-qunif_vals_check(const T p, const T a_par, const T b_par)
+qunif_vals_check(const T p, const T a_par, const T b_par, const bool lower_tail, const bool log_p)
 noexcept
 {
     return( !unif_sanity_check(a_par,b_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            !prob_val_check(p) ? \
+            !prob_val_check(p,log_p) ? \
                 STLIM<T>::quiet_NaN() :
             //
             GCINT::any_inf(a_par,b_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            p == T(0) ? \
+            prob_lower_is_zero(p,lower_tail,log_p) ? \
                 a_par :
-            p == T(1) ? \
+            prob_upper_is_zero(p,lower_tail,log_p) ? \
                 b_par :
             //
-            qunif_compute(p,a_par,b_par) );
+            qunif_compute(p,a_par,b_par,lower_tail,log_p) );
 }
 
 template<typename T1, typename T2, typename T3, typename TC = common_return_t<T1,T2,T3>>
 statslib_constexpr
 TC
-qunif_type_check(const T1 p, const T2 a_par, const T3 b_par)
+qunif_type_check(const T1 p, const T2 a_par, const T3 b_par, const bool lower_tail, const bool log_p)
 noexcept
 {
-    return qunif_vals_check(static_cast<TC>(p),static_cast<TC>(a_par),static_cast<TC>(b_par));
+    return qunif_vals_check(static_cast<TC>(p),static_cast<TC>(a_par),static_cast<TC>(b_par),lower_tail,log_p);
 }
 
 }
@@ -77,6 +79,8 @@ noexcept
  * @param p a real-valued input.
  * @param a_par the lower bound parameter, a real-valued input.
  * @param b_par the upper bound parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return the quantile function evaluated at \c p.
  * 
@@ -87,10 +91,10 @@ noexcept
 template<typename T1, typename T2, typename T3>
 statslib_constexpr
 common_return_t<T1,T2,T3>
-qunif(const T1 p, const T2 a_par, const T3 b_par)
+qunif(const T1 p, const T2 a_par, const T3 b_par, const bool lower_tail, const bool log_p)
 noexcept
 {
-    return internal::qunif_type_check(p,a_par,b_par);
+    return internal::qunif_type_check(p,a_par,b_par,lower_tail,log_p);
 }
 
 //
@@ -103,10 +107,10 @@ namespace internal
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 void
-qunif_vec(const eT* __stats_pointer_settings__ vals_in, const T1 a_par, const T2 b_par, 
+qunif_vec(const eT* __stats_pointer_settings__ vals_in, const T1 a_par, const T2 b_par, const bool lower_tail, const bool log_p, 
                 rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(qunif,vals_in,vals_out,num_elem,a_par,b_par);
+    EVAL_DIST_FN_VEC(qunif,vals_in,vals_out,num_elem,a_par,b_par,lower_tail,log_p);
 }
 #endif
 
@@ -118,6 +122,8 @@ qunif_vec(const eT* __stats_pointer_settings__ vals_in, const T1 a_par, const T2
  * @param x a standard vector.
  * @param a_par a real-valued shape parameter.
  * @param b_par a real-valued shape parameter.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return a vector of quantile values corresponding to the elements of \c x.
  * 
@@ -132,9 +138,9 @@ qunif_vec(const eT* __stats_pointer_settings__ vals_in, const T1 a_par, const T2
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 std::vector<rT>
-qunif(const std::vector<eT>& x, const T1 a_par, const T2 b_par)
+qunif(const std::vector<eT>& x, const T1 a_par, const T2 b_par, const bool lower_tail, const bool log_p)
 {
-    STDVEC_DIST_FN(qunif_vec,a_par,b_par);
+    STDVEC_DIST_FN(qunif_vec,a_par,b_par,lower_tail,log_p);
 }
 #endif
 
@@ -144,6 +150,8 @@ qunif(const std::vector<eT>& x, const T1 a_par, const T2 b_par)
  * @param X a matrix of input values.
  * @param a_par a real-valued shape parameter.
  * @param b_par a real-valued shape parameter.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -159,17 +167,17 @@ qunif(const std::vector<eT>& x, const T1 a_par, const T2 b_par)
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 ArmaMat<rT>
-qunif(const ArmaMat<eT>& X, const T1 a_par, const T2 b_par)
+qunif(const ArmaMat<eT>& X, const T1 a_par, const T2 b_par, const bool lower_tail, const bool log_p)
 {
-    ARMA_DIST_FN(qunif_vec,a_par,b_par);
+    ARMA_DIST_FN(qunif_vec,a_par,b_par,lower_tail,log_p);
 }
 
 template<typename mT, typename tT, typename T1, typename T2>
 statslib_inline
 mT
-qunif(const ArmaGen<mT,tT>& X, const T1 a_par, const T2 b_par)
+qunif(const ArmaGen<mT,tT>& X, const T1 a_par, const T2 b_par, const bool lower_tail, const bool log_p)
 {
-    return qunif(X.eval(),a_par,b_par);
+    return qunif(X.eval(),a_par,b_par,lower_tail,log_p);
 }
 #endif
 
@@ -179,6 +187,8 @@ qunif(const ArmaGen<mT,tT>& X, const T1 a_par, const T2 b_par)
  * @param X a matrix of input values.
  * @param a_par a real-valued shape parameter.
  * @param b_par a real-valued shape parameter.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -192,9 +202,9 @@ qunif(const ArmaGen<mT,tT>& X, const T1 a_par, const T2 b_par)
 template<typename eT, typename T1, typename T2, typename rT, bool To>
 statslib_inline
 BlazeMat<rT,To>
-qunif(const BlazeMat<eT,To>& X, const T1 a_par, const T2 b_par)
+qunif(const BlazeMat<eT,To>& X, const T1 a_par, const T2 b_par, const bool lower_tail, const bool log_p)
 {
-    BLAZE_DIST_FN(qunif_vec,a_par,b_par);
+    BLAZE_DIST_FN(qunif_vec,a_par,b_par,lower_tail,log_p);
 }
 #endif
 
@@ -204,6 +214,8 @@ qunif(const BlazeMat<eT,To>& X, const T1 a_par, const T2 b_par)
  * @param X a matrix of input values.
  * @param a_par a real-valued shape parameter.
  * @param b_par a real-valued shape parameter.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -217,8 +229,8 @@ qunif(const BlazeMat<eT,To>& X, const T1 a_par, const T2 b_par)
 template<typename eT, typename T1, typename T2, typename rT, int iTr, int iTc>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-qunif(const EigenMat<eT,iTr,iTc>& X, const T1 a_par, const T2 b_par)
+qunif(const EigenMat<eT,iTr,iTc>& X, const T1 a_par, const T2 b_par, const bool lower_tail, const bool log_p)
 {
-    EIGEN_DIST_FN(qunif_vec,a_par,b_par);
+    EIGEN_DIST_FN(qunif_vec,a_par,b_par,lower_tail,log_p);
 }
 #endif
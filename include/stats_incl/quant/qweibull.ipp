@@ -31,45 +31,45 @@ namespace internal
 template<typename T>
 statslib_constexpr
 T
-qweibull_compute(const T p, const T shape_par, const T scale_par)
+qweibull_compute(const T p, const T shape_par, const T scale_par, const bool lower_tail, const bool log_p)
 noexcept
 {
-    return( scale_par*stmath::pow(- stmath::log1p(-p), T(1)/shape_par) );
+    return( scale_par*stmath::pow(- log_prob_upper(p,lower_tail,log_p), T(1)/shape_par) );
 }
 
 template<typename T>
 statslib_constexpr
 T
-qweibull_vals_check(const T p, const T shape_par, const T scale_par)
+qweibull_vals_check(const T p, const T shape_par, const T scale_par, const bool lower_tail, const bool log_p)
 noexcept
 {
     return( !weibull_sanity_check(shape_par,scale_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            !prob_val_check(p) ? \
+            !prob_val_check(p,log_p) ? \
                 STLIM<T>::quiet_NaN() :
             //
             shape_par == T(0) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            p == T(0) ? \
+            prob_lower_is_zero(p,lower_tail,log_p) ? \
                 T(0) :
-            p == T(1) ? \
+            prob_upper_is_zero(p,lower_tail,log_p) ? \
                 STLIM<T>::infinity() :
             //
             GCINT::is_posinf(shape_par) ? \
                 scale_par :
             //
-            qweibull_compute(p,shape_par,scale_par) );
+            qweibull_compute(p,shape_par,scale_par,lower_tail,log_p) );
 }
 
 template<typename T1, typename T2, typename T3, typename TC = common_return_t<T1,T2,T3>>
 statslib_constexpr
 TC
-qweibull_type_check(const T1 p, const T2 shape_par, const T3 scale_par)
+qweibull_type_check(const T1 p, const T2 shape_par, const T3 scale_par, const bool lower_tail, const bool log_p)
 noexcept
 {
-    return qweibull_vals_check(static_cast<TC>(p),static_cast<TC>(shape_par),static_cast<TC>(scale_par));
+    return qweibull_vals_check(static_cast<TC>(p),static_cast<TC>(shape_par),static_cast<TC>(scale_par),lower_tail,log_p);
 }
 
 }
@@ -80,6 +80,8 @@ noexcept
  * @param p a real-valued input.
  * @param shape_par the shape parameter, a real-valued input.
  * @param scale_par the scale parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return the quantile function evaluated at \c p.
  * 
@@ -90,10 +92,10 @@ noexcept
 template<typename T1, typename T2, typename T3>
 statslib_constexpr
 common_return_t<T1,T2,T3>
-qweibull(const T1 p, const T2 shape_par, const T3 scale_par)
+qweibull(const T1 p, const T2 shape_par, const T3 scale_par, const bool lower_tail, const bool log_p)
 noexcept
 {
-    return internal::qweibull_type_check(p,shape_par,scale_par);
+    return internal::qweibull_type_check(p,shape_par,scale_par,lower_tail,log_p);
 }
 
 //
@@ -106,10 +108,10 @@ namespace internal
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 void
-qweibull_vec(const eT* __stats_pointer_settings__ vals_in, const T1 shape_par, const T2 scale_par, 
+qweibull_vec(const eT* __stats_pointer_settings__ vals_in, const T1 shape_par, const T2 scale_par, const bool lower_tail, const bool log_p, 
                    rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(qweibull,vals_in,vals_out,num_elem,shape_par,scale_par);
+    EVAL_DIST_FN_VEC(qweibull,vals_in,vals_out,num_elem,shape_par,scale_par,lower_tail,log_p);
 }
 #endif
 
@@ -121,6 +123,8 @@ qweibull_vec(const eT* __stats_pointer_settings__ vals_in, const T1 shape_par, c
  * @param x a standard vector.
  * @param shape_par the shape parameter, a real-valued input.
  * @param scale_par the scale parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return a vector of quantile values corresponding to the elements of \c x.
  * 
@@ -135,9 +139,9 @@ qweibull_vec(const eT* __stats_pointer_settings__ vals_in, const T1 shape_par, c
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 std::vector<rT>
-qweibull(const std::vector<eT>& x, const T1 shape_par, const T2 scale_par)
+qweibull(const std::vector<eT>& x, const T1 shape_par, const T2 scale_par, const bool lower_tail, const bool log_p)
 {
-    STDVEC_DIST_FN(qweibull_vec,shape_par,scale_par);
+    STDVEC_DIST_FN(qweibull_vec,shape_par,scale_par,lower_tail,log_p);
 }
 #endif
 
@@ -147,6 +151,8 @@ qweibull(const std::vector<eT>& x, const T1 shape_par, const T2 scale_par)
  * @param X a matrix of input values.
  * @param shape_par the shape parameter, a real-valued input.
  * @param scale_par the scale parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -162,17 +168,17 @@ qweibull(const std::vector<eT>& x, const T1 shape_par, const T2 scale_par)
 template<typename eT, typename T1, typename T2, typename rT>
 statslib_inline
 ArmaMat<rT>
-qweibull(const ArmaMat<eT>& X, const T1 shape_par, const T2 scale_par)
+qweibull(const ArmaMat<eT>& X, const T1 shape_par, const T2 scale_par, const bool lower_tail, const bool log_p)
 {
-    ARMA_DIST_FN(qweibull_vec,shape_par,scale_par);
+    ARMA_DIST_FN(qweibull_vec,shape_par,scale_par,lower_tail,log_p);
 }
 
 template<typename mT, typename tT, typename T1, typename T2>
 statslib_inline
 mT
-qweibull(const ArmaGen<mT,tT>& X, const T1 shape_par, const T2 scale_par)
+qweibull(const ArmaGen<mT,tT>& X, const T1 shape_par, const T2 scale_par, const bool lower_tail, const bool log_p)
 {
-    return qweibull(X.eval(),shape_par,scale_par);
+    return qweibull(X.eval(),shape_par,scale_par,lower_tail,log_p);
 }
 #endif
 
@@ -182,6 +188,8 @@ qweibull(const ArmaGen<mT,tT>& X, const T1 shape_par, const T2 scale_par)
  * @param X a matrix of input values.
  * @param shape_par the shape parameter, a real-valued input.
  * @param scale_par the scale parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -195,9 +203,9 @@ qweibull(const ArmaGen<mT,tT>& X, const T1 shape_par, const T2 scale_par)
 template<typename eT, typename T1, typename T2, typename rT, bool To>
 statslib_inline
 BlazeMat<rT,To>
-qweibull(const BlazeMat<eT,To>& X, const T1 shape_par, const T2 scale_par)
+qweibull(const BlazeMat<eT,To>& X, const T1 shape_par, const T2 scale_par, const bool lower_tail, const bool log_p)
 {
-    BLAZE_DIST_FN(qweibull_vec,shape_par,scale_par);
+    BLAZE_DIST_FN(qweibull_vec,shape_par,scale_par,lower_tail,log_p);
 }
 #endif
 
@@ -207,6 +215,8 @@ qweibull(const BlazeMat<eT,To>& X, const T1 shape_par, const T2 scale_par)
  * @param X a matrix of input values.
  * @param shape_par the shape parameter, a real-valued input.
  * @param scale_par the scale parameter, a real-valued input.
+ * @param lower_tail \c p is the lower-tail probability, \f$ P(X \leq x) \f$, or, if \c false, the upper tail, \f$ P(X > x) \f$.
+ * @param log_p \c p is given on the log scale.
  *
  * @return a matrix of quantile values corresponding to the elements of \c X.
  * 
@@ -220,8 +230,8 @@ qweibull(const BlazeMat<eT,To>& X, const T1 shape_par, const T2 scale_par)
 template<typename eT, typename T1, typename T2, typename rT, int iTr, int iTc>
 statslib_inline
 EigenMat<rT,iTr,iTc>
-qweibull(const EigenMat<eT,iTr,iTc>& X, const T1 shape_par, const T2 scale_par)
+qweibull(const EigenMat<eT,iTr,iTc>& X, const T1 shape_par, const T2 scale_par, const bool lower_tail, const bool log_p)
 {
-    EIGEN_DIST_FN(qweibull_vec,shape_par,scale_par);
+    EIGEN_DIST_FN(qweibull_vec,shape_par,scale_par,lower_tail,log_p);
 }
 #endif
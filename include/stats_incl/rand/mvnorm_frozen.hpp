@@ -0,0 +1,110 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Multivariate normal distribution with fixed parameters
+ */
+
+#ifndef _statslib_mvnorm_frozen_HPP
+#define _statslib_mvnorm_frozen_HPP
+
+#ifdef STATS_ENABLE_MATRIX_FEATURES
+
+/**
+ * @brief Multivariate-Normal distribution for a fixed mean and covariance matrix
+ *
+ * Stores the lower Cholesky factor of the covariance matrix, its log-determinant and, optionally, the precision
+ * matrix, so that repeated density evaluations and draws do not refactorize. The factor can be updated in 
+ * O(K^2) operations when the covariance matrix changes by a rank-one term.
+ */
+
+template<typename eT = double>
+class mvnorm_frozen
+{
+    public:
+        mvnorm_frozen() = default;
+
+        template<typename vT, typename mT>
+        mvnorm_frozen(const vT& mu_par, const mT& Sigma_par, const bool store_precision = false);
+
+        bool is_valid() const;
+        ullint_t dim() const;
+        eT log_det() const;
+
+        // log-density of a K x 1 vector, and of each row of an n x K matrix (returned as n x 1)
+
+        template<typename vT>
+        eT logpdf(const vT& X) const;
+
+        template<typename mT>
+        mT logpdf_batch(const mT& X) const;
+
+        // a K x 1 draw, and n draws as the rows of an n x K matrix
+
+        template<typename vT>
+        vT sample(rand_engine_t& engine) const;
+
+        template<typename mT>
+        mT sample(const ullint_t n, rand_engine_t& engine) const;
+
+        // lower Cholesky factor and precision matrix, K x K
+
+        template<typename mT>
+        mT chol_factor() const;
+
+        template<typename mT>
+        mT precision() const;
+
+        // Sigma + v v' and Sigma - v v'; a downdate that would leave Sigma not positive definite
+        // returns false and marks the object invalid
+
+        template<typename vT>
+        bool chol_update(const vT& v);
+
+        template<typename vT>
+        bool chol_downdate(const vT& v);
+
+    private:
+        bool valid_flag = false;
+        bool store_prec = false;
+
+        ullint_t K = 0;
+        eT log_det_val = eT(0);
+
+        std::vector<eT> mu_vals;        // K
+        std::vector<eT> L_vals;         // K x K, lower triangular, column-major
+        std::vector<eT> prec_vals;      // K x K, column-major; empty unless store_precision is set
+
+        template<typename vT>
+        bool chol_rank_one(const vT& v, const eT sign_val);
+
+        void draw(rand_engine_t& engine, std::normal_distribution<eT>& norm_dist, eT* z_vals, eT* x_vals) const;
+        void refresh();
+        std::vector<eT> precision_vals() const;
+};
+
+//
+// include implementation files
+
+#include "mvnorm_frozen.ipp"
+
+#endif
+
+#endif
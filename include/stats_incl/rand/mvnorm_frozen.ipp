@@ -0,0 +1,402 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Multivariate normal distribution with fixed parameters
+ */
+
+/**
+ * @brief Multivariate-Normal distribution for a fixed mean and covariance matrix
+ *
+ * @param mu_par mean vector.
+ * @param Sigma_par the covariance matrix.
+ * @param store_precision also form and store the precision matrix.
+ *
+ * If \c Sigma_par is not positive definite, or the dimensions do not agree, the object is left invalid (see \c is_valid).
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::mvnorm_frozen<> dist(mu,Sigma);
+ * stats::rand_engine_t engine(1776);
+ * arma::mat X = dist.sample<arma::mat>(1000,engine);
+ * arma::mat log_dens = dist.logpdf_batch(X);
+ * \endcode
+ */
+
+template<typename eT>
+template<typename vT, typename mT>
+mvnorm_frozen<eT>::mvnorm_frozen(const vT& mu_par, const mT& Sigma_par, const bool store_precision)
+    : store_prec(store_precision)
+{
+    if (mat_ops::n_elem(mu_par) != mat_ops::n_rows(Sigma_par) || mat_ops::n_cols(Sigma_par) != mat_ops::n_rows(Sigma_par))
+    {
+        printf("mvnorm_frozen: dimensions of mu and Sigma do not agree.\n");
+        return;
+    }
+
+    K = mat_ops::n_rows(Sigma_par);
+
+    mu_vals.resize(K);
+
+    for (ullint_t k=ullint_t(0); k < K; ++k)
+    {
+        mu_vals[k] = static_cast<eT>(mu_par(k,0));
+    }
+
+    // a factor that failed must not be read back as valid
+
+    const mat_ops::chol_fact<mT> chol_sig(Sigma_par);
+
+    if (!chol_sig.is_valid()) {
+        log_det_val = STLIM<eT>::quiet_NaN();
+        return;
+    }
+
+    internal::mvnorm_factor_vals(chol_sig,K,L_vals);
+
+    refresh();
+}
+
+template<typename eT>
+statslib_inline
+bool
+mvnorm_frozen<eT>::is_valid()
+const
+{
+    return valid_flag;
+}
+
+template<typename eT>
+statslib_inline
+ullint_t
+mvnorm_frozen<eT>::dim()
+const
+{
+    return K;
+}
+
+template<typename eT>
+statslib_inline
+eT
+mvnorm_frozen<eT>::log_det()
+const
+{
+    return log_det_val;
+}
+
+//
+// density
+
+template<typename eT>
+template<typename vT>
+statslib_inline
+eT
+mvnorm_frozen<eT>::logpdf(const vT& X)
+const
+{
+    if (!valid_flag || mat_ops::n_elem(X) != K) {
+        return STLIM<eT>::quiet_NaN();
+    }
+
+    std::vector<eT> z_vals(K);
+
+    for (ullint_t k=ullint_t(0); k < K; ++k)
+    {
+        z_vals[k] = static_cast<eT>(X(k,0)) - mu_vals[k];
+    }
+
+    internal::mvnorm_tri_solve_block(L_vals.data(),K,z_vals.data(),ullint_t(1));
+
+    eT quad_term = eT(0);
+
+    for (ullint_t k=ullint_t(0); k < K; ++k)
+    {
+        quad_term += z_vals[k] * z_vals[k];
+    }
+
+    return - eT(0.5) * ( K*eT(GCEM_LOG_2PI) + log_det_val + quad_term );
+}
+
+template<typename eT>
+template<typename mT>
+statslib_inline
+mT
+mvnorm_frozen<eT>::logpdf_batch(const mT& X)
+const
+{
+    mT ret;
+
+    if (mat_ops::n_cols(X) != K) {
+        printf("mvnorm_frozen: dimensions of X and Sigma do not agree.\n");
+        return ret;
+    }
+
+    mat_ops::zeros(ret,mat_ops::n_rows(X),1);
+
+    internal::mvnorm_log_dens_rows(X,mu_vals.data(),L_vals.data(),K,
+                                   valid_flag ? log_det_val : STLIM<eT>::quiet_NaN(),true,ret);
+
+    return ret;
+}
+
+//
+// sampling
+
+template<typename eT>
+template<typename vT>
+statslib_inline
+vT
+mvnorm_frozen<eT>::sample(rand_engine_t& engine)
+const
+{
+    vT ret;
+    mat_ops::zeros(ret,K,1);
+
+    std::vector<eT> z_vals(K);
+    std::vector<eT> x_vals(K);
+
+    std::normal_distribution<eT> norm_dist(eT(0),eT(1));
+
+    draw(engine,norm_dist,z_vals.data(),x_vals.data());
+
+    for (ullint_t k=ullint_t(0); k < K; ++k)
+    {
+        ret(k,0) = x_vals[k];
+    }
+
+    return ret;
+}
+
+template<typename eT>
+template<typename mT>
+statslib_inline
+mT
+mvnorm_frozen<eT>::sample(const ullint_t n, rand_engine_t& engine)
+const
+{
+    mT ret;
+    mat_ops::zeros(ret,n,K);
+
+    internal::rmvnorm_rows(L_vals.data(),mu_vals.data(),K,valid_flag,static_cast<ullint_t>(engine()),ret);
+
+    return ret;
+}
+
+//
+// factor and precision
+
+template<typename eT>
+template<typename mT>
+statslib_inline
+mT
+mvnorm_frozen<eT>::chol_factor()
+const
+{
+    mT ret;
+    mat_ops::zeros(ret,K,K);
+
+    for (ullint_t k=ullint_t(0); k < K; ++k)
+    {
+        for (ullint_t r=k; r < K; ++r)
+        {
+            ret(r,k) = L_vals[r + k*K];
+        }
+    }
+
+    return ret;
+}
+
+template<typename eT>
+template<typename mT>
+statslib_inline
+mT
+mvnorm_frozen<eT>::precision()
+const
+{
+    const std::vector<eT> P_vals = store_prec ? prec_vals : precision_vals();
+
+    mT ret;
+    mat_ops::zeros(ret,K,K);
+
+    for (ullint_t k=ullint_t(0); k < K; ++k)
+    {
+        for (ullint_t r=ullint_t(0); r < K; ++r)
+        {
+            ret(r,k) = P_vals[r + k*K];
+        }
+    }
+
+    return ret;
+}
+
+//
+// rank-one modifications of the factor
+
+template<typename eT>
+template<typename vT>
+statslib_inline
+bool
+mvnorm_frozen<eT>::chol_update(const vT& v)
+{
+    return chol_rank_one(v,eT(1));
+}
+
+template<typename eT>
+template<typename vT>
+statslib_inline
+bool
+mvnorm_frozen<eT>::chol_downdate(const vT& v)
+{
+    return chol_rank_one(v,eT(-1));
+}
+
+// LINPACK-style sweep of Givens (update) or hyperbolic (downdate) rotations through the columns of L
+
+template<typename eT>
+template<typename vT>
+statslib_inline
+bool
+mvnorm_frozen<eT>::chol_rank_one(const vT& v, const eT sign_val)
+{
+    if (!valid_flag || mat_ops::n_elem(v) != K) {
+        return false;
+    }
+
+    std::vector<eT> w_vals(K);
+
+    for (ullint_t k=ullint_t(0); k < K; ++k)
+    {
+        w_vals[k] = static_cast<eT>(v(k,0));
+    }
+
+    for (ullint_t k=ullint_t(0); k < K; ++k)
+    {
+        const eT L_kk = L_vals[k + k*K];
+        const eT r_sq = L_kk*L_kk + sign_val * w_vals[k]*w_vals[k];
+
+        if (!(r_sq > eT(0))) {
+            valid_flag = false;
+            return false;
+        }
+
+        const eT r_val = std::sqrt(r_sq);
+        const eT c_val = r_val / L_kk;
+        const eT s_val = w_vals[k] / L_kk;
+
+        L_vals[k + k*K] = r_val;
+
+        for (ullint_t i=k+1; i < K; ++i)
+        {
+            L_vals[i + k*K] = (L_vals[i + k*K] + sign_val * s_val * w_vals[i]) / c_val;
+            w_vals[i] = c_val * w_vals[i] - s_val * L_vals[i + k*K];
+        }
+    }
+
+    refresh();
+
+    return valid_flag;
+}
+
+//
+// internal
+
+// mu + L z for a K-vector of standard normal draws z
+
+template<typename eT>
+statslib_inline
+void
+mvnorm_frozen<eT>::draw(rand_engine_t& engine, std::normal_distribution<eT>& norm_dist, eT* z_vals, eT* x_vals)
+const
+{
+    for (ullint_t k=ullint_t(0); k < K; ++k)
+    {
+        z_vals[k] = norm_dist(engine);
+    }
+
+    for (ullint_t k=ullint_t(0); k < K; ++k)
+    {
+        eT val = mu_vals[k];
+
+        for (ullint_t r=ullint_t(0); r <= k; ++r)
+        {
+            val += L_vals[k + r*K] * z_vals[r];
+        }
+
+        x_vals[k] = valid_flag ? val : STLIM<eT>::quiet_NaN();
+    }
+}
+
+template<typename eT>
+statslib_inline
+void
+mvnorm_frozen<eT>::refresh()
+{
+    log_det_val = eT(0);
+
+    for (ullint_t k=ullint_t(0); k < K; ++k)
+    {
+        log_det_val += eT(2) * std::log(L_vals[k + k*K]);
+    }
+
+    valid_flag = GCINT::is_finite(log_det_val);
+
+    if (store_prec && valid_flag) {
+        prec_vals = precision_vals();
+    }
+}
+
+// Sigma^{-1} = L^{-T} L^{-1}, with L^{-1} from forward substitution on the identity
+
+template<typename eT>
+statslib_inline
+std::vector<eT>
+mvnorm_frozen<eT>::precision_vals()
+const
+{
+    std::vector<eT> Linv_vals(K*K, eT(0));
+
+    for (ullint_t k=ullint_t(0); k < K; ++k)
+    {
+        Linv_vals[k*K + k] = eT(1);
+    }
+
+    internal::mvnorm_tri_solve_block(L_vals.data(),K,Linv_vals.data(),K);
+
+    // Linv_vals[k*K + b] now holds (L^{-1})_{k,b}
+
+    std::vector<eT> P_vals(K*K, eT(0));
+
+    for (ullint_t b=ullint_t(0); b < K; ++b)
+    {
+        for (ullint_t a=ullint_t(0); a < K; ++a)
+        {
+            eT val = eT(0);
+
+            for (ullint_t k=std::max(a,b); k < K; ++k)
+            {
+                val += Linv_vals[k*K + a] * Linv_vals[k*K + b];
+            }
+
+            P_vals[a + b*K] = val;
+        }
+    }
+
+    return P_vals;
+}
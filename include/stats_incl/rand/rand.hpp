@@ -31,20 +31,26 @@
 #include "rbinom.hpp"
 #include "rcauchy.hpp"
 #include "rchisq.hpp"
+#include "rdirichlet.hpp"
 #include "rexp.hpp"
 #include "rf.hpp"
 #include "rinvgamma.hpp"
-#include "rinvwish.hpp"
 #include "rkumaraswamy.hpp"
 #include "rlaplace.hpp"
 #include "rlnorm.hpp"
 #include "rlogis.hpp"
 #include "rmultinom.hpp"
 #include "rmvnorm.hpp"
+#include "mvnorm_frozen.hpp"
+#include "rmvt.hpp"
 #include "rpois.hpp"
 #include "rreciprocal.hpp"
 #include "rt.hpp"
+#include "rpinv.hpp"
 #include "rweibull.hpp"
 #include "rwish.hpp"
 
+// depends on rwish
+#include "rinvwish.hpp"
+
 #endif
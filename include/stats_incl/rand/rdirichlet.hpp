@@ -0,0 +1,57 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Sample from a Dirichlet distribution
+ */
+
+#ifndef _statslib_rdirichlet_HPP
+#define _statslib_rdirichlet_HPP
+
+#ifdef STATS_ENABLE_MATRIX_FEATURES
+
+#ifndef STATS_DIRICHLET_DRAW_BLOCK
+    #define STATS_DIRICHLET_DRAW_BLOCK ullint_t(1024)
+#endif
+
+template<typename mT, typename not_arma_mat<mT>::type* = nullptr>
+statslib_inline
+mT rdirichlet(const ullint_t n, const mT& alpha_par, const ullint_t seed_val = std::random_device{}());
+
+template<typename mT, typename not_arma_mat<mT>::type* = nullptr>
+statslib_inline
+mT rdirichlet(const ullint_t n, const mT& alpha_par, rand_engine_t& engine);
+
+// specializations
+#ifdef STATS_ENABLE_ARMA_WRAPPERS
+template<typename eT>
+statslib_inline
+ArmaMat<eT> rdirichlet(const ullint_t n, const ArmaMat<eT>& alpha_par, const ullint_t seed_val = std::random_device{}());
+
+template<typename eT>
+statslib_inline
+ArmaMat<eT> rdirichlet(const ullint_t n, const ArmaMat<eT>& alpha_par, rand_engine_t& engine);
+#endif
+
+#include "rdirichlet.ipp"
+
+#endif
+
+#endif
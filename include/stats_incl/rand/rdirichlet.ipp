@@ -0,0 +1,203 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Sample from a Dirichlet distribution
+ */
+
+namespace internal
+{
+
+// fill the n x K matrix X with rows G / sum(G), G_k ~ Gamma(alpha_k, 1). Block j of STATS_DIRICHLET_DRAW_BLOCK rows
+// draws its gamma variates component by component, from an engine seeded by (seed_val, j), so that the draws are 
+// reproducible for any number of threads. The gamma variates are kept on the log scale and each row is normalized 
+// after subtracting its maximum, which avoids 0/0 rows when every alpha_k is small.
+
+template<typename mT, typename eT>
+statslib_inline
+void
+rdirichlet_rows(const std::vector<rgamma_log_setup<eT>>& setup_vals, const ullint_t seed_val, mT& X)
+{
+    const ullint_t n = mat_ops::n_rows(X);
+    const ullint_t K = setup_vals.size();
+    const ullint_t n_blocks = (n + STATS_DIRICHLET_DRAW_BLOCK - ullint_t(1)) / STATS_DIRICHLET_DRAW_BLOCK;
+
+#ifdef STATS_USE_OPENMP
+    #pragma omp parallel for
+#endif
+    for (ullint_t j=ullint_t(0); j < n_blocks; ++j)
+    {
+        const ullint_t i_begin = j*STATS_DIRICHLET_DRAW_BLOCK;
+        const ullint_t n_block = std::min(STATS_DIRICHLET_DRAW_BLOCK, n - i_begin);
+
+        std::seed_seq seed_seq_j = { uint_t(seed_val), uint_t(seed_val >> 32), uint_t(j), uint_t(j >> 32) };
+        rand_engine_t engine_j(seed_seq_j);
+
+        std::vector<eT> max_vals(n_block, - STLIM<eT>::infinity());
+        std::vector<eT> sum_vals(n_block, eT(0));
+        std::vector<eT> log_vals(n_block);
+
+        // log-scale draws, written to X
+
+        for (ullint_t k=ullint_t(0); k < K; ++k)
+        {
+            rgamma_log_vec(setup_vals[k],engine_j,log_vals.data(),n_block);
+
+            for (ullint_t b=ullint_t(0); b < n_block; ++b)
+            {
+                X(i_begin + b,k) = log_vals[b];
+                max_vals[b] = std::max(max_vals[b], log_vals[b]);
+            }
+        }
+
+        // normalize in place
+
+        for (ullint_t k=ullint_t(0); k < K; ++k)
+        {
+            for (ullint_t b=ullint_t(0); b < n_block; ++b)
+            {
+                X(i_begin + b,k) = std::exp(X(i_begin + b,k) - max_vals[b]);
+                sum_vals[b] += X(i_begin + b,k);
+            }
+        }
+
+        for (ullint_t k=ullint_t(0); k < K; ++k)
+        {
+            for (ullint_t b=ullint_t(0); b < n_block; ++b)
+            {
+                X(i_begin + b,k) /= sum_vals[b];
+            }
+        }
+    }
+}
+
+template<typename mT, typename eT>
+statslib_inline
+mT
+rdirichlet_compute(const ullint_t n, const mT& alpha_par, const ullint_t seed_val)
+{
+    mT ret;
+
+    const ullint_t K = mat_ops::n_elem(alpha_par);
+
+    if (K == ullint_t(0))
+    {
+        printf("rdirichlet: alpha is empty.\n");
+        return ret;
+    }
+
+    // Marsaglia and Tsang constants, formed once per alpha_k
+
+    std::vector<rgamma_log_setup<eT>> setup_vals(K);
+
+    bool valid_flag = true;
+
+    for (ullint_t k=ullint_t(0); k < K; ++k)
+    {
+        const eT alpha_k = static_cast<eT>(mat_ops::n_cols(alpha_par) == ullint_t(1) ? alpha_par(k,0) : alpha_par(0,k));
+
+        setup_vals[k] = rgamma_log_init(alpha_k);
+        valid_flag = valid_flag && setup_vals[k].valid_flag;
+    }
+
+    mat_ops::zeros(ret,n,K);
+
+    if (!valid_flag) {
+        mat_ops::fill(ret,STLIM<eT>::quiet_NaN());
+        return ret;
+    }
+
+    rdirichlet_rows(setup_vals,seed_val,ret);
+
+    return ret;
+}
+
+}
+
+/**
+ * @brief Random sampling function for the Dirichlet distribution
+ *
+ * @param n the number of draws.
+ * @param alpha_par a K-dimensional vector of concentration parameters, each a positive real-valued input.
+ * @param seed_val initialize the random streams with a non-negative integral-valued seed.
+ *
+ * @return an n x K matrix of pseudo-random draws from the Dirichlet distribution, one per row.
+ *
+ * Each row is formed from K independent gamma variates, normalized to sum to one. The Marsaglia and Tsang constants
+ * are computed once per \c alpha_k, and the variates are generated on the log scale, so that rows with small 
+ * concentration parameters do not underflow. The rows are filled in blocks of \c STATS_DIRICHLET_DRAW_BLOCK, in 
+ * parallel when OpenMP is enabled; each block draws from its own random stream derived from \c seed_val, so the draws
+ * for a given seed do not depend on the number of threads.
+ *
+ * Example:
+ * \code{.cpp}
+ * Eigen::VectorXd alpha(3);
+ * alpha << 0.5, 1.0, 2.0;
+ * Eigen::MatrixXd X = stats::rdirichlet(1000, alpha, 1776);
+ * \endcode
+ */
+
+template<typename mT, typename not_arma_mat<mT>::type*>
+statslib_inline
+mT
+rdirichlet(const ullint_t n, const mT& alpha_par, const ullint_t seed_val)
+{
+    typedef return_t<typename std::decay<decltype(alpha_par(0,0))>::type> eT;
+
+    return internal::rdirichlet_compute<mT,eT>(n,alpha_par,seed_val);
+}
+
+/**
+ * @brief Random sampling function for the Dirichlet distribution
+ *
+ * @param n the number of draws.
+ * @param alpha_par a K-dimensional vector of concentration parameters, each a positive real-valued input.
+ * @param engine a random engine, passed by reference; one value is drawn from it to seed the random streams.
+ *
+ * @return an n x K matrix of pseudo-random draws from the Dirichlet distribution, one per row.
+ */
+
+template<typename mT, typename not_arma_mat<mT>::type*>
+statslib_inline
+mT
+rdirichlet(const ullint_t n, const mT& alpha_par, rand_engine_t& engine)
+{
+    typedef return_t<typename std::decay<decltype(alpha_par(0,0))>::type> eT;
+
+    return internal::rdirichlet_compute<mT,eT>(n,alpha_par,static_cast<ullint_t>(engine()));
+}
+
+#ifdef STATS_ENABLE_ARMA_WRAPPERS
+template<typename eT>
+statslib_inline
+ArmaMat<eT>
+rdirichlet(const ullint_t n, const ArmaMat<eT>& alpha_par, const ullint_t seed_val)
+{
+    return internal::rdirichlet_compute<ArmaMat<eT>,eT>(n,alpha_par,seed_val);
+}
+
+template<typename eT>
+statslib_inline
+ArmaMat<eT>
+rdirichlet(const ullint_t n, const ArmaMat<eT>& alpha_par, rand_engine_t& engine)
+{
+    return internal::rdirichlet_compute<ArmaMat<eT>,eT>(n,alpha_par,static_cast<ullint_t>(engine()));
+}
+#endif
@@ -139,6 +139,91 @@ rgamma(const T1 shape_par, const T2 scale_par, ullint_t seed_val)
     return rgamma(shape_par,scale_par,engine);
 }
 
+//
+// batched log-scale draws with a fixed shape parameter
+
+namespace internal
+{
+
+// Marsaglia and Tsang constants for one shape parameter; for shape < 1, those of shape + 1, with the draw
+// boosted by U^(1/shape)
+
+template<typename T>
+struct rgamma_log_setup
+{
+    T d;
+    T c;
+    T inv_shape;
+    bool boost_flag;
+    bool valid_flag;
+};
+
+template<typename T>
+statslib_inline
+rgamma_log_setup<T>
+rgamma_log_init(const T shape_par)
+{
+    rgamma_log_setup<T> setup;
+
+    setup.valid_flag = gamma_sanity_check(shape_par,T(1)) && shape_par > T(0) && !GCINT::is_posinf(shape_par);
+    setup.boost_flag = shape_par < T(1);
+    setup.inv_shape = T(1) / shape_par;
+    setup.d = (setup.boost_flag ? shape_par + T(1) : shape_par) - T(1)/T(3);
+    setup.c = (T(1) / T(3)) / std::sqrt(setup.d);
+
+    return setup;
+}
+
+// log of a Gamma(shape, 1) draw. The log scale keeps draws with a small shape parameter, whose boosted values 
+// underflow, usable for normalization.
+
+template<typename T>
+statslib_inline
+T
+rgamma_log_draw(const rgamma_log_setup<T>& setup, rand_engine_t& engine, std::normal_distribution<T>& norm_dist, 
+                std::uniform_real_distribution<T>& unif_dist)
+{
+    if (!setup.valid_flag) {
+        return STLIM<T>::quiet_NaN();
+    }
+
+    while (true)
+    {
+        const T Z = norm_dist(engine);
+
+        if (Z > - T(1) / setup.c)
+        {
+            const T V = std::pow(T(1) + setup.c*Z, 3);
+            const T U = T(1) - unif_dist(engine); // (0,1]
+
+            if (std::log(U) < T(0.5)*Z*Z + setup.d*(T(1) - V + std::log(V))) {
+                const T log_draw = std::log(setup.d * V);
+
+                return setup.boost_flag ? log_draw + std::log(T(1) - unif_dist(engine)) * setup.inv_shape : log_draw;
+            }
+        }
+    }
+}
+
+// num_elem log-scale draws with one shape parameter
+
+template<typename T>
+statslib_inline
+void
+rgamma_log_vec(const rgamma_log_setup<T>& setup, rand_engine_t& engine, T* __stats_pointer_settings__ vals_out, 
+               const ullint_t num_elem)
+{
+    std::normal_distribution<T> norm_dist(T(0),T(1));
+    std::uniform_real_distribution<T> unif_dist(T(0),T(1));
+
+    for (ullint_t j=ullint_t(0); j < num_elem; ++j)
+    {
+        vals_out[j] = rgamma_log_draw(setup,engine,norm_dist,unif_dist);
+    }
+}
+
+}
+
 //
 // vector/matrix output
 
@@ -27,10 +27,23 @@
 
 #ifdef STATS_ENABLE_MATRIX_FEATURES
 
-template<typename mT, typename pT, typename not_arma_mat<mT>::type* = nullptr>
+// single draw
+template<typename mT, typename pT, typename not_arma_mat<mT>::type* = nullptr,
+         typename std::enable_if<!std::is_arithmetic<mT>::value>::type* = nullptr>
 statslib_inline
 mT rinvwish(const mT& Psi_par, const pT nu_par, const bool pre_chol = false);
 
+// n draws
+template<typename mT, typename pT>
+statslib_inline
+std::vector<mT> rinvwish(const ullint_t n, const mT& Psi_par, const pT nu_par, const bool pre_chol = false, 
+                         const ullint_t seed_val = std::random_device{}());
+
+template<typename mT, typename pT>
+statslib_inline
+std::vector<mT> rinvwish(const ullint_t n, const mT& Psi_par, const pT nu_par, rand_engine_t& engine, 
+                         const bool pre_chol = false);
+
 // specializations
 #ifdef STATS_ENABLE_ARMA_WRAPPERS
 template<typename mT, typename eT, typename pT>
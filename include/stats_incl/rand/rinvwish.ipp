@@ -32,45 +32,15 @@
  * @return a pseudo-random draw from the Inverse-Wishart distribution.
  */
 
-template<typename mT, typename pT, typename not_arma_mat<mT>::type*>
+template<typename mT, typename pT, typename not_arma_mat<mT>::type*,
+         typename std::enable_if<!std::is_arithmetic<mT>::value>::type*>
 statslib_inline
 mT
 rinvwish(const mT& Psi_par, const pT nu_par, const bool pre_inv_chol)
 {
     typedef return_t<pT> eT;
-    const ullint_t K = mat_ops::n_rows(Psi_par);
-    
-    mT chol_Psi_inv;
-    if (pre_inv_chol) {
-        chol_Psi_inv = Psi_par; // should be lower triangular
-    } else {
-        chol_Psi_inv = mat_ops::chol(mat_ops::inv(Psi_par)); // will be lower triangular
-    }
 
-    //
-
-    rand_engine_t engine(std::random_device{}());
-
-    mT A;
-    mat_ops::zeros(A,K,K);
-
-    for (ullint_t i=1U; i < K; i++) {
-        for (ullint_t j=0U; j < i; j++) {
-            A(i,j) = rnorm<eT>(eT(0),eT(1),engine);
-        }
-    }
-    
-    for (ullint_t i=0U; i < K; i++) {
-        A(i,i) = std::sqrt(rchisq<eT>(eT(nu_par-i),engine));
-    }
-
-    chol_Psi_inv = chol_Psi_inv*A;
-
-    //
-
-    mT mat_out_inv = chol_Psi_inv * mat_ops::trans(chol_Psi_inv); // avoid Glue issues
-    
-    return mat_ops::inv( mat_out_inv );
+    return internal::wish_rand_single<mT>(Psi_par,eT(nu_par),pre_inv_chol,true);
 }
 
 #ifdef STATS_ENABLE_ARMA_WRAPPERS
@@ -79,30 +49,57 @@ statslib_inline
 mT
 rinvwish(const ArmaMat<eT>& Psi_par, const pT nu_par, const bool pre_inv_chol)
 {
-    const ullint_t K = Psi_par.n_rows;
-    
-    ArmaMat<eT> chol_Psi = (pre_inv_chol) ? Psi_par : arma::chol(arma::inv(Psi_par),"lower"); // should be lower-triangular
+    return internal::wish_rand_single<mT>(Psi_par,eT(nu_par),pre_inv_chol,true);
+}
+#endif
+
+//
+// n draws
 
-    //
+/**
+ * @brief Random sampling function for the Inverse-Wishart distribution
+ *
+ * @param n the number of draws.
+ * @param Psi_par a positive semi-definite scale matrix.
+ * @param nu_par the degrees of parameter, a real-valued input.
+ * @param pre_inv_chol indicate whether \c Psi_par has been inverted and passed in lower triangular (Cholesky) format.
+ * @param seed_val initialize the random streams with a non-negative integral-valued seed.
+ *
+ * @return a vector of \c n pseudo-random draws from the Inverse-Wishart distribution.
+ *
+ * \c Psi_par is factorized once, and no matrix is inverted: each draw is formed from its Bartlett factor by 
+ * triangular solves. Blocks of \c STATS_WISH_DRAW_BLOCK draws are taken in parallel when OpenMP is enabled, each 
+ * from its own random stream derived from \c seed_val.
+ */
 
-    rand_engine_t engine(std::random_device{}());
+template<typename mT, typename pT>
+statslib_inline
+std::vector<mT>
+rinvwish(const ullint_t n, const mT& Psi_par, const pT nu_par, const bool pre_inv_chol, const ullint_t seed_val)
+{
+    typedef return_t<pT> eT;
 
-    ArmaMat<eT> A = arma::zeros(K,K);
+    return internal::wish_rand_compute<mT>(n,Psi_par,eT(nu_par),pre_inv_chol,seed_val,true);
+}
 
-    for (ullint_t i=1U; i < K; i++) {
-        for (ullint_t j=0U; j < i; j++) {
-            A(i,j) = rnorm<eT>(eT(0),eT(1),engine);
-        }
-    }
-    
-    for (ullint_t i=0U; i < K; i++) {
-        A(i,i) = std::sqrt(rchisq<eT>(eT(nu_par-i),engine));
-    }
+/**
+ * @brief Random sampling function for the Inverse-Wishart distribution
+ *
+ * @param n the number of draws.
+ * @param Psi_par a positive semi-definite scale matrix.
+ * @param nu_par the degrees of parameter, a real-valued input.
+ * @param engine a random engine, passed by reference; one value is drawn from it to seed the random streams.
+ * @param pre_inv_chol indicate whether \c Psi_par has been inverted and passed in lower triangular (Cholesky) format.
+ *
+ * @return a vector of \c n pseudo-random draws from the Inverse-Wishart distribution.
+ */
 
-    chol_Psi = chol_Psi*A;
+template<typename mT, typename pT>
+statslib_inline
+std::vector<mT>
+rinvwish(const ullint_t n, const mT& Psi_par, const pT nu_par, rand_engine_t& engine, const bool pre_inv_chol)
+{
+    typedef return_t<pT> eT;
 
-    //
-    
-    return arma::inv(chol_Psi * chol_Psi.t());
+    return internal::wish_rand_compute<mT>(n,Psi_par,eT(nu_par),pre_inv_chol,static_cast<ullint_t>(engine()),true);
 }
-#endif
@@ -34,7 +34,7 @@ rmultinom(const mT& prob)
     //
 
     mT ret(n_prob,1);
-    const mT prob_csum = mat_ops::cumsum(prob);
+    const mT prob_csum = mat_ops::cumsum(prob,true);
 
     eT p_j = prob(0,0);
     ret(0,0) = rbinom(n_j,p_j);
@@ -27,6 +27,12 @@
 
 #ifdef STATS_ENABLE_MATRIX_FEATURES
 
+// rows drawn from one random stream by the n-sample rmvnorm; the output does not depend on the number of threads
+
+#ifndef STATS_MVN_DRAW_BLOCK
+    #define STATS_MVN_DRAW_BLOCK ullint_t(1024)
+#endif
+
 // vector draw
 template<typename vT, typename mT, typename not_arma_mat<mT>::type* = nullptr>
 statslib_inline
@@ -35,7 +41,12 @@ vT rmvnorm(const vT& mu_par, const mT& Sigma_par, const bool pre_chol = false);
 // n samples
 template<typename vT, typename mT, typename not_arma_mat<mT>::type* = nullptr>
 statslib_inline
-mT rmvnorm(const ullint_t n, const vT& mu_par, const mT& Sigma_par, const bool pre_chol = false);
+mT rmvnorm(const ullint_t n, const vT& mu_par, const mT& Sigma_par, const bool pre_chol = false, 
+           const ullint_t seed_val = std::random_device{}());
+
+template<typename vT, typename mT, typename not_arma_mat<mT>::type* = nullptr>
+statslib_inline
+mT rmvnorm(const ullint_t n, const vT& mu_par, const mT& Sigma_par, rand_engine_t& engine, const bool pre_chol = false);
 
 // specializations
 #ifdef STATS_ENABLE_ARMA_WRAPPERS
@@ -45,7 +56,13 @@ mT rmvnorm(const mT& mu_par, const ArmaMat<eT>& Sigma_par, const bool pre_chol =
 
 template<typename mT, typename eT>
 statslib_inline
-ArmaMat<eT> rmvnorm(const ullint_t n, const mT& mu_par, const ArmaMat<eT>& Sigma_par, const bool pre_chol = false);
+ArmaMat<eT> rmvnorm(const ullint_t n, const mT& mu_par, const ArmaMat<eT>& Sigma_par, const bool pre_chol = false, 
+                    const ullint_t seed_val = std::random_device{}());
+
+template<typename mT, typename eT>
+statslib_inline
+ArmaMat<eT> rmvnorm(const ullint_t n, const mT& mu_par, const ArmaMat<eT>& Sigma_par, rand_engine_t& engine, 
+                    const bool pre_chol = false);
 #endif
 
 #include "rmvnorm.ipp"
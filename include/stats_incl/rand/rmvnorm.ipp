@@ -22,6 +22,228 @@
  * Sample from a multivariate normal distribution
  */
 
+namespace internal
+{
+
+// lower Cholesky factor of Sigma, or the lower triangle of Sigma when it is passed in factored form, into
+// L_vals (column-major); returns false if the factor has a non-positive or non-finite diagonal
+
+template<typename mT, typename eT>
+statslib_inline
+bool
+rmvnorm_factor_vals(const mT& Sigma_par, const ullint_t K, const bool pre_chol, std::vector<eT>& L_vals)
+{
+    if (!pre_chol) {
+        const mat_ops::chol_fact<mT> chol_sig(Sigma_par);
+        mvnorm_factor_vals(chol_sig,K,L_vals);
+
+        return chol_sig.is_valid();
+    }
+
+    L_vals.assign(K*K, eT(0));
+
+    bool valid_flag = true;
+
+    for (ullint_t k=ullint_t(0); k < K; ++k)
+    {
+        for (ullint_t r=k; r < K; ++r)
+        {
+            L_vals[r + k*K] = static_cast<eT>(Sigma_par(r,k));
+        }
+
+        valid_flag = valid_flag && GCINT::is_finite(L_vals[k + k*K]) && L_vals[k + k*K] > eT(0);
+    }
+
+    return valid_flag;
+}
+
+// mu + L z, overwriting a block of n_block standard normal vectors z held one coordinate after another 
+// (coordinate k of draw b at z_vals[k*n_block + b]). Coordinates are formed from the last to the first, so 
+// that each is computed from coordinates not yet overwritten, and the inner loop runs over draws.
+
+template<typename eT>
+statslib_inline
+void
+mvnorm_tri_mult_block(const eT* __stats_pointer_settings__ L_vals, const eT* __stats_pointer_settings__ mu_vals, 
+                      const ullint_t K, eT* __stats_pointer_settings__ z_vals, const ullint_t n_block)
+{
+    for (ullint_t k_rev=K; k_rev > ullint_t(0); --k_rev)
+    {
+        const ullint_t k = k_rev - ullint_t(1);
+
+        const eT L_kk = L_vals[k + k*K];
+        eT* z_k = z_vals + k*n_block;
+
+        for (ullint_t b=ullint_t(0); b < n_block; ++b)
+        {
+            z_k[b] *= L_kk;
+        }
+
+        for (ullint_t r=ullint_t(0); r < k; ++r)
+        {
+            const eT L_kr = L_vals[k + r*K];
+            const eT* z_r = z_vals + r*n_block;
+
+            for (ullint_t b=ullint_t(0); b < n_block; ++b)
+            {
+                z_k[b] += L_kr * z_r[b];
+            }
+        }
+
+        for (ullint_t b=ullint_t(0); b < n_block; ++b)
+        {
+            z_k[b] += mu_vals[k];
+        }
+    }
+}
+
+// fill the n x K matrix X with draws. Block j of STATS_MVN_DRAW_BLOCK rows takes its normals from an engine
+// seeded by (seed_val, j), so that blocks can be filled in parallel and the draws are reproducible for any
+// number of threads.
+
+template<typename mT, typename eT>
+statslib_inline
+void
+rmvnorm_rows(const eT* L_vals, const eT* mu_vals, const ullint_t K, const bool valid_flag, 
+             const ullint_t seed_val, mT& X)
+{
+    const ullint_t n = mat_ops::n_rows(X);
+    const ullint_t n_blocks = (n + STATS_MVN_DRAW_BLOCK - ullint_t(1)) / STATS_MVN_DRAW_BLOCK;
+
+#ifdef STATS_USE_OPENMP
+    #pragma omp parallel for
+#endif
+    for (ullint_t j=ullint_t(0); j < n_blocks; ++j)
+    {
+        const ullint_t i_begin = j*STATS_MVN_DRAW_BLOCK;
+        const ullint_t n_block = std::min(STATS_MVN_DRAW_BLOCK, n - i_begin);
+
+        std::seed_seq seed_seq_j = { uint_t(seed_val), uint_t(seed_val >> 32), uint_t(j), uint_t(j >> 32) };
+        rand_engine_t engine_j(seed_seq_j);
+
+        std::normal_distribution<eT> norm_dist(eT(0),eT(1));
+
+        std::vector<eT> z_vals(K*n_block);
+
+        for (ullint_t b=ullint_t(0); b < n_block; ++b)
+        {
+            for (ullint_t k=ullint_t(0); k < K; ++k)
+            {
+                z_vals[k*n_block + b] = norm_dist(engine_j);
+            }
+        }
+
+        mvnorm_tri_mult_block(L_vals,mu_vals,K,z_vals.data(),n_block);
+
+        for (ullint_t k=ullint_t(0); k < K; ++k)
+        {
+            for (ullint_t b=ullint_t(0); b < n_block; ++b)
+            {
+                X(i_begin + b,k) = valid_flag ? z_vals[k*n_block + b] : STLIM<eT>::quiet_NaN();
+            }
+        }
+    }
+}
+
+// K = 2, ..., 8: one draw, mu + L z, with L formed on the stack (or read from the lower triangle of Sigma when it
+// is passed in factored form)
+
+template<ullint_t K, typename vT, typename mT, typename eT>
+statslib_inline
+void
+rmvnorm_small(const vT& mu_par, const mT& Sigma_par, const bool pre_chol, rand_engine_t& engine, vT& X)
+{
+    small_mat<eT,K> L;
+    bool valid_flag;
+
+    if (pre_chol) {
+        small_mat_load_lower(Sigma_par,L);
+        valid_flag = small_chol_valid(L);
+    } else {
+        small_mat<eT,K> S;
+        small_mat_load(Sigma_par,S);
+        valid_flag = small_chol(S,L);
+    }
+
+    std::normal_distribution<eT> norm_dist(eT(0),eT(1));
+
+    eT z_vals[K];
+
+    for (ullint_t k=ullint_t(0); k < K; ++k)
+    {
+        z_vals[k] = norm_dist(engine);
+    }
+
+    X = mu_par;
+
+    for (ullint_t k=ullint_t(0); k < K; ++k)
+    {
+        eT val = static_cast<eT>(mu_par(k,0));
+
+        for (ullint_t r=ullint_t(0); r <= k; ++r)
+        {
+            val += L(k,r) * z_vals[r];
+        }
+
+        X(k,0) = valid_flag ? val : STLIM<eT>::quiet_NaN();
+    }
+}
+
+template<typename vT, typename mT, typename eT>
+struct rmvnorm_small_fn
+{
+    const vT& mu_par;
+    const mT& Sigma_par;
+    const bool pre_chol;
+    rand_engine_t& engine;
+
+    vT& X;
+
+    template<ullint_t K>
+    statslib_inline
+    void
+    run()
+    {
+        rmvnorm_small<K,vT,mT,eT>(mu_par,Sigma_par,pre_chol,engine,X);
+    }
+};
+
+template<typename rT, typename vT, typename mT, typename eT = double>
+statslib_inline
+rT
+rmvnorm_compute(const ullint_t n, const vT& mu_par, const mT& Sigma_par, const bool pre_chol, const ullint_t seed_val)
+{
+    rT ret;
+
+    const ullint_t K = mat_ops::n_rows(Sigma_par);
+
+    if (mat_ops::n_elem(mu_par) != K)
+    {
+        printf("rmvnorm: dimensions of mu and Sigma do not agree.\n");
+        return ret;
+    }
+
+    //
+
+    std::vector<eT> L_vals;
+    std::vector<eT> mu_vals(K);
+
+    const bool valid_flag = rmvnorm_factor_vals(Sigma_par,K,pre_chol,L_vals);
+
+    for (ullint_t k=ullint_t(0); k < K; ++k)
+    {
+        mu_vals[k] = static_cast<eT>(mu_par(k,0));
+    }
+
+    mat_ops::zeros(ret,n,K);
+
+    rmvnorm_rows(L_vals.data(),mu_vals.data(),K,valid_flag,seed_val,ret);
+
+    return ret;
+}
+
+}
+
 /**
  * @brief Random sampling function for the Multivariate-Normal distribution
  *
@@ -30,6 +252,8 @@
  * @param pre_chol indicate whether \c Sigma_par is passed in lower triangular (Cholesky) format.
  *
  * @return a pseudo-random draw from the Multivariate-Normal distribution.
+ *
+ * For dimensions 2 to 8, a fixed-size kernel is used, with \c Sigma_par factorized on the stack.
  */
 
 template<typename vT, typename mT, typename not_arma_mat<mT>::type*>
@@ -47,11 +271,22 @@ rmvnorm(const vT& mu_par, const mT& Sigma_par, const bool pre_chol)
         return ret;
     }
 
+    rand_engine_t engine(std::random_device{}());
+    internal::rmvnorm_small_fn<vT,mT,double> small_fn = { mu_par, Sigma_par, pre_chol, engine, ret };
+
+    if (internal::small_mat_dispatch(K,small_fn)) {
+        return ret;
+    }
+
     //
 
-    const mT A = (pre_chol) ? Sigma_par : mat_ops::chol(Sigma_par); // should be lower-triangular
+    const vT Z = rnorm<vT>(K,1);
 
-    ret = mu_par + A * rnorm<vT>(K,1);
+    if (pre_chol) {
+        ret = mu_par + Sigma_par * Z; // should be lower-triangular
+    } else {
+        ret = mu_par + mat_ops::chol_fact<mT>(Sigma_par).tri_mult(Z);
+    }
 
     //
     
@@ -75,12 +310,22 @@ rmvnorm(const mT& mu_par, const ArmaMat<eT>& Sigma_par, const bool pre_chol)
         return ret;
     }
 
+    rand_engine_t engine(std::random_device{}());
+    internal::rmvnorm_small_fn<mT,ArmaMat<eT>,eT> small_fn = { mu_par, Sigma_par, pre_chol, engine, ret };
+
+    if (internal::small_mat_dispatch(K,small_fn)) {
+        return ret;
+    }
+
     //
 
-    const ArmaMat<eT> A = (pre_chol) ? Sigma_par : arma::chol(Sigma_par,"lower"); // should be lower-triangular
+    const ArmaMat<eT> Z = rnorm<ArmaMat<eT>>(K,1);
 
-    // ret = mu_par + A * rnorm<mT>(K,1);
-    ret = mu_par + A * arma::randn<mT>(K,1);
+    if (pre_chol) {
+        ret = mu_par + Sigma_par * Z; // should be lower-triangular
+    } else {
+        ret = mu_par + mat_ops::chol_fact<ArmaMat<eT>>(Sigma_par).tri_mult(Z);
+    }
 
     //
     
@@ -91,30 +336,47 @@ rmvnorm(const mT& mu_par, const ArmaMat<eT>& Sigma_par, const bool pre_chol)
 //
 // n-samples: results will be an n x K matrix
 
+/**
+ * @brief Random sampling function for the Multivariate-Normal distribution
+ *
+ * @param n the number of draws.
+ * @param mu_par mean vector.
+ * @param Sigma_par the covariance matrix.
+ * @param pre_chol indicate whether \c Sigma_par is passed in lower triangular (Cholesky) format.
+ * @param seed_val initialize the random streams with a non-negative integral-valued seed.
+ *
+ * @return an n x K matrix of pseudo-random draws from the Multivariate-Normal distribution, one per row.
+ *
+ * The rows are filled in blocks of \c STATS_MVN_DRAW_BLOCK, in parallel when OpenMP is enabled, each block from its own
+ * random stream derived from \c seed_val; the draws for a given seed do not depend on the number of threads.
+ */
+
 template<typename vT, typename mT, typename not_arma_mat<mT>::type*>
 statslib_inline
 mT
-rmvnorm(const ullint_t n, const vT& mu_par, const mT& Sigma_par, const bool pre_chol)
+rmvnorm(const ullint_t n, const vT& mu_par, const mT& Sigma_par, const bool pre_chol, const ullint_t seed_val)
 {
-    mT ret;
-
-    const ullint_t K = mat_ops::n_rows(Sigma_par);
-
-    if (mat_ops::n_elem(mu_par) != K)
-    {
-        printf("rmvnorm: dimensions of mu and Sigma do not agree.\n");
-        return ret;
-    }
-
-    //
-
-    const mT A = (pre_chol) ? Sigma_par : mat_ops::chol(Sigma_par); // should be lower-triangular
+    return internal::rmvnorm_compute<mT>(n,mu_par,Sigma_par,pre_chol,seed_val);
+}
 
-    ret = mat_ops::repmat(mat_ops::trans(mu_par),n,1) + rnorm<mT>(n,K) * mat_ops::trans(A);
+/**
+ * @brief Random sampling function for the Multivariate-Normal distribution
+ *
+ * @param n the number of draws.
+ * @param mu_par mean vector.
+ * @param Sigma_par the covariance matrix.
+ * @param engine a random engine, passed by reference; one value is drawn from it to seed the random streams.
+ * @param pre_chol indicate whether \c Sigma_par is passed in lower triangular (Cholesky) format.
+ *
+ * @return an n x K matrix of pseudo-random draws from the Multivariate-Normal distribution, one per row.
+ */
 
-    //
-    
-    return ret;
+template<typename vT, typename mT, typename not_arma_mat<mT>::type*>
+statslib_inline
+mT
+rmvnorm(const ullint_t n, const vT& mu_par, const mT& Sigma_par, rand_engine_t& engine, const bool pre_chol)
+{
+    return internal::rmvnorm_compute<mT>(n,mu_par,Sigma_par,pre_chol,static_cast<ullint_t>(engine()));
 }
 
 #ifdef STATS_ENABLE_ARMA_WRAPPERS
@@ -122,27 +384,16 @@ rmvnorm(const ullint_t n, const vT& mu_par, const mT& Sigma_par, const bool pre_
 template<typename mT, typename eT>
 statslib_inline
 ArmaMat<eT>
-rmvnorm(const ullint_t n, const mT& mu_par, const ArmaMat<eT>& Sigma_par, const bool pre_chol)
+rmvnorm(const ullint_t n, const mT& mu_par, const ArmaMat<eT>& Sigma_par, const bool pre_chol, const ullint_t seed_val)
 {
-    ArmaMat<eT> ret;
-
-    const ullint_t K = Sigma_par.n_rows;
-
-    if (mu_par.n_elem != K)
-    {
-        printf("rmvnorm: dimensions of mu and Sigma do not agree.\n");
-        return ret;
-    }
-
-    //
-
-    const ArmaMat<eT> A = (pre_chol) ? Sigma_par : arma::chol(Sigma_par,"lower"); // should be lower-triangular
-
-    // ret = arma::repmat(mu_par.t(),n,1) + rnorm<ArmaMat<eT>>(n,K) * A.t();
-    ret = arma::repmat(mu_par.t(),n,1) + arma::randn<ArmaMat<eT>>(n,K) * A.t();
+    return internal::rmvnorm_compute<ArmaMat<eT>,mT,ArmaMat<eT>,eT>(n,mu_par,Sigma_par,pre_chol,seed_val);
+}
 
-    //
-    
-    return ret;
+template<typename mT, typename eT>
+statslib_inline
+ArmaMat<eT>
+rmvnorm(const ullint_t n, const mT& mu_par, const ArmaMat<eT>& Sigma_par, rand_engine_t& engine, const bool pre_chol)
+{
+    return internal::rmvnorm_compute<ArmaMat<eT>,mT,ArmaMat<eT>,eT>(n,mu_par,Sigma_par,pre_chol,static_cast<ullint_t>(engine()));
 }
 #endif
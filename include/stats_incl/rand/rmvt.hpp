@@ -0,0 +1,68 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Sample from a multivariate t distribution
+ */
+
+#ifndef _statslib_rmvt_HPP
+#define _statslib_rmvt_HPP
+
+#ifdef STATS_ENABLE_MATRIX_FEATURES
+
+// vector draw
+template<typename vT, typename mT, typename pT, typename not_arma_mat<mT>::type* = nullptr,
+         typename std::enable_if<!std::is_arithmetic<vT>::value>::type* = nullptr>
+statslib_inline
+vT rmvt(const vT& mu_par, const mT& Sigma_par, const pT dof_par, const bool pre_chol = false);
+
+// n samples
+template<typename vT, typename mT, typename pT, typename not_arma_mat<mT>::type* = nullptr>
+statslib_inline
+mT rmvt(const ullint_t n, const vT& mu_par, const mT& Sigma_par, const pT dof_par, const bool pre_chol = false, 
+        const ullint_t seed_val = std::random_device{}());
+
+template<typename vT, typename mT, typename pT, typename not_arma_mat<mT>::type* = nullptr>
+statslib_inline
+mT rmvt(const ullint_t n, const vT& mu_par, const mT& Sigma_par, const pT dof_par, rand_engine_t& engine, 
+        const bool pre_chol = false);
+
+// specializations
+#ifdef STATS_ENABLE_ARMA_WRAPPERS
+template<typename mT, typename eT, typename pT, typename std::enable_if<!std::is_arithmetic<mT>::value>::type* = nullptr>
+statslib_inline
+mT rmvt(const mT& mu_par, const ArmaMat<eT>& Sigma_par, const pT dof_par, const bool pre_chol = false);
+
+template<typename mT, typename eT, typename pT>
+statslib_inline
+ArmaMat<eT> rmvt(const ullint_t n, const mT& mu_par, const ArmaMat<eT>& Sigma_par, const pT dof_par, 
+                 const bool pre_chol = false, const ullint_t seed_val = std::random_device{}());
+
+template<typename mT, typename eT, typename pT>
+statslib_inline
+ArmaMat<eT> rmvt(const ullint_t n, const mT& mu_par, const ArmaMat<eT>& Sigma_par, const pT dof_par, 
+                 rand_engine_t& engine, const bool pre_chol = false);
+#endif
+
+#include "rmvt.ipp"
+
+#endif
+
+#endif
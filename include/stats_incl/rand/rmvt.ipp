@@ -0,0 +1,265 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Sample from a multivariate t distribution
+ */
+
+namespace internal
+{
+
+// fill the n x K matrix X with draws mu + L z / sqrt(w / nu), z standard normal and w chi-squared(nu), formed as
+// w = 2 g with g ~ Gamma(nu/2, 1) drawn on the log scale from gamma_setup, the constants for shape nu/2. Block j of
+// STATS_MVN_DRAW_BLOCK rows takes its normals, and then its Gamma variates, from an engine seeded by (seed_val, j),
+// so that the draws are reproducible for any number of threads.
+
+template<typename mT, typename eT>
+statslib_inline
+void
+rmvt_rows(const eT* L_vals, const eT* mu_vals, const ullint_t K, const eT dof_par, 
+          const rgamma_log_setup<eT>& gamma_setup, const bool valid_flag, const ullint_t seed_val, mT& X)
+{
+    const ullint_t n = mat_ops::n_rows(X);
+    const ullint_t n_blocks = (n + STATS_MVN_DRAW_BLOCK - ullint_t(1)) / STATS_MVN_DRAW_BLOCK;
+
+    const std::vector<eT> zero_vals(K, eT(0));
+    const eT log_half_dof = std::log(dof_par / eT(2));
+
+#ifdef STATS_USE_OPENMP
+    #pragma omp parallel for
+#endif
+    for (ullint_t j=ullint_t(0); j < n_blocks; ++j)
+    {
+        const ullint_t i_begin = j*STATS_MVN_DRAW_BLOCK;
+        const ullint_t n_block = std::min(STATS_MVN_DRAW_BLOCK, n - i_begin);
+
+        std::seed_seq seed_seq_j = { uint_t(seed_val), uint_t(seed_val >> 32), uint_t(j), uint_t(j >> 32) };
+        rand_engine_t engine_j(seed_seq_j);
+
+        std::normal_distribution<eT> norm_dist(eT(0),eT(1));
+
+        std::vector<eT> z_vals(K*n_block);
+        std::vector<eT> scale_vals(n_block);
+
+        for (ullint_t b=ullint_t(0); b < n_block; ++b)
+        {
+            for (ullint_t k=ullint_t(0); k < K; ++k)
+            {
+                z_vals[k*n_block + b] = norm_dist(engine_j);
+            }
+        }
+
+        // sqrt(nu / w) = exp( (log(nu/2) - log g) / 2 )
+
+        rgamma_log_vec(gamma_setup,engine_j,scale_vals.data(),n_block);
+
+        for (ullint_t b=ullint_t(0); b < n_block; ++b)
+        {
+            scale_vals[b] = std::exp( eT(0.5) * (log_half_dof - scale_vals[b]) );
+        }
+
+        mvnorm_tri_mult_block(L_vals,zero_vals.data(),K,z_vals.data(),n_block);
+
+        for (ullint_t k=ullint_t(0); k < K; ++k)
+        {
+            for (ullint_t b=ullint_t(0); b < n_block; ++b)
+            {
+                X(i_begin + b,k) = valid_flag ? mu_vals[k] + scale_vals[b] * z_vals[k*n_block + b] : 
+                                                STLIM<eT>::quiet_NaN();
+            }
+        }
+    }
+}
+
+template<typename rT, typename vT, typename mT, typename eT = double>
+statslib_inline
+rT
+rmvt_compute(const ullint_t n, const vT& mu_par, const mT& Sigma_par, const eT dof_par, const bool pre_chol, 
+             const ullint_t seed_val)
+{
+    rT ret;
+
+    const ullint_t K = mat_ops::n_rows(Sigma_par);
+
+    if (mat_ops::n_elem(mu_par) != K)
+    {
+        printf("rmvt: dimensions of mu and Sigma do not agree.\n");
+        return ret;
+    }
+
+    //
+
+    std::vector<eT> L_vals;
+    std::vector<eT> mu_vals(K);
+
+    const rgamma_log_setup<eT> gamma_setup = rgamma_log_init(dof_par / eT(2));
+
+    const bool valid_flag = rmvnorm_factor_vals(Sigma_par,K,pre_chol,L_vals) && gamma_setup.valid_flag;
+
+    for (ullint_t k=ullint_t(0); k < K; ++k)
+    {
+        mu_vals[k] = static_cast<eT>(mu_par(k,0));
+    }
+
+    mat_ops::zeros(ret,n,K);
+
+    rmvt_rows(L_vals.data(),mu_vals.data(),K,dof_par,gamma_setup,valid_flag,seed_val,ret);
+
+    return ret;
+}
+
+// a single K x 1 draw, formed as the one row of an n = 1 draw
+
+template<typename vT, typename mT, typename eT>
+statslib_inline
+vT
+rmvt_single(const vT& mu_par, const mT& Sigma_par, const eT dof_par, const bool pre_chol)
+{
+    vT ret;
+
+    const ullint_t K = mat_ops::n_rows(Sigma_par);
+    const mT X = rmvt_compute<mT,vT,mT,eT>(ullint_t(1),mu_par,Sigma_par,dof_par,pre_chol,std::random_device{}());
+
+    if (mat_ops::n_elem(X) != K) {
+        return ret;
+    }
+
+    ret = mu_par;
+
+    for (ullint_t k=ullint_t(0); k < K; ++k)
+    {
+        ret(k,0) = X(0,k);
+    }
+
+    return ret;
+}
+
+}
+
+/**
+ * @brief Random sampling function for the Multivariate t distribution
+ *
+ * @param mu_par location vector.
+ * @param Sigma_par the scale matrix.
+ * @param dof_par the degrees of freedom parameter, a real-valued input.
+ * @param pre_chol indicate whether \c Sigma_par is passed in lower triangular (Cholesky) format.
+ *
+ * @return a pseudo-random draw from the Multivariate t distribution.
+ */
+
+template<typename vT, typename mT, typename pT, typename not_arma_mat<mT>::type*, 
+         typename std::enable_if<!std::is_arithmetic<vT>::value>::type*>
+statslib_inline
+vT
+rmvt(const vT& mu_par, const mT& Sigma_par, const pT dof_par, const bool pre_chol)
+{
+    return internal::rmvt_single(mu_par,Sigma_par,static_cast<return_t<pT>>(dof_par),pre_chol);
+}
+
+#ifdef STATS_ENABLE_ARMA_WRAPPERS
+// mu is templated as it could be of type Col<eT> or Mat<eT>
+template<typename mT, typename eT, typename pT, typename std::enable_if<!std::is_arithmetic<mT>::value>::type*>
+statslib_inline
+mT
+rmvt(const mT& mu_par, const ArmaMat<eT>& Sigma_par, const pT dof_par, const bool pre_chol)
+{
+    return internal::rmvt_single(mu_par,Sigma_par,static_cast<eT>(dof_par),pre_chol);
+}
+#endif
+
+//
+// n-samples: results will be an n x K matrix
+
+/**
+ * @brief Random sampling function for the Multivariate t distribution
+ *
+ * @param n the number of draws.
+ * @param mu_par location vector.
+ * @param Sigma_par the scale matrix.
+ * @param dof_par the degrees of freedom parameter, a real-valued input.
+ * @param pre_chol indicate whether \c Sigma_par is passed in lower triangular (Cholesky) format.
+ * @param seed_val initialize the random streams with a non-negative integral-valued seed.
+ *
+ * @return an n x K matrix of pseudo-random draws from the Multivariate t distribution, one per row.
+ *
+ * \c Sigma_par is factorized once, and the Gamma(dof/2) sampler constants for the chi-squared scalings are formed 
+ * once. The rows are filled in blocks of \c STATS_MVN_DRAW_BLOCK, in parallel when OpenMP is enabled; each block draws 
+ * its normal vectors and then its chi-squared scalings from its own random stream derived from \c seed_val, so the 
+ * draws for a given seed do not depend on the number of threads.
+ */
+
+template<typename vT, typename mT, typename pT, typename not_arma_mat<mT>::type*>
+statslib_inline
+mT
+rmvt(const ullint_t n, const vT& mu_par, const mT& Sigma_par, const pT dof_par, const bool pre_chol, 
+     const ullint_t seed_val)
+{
+    typedef return_t<pT> eT;
+
+    return internal::rmvt_compute<mT,vT,mT,eT>(n,mu_par,Sigma_par,static_cast<eT>(dof_par),pre_chol,seed_val);
+}
+
+/**
+ * @brief Random sampling function for the Multivariate t distribution
+ *
+ * @param n the number of draws.
+ * @param mu_par location vector.
+ * @param Sigma_par the scale matrix.
+ * @param dof_par the degrees of freedom parameter, a real-valued input.
+ * @param engine a random engine, passed by reference; one value is drawn from it to seed the random streams.
+ * @param pre_chol indicate whether \c Sigma_par is passed in lower triangular (Cholesky) format.
+ *
+ * @return an n x K matrix of pseudo-random draws from the Multivariate t distribution, one per row.
+ */
+
+template<typename vT, typename mT, typename pT, typename not_arma_mat<mT>::type*>
+statslib_inline
+mT
+rmvt(const ullint_t n, const vT& mu_par, const mT& Sigma_par, const pT dof_par, rand_engine_t& engine, 
+     const bool pre_chol)
+{
+    typedef return_t<pT> eT;
+
+    return internal::rmvt_compute<mT,vT,mT,eT>(n,mu_par,Sigma_par,static_cast<eT>(dof_par),pre_chol,
+                                               static_cast<ullint_t>(engine()));
+}
+
+#ifdef STATS_ENABLE_ARMA_WRAPPERS
+// mu is templated as it could be of type Col<eT> or Mat<eT>
+template<typename mT, typename eT, typename pT>
+statslib_inline
+ArmaMat<eT>
+rmvt(const ullint_t n, const mT& mu_par, const ArmaMat<eT>& Sigma_par, const pT dof_par, const bool pre_chol, 
+     const ullint_t seed_val)
+{
+    return internal::rmvt_compute<ArmaMat<eT>,mT,ArmaMat<eT>,eT>(n,mu_par,Sigma_par,static_cast<eT>(dof_par),
+                                                                  pre_chol,seed_val);
+}
+
+template<typename mT, typename eT, typename pT>
+statslib_inline
+ArmaMat<eT>
+rmvt(const ullint_t n, const mT& mu_par, const ArmaMat<eT>& Sigma_par, const pT dof_par, rand_engine_t& engine, 
+     const bool pre_chol)
+{
+    return internal::rmvt_compute<ArmaMat<eT>,mT,ArmaMat<eT>,eT>(n,mu_par,Sigma_par,static_cast<eT>(dof_par),
+                                                                  pre_chol,static_cast<ullint_t>(engine()));
+}
+#endif
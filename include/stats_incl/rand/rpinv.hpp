@@ -0,0 +1,127 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/* 
+ * Tabulated inverse-CDF sampling for frozen parameters, following the
+ * polynomial interpolation based inversion (PINV) method of Derflinger, Hormann, and Leydold (2010)
+ */
+
+#ifndef _statslib_rpinv_HPP
+#define _statslib_rpinv_HPP
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+/**
+ * @brief Inverse-CDF sampler for a fixed parameter set
+ *
+ * Stores a piecewise Newton interpolant of the quantile function, built once from the density 
+ * so that the u-error, \f$ |u - F(\hat{F}^{-1}(u))| \f$, stays below a user-specified resolution.
+ * A draw is then a guide-table lookup and a polynomial evaluation.
+ *
+ * Samplers for the Beta, Gamma, t, and F distributions are built by \c pinv_beta, \c pinv_gamma, \c pinv_t, and \c pinv_f; 
+ * draws are taken with \c rpinv.
+ * The sampler is opt-in: \c rbeta, \c rgamma, \c rt, and \c rf, including their vector and matrix outputs,
+ * keep their exact generators and do not build a table.
+ */
+
+template<typename T = double>
+class pinv_sampler
+{
+    public:
+        pinv_sampler() = default;
+
+        template<typename Fn>
+        pinv_sampler(Fn dens_fn, const T x_lower, const T x_upper, const T u_lower, const T u_resolution);
+
+        T quantile(const T u) const;
+
+        T operator()(rand_engine_t& engine) const;
+
+        bool is_valid() const;
+        ullint_t n_intervals() const;
+        T u_error() const;
+
+    private:
+        static const int order = 5;     // polynomial order on each interval
+
+        bool valid_flag = false;
+        T max_u_error = T(0);
+
+        T x_lo = T(0);
+        T x_hi = T(0);
+
+        std::vector<T> u_start;         // CDF value at the start of each interval; n_intervals + 1 entries
+        std::vector<T> u_nodes;         // interpolation nodes, relative to u_start; (order + 1) per interval
+        std::vector<T> x_coefs;         // Newton coefficients; (order + 1) per interval
+        std::vector<ullint_t> guide;    // guide table over u_start
+};
+
+//
+// build
+
+template<typename T1, typename T2>
+statslib_inline
+pinv_sampler<common_return_t<T1,T2>>
+pinv_beta(const T1 a_par, const T2 b_par, const double u_resolution = 1e-10);
+
+template<typename T1, typename T2>
+statslib_inline
+pinv_sampler<common_return_t<T1,T2>>
+pinv_gamma(const T1 shape_par, const T2 scale_par, const double u_resolution = 1e-10);
+
+template<typename T1>
+statslib_inline
+pinv_sampler<return_t<T1>>
+pinv_t(const T1 dof_par, const double u_resolution = 1e-10);
+
+template<typename T1, typename T2>
+statslib_inline
+pinv_sampler<common_return_t<T1,T2>>
+pinv_f(const T1 df1_par, const T2 df2_par, const double u_resolution = 1e-10);
+
+//
+// scalar output
+
+template<typename T>
+statslib_inline
+T
+rpinv(const pinv_sampler<T>& sampler, rand_engine_t& engine);
+
+template<typename T>
+statslib_inline
+T
+rpinv(const pinv_sampler<T>& sampler, const ullint_t seed_val = std::random_device{}());
+
+//
+// vector/matrix output
+
+template<typename mT, typename T>
+statslib_inline
+mT
+rpinv(const ullint_t n, const ullint_t k, const pinv_sampler<T>& sampler);
+
+//
+// include implementation files
+
+#include "rpinv.ipp"
+
+#endif
+
+#endif
@@ -0,0 +1,573 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/* 
+ * Tabulated inverse-CDF sampling for frozen parameters, following the
+ * polynomial interpolation based inversion (PINV) method of Derflinger, Hormann, and Leydold (2010)
+ */
+
+namespace internal
+{
+
+template<typename T>
+statslib_inline
+T
+pinv_u_tol(const T u_resolution)
+{   // supported u-resolutions, as in PINV
+    return GCINT::is_nan(u_resolution) ? T(1e-10) : std::min(std::max(u_resolution,T(1e-13)),T(1e-05));
+}
+
+// five-point Gauss-Lobatto quadrature of the density over [a,b]
+
+template<typename T, typename Fn>
+statslib_inline
+T
+pinv_gauss_lobatto(const Fn& dens_fn, const T a_val, const T b_val)
+{
+    const T mid_val = (a_val + b_val) / T(2);
+    const T half_width = (b_val - a_val) / T(2);
+    const T node_val = half_width * std::sqrt(T(3) / T(7));
+
+    return half_width * ( T(0.1) * (dens_fn(a_val) + dens_fn(b_val)) 
+                          + T(49)/T(90) * (dens_fn(mid_val - node_val) + dens_fn(mid_val + node_val))
+                          + T(32)/T(45) * dens_fn(mid_val) );
+}
+
+// Newton form: c_0 + (v - v_0)*(c_1 + (v - v_1)*(c_2 + ...))
+
+template<typename T>
+statslib_inline
+T
+pinv_newton_eval(const T* __stats_pointer_settings__ u_nodes, const T* __stats_pointer_settings__ x_coefs, const int order, const T v_val)
+{
+    T ret = x_coefs[order];
+
+    for (int k = order - 1; k >= 0; --k) {
+        ret = x_coefs[k] + (v_val - u_nodes[k]) * ret;
+    }
+
+    return ret;
+}
+
+}
+
+//
+// build
+
+/**
+ * @brief Build an inverse-CDF sampler from a density
+ *
+ * @param dens_fn the density function, callable as <tt>dens_fn(x)</tt>.
+ * @param x_lower the lower end of the (truncated) support.
+ * @param x_upper the upper end of the (truncated) support.
+ * @param u_lower the probability mass below \c x_lower.
+ * @param u_resolution the maximal tolerated u-error, in \f$ [10^{-13}, 10^{-5}] \f$.
+ *
+ * The support is split adaptively into intervals; on each, the quantile function is interpolated 
+ * by a fifth-order Newton polynomial through Chebyshev points, and CDF increments are computed 
+ * by Gauss-Lobatto quadrature of the density. An interval is accepted once the u-error, checked
+ * midway between the nodes, is below \c u_resolution. Where intervals can no longer be resolved in floating-point,
+ * as next to a pole at the upper end, the table is truncated and the remaining mass is reported by \c u_error().
+ * If setup fails (more than 10000 intervals, or a non-finite domain), \c is_valid() returns \c false and draws are \c NaN.
+ */
+
+template<typename T>
+template<typename Fn>
+pinv_sampler<T>::pinv_sampler(Fn dens_fn, const T x_lower, const T x_upper, const T u_lower, const T u_resolution)
+    : x_lo(x_lower), x_hi(x_upper)
+{
+    const ullint_t max_intervals = 10000;
+
+    const T u_tol = internal::pinv_u_tol(u_resolution);
+    const T quad_tol = T(0.05) * u_tol;
+
+    if (!(x_lo < x_hi) || !GCINT::is_finite(x_lo) || !GCINT::is_finite(x_hi) || !(u_lower >= T(0))) {
+        return;
+    }
+
+    T x_n[order+1], u_n[order+1], c_n[order+1];
+
+    T h_val = (x_hi - x_lo) / T(128);
+    T a_val = x_lo;
+
+    u_start.push_back(u_lower);
+
+    while (a_val < x_hi)
+    {
+        if (n_intervals() >= max_intervals) {
+            u_start.clear(); u_nodes.clear(); x_coefs.clear();
+            return;
+        }
+
+        if (!(h_val > T(16) * STLIM<T>::epsilon() * std::abs(a_val))) {
+            // the interval width can no longer be resolved, e.g., at a pole next to the upper end of the support; 
+            // truncate there, with the untabulated mass counted in the u-error
+            if (n_intervals() == 0) {
+                u_start.clear();
+                return;
+            }
+
+            x_hi = a_val;
+            max_u_error = std::max(max_u_error,T(1) - u_start.back());
+            break;
+        }
+
+        const T b_val = (a_val + h_val > x_hi || x_hi - (a_val + h_val) < T(0.25)*h_val) ? x_hi : a_val + h_val;
+
+        // Chebyshev points, with CDF increments from the quadrature; reject where the quadrature is unreliable
+
+        bool accept_int = true;
+
+        for (int k = 0; k <= order; ++k) {
+            x_n[k] = a_val + (b_val - a_val) * (T(1) - std::cos(k * T(GCEM_PI) / order)) / T(2);
+        }
+
+        x_n[order] = b_val;
+        u_n[0] = T(0);
+
+        for (int k = 1; k <= order && accept_int; ++k)
+        {
+            const T x_mid = (x_n[k-1] + x_n[k]) / T(2);
+
+            const T int_1 = internal::pinv_gauss_lobatto(dens_fn,x_n[k-1],x_n[k]);
+            const T int_2 = internal::pinv_gauss_lobatto(dens_fn,x_n[k-1],x_mid) + internal::pinv_gauss_lobatto(dens_fn,x_mid,x_n[k]);
+
+            accept_int = (std::abs(int_1 - int_2) <= quad_tol) && (int_2 > T(0));
+            u_n[k] = u_n[k-1] + int_2;
+        }
+
+        // divided differences of x with respect to u, then the u-error between the nodes
+
+        T max_err_int = T(0);
+
+        if (accept_int)
+        {
+            for (int k = 0; k <= order; ++k) {
+                c_n[k] = x_n[k];
+            }
+
+            for (int j = 1; j <= order; ++j) {
+                for (int k = order; k >= j; --k) {
+                    c_n[k] = (c_n[k] - c_n[k-1]) / (u_n[k] - u_n[k-j]);
+                }
+            }
+
+            for (int k = 1; k <= order && accept_int; ++k)
+            {
+                const T x_test = (x_n[k-1] + x_n[k]) / T(2);
+                const T u_test = u_n[k-1] + internal::pinv_gauss_lobatto(dens_fn,x_n[k-1],x_test);
+
+                const T x_approx = internal::pinv_newton_eval(u_n,c_n,order,u_test);
+
+                if (!(x_approx >= a_val && x_approx <= b_val)) {
+                    accept_int = false;
+                } else {
+                    const T err_val = std::abs(internal::pinv_gauss_lobatto(dens_fn,std::min(x_test,x_approx),std::max(x_test,x_approx)));
+                    
+                    max_err_int = std::max(max_err_int,err_val);
+                    accept_int = (err_val <= u_tol);
+                }
+            }
+        }
+
+        if (accept_int)
+        {
+            u_nodes.insert(u_nodes.end(),u_n,u_n+order+1);
+            x_coefs.insert(x_coefs.end(),c_n,c_n+order+1);
+            u_start.push_back(u_start.back() + u_n[order]);
+
+            max_u_error = std::max(max_u_error,max_err_int);
+
+            a_val = b_val;
+            h_val *= T(1.3);
+        }
+        else
+        {
+            h_val *= T(0.8);
+        }
+    }
+
+    // guide table: guide[g] is the last interval starting at or below the g-th of n equally spaced u values
+
+    const ullint_t n_int = n_intervals();
+    const T u_range = u_start.back() - u_start.front();
+
+    guide.resize(n_int);
+
+    ullint_t i = 0;
+
+    for (ullint_t g = 0; g < n_int; ++g)
+    {
+        const T u_g = u_start.front() + u_range * T(g) / T(n_int);
+
+        while (i + 1 < n_int && u_start[i+1] <= u_g) {
+            ++i;
+        }
+
+        guide[g] = i;
+    }
+
+    valid_flag = true;
+}
+
+template<typename T>
+statslib_inline
+bool
+pinv_sampler<T>::is_valid()
+const
+{
+    return valid_flag;
+}
+
+template<typename T>
+statslib_inline
+ullint_t
+pinv_sampler<T>::n_intervals()
+const
+{
+    return u_start.empty() ? ullint_t(0) : ullint_t(u_start.size() - 1);
+}
+
+template<typename T>
+statslib_inline
+T
+pinv_sampler<T>::u_error()
+const
+{
+    return max_u_error;
+}
+
+/**
+ * @brief Approximate quantile function of a tabulated sampler
+ *
+ * @param u a real-valued input in \f$ [0,1] \f$.
+ *
+ * @return the interpolated quantile; \c u is clamped to the tabulated range, so values in the cut-off tails
+ * map to the ends of the truncated support.
+ */
+
+template<typename T>
+statslib_inline
+T
+pinv_sampler<T>::quantile(const T u)
+const
+{
+    if (!valid_flag || !(u >= T(0) && u <= T(1))) {
+        return STLIM<T>::quiet_NaN();
+    }
+
+    const ullint_t n_int = n_intervals();
+
+    const T u_val = std::min(std::max(u,u_start.front()),u_start.back());
+
+    ullint_t g = static_cast<ullint_t>( (u_val - u_start.front()) / (u_start.back() - u_start.front()) * T(n_int) );
+    ullint_t i = guide[std::min(g,n_int - 1)];
+
+    while (i + 1 < n_int && u_start[i+1] <= u_val) {
+        ++i;
+    }
+
+    const T x_val = internal::pinv_newton_eval(&u_nodes[i*(order+1)],&x_coefs[i*(order+1)],order,u_val - u_start[i]);
+
+    return std::min(std::max(x_val,x_lo),x_hi);
+}
+
+template<typename T>
+statslib_inline
+T
+pinv_sampler<T>::operator()(rand_engine_t& engine)
+const
+{
+    return quantile(runif(T(0),T(1),engine));
+}
+
+//
+// samplers for specific distributions: the support is cut where the tail mass falls below u_resolution / 20,
+// and the table starts from the CDF value at the lower cut
+
+/**
+ * @brief Build a tabulated inverse-CDF sampler for the Beta distribution
+ *
+ * @param a_par a real-valued shape parameter.
+ * @param b_par a real-valued shape parameter.
+ * @param u_resolution the maximal tolerated u-error, in \f$ [10^{-13}, 10^{-5}] \f$.
+ *
+ * @return a sampler object, used with \c rpinv.
+ *
+ * Example:
+ * \code{.cpp}
+ * auto sampler = stats::pinv_beta(3.0,2.0,1e-10);
+ * stats::rpinv(sampler,1776);
+ * \endcode
+ */
+
+template<typename T1, typename T2>
+statslib_inline
+pinv_sampler<common_return_t<T1,T2>>
+pinv_beta(const T1 a_par, const T2 b_par, const double u_resolution)
+{
+    using T = common_return_t<T1,T2>;
+
+    const T a_r = static_cast<T>(a_par);
+    const T b_r = static_cast<T>(b_par);
+    const T u_tol = internal::pinv_u_tol(static_cast<T>(u_resolution));
+
+    if (!internal::beta_sanity_check(a_r,b_r) || a_r == T(0) || b_r == T(0) || GCINT::any_posinf(a_r,b_r)) {
+        return pinv_sampler<T>();
+    }
+
+    const T tail_val = u_tol / T(20);
+    const T x_lower = qbeta(tail_val,a_r,b_r);
+
+    return pinv_sampler<T>([a_r,b_r](const T x) { return dbeta(x,a_r,b_r); },
+                           x_lower, qbeta(tail_val,a_r,b_r,false), pbeta(x_lower,a_r,b_r), u_tol);
+}
+
+/**
+ * @brief Build a tabulated inverse-CDF sampler for the Gamma distribution
+ *
+ * @param shape_par the shape parameter, a real-valued input.
+ * @param scale_par the scale parameter, a real-valued input.
+ * @param u_resolution the maximal tolerated u-error, in \f$ [10^{-13}, 10^{-5}] \f$.
+ *
+ * @return a sampler object, used with \c rpinv.
+ *
+ * Example:
+ * \code{.cpp}
+ * auto sampler = stats::pinv_gamma(3.0,2.0,1e-10);
+ * stats::rpinv(sampler,1776);
+ * \endcode
+ */
+
+template<typename T1, typename T2>
+statslib_inline
+pinv_sampler<common_return_t<T1,T2>>
+pinv_gamma(const T1 shape_par, const T2 scale_par, const double u_resolution)
+{
+    using T = common_return_t<T1,T2>;
+
+    const T shape_r = static_cast<T>(shape_par);
+    const T scale_r = static_cast<T>(scale_par);
+    const T u_tol = internal::pinv_u_tol(static_cast<T>(u_resolution));
+
+    if (!internal::gamma_sanity_check(shape_r,scale_r) || shape_r == T(0) || scale_r == T(0) || GCINT::any_posinf(shape_r,scale_r)) {
+        return pinv_sampler<T>();
+    }
+
+    const T tail_val = u_tol / T(20);
+    const T x_lower = qgamma(tail_val,shape_r,scale_r);
+
+    return pinv_sampler<T>([shape_r,scale_r](const T x) { return dgamma(x,shape_r,scale_r); },
+                           x_lower, qgamma(tail_val,shape_r,scale_r,false), pgamma(x_lower,shape_r,scale_r), u_tol);
+}
+
+/**
+ * @brief Build a tabulated inverse-CDF sampler for the t-distribution
+ *
+ * @param dof_par the degrees of freedom parameter, a real-valued input.
+ * @param u_resolution the maximal tolerated u-error, in \f$ [10^{-13}, 10^{-5}] \f$.
+ *
+ * @return a sampler object, used with \c rpinv.
+ *
+ * Example:
+ * \code{.cpp}
+ * auto sampler = stats::pinv_t(4.0,1e-10);
+ * stats::rpinv(sampler,1776);
+ * \endcode
+ */
+
+template<typename T1>
+statslib_inline
+pinv_sampler<return_t<T1>>
+pinv_t(const T1 dof_par, const double u_resolution)
+{
+    using T = return_t<T1>;
+
+    const T dof_r = static_cast<T>(dof_par);
+    const T u_tol = internal::pinv_u_tol(static_cast<T>(u_resolution));
+
+    if (!internal::t_sanity_check(dof_r) || GCINT::is_posinf(dof_r)) {
+        return pinv_sampler<T>();
+    }
+
+    const T tail_val = u_tol / T(20);
+    const T x_lower = qt(tail_val,dof_r);
+
+    return pinv_sampler<T>([dof_r](const T x) { return dt(x,dof_r); },
+                           x_lower, qt(tail_val,dof_r,false), pt(x_lower,dof_r), u_tol);
+}
+
+/**
+ * @brief Build a tabulated inverse-CDF sampler for the F-distribution
+ *
+ * @param df1_par a degrees of freedom parameter, a real-valued input.
+ * @param df2_par a degrees of freedom parameter, a real-valued input.
+ * @param u_resolution the maximal tolerated u-error, in \f$ [10^{-13}, 10^{-5}] \f$.
+ *
+ * @return a sampler object, used with \c rpinv.
+ *
+ * Example:
+ * \code{.cpp}
+ * auto sampler = stats::pinv_f(3.0,2.0,1e-10);
+ * stats::rpinv(sampler,1776);
+ * \endcode
+ */
+
+template<typename T1, typename T2>
+statslib_inline
+pinv_sampler<common_return_t<T1,T2>>
+pinv_f(const T1 df1_par, const T2 df2_par, const double u_resolution)
+{
+    using T = common_return_t<T1,T2>;
+
+    const T df1_r = static_cast<T>(df1_par);
+    const T df2_r = static_cast<T>(df2_par);
+    const T u_tol = internal::pinv_u_tol(static_cast<T>(u_resolution));
+
+    if (!internal::f_sanity_check(df1_r,df2_r) || GCINT::any_posinf(df1_r,df2_r)) {
+        return pinv_sampler<T>();
+    }
+
+    const T tail_val = u_tol / T(20);
+    const T x_lower = qf(tail_val,df1_r,df2_r);
+
+    return pinv_sampler<T>([df1_r,df2_r](const T x) { return df(x,df1_r,df2_r); },
+                           x_lower, qf(tail_val,df1_r,df2_r,false), pf(x_lower,df1_r,df2_r), u_tol);
+}
+
+//
+// scalar output
+
+/**
+ * @brief Random sampling function for a tabulated inverse-CDF sampler
+ *
+ * @param sampler a sampler object built by \c pinv_beta, \c pinv_gamma, \c pinv_t, or \c pinv_f.
+ * @param engine a random engine, passed by reference.
+ *
+ * @return a pseudo-random draw from the sampler's distribution.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * auto sampler = stats::pinv_gamma(3.0,2.0);
+ * stats::rpinv(sampler,engine);
+ * \endcode
+ */
+
+template<typename T>
+statslib_inline
+T
+rpinv(const pinv_sampler<T>& sampler, rand_engine_t& engine)
+{
+    return sampler(engine);
+}
+
+/**
+ * @brief Random sampling function for a tabulated inverse-CDF sampler
+ *
+ * @param sampler a sampler object built by \c pinv_beta, \c pinv_gamma, \c pinv_t, or \c pinv_f.
+ * @param seed_val initialize the random engine with a non-negative integral-valued seed.
+ *
+ * @return a pseudo-random draw from the sampler's distribution.
+ *
+ * Example:
+ * \code{.cpp}
+ * auto sampler = stats::pinv_gamma(3.0,2.0);
+ * stats::rpinv(sampler,1776);
+ * \endcode
+ */
+
+template<typename T>
+statslib_inline
+T
+rpinv(const pinv_sampler<T>& sampler, const ullint_t seed_val)
+{
+    rand_engine_t engine(seed_val);
+    return rpinv(sampler,engine);
+}
+
+//
+// vector/matrix output
+
+namespace internal
+{
+
+template<typename T, typename rT>
+statslib_inline
+void
+rpinv_vec(const pinv_sampler<T>& sampler, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    RAND_DIST_FN_VEC(rpinv,vals_out,num_elem,sampler);
+}
+
+#ifdef STATS_ENABLE_STDVEC_WRAPPERS
+template<typename eT, typename T>
+statslib_inline
+void
+rpinv_mat_check(std::vector<eT>& X, const pinv_sampler<T>& sampler)
+{
+    STDVEC_RAND_DIST_FN(rpinv,sampler);
+}
+#endif
+
+#ifdef STATS_ENABLE_MATRIX_FEATURES
+template<typename mT, typename T>
+statslib_inline
+void
+rpinv_mat_check(mT& X, const pinv_sampler<T>& sampler)
+{
+    MAIN_MAT_RAND_DIST_FN(rpinv,sampler);
+}
+#endif
+
+}
+
+/**
+ * @brief Random matrix sampling function for a tabulated inverse-CDF sampler
+ *
+ * @param n the number of output rows
+ * @param k the number of output columns
+ * @param sampler a sampler object built by \c pinv_beta, \c pinv_gamma, \c pinv_t, or \c pinv_f.
+ *
+ * @return a matrix of pseudo-random draws from the sampler's distribution.
+ *
+ * Example:
+ * \code{.cpp}
+ * auto sampler = stats::pinv_beta(3.0,2.0);
+ * // std::vector
+ * stats::rpinv<std::vector<double>>(5,4,sampler);
+ * // Armadillo matrix
+ * stats::rpinv<arma::mat>(5,4,sampler);
+ * // Blaze dynamic matrix
+ * stats::rpinv<blaze::DynamicMatrix<double,blaze::columnMajor>>(5,4,sampler);
+ * // Eigen dynamic matrix
+ * stats::rpinv<Eigen::MatrixXd>(5,4,sampler);
+ * \endcode
+ *
+ * @note This function requires template instantiation; acceptable output types include: <tt>std::vector</tt>, with element type \c float, \c double, etc., as well as Armadillo, Blaze, and Eigen dense matrices.
+ */
+
+template<typename mT, typename T>
+statslib_inline
+mT
+rpinv(const ullint_t n, const ullint_t k, const pinv_sampler<T>& sampler)
+{
+    GEN_MAT_RAND_FN(rpinv_mat_check,sampler);
+}
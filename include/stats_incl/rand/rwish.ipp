@@ -22,53 +22,284 @@
  * Sample from a Wishart distribution
  */
 
-/**
- * @brief Random sampling function for the Wishart distribution
- *
- * @param Psi_par a positive semi-definite scale matrix.
- * @param nu_par the degrees of parameter, a real-valued input.
- * @param pre_chol indicate whether \c Psi_par is passed in lower triangular (Cholesky) format.
- *
- * @return a pseudo-random draw from the Wishart distribution.
- */
+namespace internal
+{
+
+// Bartlett factor: a K x K lower triangular matrix (column-major) with standard normal draws below the diagonal
+// and the square root of a chi-squared(nu - i) draw at diagonal position i
 
-template<typename mT, typename pT, typename not_arma_mat<mT>::type*>
+template<typename eT>
 statslib_inline
-mT
-rwish(const mT& Psi_par, const pT nu_par, const bool pre_chol)
+void
+wish_bartlett_draw(const eT nu_par, const ullint_t K, rand_engine_t& engine, std::normal_distribution<eT>& norm_dist, 
+                   eT* A_vals)
+{
+    for (ullint_t j=ullint_t(0); j < K; ++j)
+    {
+        A_vals[j + j*K] = std::sqrt(rchisq<eT>(nu_par - eT(j),engine));
+
+        for (ullint_t i=j+1; i < K; ++i)
+        {
+            A_vals[i + j*K] = norm_dist(engine);
+        }
+    }
+}
+
+// B = L A, for lower triangular L and A; B is lower triangular
+
+template<typename eT>
+statslib_inline
+void
+wish_tri_mult(const eT* __stats_pointer_settings__ L_vals, const eT* __stats_pointer_settings__ A_vals, 
+              const ullint_t K, eT* __stats_pointer_settings__ B_vals)
+{
+    for (ullint_t j=ullint_t(0); j < K; ++j)
+    {
+        for (ullint_t i=ullint_t(0); i < j; ++i)
+        {
+            B_vals[i + j*K] = eT(0);
+        }
+
+        for (ullint_t i=j; i < K; ++i)
+        {
+            eT val = eT(0);
+
+            for (ullint_t k=j; k <= i; ++k)
+            {
+                val += L_vals[i + k*K] * A_vals[k + j*K];
+            }
+
+            B_vals[i + j*K] = val;
+        }
+    }
+}
+
+// W(a,b) = sum_k Y(k,a) Y(k,b), with Y(k,a) at Y_vals[k*K + a]; the lower triangle is formed and mirrored. With Y the
+// column-major array of a matrix B, this is B B'.
+
+template<typename mT, typename eT>
+statslib_inline
+void
+wish_gram(const eT* Y_vals, const ullint_t K, mT& W)
+{
+    for (ullint_t b=ullint_t(0); b < K; ++b)
+    {
+        for (ullint_t a=b; a < K; ++a)
+        {
+            eT val = eT(0);
+
+            for (ullint_t k=ullint_t(0); k < K; ++k)
+            {
+                val += Y_vals[k*K + a] * Y_vals[k*K + b];
+            }
+
+            W(a,b) = val;
+            W(b,a) = val;
+        }
+    }
+}
+
+// n draws from the Wishart (inv_flag = false) or inverse-Wishart distribution. L is the lower Cholesky factor of
+// Psi, or, with pre_chol, the given factor: of Psi for the Wishart, and of Psi^{-1} for the inverse-Wishart. With
+// A the Bartlett factor:
+//   Wishart:                            W = (L A)(L A)'
+//   inverse-Wishart, L L' = Psi:        W = Y'Y, Y = A^{-1} L'
+//   inverse-Wishart, L L' = Psi^{-1}:   W = Y'Y, Y = (L A)^{-1}
+// Block j of STATS_WISH_DRAW_BLOCK draws takes its random numbers from an engine seeded by (seed_val, j).
+
+template<typename mT, typename eT, typename sT>
+statslib_inline
+std::vector<mT>
+wish_rand_compute(const ullint_t n, const sT& Psi_par, const eT nu_par, const bool pre_chol, const ullint_t seed_val,
+                  const bool inv_flag)
 {
-    typedef return_t<pT> eT;
     const ullint_t K = mat_ops::n_rows(Psi_par);
-    
-    mT chol_Psi;
+
+    std::vector<mT> ret(n);
+
+    std::vector<eT> L_vals;
+    const bool valid_flag = rmvnorm_factor_vals(Psi_par,K,pre_chol,L_vals) && nu_par > eT(K) - eT(1);
+
+    const ullint_t n_blocks = (n + STATS_WISH_DRAW_BLOCK - ullint_t(1)) / STATS_WISH_DRAW_BLOCK;
+
+#ifdef STATS_USE_OPENMP
+    #pragma omp parallel for
+#endif
+    for (ullint_t j=ullint_t(0); j < n_blocks; ++j)
+    {
+        const ullint_t d_begin = j*STATS_WISH_DRAW_BLOCK;
+        const ullint_t d_end = std::min(d_begin + STATS_WISH_DRAW_BLOCK, n);
+
+        std::seed_seq seed_seq_j = { uint_t(seed_val), uint_t(seed_val >> 32), uint_t(j), uint_t(j >> 32) };
+        rand_engine_t engine_j(seed_seq_j);
+
+        std::normal_distribution<eT> norm_dist(eT(0),eT(1));
+
+        std::vector<eT> A_vals(K*K);
+        std::vector<eT> B_vals(K*K);
+
+        for (ullint_t d=d_begin; d < d_end; ++d)
+        {
+            mat_ops::zeros(ret[d],K,K);
+
+            if (!valid_flag) {
+                ret[d] = ret[d] * STLIM<eT>::quiet_NaN();
+                continue;
+            }
+
+            wish_bartlett_draw(nu_par,K,engine_j,norm_dist,A_vals.data());
+
+            if (!inv_flag) {
+                wish_tri_mult(L_vals.data(),A_vals.data(),K,B_vals.data());
+            } else if (!pre_chol) {
+                B_vals = L_vals;
+                mvnorm_tri_solve_block(A_vals.data(),K,B_vals.data(),K);
+            } else {
+                std::vector<eT> LA_vals(K*K);
+                wish_tri_mult(L_vals.data(),A_vals.data(),K,LA_vals.data());
+
+                std::fill(B_vals.begin(),B_vals.end(),eT(0));
+
+                for (ullint_t k=ullint_t(0); k < K; ++k)
+                {
+                    B_vals[k*K + k] = eT(1);
+                }
+
+                mvnorm_tri_solve_block(LA_vals.data(),K,B_vals.data(),K);
+            }
+
+            wish_gram(B_vals.data(),K,ret[d]);
+        }
+    }
+
+    return ret;
+}
+
+// K = 2, ..., 8: one draw, as above, with the factors held on the stack
+
+template<ullint_t K, typename mT, typename eT, typename sT>
+statslib_inline
+void
+wish_rand_small(const sT& Psi_par, const eT nu_par, const bool pre_chol, const bool inv_flag, rand_engine_t& engine,
+                mT& W)
+{
+    small_mat<eT,K> L, A, B;
+    bool valid_flag;
+
     if (pre_chol) {
-        chol_Psi = Psi_par; // should be lower triangular
+        small_mat_load_lower(Psi_par,L);
+        valid_flag = small_chol_valid(L);
     } else {
-        chol_Psi = mat_ops::chol(Psi_par); // will be lower triangular
+        small_mat_load(Psi_par,A);
+        valid_flag = small_chol(A,L);
+    }
+
+    mat_ops::zeros(W,K,K);
+
+    if (!valid_flag || !(nu_par > eT(K) - eT(1))) {
+        W = W * STLIM<eT>::quiet_NaN();
+        return;
+    }
+
+    std::normal_distribution<eT> norm_dist(eT(0),eT(1));
+
+    wish_bartlett_draw(nu_par,K,engine,norm_dist,A.vals);
+
+    if (!inv_flag) {
+        small_tri_mat_mult(L,A,B);
+        small_gram(B,W);
+        return;
     }
 
-    //
+    // B = Y', column b of Y solving A y = L'(:,b), or (L A) y = e_b with pre_chol
+
+    small_mat<eT,K> T_mat = A;
 
-    rand_engine_t engine(std::random_device{}());
+    if (pre_chol) {
+        small_tri_mat_mult(L,A,T_mat);
+    }
 
-    mT A;
-    mat_ops::zeros(A,K,K);
+    for (ullint_t b=ullint_t(0); b < K; ++b)
+    {
+        eT y_vals[K];
 
-    for (ullint_t i=1U; i < K; i++) {
-        for (ullint_t j=0U; j < i; j++) {
-            A(i,j) = rnorm<eT>(eT(0),eT(1),engine);
+        for (ullint_t k=ullint_t(0); k < K; ++k)
+        {
+            y_vals[k] = pre_chol ? eT(k == b) : L(b,k);
         }
+
+        small_tri_solve(T_mat,y_vals);
+
+        for (ullint_t k=ullint_t(0); k < K; ++k)
+        {
+            B(b,k) = y_vals[k];
+        }
+    }
+
+    small_gram(B,W);
+}
+
+template<typename mT, typename eT, typename sT>
+struct wish_rand_small_fn
+{
+    const sT& Psi_par;
+    const eT nu_par;
+    const bool pre_chol;
+    const bool inv_flag;
+    rand_engine_t& engine;
+
+    mT& W;
+
+    template<ullint_t K>
+    statslib_inline
+    void
+    run()
+    {
+        wish_rand_small<K>(Psi_par,nu_par,pre_chol,inv_flag,engine,W);
     }
-    
-    for (ullint_t i=0U; i < K; i++) {
-        A(i,i) = std::sqrt(rchisq<eT>(eT(nu_par-i),engine));
+};
+
+// a single draw
+
+template<typename mT, typename eT, typename sT>
+statslib_inline
+mT
+wish_rand_single(const sT& Psi_par, const eT nu_par, const bool pre_chol, const bool inv_flag)
+{
+    const ullint_t seed_val = std::random_device{}();
+
+    mT ret;
+    rand_engine_t engine(seed_val);
+    wish_rand_small_fn<mT,eT,sT> small_fn = { Psi_par, nu_par, pre_chol, inv_flag, engine, ret };
+
+    if (small_mat_dispatch(mat_ops::n_rows(Psi_par),small_fn)) {
+        return ret;
     }
 
-    chol_Psi = chol_Psi*A;
+    return wish_rand_compute<mT>(ullint_t(1),Psi_par,nu_par,pre_chol,seed_val,inv_flag)[0];
+}
+
+}
+
+/**
+ * @brief Random sampling function for the Wishart distribution
+ *
+ * @param Psi_par a positive semi-definite scale matrix.
+ * @param nu_par the degrees of parameter, a real-valued input.
+ * @param pre_chol indicate whether \c Psi_par is passed in lower triangular (Cholesky) format.
+ *
+ * @return a pseudo-random draw from the Wishart distribution.
+ */
+
+template<typename mT, typename pT, typename not_arma_mat<mT>::type*, 
+         typename std::enable_if<!std::is_arithmetic<mT>::value>::type*>
+statslib_inline
+mT
+rwish(const mT& Psi_par, const pT nu_par, const bool pre_chol)
+{
+    typedef return_t<pT> eT;
 
-    //
-    
-    return chol_Psi * mat_ops::trans(chol_Psi);
+    return internal::wish_rand_single<mT>(Psi_par,eT(nu_par),pre_chol,false);
 }
 
 #ifdef STATS_ENABLE_ARMA_WRAPPERS
@@ -77,30 +308,57 @@ statslib_inline
 mT
 rwish(const ArmaMat<eT>& Psi_par, const pT nu_par, const bool pre_chol)
 {
-    const ullint_t K = Psi_par.n_rows;
-    
-    ArmaMat<eT> chol_Psi = (pre_chol) ? Psi_par : arma::chol(Psi_par,"lower"); // should be lower-triangular
+    return internal::wish_rand_single<mT>(Psi_par,eT(nu_par),pre_chol,false);
+}
+#endif
 
-    //
+//
+// n draws
+
+/**
+ * @brief Random sampling function for the Wishart distribution
+ *
+ * @param n the number of draws.
+ * @param Psi_par a positive semi-definite scale matrix.
+ * @param nu_par the degrees of parameter, a real-valued input.
+ * @param pre_chol indicate whether \c Psi_par is passed in lower triangular (Cholesky) format.
+ * @param seed_val initialize the random streams with a non-negative integral-valued seed.
+ *
+ * @return a vector of \c n pseudo-random draws from the Wishart distribution.
+ *
+ * \c Psi_par is factorized once. Each draw is formed from its Bartlett factor by triangular products; blocks of
+ * \c STATS_WISH_DRAW_BLOCK draws are taken in parallel when OpenMP is enabled, each from its own random stream derived
+ * from \c seed_val, so the draws for a given seed do not depend on the number of threads.
+ */
 
-    rand_engine_t engine(std::random_device{}());
+template<typename mT, typename pT>
+statslib_inline
+std::vector<mT>
+rwish(const ullint_t n, const mT& Psi_par, const pT nu_par, const bool pre_chol, const ullint_t seed_val)
+{
+    typedef return_t<pT> eT;
 
-    ArmaMat<eT> A = arma::zeros(K,K);
+    return internal::wish_rand_compute<mT>(n,Psi_par,eT(nu_par),pre_chol,seed_val,false);
+}
 
-    for (ullint_t i=1U; i < K; i++) {
-        for (ullint_t j=0U; j < i; j++) {
-            A(i,j) = rnorm<eT>(eT(0),eT(1),engine);
-        }
-    }
-    
-    for (ullint_t i=0U; i < K; i++) {
-        A(i,i) = std::sqrt(rchisq<eT>(eT(nu_par-i),engine));
-    }
+/**
+ * @brief Random sampling function for the Wishart distribution
+ *
+ * @param n the number of draws.
+ * @param Psi_par a positive semi-definite scale matrix.
+ * @param nu_par the degrees of parameter, a real-valued input.
+ * @param engine a random engine, passed by reference; one value is drawn from it to seed the random streams.
+ * @param pre_chol indicate whether \c Psi_par is passed in lower triangular (Cholesky) format.
+ *
+ * @return a vector of \c n pseudo-random draws from the Wishart distribution.
+ */
 
-    chol_Psi = chol_Psi*A;
+template<typename mT, typename pT>
+statslib_inline
+std::vector<mT>
+rwish(const ullint_t n, const mT& Psi_par, const pT nu_par, rand_engine_t& engine, const bool pre_chol)
+{
+    typedef return_t<pT> eT;
 
-    //
-    
-    return chol_Psi * chol_Psi.t();
+    return internal::wish_rand_compute<mT>(n,Psi_par,eT(nu_par),pre_chol,static_cast<ullint_t>(engine()),false);
 }
-#endif
@@ -58,6 +58,18 @@ int main()
 #ifdef STATS_TEST_STDVEC_FEATURES
     STATS_TEST_EXPECTED_MAT(dbern,inp_vals,exp_vals,std::vector<double>,false,prob_par);
     STATS_TEST_EXPECTED_MAT(dbern,inp_vals,exp_vals,std::vector<double>,true,prob_par);
+
+    // a longer integer input through the two-value fast path, with a value outside the support
+
+    std::vector<int> inp_rep_vals;
+    std::vector<double> exp_rep_vals;
+
+    for (int j = 0; j < 40; ++j) {
+        inp_rep_vals.insert(inp_rep_vals.end(), { 1, 0, 0, 2 });
+        exp_rep_vals.insert(exp_rep_vals.end(), { prob_par, 1-prob_par, 1-prob_par, 0.0 });
+    }
+
+    STATS_TEST_EXPECTED_BATCH(dbern,inp_rep_vals,exp_rep_vals,std::vector<double>,prob_par,false);
 #endif
 
 #ifdef STATS_TEST_MATRIX_FEATURES
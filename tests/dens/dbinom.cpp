@@ -59,12 +59,31 @@ int main()
 
     STATS_TEST_EXPECTED_VAL(dbinom,1,prob_par,false,1,prob_par);                                    // n_trials == 1
 
+    STATS_TEST_EXPECTED_VAL(dbinom,2500,0.0003293388,true,6000,0.4);                                // n_trials beyond the log-factorial table
+
     //
     // vector/matrix tests
 
 #ifdef STATS_TEST_STDVEC_FEATURES
     STATS_TEST_EXPECTED_MAT(dbinom,inp_vals,exp_vals,std::vector<double>,false,n_trials,prob_par);
     STATS_TEST_EXPECTED_MAT(dbinom,inp_vals,exp_vals,std::vector<double>,true,n_trials,prob_par);
+
+    // repeated counts, long enough to go through the per-call cache of small counts, with a count outside the support
+
+    std::vector<int> inp_rep_vals;
+    std::vector<double> exp_rep_vals;
+
+    for (int j = 0; j < 40; ++j) {
+        inp_rep_vals.insert(inp_rep_vals.end(), { 3, 0, 4, 5 });
+        exp_rep_vals.insert(exp_rep_vals.end(), { 0.3456, 0.0256, 0.1296, 0.0 });
+    }
+
+    STATS_TEST_EXPECTED_BATCH(dbinom,inp_rep_vals,exp_rep_vals,std::vector<double>,n_trials,prob_par,false);
+
+    std::vector<int> inp_rep_log_vals(inp_rep_vals.size(), 2);
+    std::vector<double> exp_rep_log_vals(inp_rep_vals.size(), std::log(0.3456));
+
+    STATS_TEST_EXPECTED_BATCH(dbinom,inp_rep_log_vals,exp_rep_log_vals,std::vector<double>,n_trials,prob_par,true);
 #endif
 
 #ifdef STATS_TEST_MATRIX_FEATURES
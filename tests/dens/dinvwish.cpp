@@ -38,6 +38,27 @@ int main()
 
     std::cout << "density value = " << dinvwish_val << "." << std::endl;
 
+    // a set of matrices, with one factorization of Psi
+
+    std::vector<mat_obj> X_set(3, X);
+
+    for (int j = 0; j < 3; ++j) {
+        X_set[j](0,0) += 0.5*j;
+        X_set[j](1,0) = X_set[j](0,1) = 0.1*j;
+    }
+
+    std::vector<double> dinvwish_batch = stats::dinvwish(X_set,Psi,K+1,true);
+
+    for (int j = 0; j < 3; ++j) {
+        const double err = std::abs(dinvwish_batch[j] - stats::dinvwish(X_set[j],Psi,K+1,true));
+
+        std::cout << "log-density value " << j << " = " << dinvwish_batch[j] << ". Abs. error = " << err << std::endl;
+
+        if (err > 1e-10) {
+            throw std::runtime_error("test fail");
+        }
+    }
+
     std::cout << "\n*** dinvwish: tests finished. ***\n" << std::endl;
 #endif
     return 0;
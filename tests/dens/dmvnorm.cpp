@@ -42,6 +42,40 @@ int main()
 
     std::cout << "density value: " << dmvnorm_val << "." << std::endl;
 
+    // batch version: one observation per row, against the single-observation values
+
+    int n = 100;
+
+    mat_obj X_batch;
+    stats::mat_ops::zeros(X_batch,n,K);
+    Sigma(1,0) = 0.4;
+    Sigma(0,1) = 0.4;
+
+    for (int i=0; i < n; i++)
+    {
+        for (int k=0; k < K; k++)
+        {
+            X_batch(i,k) = 0.05 * (i - 50) * (k + 1) - 0.3 * k;
+        }
+    }
+
+    mat_obj dmvnorm_batch_vals = stats::dmvnorm_batch(X_batch,mu,Sigma,true);
+
+    double max_err = 0.0;
+
+    for (int i=0; i < n; i++)
+    {
+        mat_obj X_i = stats::mat_ops::trans(stats::mat_ops::get_row(X_batch,i));
+        max_err = std::max(max_err, std::abs(dmvnorm_batch_vals(i,0) - stats::dmvnorm(X_i,mu,Sigma,true)));
+    }
+
+    std::cout << "batch log-density values: " << dmvnorm_batch_vals(0,0) << ", ..., " << dmvnorm_batch_vals(n-1,0) 
+              << "; max. difference from dmvnorm: " << max_err << "." << std::endl;
+
+    if (max_err > 1e-10) {
+        throw std::runtime_error("test fail");
+    }
+
 #ifdef STATS_ENABLE_EIGEN_WRAPPERS
     // test static versions
     Eigen::Matrix<double, 3, 1> X2(1, 1, 1);
@@ -50,6 +84,12 @@ int main()
 
     double p = stats::dmvnorm(X2, mean, Sigma2);
     std::cout << "p = " << p << "." << std::endl;
+
+    // fixed-size path against the closed form: (2 pi)^{-3/2} exp(-3/2)
+
+    if (std::abs(p - std::exp(-1.5 * (std::log(2 * GCEM_PI) + 1))) > 1e-12) {
+        throw std::runtime_error("test fail");
+    }
 #endif
 
     std::cout << "\n*** dmvnorm: tests finished. ***\n" << std::endl;
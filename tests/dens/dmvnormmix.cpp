@@ -0,0 +1,102 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+#define TEST_PRINT_PRECISION_1 2
+#define TEST_PRINT_PRECISION_2 5
+
+#include "../stats_tests.hpp"
+
+int main()
+{
+#ifdef STATS_TEST_MATRIX_FEATURES
+    int n = 100;
+    int d = 2;
+    int K = 3;
+
+    std::cout << "\n*** dmvnormmix: begin tests. ***\n" << std::endl;
+
+    mat_obj X, weights;
+    stats::mat_ops::zeros(X,n,d);
+    stats::mat_ops::zeros(weights,K,1);
+
+    for (int i=0; i < n; i++)
+    {
+        X(i,0) = 0.06 * (i - 50);
+        X(i,1) = 0.3 * std::sin(0.1 * i);
+    }
+
+    std::vector<mat_obj> mu(K), Sigma(K);
+
+    for (int k=0; k < K; k++)
+    {
+        weights(k,0) = (k + 1.0) / 6.0;
+
+        stats::mat_ops::zeros(mu[k],d,1);
+        mu[k](0,0) = k - 1.0;
+        mu[k](1,0) = 0.2 * k;
+
+        stats::mat_ops::eye(Sigma[k],d);
+        Sigma[k](0,0) = 0.5 + 0.5 * k;
+        Sigma[k](1,0) = Sigma[k](0,1) = 0.1 * k;
+    }
+
+    mat_obj resp;
+    mat_obj dmvnormmix_vals = stats::dmvnormmix(X,weights,mu,Sigma,true,&resp);
+
+    // shared covariance matrix
+
+    mat_obj dmvnormmix_tied_vals = stats::dmvnormmix(X,weights,mu,Sigma[1],true);
+
+    // against sums of dmvnorm values, and responsibilities summing to one
+
+    double max_err = 0.0;
+
+    for (int i=0; i < n; i++)
+    {
+        mat_obj X_i = stats::mat_ops::trans(stats::mat_ops::get_row(X,i));
+
+        double dens_val = 0.0;
+        double dens_tied_val = 0.0;
+        double resp_sum = 0.0;
+
+        for (int k=0; k < K; k++)
+        {
+            dens_val += weights(k,0) * stats::dmvnorm(X_i,mu[k],Sigma[k]);
+            dens_tied_val += weights(k,0) * stats::dmvnorm(X_i,mu[k],Sigma[1]);
+            resp_sum += resp(i,k);
+        }
+
+        max_err = std::max(max_err, std::abs(dmvnormmix_vals(i,0) - std::log(dens_val)));
+        max_err = std::max(max_err, std::abs(dmvnormmix_tied_vals(i,0) - std::log(dens_tied_val)));
+        max_err = std::max(max_err, std::abs(resp_sum - 1.0));
+    }
+
+    std::cout << "log-density values: " << dmvnormmix_vals(0,0) << ", ..., " << dmvnormmix_vals(n-1,0) 
+              << "; max. error: " << max_err << "." << std::endl;
+
+    if (max_err > 1e-10) {
+        throw std::runtime_error("test fail");
+    }
+
+    std::cout << "\n*** dmvnormmix: tests finished. ***\n" << std::endl;
+#endif
+
+    return 0;
+}
@@ -0,0 +1,91 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+#define TEST_PRINT_PRECISION_1 2
+#define TEST_PRINT_PRECISION_2 5
+
+#include "../stats_tests.hpp"
+
+int main()
+{
+#ifdef STATS_TEST_MATRIX_FEATURES
+    int K = 3;
+    double dof = 5.0;
+
+    std::cout << "\n*** dmvt: begin tests. ***\n" << std::endl;
+
+    mat_obj X, mu, Sigma;
+    stats::mat_ops::zeros(X,K,1);
+    stats::mat_ops::zeros(mu,K,1);
+    stats::mat_ops::eye(Sigma,K);
+
+    X(0,0) = 1.0;
+
+    // with Sigma = I: Gamma(4)/(Gamma(5/2) (5 pi)^{3/2}) (1 + 1/5)^{-4}
+
+    double dmvt_val = stats::dmvt(X,mu,Sigma,dof,false);
+    double expected_val = std::exp(std::lgamma(4.0) - std::lgamma(2.5) - 1.5 * std::log(5.0 * GCEM_PI)) 
+                            * std::pow(1.2, -4.0);
+
+    std::cout << "density value: " << dmvt_val << "; expected: " << expected_val << "." << std::endl;
+
+    if (std::abs(dmvt_val - expected_val) > 1e-12) {
+        throw std::runtime_error("test fail");
+    }
+
+    // batch version: one observation per row, against the single-observation values
+
+    int n = 100;
+
+    mat_obj X_batch;
+    stats::mat_ops::zeros(X_batch,n,K);
+    Sigma(1,0) = 0.4;
+    Sigma(0,1) = 0.4;
+
+    for (int i=0; i < n; i++)
+    {
+        for (int k=0; k < K; k++)
+        {
+            X_batch(i,k) = 0.05 * (i - 50) * (k + 1) - 0.3 * k;
+        }
+    }
+
+    mat_obj dmvt_batch_vals = stats::dmvt_batch(X_batch,mu,Sigma,dof,true);
+
+    double max_err = 0.0;
+
+    for (int i=0; i < n; i++)
+    {
+        mat_obj X_i = stats::mat_ops::trans(stats::mat_ops::get_row(X_batch,i));
+        max_err = std::max(max_err, std::abs(dmvt_batch_vals(i,0) - stats::dmvt(X_i,mu,Sigma,dof,true)));
+    }
+
+    std::cout << "batch log-density values: " << dmvt_batch_vals(0,0) << ", ..., " << dmvt_batch_vals(n-1,0) 
+              << "; max. difference from dmvt: " << max_err << "." << std::endl;
+
+    if (max_err > 1e-10) {
+        throw std::runtime_error("test fail");
+    }
+
+    std::cout << "\n*** dmvt: tests finished. ***\n" << std::endl;
+#endif
+
+    return 0;
+}
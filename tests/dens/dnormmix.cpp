@@ -0,0 +1,82 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+#define TEST_PRINT_PRECISION_1 2
+#define TEST_PRINT_PRECISION_2 5
+
+#include "../stats_tests.hpp"
+
+int main()
+{
+#ifdef STATS_TEST_MATRIX_FEATURES
+    int n = 200;
+    int K = 3;
+
+    std::cout << "\n*** dnormmix: begin tests. ***\n" << std::endl;
+
+    mat_obj X, weights, mu, sigma;
+    stats::mat_ops::zeros(X,n,1);
+    stats::mat_ops::zeros(weights,K,1);
+    stats::mat_ops::zeros(mu,K,1);
+    stats::mat_ops::zeros(sigma,K,1);
+
+    for (int i=0; i < n; i++)
+    {
+        X(i,0) = 0.05 * (i - 100);
+    }
+
+    weights(0,0) = 0.2; weights(1,0) = 0.5; weights(2,0) = 0.3;
+    mu(0,0) = -1.0;     mu(1,0) = 0.5;      mu(2,0) = 2.0;
+    sigma(0,0) = 0.5;   sigma(1,0) = 1.0;   sigma(2,0) = 1.5;
+
+    mat_obj resp;
+    mat_obj dnormmix_vals = stats::dnormmix(X,weights,mu,sigma,true,&resp);
+
+    // against a sum of dnorm values, and responsibilities summing to one
+
+    double max_err = 0.0;
+
+    for (int i=0; i < n; i++)
+    {
+        double dens_val = 0.0;
+        double resp_sum = 0.0;
+
+        for (int k=0; k < K; k++)
+        {
+            dens_val += weights(k,0) * stats::dnorm(X(i,0),mu(k,0),sigma(k,0));
+            resp_sum += resp(i,k);
+        }
+
+        max_err = std::max(max_err, std::abs(dnormmix_vals(i,0) - std::log(dens_val)));
+        max_err = std::max(max_err, std::abs(resp_sum - 1.0));
+    }
+
+    std::cout << "log-density values: " << dnormmix_vals(0,0) << ", ..., " << dnormmix_vals(n-1,0) 
+              << "; max. error: " << max_err << "." << std::endl;
+
+    if (max_err > 1e-10) {
+        throw std::runtime_error("test fail");
+    }
+
+    std::cout << "\n*** dnormmix: tests finished. ***\n" << std::endl;
+#endif
+
+    return 0;
+}
@@ -64,6 +64,8 @@ int main()
 
     STATS_TEST_EXPECTED_VAL(dpois,-1,0,false,2);                                                    // x < 0
 
+    STATS_TEST_EXPECTED_VAL(dpois,5000,0.005641802,true,5000);                                      // x beyond the log-factorial table
+
     // STATS_TEST_EXPECTED_VAL(dpois,TEST_POSINF,0,false,10);                                          // x == Inf
 
     //
@@ -72,6 +74,19 @@ int main()
 #ifdef STATS_TEST_STDVEC_FEATURES
     STATS_TEST_EXPECTED_MAT(dpois,inp_vals,exp_vals,std::vector<double>,false,rate);
     STATS_TEST_EXPECTED_MAT(dpois,inp_vals,exp_vals,std::vector<double>,true,rate);
+
+    // repeated counts over several blocks, long enough to go through the per-block cache of small counts, with a
+    // count outside the support
+
+    std::vector<int> inp_rep_vals;
+    std::vector<double> exp_rep_vals;
+
+    for (int j = 0; j < 2100; ++j) {
+        inp_rep_vals.insert(inp_rep_vals.end(), { 8, 9, 10, -1 });
+        exp_rep_vals.insert(exp_rep_vals.end(), { 0.112599, 0.12511, 0.12511, 0.0 });
+    }
+
+    STATS_TEST_EXPECTED_BATCH(dpois,inp_rep_vals,exp_rep_vals,std::vector<double>,rate,false);
 #endif
 
 #ifdef STATS_TEST_MATRIX_FEATURES
@@ -0,0 +1,171 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+#include "../stats_tests.hpp"
+
+#if defined(STATS_TEST_STDVEC_FEATURES) || defined(STATS_TEST_MATRIX_FEATURES)
+typedef stats::mat_ops::accu_mode_t accu_mode_t;
+
+const accu_mode_t accu_modes[3] = { accu_mode_t::naive, accu_mode_t::pairwise, accu_mode_t::kahan };
+const char* accu_mode_names[3] = { "naive", "pairwise", "kahan" };
+
+// relative error bounds for the test input below: naive and pairwise grow with n, Kahan is near the rounding of the
+// result
+
+const double accu_err_tol[3] = { 1e-10, 1e-13, 1e-15 };
+#endif
+
+int main()
+{
+    print_begin("accu");
+
+    std::cout << "\n*** accu: begin tests. ***\n" << std::endl;
+
+#ifdef STATS_TEST_STDVEC_FEATURES
+    {
+        // several blocks of values with mixed magnitudes, against a long double reference
+
+        const int n = 3*4096 + 17;
+        std::vector<double> x(n);
+
+        long double sum_ref = 0, sqsum_ref = 0;
+
+        for (int i=0; i < n; i++)
+        {
+            x[i] = 0.1 * (i % 97) + 1e3 * std::sin(0.01 * i);
+
+            sum_ref += static_cast<long double>(x[i]);
+            sqsum_ref += static_cast<long double>(x[i]) * static_cast<long double>(x[i]);
+        }
+
+        for (int m=0; m < 3; m++)
+        {
+            const double sum_val = stats::mat_ops::accu(x,accu_modes[m]);
+            const double sqsum_val = stats::mat_ops::sqaccu(x,accu_modes[m]);
+
+            const double err_sum = static_cast<double>(std::abs((sum_val - sum_ref) / sum_ref));
+            const double err_sqsum = static_cast<double>(std::abs((sqsum_val - sqsum_ref) / sqsum_ref));
+
+            std::cout << accu_mode_names[m] << ": relative error of accu: " << err_sum << "; of sqaccu: " << err_sqsum 
+                      << "." << std::endl;
+
+            if (err_sum > accu_err_tol[m] || err_sqsum > accu_err_tol[m]) {
+                throw std::runtime_error("test fail");
+            }
+
+            // the same input is summed identically on every call, and for any number of threads
+
+            if (stats::mat_ops::accu(x,accu_modes[m]) != sum_val) {
+                throw std::runtime_error("test fail");
+            }
+
+#ifdef STATS_USE_OPENMP
+            const int n_threads = omp_get_max_threads();
+
+            omp_set_num_threads(1);
+            const double sum_val_1 = stats::mat_ops::accu(x,accu_modes[m]);
+            omp_set_num_threads(3);
+            const double sum_val_3 = stats::mat_ops::accu(x,accu_modes[m]);
+            omp_set_num_threads(n_threads);
+
+            if (sum_val_1 != sum_val || sum_val_3 != sum_val) {
+                throw std::runtime_error("test fail");
+            }
+#endif
+        }
+
+        // cancellation that only the compensated mode resolves
+
+        std::vector<double> x_cancel = { 1.0, 1e100, 1.0, -1e100 };
+
+        if (stats::mat_ops::accu(x_cancel,accu_mode_t::kahan) != 2.0) {
+            throw std::runtime_error("test fail");
+        }
+
+        // non-finite inputs: Inf is kept, Inf - Inf and NaN give NaN
+
+        std::vector<double> x_inf(n, 1.0);
+        x_inf[5000] = TEST_POSINF;
+
+        std::vector<double> x_inf_nan = { 1.0, TEST_POSINF, TEST_NEGINF };
+        std::vector<double> x_nan = { 1.0, TEST_NAN, 2.0 };
+
+        for (int m=0; m < 3; m++)
+        {
+            const double sum_inf = stats::mat_ops::accu(x_inf,accu_modes[m]);
+            const double sqsum_inf = stats::mat_ops::sqaccu(x_inf,accu_modes[m]);
+
+            std::cout << accu_mode_names[m] << ": accu with an Inf entry: " << sum_inf << "." << std::endl;
+
+            if (!(sum_inf == TEST_POSINF) || !(sqsum_inf == TEST_POSINF) 
+                    || !std::isnan(stats::mat_ops::accu(x_inf_nan,accu_modes[m])) 
+                    || !std::isnan(stats::mat_ops::accu(x_nan,accu_modes[m]))) {
+                throw std::runtime_error("test fail");
+            }
+        }
+    }
+#endif
+
+#ifdef STATS_TEST_MATRIX_FEATURES
+    {
+        const int n = 5000;
+        const int K = 3;
+
+        mat_obj X(n,K);
+
+        long double sum_ref = 0, sqsum_ref = 0;
+
+        for (int k=0; k < K; k++)
+        {
+            for (int i=0; i < n; i++)
+            {
+                X(i,k) = 0.1 * ((i + k) % 97) + 1e3 * std::sin(0.01 * i + k);
+
+                sum_ref += static_cast<long double>(X(i,k));
+                sqsum_ref += static_cast<long double>(X(i,k)) * static_cast<long double>(X(i,k));
+            }
+        }
+
+        for (int m=0; m < 3; m++)
+        {
+            const double err_sum = static_cast<double>(std::abs((stats::mat_ops::accu(X,accu_modes[m]) - sum_ref) / sum_ref));
+            const double err_sqsum = static_cast<double>(std::abs((stats::mat_ops::sqaccu(X,accu_modes[m]) - sqsum_ref) / sqsum_ref));
+
+            std::cout << "matrix, " << accu_mode_names[m] << ": relative error of accu: " << err_sum 
+                      << "; of sqaccu: " << err_sqsum << "." << std::endl;
+
+            if (err_sum > accu_err_tol[m] || err_sqsum > accu_err_tol[m]) {
+                throw std::runtime_error("test fail");
+            }
+        }
+
+        X(7,1) = TEST_POSINF;
+
+        if (!(stats::mat_ops::accu(X,accu_mode_t::kahan) == TEST_POSINF) 
+                || !(stats::mat_ops::sqaccu(X,accu_mode_t::kahan) == TEST_POSINF)) {
+            throw std::runtime_error("test fail");
+        }
+    }
+#endif
+
+    std::cout << "\n*** accu: end tests. ***\n" << std::endl;
+
+    return 0;
+}
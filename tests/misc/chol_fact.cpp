@@ -0,0 +1,131 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+#include "../stats_tests.hpp"
+
+int main()
+{
+    print_begin("chol_fact");
+
+#ifdef STATS_TEST_MATRIX_FEATURES
+    int K = 3;
+
+    std::cout << "\n*** chol_fact: begin tests. ***\n" << std::endl;
+
+    //
+
+    mat_obj A, x(K,1);
+    stats::mat_ops::eye(A,K);
+    A(0,0) = 4.0;
+    A(1,0) = 2.0;
+    A(0,1) = 2.0;
+    A(1,1) = 2.0;
+    A(2,2) = 9.0;
+
+    x(0,0) = 1.0;
+    x(1,0) = -2.0;
+    x(2,0) = 3.0;
+
+    stats::mat_ops::chol_fact<mat_obj> chol_A(A);
+
+    // L L' against A, log|A| against log(36), and x' A^{-1} x against an explicit inverse
+
+    const mat_obj& L = chol_A.factor();
+    mat_obj LLt = L * stats::mat_ops::trans(L);
+
+    double max_err = std::abs(chol_A.log_det() - std::log(36.0));
+
+    for (int i=0; i < K; i++)
+    {
+        for (int j=0; j < K; j++)
+        {
+            max_err = std::max(max_err, std::abs(LLt(i,j) - A(i,j)));
+        }
+    }
+
+    mat_obj A_inv = stats::mat_ops::inv(A);
+    mat_obj quad_check = stats::mat_ops::trans(x) * A_inv * x;
+
+    max_err = std::max(max_err, std::abs(chol_A.quad_form(x) - quad_check(0,0)));
+    max_err = std::max(max_err, std::abs(stats::mat_ops::quad_form(x,A) - quad_check(0,0)));
+
+    std::cout << "log|A| = " << chol_A.log_det() << "; x' A^{-1} x = " << chol_A.quad_form(x) 
+              << "; max. error: " << max_err << "." << std::endl;
+
+    if (!chol_A.is_valid() || max_err > 1e-12) {
+        throw std::runtime_error("test fail");
+    }
+
+    // A A^{-1} x, L L^{-1} x and L^{-1} (L x) against x, and mat_ops::log_det against log(36)
+
+    mat_obj solve_check = A * chol_A.solve(x);
+    mat_obj tri_solve_check = L * chol_A.tri_solve(x);
+    mat_obj tri_mult_check = chol_A.tri_solve(chol_A.tri_mult(x));
+    mat_obj Lx = L * x;
+    mat_obj tri_mult_vals = chol_A.tri_mult(x);
+
+    max_err = std::abs(stats::mat_ops::log_det(A) - std::log(36.0));
+
+    for (int i=0; i < K; i++)
+    {
+        max_err = std::max(max_err, std::abs(solve_check(i,0) - x(i,0)));
+        max_err = std::max(max_err, std::abs(tri_solve_check(i,0) - x(i,0)));
+        max_err = std::max(max_err, std::abs(tri_mult_check(i,0) - x(i,0)));
+        max_err = std::max(max_err, std::abs(tri_mult_vals(i,0) - Lx(i,0)));
+    }
+
+    std::cout << "solve, tri_solve, tri_mult and log_det: max. error: " << max_err << "." << std::endl;
+
+    if (max_err > 1e-12) {
+        throw std::runtime_error("test fail");
+    }
+
+    // a matrix that is not positive definite: the factor keeps the dimensions of A and holds NaN
+
+    mat_obj B;
+    stats::mat_ops::eye(B,K);
+    B(0,1) = 2.0;
+    B(1,0) = 2.0;
+
+    stats::mat_ops::chol_fact<mat_obj> chol_B(B);
+
+    std::cout << "indefinite B: is_valid = " << chol_B.is_valid() << ", log|B| = " << chol_B.log_det() 
+              << ", x' B^{-1} x = " << chol_B.quad_form(x) << "." << std::endl;
+
+    if (chol_B.is_valid() || !std::isnan(chol_B.log_det()) || !std::isnan(chol_B.quad_form(x)) 
+            || !std::isnan(chol_B.solve(x)(0,0)) || !std::isnan(chol_B.tri_solve(x)(0,0))
+            || !std::isnan(stats::mat_ops::log_det(B))) {
+        throw std::runtime_error("test fail");
+    }
+
+    if (stats::mat_ops::n_rows(chol_B.factor()) != stats::ullint_t(K) || stats::mat_ops::n_cols(chol_B.factor()) != stats::ullint_t(K)
+            || !std::isnan(chol_B.factor()(K-1,K-1))) {
+        throw std::runtime_error("test fail");
+    }
+
+    //
+
+    std::cout << "\n*** chol_fact: end tests. ***\n" << std::endl;
+#else
+    std::cout << "\n*** chol_fact: no matrix library found. ***\n" << std::endl;
+#endif
+
+    return 0;
+}
@@ -0,0 +1,151 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+#include "../stats_tests.hpp"
+
+int main()
+{
+    print_begin("cumsum");
+
+    std::cout << "\n*** cumsum: begin tests. ***\n" << std::endl;
+
+#ifdef STATS_TEST_STDVEC_FEATURES
+    {
+        // several blocks, against a sequential long double scan; the compensated form stays within the rounding of
+        // each output
+
+        const int n = 3*4096 + 17;
+        std::vector<double> x(n);
+        std::vector<long double> csum_ref(n);
+
+        long double sum_ref = 0;
+
+        for (int i=0; i < n; i++)
+        {
+            x[i] = 0.1 + 1e-3 * std::sin(0.01 * i);
+            sum_ref += static_cast<long double>(x[i]);
+            csum_ref[i] = sum_ref;
+        }
+
+        std::vector<double> csum = stats::mat_ops::cumsum(x);
+        std::vector<double> csum_comp = stats::mat_ops::cumsum(x,true);
+
+        double max_err = 0.0, max_err_comp = 0.0;
+
+        for (int i=0; i < n; i++)
+        {
+            max_err = std::max(max_err, static_cast<double>(std::abs((csum[i] - csum_ref[i]) / csum_ref[i])));
+            max_err_comp = std::max(max_err_comp, static_cast<double>(std::abs((csum_comp[i] - csum_ref[i]) / csum_ref[i])));
+        }
+
+        std::cout << "max. relative error: " << max_err << "; compensated: " << max_err_comp << "." << std::endl;
+
+        if (max_err > 1e-12 || max_err_comp > 2.5e-16) {
+            throw std::runtime_error("test fail");
+        }
+
+        // in place, identical to the copying form
+
+        std::vector<double> x_inplace = x;
+        stats::mat_ops::cumsum_inplace(x_inplace,true);
+
+        if (x_inplace != csum_comp) {
+            throw std::runtime_error("test fail");
+        }
+
+#ifdef STATS_USE_OPENMP
+        const int n_threads = omp_get_max_threads();
+
+        omp_set_num_threads(1);
+        std::vector<double> csum_1 = stats::mat_ops::cumsum(x);
+        omp_set_num_threads(n_threads);
+
+        if (csum_1 != csum) {
+            throw std::runtime_error("test fail");
+        }
+#endif
+
+        // an Inf entry carries through the compensated scan
+
+        std::vector<double> x_inf = { 1.0, TEST_POSINF, 2.0 };
+        std::vector<double> csum_inf = stats::mat_ops::cumsum(x_inf,true);
+
+        if (csum_inf[0] != 1.0 || !(csum_inf[1] == TEST_POSINF) || !(csum_inf[2] == TEST_POSINF)) {
+            throw std::runtime_error("test fail");
+        }
+    }
+#endif
+
+#ifdef STATS_TEST_MATRIX_FEATURES
+    {
+        // a column vector over several blocks, in place and copied
+
+        const int n = 2*4096 + 5;
+
+        mat_obj X(n,1);
+
+        for (int i=0; i < n; i++)
+        {
+            X(i,0) = 1.0 + (i % 3);
+        }
+
+        mat_obj X_csum = stats::mat_ops::cumsum(X,true);
+
+        mat_obj X_inplace = X;
+        stats::mat_ops::cumsum_inplace(X_inplace);
+
+        double sum_val = 0.0;
+
+        for (int i=0; i < n; i++)
+        {
+            sum_val += X(i,0);
+
+            if (X_csum(i,0) != sum_val || X_inplace(i,0) != sum_val) {
+                throw std::runtime_error("test fail");
+            }
+        }
+
+        // matrices: column by column for Armadillo, otherwise in column-major order
+
+        mat_obj Y(2,2);
+        Y(0,0) = 1.0; Y(0,1) = 3.0;
+        Y(1,0) = 2.0; Y(1,1) = 4.0;
+
+        mat_obj Y_csum = stats::mat_ops::cumsum(Y);
+
+#ifdef STATS_ENABLE_ARMA_WRAPPERS
+        const double Y_exp[4] = { 1.0, 3.0, 3.0, 7.0 };
+#else
+        const double Y_exp[4] = { 1.0, 3.0, 6.0, 10.0 };
+#endif
+
+        std::cout << "matrix: cumsum of [1 3; 2 4] = [" << Y_csum(0,0) << " " << Y_csum(0,1) << "; " 
+                  << Y_csum(1,0) << " " << Y_csum(1,1) << "]." << std::endl;
+
+        if (Y_csum(0,0) != Y_exp[0] || Y_csum(1,0) != Y_exp[1] || Y_csum(0,1) != Y_exp[2] || Y_csum(1,1) != Y_exp[3]) {
+            throw std::runtime_error("test fail");
+        }
+    }
+#endif
+
+    std::cout << "\n*** cumsum: end tests. ***\n" << std::endl;
+
+    return 0;
+}
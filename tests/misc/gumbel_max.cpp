@@ -0,0 +1,109 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+#include "../stats_tests.hpp"
+
+int main()
+{
+    print_begin("gumbel_max");
+
+    const double neg_inf = TEST_NEGINF;
+
+    std::cout << "\n*** gumbel_max: begin tests. ***\n" << std::endl;
+
+#ifdef STATS_TEST_STDVEC_FEATURES
+    {
+        // draw frequencies against softmax(x); the -Inf entry is never selected
+
+        const int n = 20000;
+
+        std::vector<double> x = { std::log(0.2), neg_inf, std::log(0.5), std::log(0.3) };
+        std::vector<double> freq(x.size(), 0.0);
+
+        stats::rand_engine_t engine(1776);
+
+        for (int i=0; i < n; i++)
+        {
+            const stats::ullint_t k = stats::mat_ops::gumbel_max(x,engine);
+
+            if (k >= x.size()) {
+                throw std::runtime_error("test fail");
+            }
+
+            freq[k] += 1.0 / n;
+        }
+
+        std::vector<double> x_all_neginf = { neg_inf, neg_inf, neg_inf };
+
+        std::cout << "std::vector: frequencies: " << freq[0] << ", " << freq[1] << ", " << freq[2] << ", " << freq[3] 
+                  << "." << std::endl;
+
+        if (freq[1] != 0.0 || std::abs(freq[0] - 0.2) > 0.02 || std::abs(freq[2] - 0.5) > 0.02 || std::abs(freq[3] - 0.3) > 0.02
+                || stats::mat_ops::gumbel_max(x_all_neginf,engine) != x_all_neginf.size()) {
+            throw std::runtime_error("test fail");
+        }
+    }
+#endif
+
+#ifdef STATS_TEST_MATRIX_FEATURES
+    {
+        // one draw per row over several blocks of rows; column 1 is -Inf in every row
+
+        const int n = 5000;
+        const int K = 3;
+
+        mat_obj X(n,K);
+
+        for (int i=0; i < n; i++)
+        {
+            X(i,0) = std::log(0.25);
+            X(i,1) = neg_inf;
+            X(i,2) = std::log(0.75);
+        }
+
+        stats::rand_engine_t engine_1(42);
+        stats::rand_engine_t engine_2(42);
+
+        std::vector<stats::ullint_t> draws_1 = stats::mat_ops::gumbel_max_rows(X,engine_1);
+        std::vector<stats::ullint_t> draws_2 = stats::mat_ops::gumbel_max_rows(X,engine_2);
+
+        double freq_0 = 0.0;
+
+        for (int i=0; i < n; i++)
+        {
+            if (draws_1[i] == 1 || draws_1[i] >= stats::ullint_t(K) || draws_1[i] != draws_2[i]) {
+                throw std::runtime_error("test fail");
+            }
+
+            freq_0 += (draws_1[i] == 0) ? 1.0 / n : 0.0;
+        }
+
+        std::cout << "matrix: frequency of column 0: " << freq_0 << "." << std::endl;
+
+        if (std::abs(freq_0 - 0.25) > 0.03) {
+            throw std::runtime_error("test fail");
+        }
+    }
+#endif
+
+    std::cout << "\n*** gumbel_max: end tests. ***\n" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,110 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+#include "../stats_tests.hpp"
+
+int main()
+{
+    print_begin("log_sum_exp");
+
+    const double neg_inf = TEST_NEGINF;
+
+    std::cout << "\n*** log_sum_exp: begin tests. ***\n" << std::endl;
+
+#ifdef STATS_TEST_STDVEC_FEATURES
+    {
+        // large magnitudes in both directions, -Inf entries, and an input of several blocks
+
+        std::vector<double> x_large = { 1000.0, 1000.0 + std::log(3.0) };
+        std::vector<double> x_small = { -1000.0, -1000.0, -1000.0 };
+        std::vector<double> x_neginf = { neg_inf, 0.0, std::log(3.0), neg_inf };
+        std::vector<double> x_all_neginf = { neg_inf, neg_inf };
+        std::vector<double> x_long(10001, -2.5);
+
+        double max_err = std::abs(stats::mat_ops::log_sum_exp(x_large) - (1000.0 + std::log(4.0)));
+        max_err = std::max(max_err, std::abs(stats::mat_ops::log_sum_exp(x_small) - (-1000.0 + std::log(3.0))));
+        max_err = std::max(max_err, std::abs(stats::mat_ops::log_sum_exp(x_neginf) - std::log(4.0)));
+        max_err = std::max(max_err, std::abs(stats::mat_ops::log_sum_exp(x_long) - (-2.5 + std::log(10001.0))));
+
+        const double lse_all_neginf = stats::mat_ops::log_sum_exp(x_all_neginf);
+
+        std::cout << "std::vector: max. error: " << max_err << "; all -Inf: " << lse_all_neginf << "." << std::endl;
+
+        if (max_err > 1e-12 || !(lse_all_neginf == neg_inf)) {
+            throw std::runtime_error("test fail");
+        }
+    }
+#endif
+
+#ifdef STATS_TEST_MATRIX_FEATURES
+    {
+        mat_obj X(3,2);
+        X(0,0) = 1000.0;    X(0,1) = 1000.0;
+        X(1,0) = neg_inf;   X(1,1) = -1000.0;
+        X(2,0) = neg_inf;   X(2,1) = neg_inf;
+
+        // rows: 1000 + log(2), -1000, -Inf; columns: 1000, 1000
+
+        mat_obj lse_rows = stats::mat_ops::log_sum_exp_rows(X);
+        mat_obj lse_cols = stats::mat_ops::log_sum_exp_cols(X);
+
+        double max_err = std::abs(stats::mat_ops::log_sum_exp(X) - (1000.0 + std::log(2.0)));
+        max_err = std::max(max_err, std::abs(lse_rows(0,0) - (1000.0 + std::log(2.0))));
+        max_err = std::max(max_err, std::abs(lse_rows(1,0) + 1000.0));
+        max_err = std::max(max_err, std::abs(lse_cols(0,0) - 1000.0));
+        max_err = std::max(max_err, std::abs(lse_cols(0,1) - 1000.0));
+
+        std::cout << "matrix: max. error: " << max_err << "; all -Inf row: " << lse_rows(2,0) << "." << std::endl;
+
+        if (max_err > 1e-12 || !(lse_rows(2,0) == neg_inf) || stats::mat_ops::n_rows(lse_rows) != 3 
+                || stats::mat_ops::n_cols(lse_cols) != 2) {
+            throw std::runtime_error("test fail");
+        }
+
+        // more rows than one block
+
+        const int n = 5000;
+        mat_obj Y(n,2);
+
+        for (int i=0; i < n; i++)
+        {
+            Y(i,0) = 0.001 * i;
+            Y(i,1) = 0.001 * i + std::log(3.0);
+        }
+
+        mat_obj lse_rows_Y = stats::mat_ops::log_sum_exp_rows(Y);
+
+        max_err = 0.0;
+
+        for (int i=0; i < n; i++)
+        {
+            max_err = std::max(max_err, std::abs(lse_rows_Y(i,0) - (0.001 * i + std::log(4.0))));
+        }
+
+        if (max_err > 1e-12) {
+            throw std::runtime_error("test fail");
+        }
+    }
+#endif
+
+    std::cout << "\n*** log_sum_exp: end tests. ***\n" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,164 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+#include "../stats_tests.hpp"
+
+#if defined(STATS_TEST_STDVEC_FEATURES) || defined(STATS_TEST_MATRIX_FEATURES)
+typedef stats::mat_ops::moments_acc<double> acc_t;
+
+double
+moments_rel_diff(const acc_t& acc_a, const acc_t& acc_b)
+{
+    double ret = std::abs(acc_a.mean() - acc_b.mean()) / std::abs(acc_b.mean());
+    ret = std::max(ret, std::abs(acc_a.var() - acc_b.var()) / acc_b.var());
+    ret = std::max(ret, std::abs(acc_a.skewness() - acc_b.skewness()) / std::abs(acc_b.skewness()));
+    ret = std::max(ret, std::abs(acc_a.kurtosis() - acc_b.kurtosis()) / std::abs(acc_b.kurtosis()));
+
+    return acc_a.count() == acc_b.count() ? ret : 1.0;
+}
+#endif
+
+int main()
+{
+    print_begin("moments");
+
+    std::cout << "\n*** moments: begin tests. ***\n" << std::endl;
+
+#if defined(STATS_TEST_STDVEC_FEATURES) || defined(STATS_TEST_MATRIX_FEATURES)
+    // one value at a time, as an array (in blocks), and as merged pieces of unequal length, with empty merges
+
+    const int n = 10001;
+    std::vector<double> x(n);
+
+    for (int i=0; i < n; i++)
+    {
+        x[i] = std::exp(std::sin(0.1 * i)) + 0.01 * i;
+    }
+
+    acc_t acc_stream, acc_arr, acc_1, acc_2, acc_3, acc_empty;
+
+    for (int i=0; i < n; i++)
+    {
+        acc_stream.update(x[i]);
+    }
+
+    acc_arr.update(x.data(),n);
+
+    acc_1.update(x.data(),17);
+    acc_2.update(x.data() + 17,5000);
+    acc_3.update(x.data() + 5017,n - 5017);
+
+    acc_empty.merge(acc_1);
+    acc_empty.merge(acc_2);
+    acc_empty.merge(acc_t());
+    acc_empty.merge(acc_3);
+
+    double max_err = std::max(moments_rel_diff(acc_arr,acc_stream), moments_rel_diff(acc_empty,acc_stream));
+
+    std::cout << "merged vs streamed: max. relative difference: " << max_err << "." << std::endl;
+
+    if (max_err > 1e-10) {
+        throw std::runtime_error("test fail");
+    }
+
+    // a large mean relative to the spread: 1e9 +/- 1. A running sum of squares would lose every digit here; the
+    // updates keep the variance to within the rounding of the mean, about 1e9 * 1e-16 per value
+
+    acc_t acc_large;
+
+    for (int i=0; i < 1000; i++)
+    {
+        acc_large.update(1e9 + (i % 2 == 0 ? 1.0 : -1.0));
+    }
+
+    std::cout << "mean 1e9, spread 1: var = " << acc_large.var() << ", sample var = " << acc_large.var(true) << "." << std::endl;
+
+    if (std::abs(acc_large.var() - 1.0) > 1e-6 || std::abs(acc_large.var(true) - 1000.0 / 999.0) > 1e-6 
+            || std::abs(acc_large.mean() - 1e9) > 1e-6) {
+        throw std::runtime_error("test fail");
+    }
+
+    // skewness and excess kurtosis of {0, 0, 0, 1}: 2/sqrt(3) and -2/3
+
+    acc_t acc_4;
+    const double x_4[4] = { 0.0, 0.0, 0.0, 1.0 };
+    acc_4.update(x_4,4);
+
+    max_err = std::abs(acc_4.skewness() - 2.0 / std::sqrt(3.0));
+    max_err = std::max(max_err, std::abs(acc_4.kurtosis() + 2.0 / 3.0));
+    max_err = std::max(max_err, std::abs(acc_4.var() - 0.1875));
+
+    std::cout << "{0, 0, 0, 1}: skewness = " << acc_4.skewness() << ", kurtosis = " << acc_4.kurtosis() << "." << std::endl;
+
+    if (max_err > 1e-12) {
+        throw std::runtime_error("test fail");
+    }
+
+    // empty and single-value accumulators
+
+    acc_t acc_0, acc_n1;
+    acc_n1.update(2.5);
+
+    if (acc_0.count() != 0 || !std::isnan(acc_0.mean()) || !std::isnan(acc_0.var()) || !std::isnan(acc_0.skewness())
+            || !std::isnan(acc_0.kurtosis())) {
+        throw std::runtime_error("test fail");
+    }
+
+    if (acc_n1.count() != 1 || acc_n1.mean() != 2.5 || acc_n1.var() != 0.0 || !std::isnan(acc_n1.var(true))) {
+        throw std::runtime_error("test fail");
+    }
+#endif
+
+#ifdef STATS_TEST_STDVEC_FEATURES
+    if (std::abs(stats::mat_ops::var(x) - acc_stream.var()) > 1e-10 * acc_stream.var() 
+            || std::abs(stats::mat_ops::mean(x) - acc_stream.mean()) > 1e-10 * acc_stream.mean()) {
+        throw std::runtime_error("test fail");
+    }
+#endif
+
+#ifdef STATS_TEST_MATRIX_FEATURES
+    {
+        // a matrix spanning several blocks, and a single element (variance 0 in both the n and n - 1 forms)
+
+        mat_obj X(n,1), X_1(1,1);
+
+        for (int i=0; i < n; i++)
+        {
+            X(i,0) = x[i];
+        }
+
+        X_1(0,0) = 2.5;
+
+        const acc_t acc_X = stats::mat_ops::moments(X);
+
+        std::cout << "matrix: mean = " << stats::mat_ops::mean(X) << ", var = " << stats::mat_ops::var(X) 
+                  << "; var of one element = " << stats::mat_ops::var(X_1) << "." << std::endl;
+
+        if (moments_rel_diff(acc_X,acc_stream) > 1e-10 || std::abs(stats::mat_ops::mean(X) - acc_stream.mean()) > 1e-10
+                || stats::mat_ops::var(X_1) != 0.0) {
+            throw std::runtime_error("test fail");
+        }
+    }
+#endif
+
+    std::cout << "\n*** moments: end tests. ***\n" << std::endl;
+
+    return 0;
+}
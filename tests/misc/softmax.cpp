@@ -0,0 +1,124 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+#include "../stats_tests.hpp"
+
+int main()
+{
+    print_begin("softmax");
+
+    const double neg_inf = TEST_NEGINF;
+
+    std::cout << "\n*** softmax: begin tests. ***\n" << std::endl;
+
+#ifdef STATS_TEST_STDVEC_FEATURES
+    {
+        // large entries would overflow exp(x) directly; -Inf entries get probability 0
+
+        std::vector<double> x = { 1000.0, 1000.0 + std::log(3.0), neg_inf, 998.0 };
+        std::vector<double> p = stats::mat_ops::softmax(x);
+
+        double p_sum = 0.0;
+
+        for (size_t k=0; k < p.size(); k++)
+        {
+            p_sum += p[k];
+        }
+
+        const double norm_const = 4.0 + std::exp(-2.0);
+
+        double max_err = std::abs(p_sum - 1.0);
+        max_err = std::max(max_err, std::abs(p[0] - 1.0 / norm_const));
+        max_err = std::max(max_err, std::abs(p[1] - 3.0 / norm_const));
+        max_err = std::max(max_err, std::abs(p[3] - std::exp(-2.0) / norm_const));
+
+        std::cout << "std::vector: max. error: " << max_err << "; p at -Inf: " << p[2] << "." << std::endl;
+
+        if (max_err > 1e-12 || p[2] != 0.0) {
+            throw std::runtime_error("test fail");
+        }
+    }
+#endif
+
+#ifdef STATS_TEST_MATRIX_FEATURES
+    {
+        const int n = 5000;
+        const int K = 4;
+
+        mat_obj X(n,K);
+
+        for (int i=0; i < n; i++)
+        {
+            for (int k=0; k < K; k++)
+            {
+                X(i,k) = (k == 2 && i % 7 == 0) ? neg_inf : 500.0 * std::sin(0.37 * i + 1.3 * k);
+            }
+        }
+
+        mat_obj P = stats::mat_ops::softmax(X);
+        mat_obj P_rows = stats::mat_ops::softmax_rows(X);
+        mat_obj P_cols = stats::mat_ops::softmax_cols(X);
+
+        double P_sum = 0.0;
+        double max_err = 0.0;
+
+        for (int i=0; i < n; i++)
+        {
+            double row_sum = 0.0;
+
+            for (int k=0; k < K; k++)
+            {
+                P_sum += P(i,k);
+                row_sum += P_rows(i,k);
+            }
+
+            max_err = std::max(max_err, std::abs(row_sum - 1.0));
+
+            if (i % 7 == 0 && P_rows(i,2) != 0.0) {
+                throw std::runtime_error("test fail");
+            }
+        }
+
+        for (int k=0; k < K; k++)
+        {
+            double col_sum = 0.0;
+
+            for (int i=0; i < n; i++)
+            {
+                col_sum += P_cols(i,k);
+            }
+
+            max_err = std::max(max_err, std::abs(col_sum - 1.0));
+        }
+
+        max_err = std::max(max_err, std::abs(P_sum - 1.0));
+
+        std::cout << "matrix: max. error in the sums: " << max_err << "." << std::endl;
+
+        if (max_err > 1e-10) {
+            throw std::runtime_error("test fail");
+        }
+    }
+#endif
+
+    std::cout << "\n*** softmax: end tests. ***\n" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,161 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+
+#include "../stats_tests.hpp"
+
+#if defined(STATS_TEST_STDVEC_FEATURES) || defined(STATS_TEST_MATRIX_FEATURES)
+// largest absolute error of a batch kernel against a reference, over a vector of inputs
+
+template<typename Fn>
+double
+max_abs_err(const std::vector<double>& vals, const std::vector<double>& x, Fn ref_fn)
+{
+    double err_val = 0;
+
+    for (size_t j=0; j < x.size(); j++)
+    {
+        err_val = std::max(err_val, std::abs(vals[j] - ref_fn(x[j])));
+    }
+
+    return err_val;
+}
+
+void
+check_err(const char* fn_name, const double err_val, const double err_tol)
+{
+    std::cout << fn_name << ": error against the scalar function: " << err_val << "." << std::endl;
+
+    if (!(err_val <= err_tol)) {
+        throw std::runtime_error("test fail");
+    }
+}
+#endif
+
+int main()
+{
+    print_begin("special_fns");
+
+    std::cout << "\n*** special_fns: begin tests. ***\n" << std::endl;
+
+#if defined(STATS_TEST_STDVEC_FEATURES) || defined(STATS_TEST_MATRIX_FEATURES)
+    {
+        // erf and erfc over the central and both tail pieces
+
+        std::vector<double> x;
+        for (int i=-60; i <= 60; i++) {
+            x.push_back(0.1 * i);
+        }
+
+        std::vector<double> vals(x.size());
+
+        stats::internal::erf_vec(x.data(),vals.data(),x.size());
+        check_err("erf_vec",max_abs_err(vals,x,[](double z){ return std::erf(z); }),1e-14);
+
+        stats::internal::erfc_vec(x.data(),vals.data(),x.size());
+        check_err("erfc_vec",max_abs_err(vals,x,[](double z){ return std::erfc(z); }),1e-14);
+
+        // erfc far in the upper tail, relative to its value; the rounding of x sqrt(2) is amplified by about 2 x^2
+
+        std::vector<double> x_tail = { 5.0, 10.0, 20.0, 26.0 };
+        std::vector<double> vals_tail(x_tail.size());
+
+        stats::internal::erfc_vec(x_tail.data(),vals_tail.data(),x_tail.size());
+
+        for (size_t j=0; j < x_tail.size(); j++) {
+            check_err("erfc_vec (relative)",std::abs(vals_tail[j] / std::erfc(x_tail[j]) - 1.0),1e-12);
+        }
+    }
+
+    {
+        // erf_inv, as a round trip through erf, including values close to -1 and 1
+
+        std::vector<double> y;
+        for (int i=-99; i <= 99; i++) {
+            y.push_back(0.01 * i);
+        }
+        y.push_back(-0.999999);
+        y.push_back(0.999999);
+
+        std::vector<double> vals(y.size());
+
+        stats::internal::erf_inv_vec(y.data(),vals.data(),y.size());
+
+        std::vector<double> erf_vals(y.size());
+        for (size_t j=0; j < y.size(); j++) {
+            erf_vals[j] = std::erf(vals[j]);
+        }
+
+        check_err("erf_inv_vec (round trip)",max_abs_err(erf_vals,y,[](double z){ return z; }),1e-14);
+        check_err("erf_inv_vec",max_abs_err(vals,y,[](double z){ return gcem::erf_inv(z); }),1e-12);
+    }
+
+    {
+        // lgamma, for small and large arguments, with poles and negative values passed through
+
+        std::vector<double> x = { 1e-8, 0.1, 0.5, 1.0, 1.5, 2.0, 3.7, 10.0, 55.5, 171.3, 1e5, 0.0, -0.5, -3.0, TEST_POSINF };
+        std::vector<double> vals(x.size());
+
+        stats::internal::lgamma_vec(x.data(),vals.data(),x.size());
+
+        double err_val = 0;
+        for (size_t j=0; j < x.size(); j++) {
+            const double ref_val = std::lgamma(x[j]);
+
+            err_val = std::max(err_val, std::isfinite(ref_val) ? std::abs(vals[j] - ref_val) / std::max(1.0, std::abs(ref_val)) :
+                                                                 (vals[j] == ref_val ? 0.0 : 1.0));
+        }
+
+        check_err("lgamma_vec",err_val,1e-13);
+    }
+
+    {
+        // digamma, against known values; the poles are returned as NaN
+
+        std::vector<double> x       = { 1.0,              0.5,              10.0,            -0.5,             1e-3 };
+        std::vector<double> psi_ref = { -0.5772156649015, -1.963510026021,  2.251752589066,  0.03648997397857, -1000.5755719318 };
+        std::vector<double> vals(x.size());
+
+        stats::internal::digamma_vec(x.data(),vals.data(),x.size());
+
+        double err_val = 0;
+        for (size_t j=0; j < x.size(); j++) {
+            err_val = std::max(err_val, std::abs(vals[j] - psi_ref[j]) / std::max(1.0, std::abs(psi_ref[j])));
+        }
+
+        check_err("digamma_vec",err_val,1e-12);
+
+        std::vector<double> x_poles = { 0.0, -1.0, -4.0 };
+        std::vector<double> vals_poles(x_poles.size());
+
+        stats::internal::digamma_vec(x_poles.data(),vals_poles.data(),x_poles.size());
+
+        for (size_t j=0; j < x_poles.size(); j++) {
+            if (!std::isnan(vals_poles[j])) {
+                throw std::runtime_error("test fail");
+            }
+        }
+    }
+#endif
+
+    std::cout << "\n*** special_fns: end tests. ***\n" << std::endl;
+
+    return 0;
+}
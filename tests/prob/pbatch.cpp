@@ -0,0 +1,123 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+#define TEST_PRINT_PRECISION_1 2
+#define TEST_PRINT_PRECISION_2 5
+
+#include "../stats_tests.hpp"
+
+int main()
+{
+    print_begin("pbatch");
+
+    // t-tests; p-values from the upper tail
+
+    std::vector<double> t_stats = { 2.1,           -0.4,          3.3,            1.0,          0.0 };
+    std::vector<double> t_dof   = { 8,             12,            8,              30,           12 };
+    std::vector<double> t_pvals = { 0.03446876215, 0.6519073473,  0.005429425805, 0.1626543077, 0.5 };
+    std::vector<double> t_bonf  = { 0.1723438108,  1.0,           0.02714712902,  0.8132715385, 1.0 };
+    std::vector<double> t_bh    = { 0.08617190537, 0.6519073473,  0.02714712902,  0.2710905129, 0.625 };
+
+    // chi-squared, F, and z-tests
+
+    std::vector<double> chisq_stats = { 4.2,          11.0,          0.7,           6.0 };
+    std::vector<double> chisq_dof   = { 2,            3,             2,             5 };
+    std::vector<double> chisq_pvals = { 0.1224564283, 0.01172587558, 0.7046880897,  0.3062189184 };
+
+    std::vector<double> f_stats = { 1.5,          3.9,           0.8 };
+    std::vector<double> f_df1   = { 2,            4,             2 };
+    std::vector<double> f_df2   = { 20,           20,            20 };
+    std::vector<double> f_pvals = { 0.2471847061, 0.01685564918, 0.4631934881 };
+
+    std::vector<double> z_stats = { 1.2,          2.8,           -0.3 };
+    std::vector<double> z_bh    = { 0.1726045053, 0.00766539099, 0.6179114222 };
+
+#ifdef STATS_TEST_STDVEC_FEATURES
+    STATS_TEST_EXPECTED_BATCH(pt_batch,t_stats,t_pvals,std::vector<double>,t_dof,false,false);
+    STATS_TEST_EXPECTED_BATCH(pt_batch,t_stats,t_bonf,std::vector<double>,t_dof,false,false,stats::p_adjust_t::bonferroni);
+    STATS_TEST_EXPECTED_BATCH(pt_batch,t_stats,t_bh,std::vector<double>,t_dof,false,false,stats::p_adjust_t::bh);
+    STATS_TEST_EXPECTED_BATCH(pt_batch,t_stats,MATOPS::log(t_bh),std::vector<double>,t_dof,true,false,stats::p_adjust_t::bh);
+
+    std::vector<double> t_lower(t_pvals.size());
+    for (size_t j = 0; j < t_pvals.size(); ++j) {
+        t_lower[j] = 1.0 - t_pvals[j];
+    }
+
+    STATS_TEST_EXPECTED_BATCH(pt_batch,t_stats,t_lower,std::vector<double>,t_dof);
+
+    STATS_TEST_EXPECTED_BATCH(pchisq_batch,chisq_stats,chisq_pvals,std::vector<double>,chisq_dof,false,false);
+    STATS_TEST_EXPECTED_BATCH(pchisq_batch,chisq_stats,MATOPS::log(chisq_pvals),std::vector<double>,chisq_dof,true,false);
+
+    STATS_TEST_EXPECTED_BATCH(pf_batch,f_stats,f_pvals,std::vector<double>,f_df1,f_df2,false,false);
+
+    STATS_TEST_EXPECTED_BATCH(pnorm_batch,z_stats,z_bh,std::vector<double>,false,false,stats::p_adjust_t::bh);
+
+    // adjustment on its own
+
+    STATS_TEST_EXPECTED_BATCH(p_adjust,t_pvals,t_bh,std::vector<double>,stats::p_adjust_t::bh);
+    STATS_TEST_EXPECTED_BATCH(p_adjust,t_pvals,t_bonf,std::vector<double>,stats::p_adjust_t::bonferroni);
+#endif
+
+#ifdef STATS_TEST_MATRIX_FEATURES
+    // every element is one test
+
+    mat_obj t_mat(2,2), t_dof_mat(2,2), t_pval_mat(2,2), t_bonf_mat(2,2);
+
+    mat_obj chisq_mat(2,2), chisq_dof_mat(2,2), chisq_pval_mat(2,2);
+
+    for (size_t j = 0; j < 4; ++j) {
+        t_mat(j%2,j/2) = t_stats[j];
+        t_dof_mat(j%2,j/2) = t_dof[j];
+        t_pval_mat(j%2,j/2) = t_pvals[j];
+        t_bonf_mat(j%2,j/2) = std::min(1.0, 4*t_pvals[j]);
+
+        chisq_mat(j%2,j/2) = chisq_stats[j];
+        chisq_dof_mat(j%2,j/2) = chisq_dof[j];
+        chisq_pval_mat(j%2,j/2) = chisq_pvals[j];
+    }
+
+    STATS_TEST_EXPECTED_BATCH(pt_batch,t_mat,t_pval_mat,mat_obj,t_dof_mat,false,false);
+    STATS_TEST_EXPECTED_BATCH(pt_batch,t_mat,t_bonf_mat,mat_obj,t_dof_mat,false,false,stats::p_adjust_t::bonferroni);
+    STATS_TEST_EXPECTED_BATCH(pchisq_batch,chisq_mat,chisq_pval_mat,mat_obj,chisq_dof_mat,false,false);
+    STATS_TEST_EXPECTED_BATCH(p_adjust,t_pval_mat,t_bonf_mat,mat_obj,stats::p_adjust_t::bonferroni);
+
+    mat_obj f_mat(1,3), f_df1_mat(1,3), f_df2_mat(1,3), f_pval_mat(1,3);
+    mat_obj z_mat(1,3), z_bh_mat(1,3);
+
+    for (size_t j = 0; j < 3; ++j) {
+        f_mat(0,j) = f_stats[j];
+        f_df1_mat(0,j) = f_df1[j];
+        f_df2_mat(0,j) = f_df2[j];
+        f_pval_mat(0,j) = f_pvals[j];
+
+        z_mat(0,j) = z_stats[j];
+        z_bh_mat(0,j) = z_bh[j];
+    }
+
+    STATS_TEST_EXPECTED_BATCH(pf_batch,f_mat,f_pval_mat,mat_obj,f_df1_mat,f_df2_mat,false,false);
+    STATS_TEST_EXPECTED_BATCH(pnorm_batch,z_mat,z_bh_mat,mat_obj,false,false,stats::p_adjust_t::bh);
+#endif
+
+    // 
+
+    print_final("pbatch");
+
+    return 0;
+}
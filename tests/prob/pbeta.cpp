@@ -79,6 +79,13 @@ int main()
 #ifdef STATS_TEST_STDVEC_FEATURES
     STATS_TEST_EXPECTED_MAT(pbeta,inp_vals,exp_vals,std::vector<double>,false,a_par,b_par);
     STATS_TEST_EXPECTED_MAT(pbeta,inp_vals,exp_vals,std::vector<double>,true,a_par,b_par);
+
+    // upper tail on both sides of the continued fraction switch, with boundary inputs
+
+    std::vector<double> inp_upper_vals = { -0.5,  0.0,  0.15,       0.5,     0.95,        1.0 };
+    std::vector<double> exp_upper_vals = { 1.0,   1.0,  0.9880188,  0.6875,  0.01401875,  0.0 };
+
+    STATS_TEST_EXPECTED_BATCH(pbeta,inp_upper_vals,exp_upper_vals,std::vector<double>,a_par,b_par,false,false);
 #endif
 
 #ifdef STATS_TEST_MATRIX_FEATURES
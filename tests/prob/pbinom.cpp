@@ -61,12 +61,39 @@ int main()
     STATS_TEST_EXPECTED_VAL(pbinom,0,1-prob_par,false,1,prob_par);                                  // n_trials == 1
     STATS_TEST_EXPECTED_VAL(pbinom,1,1,false,1,prob_par);
 
+    STATS_TEST_EXPECTED_VAL(pbinom,480,0.1087241466,false,1000,0.5);                                // large n_trials
+    STATS_TEST_EXPECTED_VAL(pbinom,25,0.1631301045,false,100,0.3);
+
+    STATS_TEST_EXPECTED_UPPER_VAL(pbinom,inp_vals[0],1-exp_vals[0],false,n_trials,prob_par);        // upper tail
+    STATS_TEST_EXPECTED_UPPER_VAL(pbinom,inp_vals[2],1-exp_vals[2],true,n_trials,prob_par);
+    STATS_TEST_EXPECTED_UPPER_VAL(pbinom,520,0.0973831642,false,1000,0.5);
+    STATS_TEST_EXPECTED_UPPER_VAL(pbinom,40,0.0124984072,false,100,0.3);
+    STATS_TEST_EXPECTED_UPPER_VAL(pbinom,900,7.427818096436041e-163,true,1000,0.5);
+    STATS_TEST_EXPECTED_UPPER_VAL(pbinom,-1,1,false,n_trials,prob_par);
+    STATS_TEST_EXPECTED_UPPER_VAL(pbinom,n_trials,0,false,n_trials,prob_par);
+    STATS_TEST_EXPECTED_UPPER_VAL(pbinom,0,prob_par,false,1,prob_par);
+
     //
     // vector/matrix tests
 
 #ifdef STATS_TEST_STDVEC_FEATURES
     STATS_TEST_EXPECTED_MAT(pbinom,inp_vals,exp_vals,std::vector<double>,false,n_trials,prob_par);
     STATS_TEST_EXPECTED_MAT(pbinom,inp_vals,exp_vals,std::vector<double>,true,n_trials,prob_par);
+
+    std::vector<int> inp_vals_large    = { -1,  25,            480,           1000 };
+    std::vector<double> exp_vals_large = { 0,   0.1631301045,  0.1087241466,  1 };
+
+    STATS_TEST_EXPECTED_MAT(pbinom,std::vector<int>(inp_vals_large.begin(),inp_vals_large.begin()+2),
+                            std::vector<double>(exp_vals_large.begin(),exp_vals_large.begin()+2),
+                            std::vector<double>,false,100,0.3);
+    STATS_TEST_EXPECTED_MAT(pbinom,std::vector<int>(inp_vals_large.begin()+2,inp_vals_large.end()),
+                            std::vector<double>(exp_vals_large.begin()+2,exp_vals_large.end()),
+                            std::vector<double>,false,1000,0.5);
+
+    std::vector<int> inp_vals_sorted    = { -1,  480,           500,              520,           1000 };    // sorted input
+    std::vector<double> exp_vals_sorted = { 0,   0.1087241466,  0.5126125090891,  0.9026168358,  1 };
+
+    STATS_TEST_EXPECTED_MAT(pbinom,inp_vals_sorted,exp_vals_sorted,std::vector<double>,false,1000,0.5);
 #endif
 
 #ifdef STATS_TEST_MATRIX_FEATURES
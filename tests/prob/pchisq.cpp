@@ -43,6 +43,9 @@ int main()
     STATS_TEST_EXPECTED_VAL(pchisq,inp_vals[1],exp_vals[1],true,dof);
     STATS_TEST_EXPECTED_VAL(pchisq,inp_vals[2],exp_vals[2],false,dof);
 
+    STATS_TEST_EXPECTED_UPPER_VAL(pchisq,inp_vals[0],1-exp_vals[0],false,dof);                      // upper tail
+    STATS_TEST_EXPECTED_UPPER_VAL(pchisq,100,1.554159431389605e-21,true,3);
+
     STATS_TEST_EXPECTED_VAL(pchisq,TEST_NAN,TEST_NAN,false,3);                                      // Input NaNs
     STATS_TEST_EXPECTED_VAL(pchisq,1,TEST_NAN,false,TEST_NAN);
     STATS_TEST_EXPECTED_VAL(pchisq,TEST_NAN,TEST_NAN,false,TEST_NAN);
@@ -78,6 +78,13 @@ int main()
 #ifdef STATS_TEST_STDVEC_FEATURES
     STATS_TEST_EXPECTED_MAT(pgamma,inp_vals,exp_vals,std::vector<double>,false,shape_par,scale_par);
     STATS_TEST_EXPECTED_MAT(pgamma,inp_vals,exp_vals,std::vector<double>,true,shape_par,scale_par);
+
+    // upper tail from both the series and the continued fraction, with boundary inputs
+
+    std::vector<double> inp_upper_vals = { -1.0,  0.0,  1.0,        9.0,        30.0,          TEST_POSINF };
+    std::vector<double> exp_upper_vals = { 1.0,   1.0,  0.9553751,  0.1991483,  4.993992e-04,  0.0 };
+
+    STATS_TEST_EXPECTED_BATCH(pgamma,inp_upper_vals,exp_upper_vals,std::vector<double>,shape_par,scale_par,false,false);
 #endif
 
 #ifdef STATS_TEST_MATRIX_FEATURES
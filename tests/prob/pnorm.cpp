@@ -44,6 +44,10 @@ int main()
     STATS_TEST_EXPECTED_VAL(pnorm,inp_vals[1],exp_vals[1],true,mu,sigma);
     STATS_TEST_EXPECTED_VAL(pnorm,inp_vals[2],exp_vals[2],false,mu,sigma);
 
+    STATS_TEST_EXPECTED_UPPER_VAL(pnorm,inp_vals[0],1-exp_vals[0],false,mu,sigma);                  // upper tail
+    STATS_TEST_EXPECTED_UPPER_VAL(pnorm,9,1.1285884059538422e-19,true,0,1);
+    STATS_TEST_EXPECTED_UPPER_VAL(pnorm,30,4.906713927148764e-198,true,0,1);
+
     STATS_TEST_EXPECTED_VAL(pnorm,TEST_NAN,TEST_NAN,false,0,1);                                  // Input NaNs
     STATS_TEST_EXPECTED_VAL(pnorm,0,TEST_NAN,false,TEST_NAN,1);
     STATS_TEST_EXPECTED_VAL(pnorm,0,TEST_NAN,false,0,TEST_NAN);
@@ -91,6 +95,13 @@ int main()
 #ifdef STATS_TEST_STDVEC_FEATURES
     STATS_TEST_EXPECTED_MAT(pnorm,inp_vals,exp_vals,std::vector<double>,false,mu,sigma);
     STATS_TEST_EXPECTED_MAT(pnorm,inp_vals,exp_vals,std::vector<double>,true,mu,sigma);
+
+    // upper tail across the regions of the batch normal CDF, with infinite inputs
+
+    std::vector<double> inp_upper_vals = { TEST_NEGINF, -20.0, 0.5,        2.2,        12.0,          TEST_POSINF };
+    std::vector<double> exp_upper_vals = { 1.0,         1.0,   0.5987063,  0.2742531,  1.898956e-08,  0.0 };
+
+    STATS_TEST_EXPECTED_BATCH(pnorm,inp_upper_vals,exp_upper_vals,std::vector<double>,mu,sigma,false,false);
 #endif
 
 #ifdef STATS_TEST_MATRIX_FEATURES
@@ -60,12 +60,55 @@ int main()
     STATS_TEST_EXPECTED_VAL(ppois,20,0.9984117,false,10.0);
     STATS_TEST_EXPECTED_VAL(ppois,100,1.0,false,10.0);
 
+    STATS_TEST_EXPECTED_VAL(ppois,40,7.519646690907e-12,false,100.0);                               // large x and rate
+    STATS_TEST_EXPECTED_VAL(ppois,60,1.081221817024e-05,true,100.0);
+    STATS_TEST_EXPECTED_VAL(ppois,95,0.3311917340353,false,100.0);
+    STATS_TEST_EXPECTED_VAL(ppois,950,0.05783629295532,false,1000.0);
+
+    STATS_TEST_EXPECTED_VAL(ppois,20,1.0,false,1e-20);                                              // small rate
+    STATS_TEST_EXPECTED_VAL(ppois,31,1.0,false,1e-10);
+    STATS_TEST_EXPECTED_VAL(ppois,5,1.0,true,1e-300);
+    STATS_TEST_EXPECTED_VAL(ppois,1,1.0,false,1e-300);
+    STATS_TEST_EXPECTED_VAL(ppois,1,1.0-4.999999999666667e-21,true,1e-10);
+
+    STATS_TEST_EXPECTED_UPPER_VAL(ppois,inp_vals[0],1-exp_vals[0],false,rate);                      // upper tail
+    STATS_TEST_EXPECTED_UPPER_VAL(ppois,inp_vals[2],1-exp_vals[2],true,rate);
+    STATS_TEST_EXPECTED_UPPER_VAL(ppois,3,1.751622556291e-03,false,0.5);
+    STATS_TEST_EXPECTED_UPPER_VAL(ppois,100,5.339405460720e-64,true,10.0);
+    STATS_TEST_EXPECTED_UPPER_VAL(ppois,150,1.233094419160e-06,false,100.0);
+    STATS_TEST_EXPECTED_UPPER_VAL(ppois,1100,8.676409634436e-04,false,1000.0);
+    STATS_TEST_EXPECTED_UPPER_VAL(ppois,-1,1,false,2);
+    STATS_TEST_EXPECTED_UPPER_VAL(ppois,1,1,false,TEST_POSINF);
+    STATS_TEST_EXPECTED_UPPER_VAL(ppois,1,4.999999999666667e-21,false,1e-10);                       // small rate
+    STATS_TEST_EXPECTED_UPPER_VAL(ppois,1,4.999999999666667e-21,true,1e-10);
+    STATS_TEST_EXPECTED_UPPER_VAL(ppois,5,1.388888888769841e-63,true,1e-10);
+
     //
     // vector/matrix tests
 
 #ifdef STATS_TEST_STDVEC_FEATURES
     STATS_TEST_EXPECTED_MAT(ppois,inp_vals,exp_vals,std::vector<double>,false,rate);
     STATS_TEST_EXPECTED_MAT(ppois,inp_vals,exp_vals,std::vector<double>,true,rate);
+
+    std::vector<int> inp_vals_large    = { 95,             40,                 -1,  60 };
+    std::vector<double> exp_vals_large = { 0.3311917340353, 7.519646690907e-12, 0,  1.081221817024e-05 };
+
+    STATS_TEST_EXPECTED_MAT(ppois,inp_vals_large,exp_vals_large,std::vector<double>,false,100.0);
+
+    std::vector<int> inp_vals_sorted    = { -1,  40,                 60,                 95,              150 };  // sorted input
+    std::vector<double> exp_vals_sorted = { 0,   7.519646690907e-12, 1.081221817024e-05, 0.3311917340353, 0.9999987669055841 };
+
+    STATS_TEST_EXPECTED_MAT(ppois,inp_vals_sorted,exp_vals_sorted,std::vector<double>,false,100.0);
+
+    std::vector<int> inp_vals_small    = { 1,    5,    20,   31 };                                     // small rate
+    std::vector<double> exp_vals_small = { 1.0,  1.0,  1.0,  1.0 };
+
+    STATS_TEST_EXPECTED_MAT(ppois,inp_vals_small,exp_vals_small,std::vector<double>,false,1e-10);
+
+    std::vector<int> inp_vals_small_u    = { 20,   1,    31,   5 };
+    std::vector<double> exp_vals_small_u = { 1.0,  1.0,  1.0,  1.0 };
+
+    STATS_TEST_EXPECTED_MAT(ppois,inp_vals_small_u,exp_vals_small_u,std::vector<double>,true,1e-10);
 #endif
 
 #ifdef STATS_TEST_MATRIX_FEATURES
@@ -61,6 +61,12 @@ int main()
     STATS_TEST_EXPECTED_VAL(pt,1.0,0.8282818,false,9.0);                                            // dof == 9
     STATS_TEST_EXPECTED_VAL(pt,1.0,0.8295534,false,10.0);                                           // dof == 10
 
+    STATS_TEST_EXPECTED_UPPER_VAL(pt,40.0,1.7190340394579253e-05,true,3.0);                        // integer dof, far tails
+    STATS_TEST_EXPECTED_UPPER_VAL(pt,9.0,3.404952312873089e-10,true,29.0);
+    STATS_TEST_EXPECTED_VAL(pt,-9.0,3.404952312873089e-10,true,29.0);
+
+    STATS_TEST_EXPECTED_UPPER_VAL(pt,2.5,0.006210062,false,2e05);                                   // large dof
+
     STATS_TEST_EXPECTED_VAL(pt,0,0.5,false,TEST_POSINF);                                            // dt(x,+Inf) => dnorm(x,0,1)
     STATS_TEST_EXPECTED_VAL(pt,TEST_POSINF,1,false,TEST_POSINF);
 
@@ -73,6 +79,28 @@ int main()
 #ifdef STATS_TEST_STDVEC_FEATURES
     STATS_TEST_EXPECTED_MAT(pt,inp_vals,exp_vals,std::vector<double>,false,dof);
     STATS_TEST_EXPECTED_MAT(pt,inp_vals,exp_vals,std::vector<double>,true,dof);
+
+    // dof = 1 and 2, outside the integer series, through their closed forms
+
+    std::vector<double> inp_upper_vals = { TEST_NEGINF, -3.0,       0.0,  1.5,        40.0 };
+    std::vector<double> exp_upper_vals = { 1.0,         0.9522670,  0.5,  0.1361966,  3.122073e-04 };
+
+    STATS_TEST_EXPECTED_BATCH(pt,inp_upper_vals,exp_upper_vals,std::vector<double>,2.0,false,false);
+
+    std::vector<double> exp_cauchy_vals = { 1.0,         0.8975836,  0.5,  0.1871670,  7.956090e-03 };
+
+    STATS_TEST_EXPECTED_BATCH(pt,inp_upper_vals,exp_cauchy_vals,std::vector<double>,1.0,false,false);
+
+    // integer series over several blocks
+
+    std::vector<double> inp_long_vals, exp_long_vals;
+
+    for (int i = 0; i < 7; ++i) {
+        inp_long_vals.insert(inp_long_vals.end(),inp_vals.begin(),inp_vals.end());
+        exp_long_vals.insert(exp_long_vals.end(),exp_vals.begin(),exp_vals.end());
+    }
+
+    STATS_TEST_EXPECTED_BATCH(pt,inp_long_vals,exp_long_vals,std::vector<double>,dof,false,true);
 #endif
 
 #ifdef STATS_TEST_MATRIX_FEATURES
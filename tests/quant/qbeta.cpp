@@ -91,6 +91,32 @@ int main()
 
 #ifdef STATS_TEST_STDVEC_FEATURES
     STATS_TEST_EXPECTED_QUANT_MAT(qbeta,inp_vals,exp_vals,std::vector<double>,a_par,b_par);
+
+    std::vector<double> inp_vals_sorted = { 0,  0.15,       0.3,        0.5,        0.7,        0.95,       1 };  // sorted input
+    std::vector<double> exp_vals_sorted = { 0,  0.3734678,  0.4915952,  0.6142724,  0.7276161,  0.9023885,  1 };
+
+    STATS_TEST_EXPECTED_QUANT_MAT(qbeta,inp_vals_sorted,exp_vals_sorted,std::vector<double>,a_par,b_par);
+
+    std::vector<double> inp_vals_grid;                                                                   // iteration count
+    for (int i = 1; i < 100; ++i) {
+        inp_vals_grid.push_back(i / 100.0);
+    }
+
+    stats::ullint_t n_iter = 0;
+    stats::qbeta(inp_vals_grid,a_par,b_par,true,false,&n_iter);
+
+    std::cout << "qbeta: Halley iterations over " << inp_vals_grid.size() << " sorted values: " << n_iter << "." << std::endl;
+
+    if (n_iter == 0 || n_iter > 4*inp_vals_grid.size()) {
+        throw std::runtime_error("test fail");
+    }
+
+    n_iter = 1;
+    stats::qbeta(inp_vals_grid,a_par,b_par,false,false,&n_iter);                                               // upper tail skips the root-finder
+
+    if (n_iter != 0) {
+        throw std::runtime_error("test fail");
+    }
 #endif
 
 #ifdef STATS_TEST_MATRIX_FEATURES
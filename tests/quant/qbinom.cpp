@@ -65,11 +65,22 @@ int main()
     STATS_TEST_EXPECTED_QUANT_VAL(qbinom,1-prob_par,0,1,prob_par);                                  // n_trials == 1
     STATS_TEST_EXPECTED_QUANT_VAL(qbinom,1-prob_par+0.0001,1,1,prob_par);
 
+    STATS_TEST_EXPECTED_QUANT_VAL(qbinom,0.1,480,1000,0.5);                                         // large n_trials
+    STATS_TEST_EXPECTED_QUANT_VAL(qbinom,0.5,500,1000,0.5);
+    STATS_TEST_EXPECTED_QUANT_VAL(qbinom,0.9,520,1000,0.5);
+    STATS_TEST_EXPECTED_QUANT_VAL(qbinom,0.01,20,100,0.3);
+    STATS_TEST_EXPECTED_QUANT_VAL(qbinom,0.99,41,100,0.3);
+
     //
     // vector/matrix tests
 
 #ifdef STATS_TEST_STDVEC_FEATURES
     STATS_TEST_EXPECTED_QUANT_MAT(qbinom,inp_vals,exp_vals,std::vector<double>,n_trials,prob_par);
+
+    std::vector<double> inp_vals_sorted = { 0,  0.1,  0.5,  0.9,  1 };                                 // sorted input
+    std::vector<double> exp_vals_sorted = { 0,  480,  500,  520,  1000 };
+
+    STATS_TEST_EXPECTED_QUANT_MAT(qbinom,inp_vals_sorted,exp_vals_sorted,std::vector<double>,1000,0.5);
 #endif
 
 #ifdef STATS_TEST_MATRIX_FEATURES
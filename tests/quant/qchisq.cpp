@@ -46,6 +46,10 @@ int main()
     STATS_TEST_EXPECTED_QUANT_VAL(qchisq,inp_vals[1],exp_vals[1],dof);
     STATS_TEST_EXPECTED_QUANT_VAL(qchisq,inp_vals[2],exp_vals[2],dof);
 
+    STATS_TEST_EXPECTED_QUANT_TAIL_VAL(qchisq,1-inp_vals[2],exp_vals[2],false,false,dof);           // upper tail, log p
+    STATS_TEST_EXPECTED_QUANT_TAIL_VAL(qchisq,std::log(inp_vals[0]),exp_vals[0],true,true,dof);
+    STATS_TEST_EXPECTED_QUANT_TAIL_VAL(qchisq,1e-20,96.2391239380938,false,false,3);
+
     STATS_TEST_EXPECTED_QUANT_VAL(qchisq,TEST_NAN,TEST_NAN,3);                                      // Input NaNs
     STATS_TEST_EXPECTED_QUANT_VAL(qchisq,0.5,TEST_NAN,TEST_NAN);
     STATS_TEST_EXPECTED_QUANT_VAL(qchisq,TEST_NAN,TEST_NAN,TEST_NAN);
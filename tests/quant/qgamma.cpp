@@ -79,6 +79,32 @@ int main()
 
 #ifdef STATS_TEST_STDVEC_FEATURES
     STATS_TEST_EXPECTED_QUANT_MAT(qgamma,inp_vals,exp_vals,std::vector<double>,shape_par,scale_par);
+
+    std::vector<double> inp_vals_sorted = { 0,  0.05,      0.2,       0.35,      0.5,       0.79 };          // sorted input
+    std::vector<double> exp_vals_sorted = { 0,  1.066085,  2.473165,  3.705131,  5.035041,  8.787132 };
+
+    STATS_TEST_EXPECTED_QUANT_MAT(qgamma,inp_vals_sorted,exp_vals_sorted,std::vector<double>,shape_par,scale_par);
+
+    std::vector<double> inp_vals_grid;                                                                   // iteration count
+    for (int i = 1; i < 100; ++i) {
+        inp_vals_grid.push_back(i / 100.0);
+    }
+
+    stats::ullint_t n_iter = 0;
+    stats::qgamma(inp_vals_grid,shape_par,scale_par,true,false,&n_iter);
+
+    std::cout << "qgamma: Halley iterations over " << inp_vals_grid.size() << " sorted values: " << n_iter << "." << std::endl;
+
+    if (n_iter == 0 || n_iter > 4*inp_vals_grid.size()) {
+        throw std::runtime_error("test fail");
+    }
+
+    n_iter = 1;
+    stats::qgamma(inp_vals_grid,shape_par,scale_par,false,false,&n_iter);                                               // upper tail skips the root-finder
+
+    if (n_iter != 0) {
+        throw std::runtime_error("test fail");
+    }
 #endif
 
 #ifdef STATS_TEST_MATRIX_FEATURES
@@ -48,6 +48,12 @@ int main()
 
     STATS_TEST_EXPECTED_QUANT_VAL(qnorm,0.9995,3.290527,0,1);
 
+    STATS_TEST_EXPECTED_QUANT_TAIL_VAL(qnorm,1-inp_vals[2],exp_vals[2],false,false,mu,sigma);       // upper tail, log p
+    STATS_TEST_EXPECTED_QUANT_TAIL_VAL(qnorm,std::log(inp_vals[0]),exp_vals[0],true,true,mu,sigma);
+    STATS_TEST_EXPECTED_QUANT_TAIL_VAL(qnorm,1e-20,9.262340089798407,false,false,0,1);
+    STATS_TEST_EXPECTED_QUANT_TAIL_VAL(qnorm,-1000,-44.6157477319694,true,true,0,1);
+    STATS_TEST_EXPECTED_QUANT_TAIL_VAL(qnorm,0,TEST_NEGINF,false,true,0,1);
+
     STATS_TEST_EXPECTED_QUANT_VAL(qnorm,TEST_NAN,TEST_NAN,0,1);                                     // Input NaNs
     STATS_TEST_EXPECTED_QUANT_VAL(qnorm,0,TEST_NAN,TEST_NAN,1);
     STATS_TEST_EXPECTED_QUANT_VAL(qnorm,0,TEST_NAN,0,TEST_NAN);
@@ -88,6 +88,11 @@ int main()
 
 #ifdef STATS_TEST_STDVEC_FEATURES
     STATS_TEST_EXPECTED_QUANT_MAT(qpois,inp_vals,exp_vals,std::vector<double>,rate_par);
+
+    std::vector<double> inp_vals_sorted = { 0.00001,  0.001,  0.01,  0.5,  0.99,  0.999999 };           // sorted input
+    std::vector<double> exp_vals_sorted = { 0,        2,      4,     11,   19,    30 };
+
+    STATS_TEST_EXPECTED_QUANT_MAT(qpois,inp_vals_sorted,exp_vals_sorted,std::vector<double>,11);
 #endif
 
 #ifdef STATS_TEST_MATRIX_FEATURES
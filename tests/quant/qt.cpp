@@ -73,6 +73,12 @@ int main()
     STATS_TEST_EXPECTED_QUANT_VAL(qt,0.7,0.5434802,9.0);                                            // dof == 9
     STATS_TEST_EXPECTED_QUANT_VAL(qt,0.7,0.541528,10.0);                                            // dof == 10
 
+    STATS_TEST_EXPECTED_QUANT_VAL(qt,0.975,2.776445,4.0);                                           // closed form, dof == 4
+    STATS_TEST_EXPECTED_QUANT_VAL(qt,0.7,0.530019,30.0);                                            // integer dof
+    STATS_TEST_EXPECTED_QUANT_VAL(qt,1e-20,-256.4347,10.0);
+    STATS_TEST_EXPECTED_QUANT_TAIL_VAL(qt,-1000.0,-1.133316e+87,true,true,5.0);
+    STATS_TEST_EXPECTED_QUANT_VAL(qt,0.975,1.959976,2e05);                                          // large dof
+
     STATS_TEST_EXPECTED_QUANT_VAL(qt,0.7,0.5244005,TEST_POSINF);                                    // qt(p,+Inf) => qnorm(p,0,1)
 
     //
@@ -0,0 +1,141 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+#include "../stats_tests.hpp"
+
+int main()
+{
+    print_begin("mvnorm_frozen");
+
+#ifdef STATS_TEST_MATRIX_FEATURES
+    int n = 10000;
+    int K = 3;
+
+    std::cout << "\n*** mvnorm_frozen: begin tests. ***\n" << std::endl;
+
+    //
+
+    mat_obj mu(K,1), Sigma, v(K,1);
+    stats::mat_ops::fill(mu,1.0);
+    stats::mat_ops::fill(v,0.5);
+
+    stats::mat_ops::eye(Sigma,K);
+    Sigma(0,0) = 1.3;
+    Sigma(1,0) = 0.4;
+    Sigma(0,1) = 0.4;
+
+    stats::mvnorm_frozen<> dist(mu,Sigma,true);
+
+    mat_obj X(K,1);
+    stats::mat_ops::fill(X,0.2);
+
+    double max_err = std::abs(dist.logpdf(X) - stats::dmvnorm(X,mu,Sigma,true));
+
+    // draws
+
+    stats::rand_engine_t engine(1776);
+
+    mat_obj mvnorm_vars = dist.sample<mat_obj>(n,engine);
+
+    mat_obj mean_vec;
+    stats::mat_ops::zeros(mean_vec,1,K);
+
+    for (int i=0; i < n; i++)
+    {
+        mean_vec = mean_vec + stats::mat_ops::get_row(mvnorm_vars,i);
+    }
+
+    mean_vec = mean_vec * (1.0 / static_cast<double>(n));
+
+    mat_obj demeaned = mvnorm_vars - stats::mat_ops::repmat(mean_vec,n,1);
+    mat_obj cov_mat = stats::mat_ops::trans(demeaned) * demeaned * (1.0 / static_cast<double>(n));
+
+    std::cout << "mu_hat:\n" << stats::mat_ops::trans(mean_vec) << std::endl;
+    std::cout << "\nSigma_hat:\n" << cov_mat << std::endl;
+
+    // batch density against dmvnorm_batch; precision against Sigma
+
+    mat_obj log_dens = dist.logpdf_batch(mvnorm_vars);
+    mat_obj log_dens_check = stats::dmvnorm_batch(mvnorm_vars,mu,Sigma,true);
+
+    for (int i=0; i < n; i++)
+    {
+        max_err = std::max(max_err, std::abs(log_dens(i,0) - log_dens_check(i,0)));
+    }
+
+    mat_obj prec_prod = dist.precision<mat_obj>() * Sigma;
+
+    for (int i=0; i < K; i++)
+    {
+        for (int j=0; j < K; j++)
+        {
+            max_err = std::max(max_err, std::abs(prec_prod(i,j) - (i == j ? 1.0 : 0.0)));
+        }
+    }
+
+    // rank-one update and downdate of the factor
+
+    dist.chol_update(v);
+
+    mat_obj Sigma_upd = Sigma + v * stats::mat_ops::trans(v);
+
+    max_err = std::max(max_err, std::abs(dist.logpdf(X) - stats::dmvnorm(X,mu,Sigma_upd,true)));
+    max_err = std::max(max_err, std::abs(dist.log_det() - stats::mat_ops::log_det(Sigma_upd)));
+
+    dist.chol_downdate(v);
+
+    max_err = std::max(max_err, std::abs(dist.logpdf(X) - stats::dmvnorm(X,mu,Sigma,true)));
+
+    std::cout << "max. difference from dmvnorm: " << max_err << "." << std::endl;
+
+    if (max_err > 1e-10) {
+        throw std::runtime_error("test fail");
+    }
+
+    // an indefinite Sigma leaves the object invalid
+
+    mat_obj Sigma_indef;
+    stats::mat_ops::eye(Sigma_indef,K);
+    Sigma_indef(0,1) = 2.0;
+    Sigma_indef(1,0) = 2.0;
+
+    stats::mvnorm_frozen<> dist_indef(mu,Sigma_indef);
+
+    std::cout << "indefinite Sigma: is_valid = " << dist_indef.is_valid() << ", logpdf = " << dist_indef.logpdf(X) << "." << std::endl;
+
+    if (dist_indef.is_valid() || !std::isnan(dist_indef.logpdf(X)) || !std::isnan(dist_indef.log_det())) {
+        throw std::runtime_error("test fail");
+    }
+
+    //
+    // coverage tests
+
+    dist.sample<mat_obj>(engine);
+    dist.chol_factor<mat_obj>();
+
+    //
+
+    std::cout << "\n*** mvnorm_frozen: end tests. ***\n" << std::endl;
+#else
+    std::cout << "\n*** mvnorm_frozen: no matrix library found. ***\n" << std::endl;
+#endif
+
+    return 0;
+}
@@ -0,0 +1,153 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+#include "../stats_tests.hpp"
+
+int main()
+{
+    print_begin("rdirichlet");
+
+#ifdef STATS_TEST_MATRIX_FEATURES
+    int n = 100000;
+    int K = 3;
+
+    std::cout << "\n*** rdirichlet: begin tests. ***\n" << std::endl;
+
+    //
+
+    mat_obj alpha(K,1);
+    alpha(0,0) = 0.5;
+    alpha(1,0) = 1.5;
+    alpha(2,0) = 3.0;
+
+    const double alpha_sum = 5.0;
+
+    mat_obj dirichlet_vars = stats::rdirichlet(n,alpha,1776);
+
+    // each row sums to one, and the mean of component k is alpha_k / sum(alpha)
+
+    double max_sum_err = 0.0;
+
+    mat_obj mean_vec;
+    stats::mat_ops::zeros(mean_vec,K,1);
+
+    for (int i=0; i < n; i++)
+    {
+        double row_sum = 0.0;
+
+        for (int k=0; k < K; k++)
+        {
+            row_sum += dirichlet_vars(i,k);
+            mean_vec(k,0) += dirichlet_vars(i,k) / static_cast<double>(n);
+        }
+
+        max_sum_err = std::max(max_sum_err, std::abs(row_sum - 1.0));
+    }
+
+    std::cout << "mean (expected: alpha / sum(alpha)):\n" << mean_vec << std::endl;
+    std::cout << "\nmax. error in row sums: " << max_sum_err << std::endl;
+
+    double max_err = 0.0;
+
+    for (int k=0; k < K; k++)
+    {
+        max_err = std::max(max_err, std::abs(mean_vec(k,0) - alpha(k,0) / alpha_sum));
+    }
+
+    if (max_err > 0.005 || max_sum_err > 1e-12) {
+        throw std::runtime_error("test fail");
+    }
+
+    // seeded draws are reproducible
+
+    mat_obj draws_1 = stats::rdirichlet(n,alpha,1776);
+
+    double max_diff = 0.0;
+
+    for (int i=0; i < n; i++)
+    {
+        for (int k=0; k < K; k++)
+        {
+            max_diff = std::max(max_diff, std::abs(draws_1(i,k) - dirichlet_vars(i,k)));
+        }
+    }
+
+    std::cout << "\nmax. difference between seeded draws: " << max_diff << std::endl;
+
+    if (max_diff > 0.0) {
+        throw std::runtime_error("test fail");
+    }
+
+    // small concentration parameters: the gamma variates underflow, but the rows are still valid
+
+    mat_obj alpha_small(K,1);
+    stats::mat_ops::fill(alpha_small,0.001);
+
+    mat_obj small_vars = stats::rdirichlet(1000,alpha_small,1776);
+
+    for (int i=0; i < 1000; i++)
+    {
+        double row_sum = 0.0;
+
+        for (int k=0; k < K; k++)
+        {
+            if (!std::isfinite(small_vars(i,k))) {
+                throw std::runtime_error("test fail");
+            }
+
+            row_sum += small_vars(i,k);
+        }
+
+        if (std::abs(row_sum - 1.0) > 1e-12) {
+            throw std::runtime_error("test fail");
+        }
+    }
+
+    std::cout << "\nsmall alpha: rows are valid" << std::endl;
+
+    // invalid parameters
+
+    alpha(1,0) = -1.0;
+
+    mat_obj nan_vars = stats::rdirichlet(10,alpha,1776);
+
+    if (!std::isnan(nan_vars(0,0))) {
+        throw std::runtime_error("test fail");
+    }
+
+    //
+    // coverage tests
+
+    alpha(1,0) = 1.5;
+
+    stats::rand_engine_t engine(1776);
+    stats::rdirichlet(n,alpha,engine);
+
+    stats::rdirichlet(n,alpha);
+
+    //
+
+    std::cout << "\n*** rdirichlet: end tests. ***\n" << std::endl;
+#else
+    std::cout << "\n*** rdirichlet: no matrix library found. ***\n" << std::endl;
+#endif
+
+    return 0;
+}
@@ -51,6 +51,29 @@ int main()
 
     std::cout << "density value: " << dinvwish_val << std::endl;
 
+    // n draws with a non-diagonal scale matrix, from Psi and from the factor of its inverse
+
+    Psi(1,0) = 0.3 * static_cast<double>(nu - K - 1);
+    Psi(0,1) = Psi(1,0);
+
+    mat_obj chol_Psi_inv = stats::mat_ops::chol(stats::mat_ops::inv(Psi));
+
+    std::vector<mat_obj> draws = stats::rinvwish(n_samp,Psi,nu,false,1776);
+    std::vector<mat_obj> draws_pre = stats::rinvwish(n_samp,chol_Psi_inv,nu,true,1776);
+
+    mat_obj X_pre;
+    stats::mat_ops::zeros(X,K,K);
+    stats::mat_ops::zeros(X_pre,K,K);
+
+    for (int i=0; i < n_samp; i++) {
+        X += draws[i] / static_cast<double>(n_samp);
+        X_pre += draws_pre[i] / static_cast<double>(n_samp);
+    }
+
+    std::cout << "\ntrue mean:\n" << Psi / static_cast<double>(nu - K - 1) << std::endl;
+    std::cout << "sample mean, n draws:\n" << X << std::endl;
+    std::cout << "sample mean, n draws from the inverse factor:\n" << X_pre << std::endl;
+
     //
 
     std::cout << "\n*** rinvwish: end tests. ***\n" << std::endl;
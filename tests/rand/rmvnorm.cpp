@@ -60,6 +60,30 @@ int main()
     std::cout << "mu_hat:\n" << mean_vec << std::endl;
     std::cout << "\nSigma_hat:\n" << cov_mat << std::endl;
 
+    // seeded draws are reproducible
+
+    mat_obj draws_1 = stats::rmvnorm(n,mu,Sigma,false,1776);
+    mat_obj draws_2 = stats::rmvnorm(n,mu,Sigma,false,1776);
+
+    stats::rand_engine_t engine(1776);
+    stats::rmvnorm(n,mu,Sigma,engine);
+
+    double max_diff = 0.0;
+
+    for (int i=0; i < n; i++)
+    {
+        for (int k=0; k < K; k++)
+        {
+            max_diff = std::max(max_diff, std::abs(draws_1(i,k) - draws_2(i,k)));
+        }
+    }
+
+    std::cout << "\nmax. difference between seeded draws: " << max_diff << std::endl;
+
+    if (max_diff > 0.0) {
+        throw std::runtime_error("test fail");
+    }
+
     //
     // coverage tests
 
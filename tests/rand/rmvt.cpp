@@ -0,0 +1,121 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+#include "../stats_tests.hpp"
+
+int main()
+{
+    print_begin("rmvt");
+
+#ifdef STATS_TEST_MATRIX_FEATURES
+    int n = 100000;
+    int K = 3;
+    double dof = 8.0;
+
+    std::cout << "\n*** rmvt: begin tests. ***\n" << std::endl;
+
+    //
+
+    mat_obj mu(K,1), Sigma;
+    stats::mat_ops::fill(mu,2.0);
+
+    stats::mat_ops::eye(Sigma,K);
+    Sigma(1,0) = 0.3;
+    Sigma(0,1) = 0.3;
+
+    std::cout << "\nSigma:\n" << Sigma << std::endl;
+
+    mat_obj mvt_vars = stats::rmvt(n,mu,Sigma,dof,false,1776);
+
+    mat_obj mean_vec;
+    stats::mat_ops::zeros(mean_vec,1,K);
+
+    for (int i=0; i < n; i++)
+    {
+        mean_vec = mean_vec + stats::mat_ops::get_row(mvt_vars,i);
+    }
+
+    mean_vec = mean_vec * (1.0 / static_cast<double>(n));
+
+    mat_obj demeaned = mvt_vars - stats::mat_ops::repmat(mean_vec,n,1);
+
+    mean_vec = stats::mat_ops::trans(mean_vec);
+
+    mat_obj cov_mat = stats::mat_ops::trans(demeaned) * demeaned * (1.0 / static_cast<double>(n));
+
+    std::cout << "mu_hat:\n" << mean_vec << std::endl;
+    std::cout << "\nSigma_hat (expected: Sigma * " << dof / (dof - 2.0) << "):\n" << cov_mat << std::endl;
+
+    // the mean is mu and the covariance matrix is Sigma * dof / (dof - 2)
+
+    double max_err = 0.0;
+
+    for (int k=0; k < K; k++)
+    {
+        max_err = std::max(max_err, std::abs(mean_vec(k,0) - mu(k,0)));
+
+        for (int l=0; l < K; l++)
+        {
+            max_err = std::max(max_err, std::abs(cov_mat(k,l) - Sigma(k,l) * dof / (dof - 2.0)));
+        }
+    }
+
+    if (max_err > 0.05) {
+        throw std::runtime_error("test fail");
+    }
+
+    // seeded draws are reproducible
+
+    mat_obj draws_1 = stats::rmvt(n,mu,Sigma,dof,false,1776);
+
+    double max_diff = 0.0;
+
+    for (int i=0; i < n; i++)
+    {
+        for (int k=0; k < K; k++)
+        {
+            max_diff = std::max(max_diff, std::abs(draws_1(i,k) - mvt_vars(i,k)));
+        }
+    }
+
+    std::cout << "\nmax. difference between seeded draws: " << max_diff << std::endl;
+
+    if (max_diff > 0.0) {
+        throw std::runtime_error("test fail");
+    }
+
+    //
+    // coverage tests
+
+    stats::rand_engine_t engine(1776);
+    stats::rmvt(n,mu,Sigma,dof,engine);
+
+    stats::rmvt(mu,Sigma,dof);
+    stats::rmvt(mu,Sigma,dof,false);
+
+    //
+
+    std::cout << "\n*** rmvt: end tests. ***\n" << std::endl;
+#else
+    std::cout << "\n*** rmvt: no matrix library found. ***\n" << std::endl;
+#endif
+
+    return 0;
+}
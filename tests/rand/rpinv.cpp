@@ -0,0 +1,112 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2021 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+
+#include "../stats_tests.hpp"
+
+int main()
+{
+    print_begin("rpinv");
+
+#if defined(STATS_TEST_STDVEC_FEATURES) || defined(STATS_TEST_MATRIX_FEATURES)
+    int n_sample = 10000;
+
+    //
+
+    double alpha = 3;
+    double beta = 2;
+
+    double beta_mean = alpha/(alpha + beta);
+    double beta_var = alpha*beta/(std::pow(alpha + beta,2)*(alpha + beta + 1.0));
+
+    stats::pinv_sampler<double> beta_sampler = stats::pinv_beta(alpha,beta,1e-10);
+
+    std::cout << "beta sampler: " << beta_sampler.n_intervals() << " intervals, u-error: " << beta_sampler.u_error() << ". Should be below: 1e-10\n";
+    std::cout << "beta sampler quantile at 0.3: " << beta_sampler.quantile(0.3) << ". Should be close to: " << stats::qbeta(0.3,alpha,beta) << "\n";
+    std::cout << "beta rv draw: " << stats::rpinv(beta_sampler) << std::endl;
+
+    double shape = 0.5;
+    double scale = 2;
+
+    stats::pinv_sampler<double> gamma_sampler = stats::pinv_gamma(shape,scale);
+
+    std::cout << "\ngamma sampler: " << gamma_sampler.n_intervals() << " intervals, u-error: " << gamma_sampler.u_error() << ". Should be below: 1e-10\n";
+    std::cout << "gamma sampler quantile at 0.9: " << gamma_sampler.quantile(0.9) << ". Should be close to: " << stats::qgamma(0.9,shape,scale) << std::endl;
+
+    double dof = 4;
+
+    stats::pinv_sampler<double> t_sampler = stats::pinv_t(dof,1e-12);
+
+    std::cout << "\nt sampler: " << t_sampler.n_intervals() << " intervals, u-error: " << t_sampler.u_error() << ". Should be below: 1e-12\n";
+    std::cout << "t sampler quantile at 0.975: " << t_sampler.quantile(0.975) << ". Should be close to: " << stats::qt(0.975,dof) << std::endl;
+
+    double df1 = 3;
+    double df2 = 8;
+
+    double f_mean = df2 / (df2 - 2.0);
+
+    stats::pinv_sampler<double> f_sampler = stats::pinv_f(df1,df2);
+
+    std::cout << "\nF sampler: " << f_sampler.n_intervals() << " intervals, u-error: " << f_sampler.u_error() << ". Should be below: 1e-10\n";
+
+    stats::pinv_sampler<double> bad_sampler = stats::pinv_beta(-1.0,beta);
+
+    std::cout << "\ninvalid beta sampler: valid flag: " << bad_sampler.is_valid() << ", draw: " << stats::rpinv(bad_sampler) << ". Should be: 0, nan" << std::endl;
+
+    //
+
+#ifdef STATS_TEST_STDVEC_FEATURES
+    std::cout << "\n";
+    std::vector<double> beta_stdvec = stats::rpinv<std::vector<double>>(n_sample,1,beta_sampler);
+
+    std::cout << "stdvec: beta rv mean: " << stats::mat_ops::mean(beta_stdvec) << ". Should be close to: " << beta_mean << "\n";
+    std::cout << "stdvec: beta rv variance: " << stats::mat_ops::var(beta_stdvec) << ". Should be close to: " << beta_var << "\n";
+
+    std::vector<double> gamma_stdvec = stats::rpinv<std::vector<double>>(n_sample,1,gamma_sampler);
+
+    std::cout << "stdvec: gamma rv mean: " << stats::mat_ops::mean(gamma_stdvec) << ". Should be close to: " << shape*scale << "\n";
+
+    std::vector<double> f_stdvec = stats::rpinv<std::vector<double>>(n_sample,1,f_sampler);
+
+    std::cout << "stdvec: F rv mean: " << stats::mat_ops::mean(f_stdvec) << ". Should be close to: " << f_mean << std::endl;
+#endif
+
+#ifdef STATS_TEST_MATRIX_FEATURES
+    std::cout << "\n";
+    mat_obj beta_vec = stats::rpinv<mat_obj>(n_sample,1,beta_sampler);
+
+    std::cout << "beta rv mean: " << stats::mat_ops::mean(beta_vec) << ". Should be close to: " << beta_mean << std::endl;
+    std::cout << "beta rv variance: " << stats::mat_ops::var(beta_vec) << ". Should be close to: " << beta_var << std::endl;
+
+    mat_obj t_vec = stats::rpinv<mat_obj>(n_sample,1,t_sampler);
+
+    std::cout << "t rv mean: " << stats::mat_ops::mean(t_vec) << ". Should be close to: " << 0.0 << std::endl;
+    std::cout << "t rv variance: " << stats::mat_ops::var(t_vec) << ". Should be close to: " << dof / (dof - 2.0) << std::endl;
+#endif
+
+    //
+
+    std::cout << "\n*** rpinv: end tests. ***\n" << std::endl;
+#else
+    std::cout << "\n*** rpinv: no vector or matrix library found. ***\n" << std::endl;
+#endif
+    
+    return 0;
+}
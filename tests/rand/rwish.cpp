@@ -52,6 +52,24 @@ int main()
 
     std::cout << "density value: " << dwish_val << std::endl;
 
+    // n draws with a non-diagonal scale matrix
+
+    Psi(1,0) = 0.3 / nu;
+    Psi(0,1) = Psi(1,0);
+
+    stats::rand_engine_t engine(1776);
+
+    std::vector<mat_obj> draws = stats::rwish(n_samp,Psi,nu,engine);
+
+    stats::mat_ops::zeros(X,K,K);
+
+    for (int i=0; i < n_samp; i++) {
+        X += draws[i] / static_cast<double>(n_samp);
+    }
+
+    std::cout << "\ntrue mean:\n" << Psi * static_cast<double>(nu) << std::endl;
+    std::cout << "sample mean, n draws:\n" << X << std::endl;
+
     //
 
     std::cout << "\n*** rwish: end tests. ***\n" << std::endl;
@@ -167,6 +167,9 @@ int STATS_TEST_NUMBER = 0;
     #ifndef TEST_STRIP_FN_ARGS
         #define TEST_STRIP_FN_ARGS(fn,x,lf,...) fn(x,__VA_ARGS__,lf)
     #endif
+    #ifndef TEST_STRIP_TAIL_FN_ARGS
+        #define TEST_STRIP_TAIL_FN_ARGS(fn,x,lf,lt,...) fn(x,__VA_ARGS__,lf,lt)
+    #endif
     #ifndef TEST_PRINT_LOG_INPUT
         #define TEST_PRINT_LOG_INPUT(lf) << "," << ((lf) ? "true" : "false")
     #endif
@@ -174,6 +177,9 @@ int STATS_TEST_NUMBER = 0;
     #ifndef TEST_STRIP_FN_ARGS
         #define TEST_STRIP_FN_ARGS(fn,x,lf,...) fn(x,__VA_ARGS__)
     #endif
+    #ifndef TEST_STRIP_TAIL_FN_ARGS
+        #define TEST_STRIP_TAIL_FN_ARGS(fn,x,lf,lt,...) fn(x,__VA_ARGS__,lt)
+    #endif
     #ifndef TEST_PRINT_LOG_INPUT
         #define TEST_PRINT_LOG_INPUT(lf) 
     #endif
@@ -324,6 +330,78 @@ log_if(const T x, const bool log_form)
     STATS_TEST_EXPECTED_VAL(fn_eval, val_inp, expected_val, false, __VA_ARGS__)                     \
 }
 
+// lower_tail = false cases
+
+#define STATS_TEST_EXPECTED_UPPER_VAL(fn_eval, val_inp, expected_val,                               \
+                                      log_form, ...)                                                \
+{                                                                                                   \
+    ++STATS_TEST_NUMBER;                                                                            \
+    std::string fn_name = #fn_eval;                                                                 \
+    fn_name += " (upper tail)";                                                                     \
+                                                                                                    \
+    auto check_val = log_if(expected_val,log_form);                                                 \
+                                                                                                    \
+    auto f_val = TEST_STRIP_TAIL_FN_ARGS(stats::fn_eval,val_inp,log_form,false,__VA_ARGS__);        \
+    auto err_val = std::abs(f_val - check_val) / (1 + std::abs(check_val));                         \
+                                                                                                    \
+    bool test_success = false;                                                                      \
+                                                                                                    \
+    if (VAL_IS_NAN(expected_val) && VAL_IS_NAN(f_val)) {                                            \
+        test_success = true;                                                                        \
+    } else if(!VAL_IS_NAN(f_val) && VAL_IS_INF(f_val) && f_val == check_val) {                      \
+        test_success = true;                                                                        \
+    } else if(err_val < TEST_ERR_TOL) {                                                             \
+        test_success = true;                                                                        \
+    } else {                                                                                        \
+        print_test_fail(fn_name,STATS_TEST_NUMBER,TEST_PRINT_LEVEL,                                 \
+                        TEST_PRINT_PRECISION_1,TEST_PRINT_PRECISION_2,                              \
+                        f_val,check_val,err_val,val_inp,__VA_ARGS__,log_form);                      \
+    }                                                                                               \
+                                                                                                    \
+    if (test_success && TEST_PRINT_LEVEL > 0)                                                       \
+    {                                                                                               \
+        print_test_pass(fn_name,TEST_PRINT_LEVEL,                                                   \
+                        TEST_PRINT_PRECISION_1,TEST_PRINT_PRECISION_2,                              \
+                        f_val,err_val,val_inp,__VA_ARGS__,log_form);                                \
+    }                                                                                               \
+}
+
+// quantile inputs given as upper-tail and/or log probabilities
+
+#define STATS_TEST_EXPECTED_QUANT_TAIL_VAL(fn_eval, val_inp, expected_val,                          \
+                                           lower_tail, log_p, ...)                                  \
+{                                                                                                   \
+    ++STATS_TEST_NUMBER;                                                                            \
+    std::string fn_name = #fn_eval;                                                                 \
+    fn_name += (lower_tail) ? "" : " (upper tail)";                                                 \
+    fn_name += (log_p) ? " (log p)" : "";                                                           \
+                                                                                                    \
+    auto f_val = stats::fn_eval(val_inp,__VA_ARGS__,lower_tail,log_p);                              \
+    auto check_val = static_cast<decltype(f_val)>(expected_val);                                    \
+    auto err_val = std::abs(f_val - check_val) / (1 + std::abs(check_val));                         \
+                                                                                                    \
+    bool test_success = false;                                                                      \
+                                                                                                    \
+    if (VAL_IS_NAN(expected_val) && VAL_IS_NAN(f_val)) {                                            \
+        test_success = true;                                                                        \
+    } else if(!VAL_IS_NAN(f_val) && VAL_IS_INF(f_val) && f_val == check_val) {                      \
+        test_success = true;                                                                        \
+    } else if(err_val < TEST_ERR_TOL) {                                                             \
+        test_success = true;                                                                        \
+    } else {                                                                                        \
+        print_test_fail(fn_name,STATS_TEST_NUMBER,TEST_PRINT_LEVEL,                                 \
+                        TEST_PRINT_PRECISION_1,TEST_PRINT_PRECISION_2,                              \
+                        f_val,check_val,err_val,val_inp,__VA_ARGS__,log_p);                         \
+    }                                                                                               \
+                                                                                                    \
+    if (test_success && TEST_PRINT_LEVEL > 0)                                                       \
+    {                                                                                               \
+        print_test_pass(fn_name,TEST_PRINT_LEVEL,                                                   \
+                        TEST_PRINT_PRECISION_1,TEST_PRINT_PRECISION_2,                              \
+                        f_val,err_val,val_inp,__VA_ARGS__,log_p);                                   \
+    }                                                                                               \
+}
+
 //
 // matrix tests
 //
@@ -498,6 +576,39 @@ print_mat_test_fail(std::string fn_name, std::string mtype, int test_number,
     STATS_TEST_EXPECTED_MAT(fn_eval, vals_inp, exp_vals, mtype, false, __VA_ARGS__)                 \
 }
 
+// batch functions: the remaining arguments, parameter arrays included, are passed through as they are
+
+#define STATS_TEST_EXPECTED_BATCH(fn_eval, vals_inp, exp_vals, mtype, ...)                          \
+{                                                                                                   \
+    ++STATS_TEST_NUMBER;                                                                            \
+    std::string fn_name = #fn_eval;                                                                 \
+                                                                                                    \
+    mtype f_vals = stats::fn_eval(vals_inp,__VA_ARGS__);                                            \
+                                                                                                    \
+    double err_val = MATOPS::sum_absdiff(f_vals,exp_vals);                                          \
+    err_val /= MATOPS::n_elem(vals_inp);                                                            \
+                                                                                                    \
+    if (err_val < TEST_ERR_TOL) {                                                                   \
+        if (TEST_PRINT_LEVEL > 0) {                                                                 \
+            std::cout << "[\033[32mOK\033[0m] " << fn_name << "(X,...) = \n";                       \
+            MATOPS::cout_output(f_vals);                                                            \
+            std::cout << std::endl;                                                                 \
+        }                                                                                           \
+    } else {                                                                                        \
+        std::cerr << "\033[31m Vector/Matrix test failed!\033[0m\n";                                \
+        std::cerr << "  - Input class: " << TEST_STRIP_MACRO(mtype) << "\n";                        \
+        std::cerr << "  - Test number: " << STATS_TEST_NUMBER << "\n";                              \
+        std::cerr << "  - Function Call:  " << fn_name << "(" << #__VA_ARGS__ << ");\n";            \
+        std::cerr << "  - Expected values:\n";                                                      \
+        MATOPS::cerr_output(exp_vals);                                                              \
+        std::cerr << "  - Actual values:\n";                                                        \
+        MATOPS::cerr_output(f_vals);                                                                \
+        TEST_FAIL_PRINT_FINISH                                                                      \
+                                                                                                    \
+        throw std::runtime_error("test fail");                                                      \
+    }                                                                                               \
+}
+
 #endif
 
 //